@@ -0,0 +1,165 @@
+#ifndef MLC_CORE_ALLOC_H
+#define MLC_CORE_ALLOC_H
+
+#include <stddef.h>
+
+/**
+ * @brief Allocator interface used for memory owned by library objects.
+ *
+ * Only `alloc` is required. A NULL `realloc` falls back to `alloc`, copy
+ * and `free`, and a NULL `free` never releases memory, which suits bump
+ * arenas. Every hook receives `ctx` as its first argument.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+typedef struct mlc_allocator {
+    /** Returns `size` bytes aligned to `align`, a power of two. NULL on error. */
+    void *(*alloc)(void *ctx, size_t size, size_t align);
+    /** Resizes `ptr`, preserving its first `old_size` bytes. NULL on error. */
+    void *(*realloc)(
+        void *ctx,
+        void *ptr,
+        size_t old_size,
+        size_t size,
+        size_t align
+    );
+    /** Releases `ptr`, which may be NULL. */
+    void (*free)(void *ctx, void *ptr);
+    void *ctx;                  /**< User context passed to every hook*/
+} mlc_allocator_t;
+
+/**
+ * @brief Returns the allocator backed by the C library.
+ *
+ * @return Pointer to the static default allocator.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+const mlc_allocator_t *mlc_allocator_default(void);
+
+/**
+ * @brief Returns the allocator new objects use when none is given.
+ *
+ * @return Pointer to the global allocator.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+const mlc_allocator_t *mlc_allocator_global(void);
+
+/**
+ * @brief Replaces the global allocator.
+ *
+ * The allocator is copied. Objects created before the call keep the
+ * allocator they were created with. This function is not thread safe.
+ *
+ * @param allocator New global allocator, or NULL to restore the default.
+ * Ignored if its `alloc` hook is NULL.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+void mlc_allocator_set_global(const mlc_allocator_t *allocator);
+
+/**
+ * @brief Allocates `size` bytes aligned to `align` from `allocator`.
+ *
+ * @param allocator Allocator to use.
+ * @param size Number of bytes. Zero returns NULL.
+ * @param align Alignment, a power of two.
+ * @return Pointer to the memory. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+void *mlc_alloc(
+    const mlc_allocator_t *allocator,
+    const size_t size,
+    const size_t align
+);
+
+/**
+ * @brief Allocates `n * size` zeroed bytes from `allocator`.
+ *
+ * @param allocator Allocator to use.
+ * @param n Number of elements.
+ * @param size Byte size of one element.
+ * @return Pointer to the memory. NULL on overflow or error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+void *mlc_calloc(
+    const mlc_allocator_t *allocator,
+    const size_t n,
+    const size_t size
+);
+
+/**
+ * @brief Resizes memory from `allocator`.
+ *
+ * On error the old memory is left untouched.
+ *
+ * @param allocator Allocator `ptr` came from.
+ * @param ptr Memory to resize, or NULL.
+ * @param old_size Number of leading bytes of `ptr` to preserve, at most
+ * its allocated size.
+ * @param size New size in bytes. Zero frees `ptr` and returns NULL.
+ * @param align Alignment, a power of two.
+ * @return Pointer to the resized memory. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+void *mlc_realloc(
+    const mlc_allocator_t *allocator,
+    void *ptr,
+    const size_t old_size,
+    const size_t size,
+    const size_t align
+);
+
+/**
+ * @brief Releases memory from `allocator`.
+ *
+ * @param allocator Allocator `ptr` came from.
+ * @param ptr Memory to release, or NULL.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+void mlc_free(const mlc_allocator_t *allocator, void *ptr);
+
+/**
+ * @brief Copies a NUL-terminated string into memory from `allocator`.
+ *
+ * @param allocator Allocator to use.
+ * @param str String to copy.
+ * @return Pointer to the copy. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+char *mlc_strdup(const mlc_allocator_t *allocator, const char *str);
+
+#endif
@@ -0,0 +1,93 @@
+#ifndef MLC_CORE_ARENA_H
+#define MLC_CORE_ARENA_H
+
+#include <stddef.h>
+
+#include "core/alloc.h"
+
+/**
+ * @brief Bump allocator that releases everything it handed out at once.
+ *
+ * Allocations are carved from large blocks and individual frees are
+ * no-ops, which makes short-lived objects nearly free to create. Objects
+ * allocated from an arena need not be freed before `mlc_arena_reset` or
+ * `mlc_arena_free`, and must not be used after. An arena is not thread
+ * safe.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+typedef struct mlc_arena mlc_arena_t;
+
+/**
+ * @brief Creates an empty arena.
+ *
+ * @param block_size Bytes requested from the C library at a time. Zero
+ * uses a default. Larger allocations get a block of their own.
+ * @param max_bytes Cap on the bytes of all blocks combined, after which
+ * allocations fail. Zero means unbounded.
+ * @return Pointer to the arena. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+mlc_arena_t *mlc_arena_create(const size_t block_size, const size_t max_bytes);
+
+/**
+ * @brief Returns an allocator drawing from `arena`.
+ *
+ * @param arena Arena to allocate from. Must outlive every use of the
+ * allocator.
+ * @return Allocator whose context is `arena`.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+mlc_allocator_t mlc_arena_allocator(mlc_arena_t *arena);
+
+/**
+ * @brief Returns the number of bytes of all blocks held by `arena`.
+ *
+ * @param arena Target arena.
+ * @return Number of bytes.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+size_t mlc_arena_bytes(const mlc_arena_t *arena);
+
+/**
+ * @brief Releases every allocation made from `arena` in one call.
+ *
+ * The first block is kept for reuse.
+ *
+ * @param arena Target arena.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+void mlc_arena_reset(mlc_arena_t *arena);
+
+/**
+ * @brief Frees `arena` and every allocation made from it.
+ *
+ * @param arena Target arena, or NULL.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+void mlc_arena_free(mlc_arena_t *arena);
+
+#endif
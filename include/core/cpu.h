@@ -0,0 +1,62 @@
+#ifndef MLC_CORE_CPU_H
+#define MLC_CORE_CPU_H
+
+/**
+ * @brief Instruction set levels that kernels may be specialised for.
+ *
+ * Levels are ordered, each one implying every level below it.
+ */
+typedef enum mlc_isa {
+    MLC_ISA_SCALAR = 0,
+    MLC_ISA_SSE2,
+    MLC_ISA_AVX2,   /* AVX2 + FMA */
+    MLC_ISA_AVX512, /* AVX-512 F/BW/DQ/VL */
+    MLC_ISA_COUNT
+} mlc_isa_t;
+
+/**
+ * @brief Returns the instruction set level kernels should dispatch to.
+ *
+ * The host CPU is probed once via cpuid and the result is cached. The level
+ * is capped by `mlc_cpu_isa_limit`.
+ *
+ * @return Highest usable `mlc_isa_t`.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+mlc_isa_t mlc_cpu_isa(void);
+
+/**
+ * @brief Returns the highest instruction set level the host CPU supports.
+ *
+ * Unlike `mlc_cpu_isa`, this ignores `mlc_cpu_isa_limit`.
+ *
+ * @return Highest supported `mlc_isa_t`.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+mlc_isa_t mlc_cpu_isa_detect(void);
+
+/**
+ * @brief Caps the instruction set level used for dispatch.
+ *
+ * Useful for benchmarking or testing a specific code path. Passing
+ * `MLC_ISA_COUNT` removes the cap. Levels above what the host supports are
+ * never used.
+ *
+ * @param isa Highest level kernels may dispatch to.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+void mlc_cpu_isa_limit(const mlc_isa_t isa);
+
+#endif
@@ -2,6 +2,7 @@
 #define MLC_CORE_ERROR_H
 
 #include <math.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 #ifdef MLC_ABORT_ON_ERROR
@@ -10,6 +11,14 @@
 #define MLC_ABORT() do { } while (0)
 #endif
 
+/* Checks of the unchecked fast paths, compiled out by MLC_NDEBUG */
+#ifdef MLC_NDEBUG
+#define MLC_ASSERT(cond) ((void)0)
+#else
+#include <assert.h>
+#define MLC_ASSERT(cond) assert(cond)
+#endif
+
 static inline void *mlc_fail_null(const int err_code, int *err_out) {
     if (err_out)
         *err_out = err_code;
@@ -24,6 +33,20 @@ static inline double mlc_fail_nan(const int err_code, int *err_out) {
     return NAN;
 }
 
+static inline int mlc_fail_neg(const int err_code, int *err_out) {
+    if (err_out)
+        *err_out = err_code;
+    MLC_ABORT();
+    return -1;
+}
+
+static inline size_t mlc_fail_npos(const int err_code, int *err_out) {
+    if (err_out)
+        *err_out = err_code;
+    MLC_ABORT();
+    return SIZE_MAX;
+}
+
 static inline void *mlc_fail_zero(const int err_code, int *err_out) {
     if (err_out)
         *err_out = err_code;
@@ -0,0 +1,46 @@
+#ifndef MLC_CORE_HASH_H
+#define MLC_CORE_HASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MLC_HASH_SEED 0xcbf29ce484222325ULL
+#define MLC_HASH_PRIME 0x100000001b3ULL
+
+/* splitmix64 finalizer, good avalanche for integer keys */
+static inline uint64_t mlc_hash_u64(uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+/* FNV-1a over `len` bytes, finalized so low bits are usable as a mask */
+static inline uint64_t mlc_hash_bytes(const void *data, const size_t len) {
+    const unsigned char *bytes = data;
+    uint64_t h = MLC_HASH_SEED;
+    for (size_t i = 0; i < len; i++) {
+        h ^= bytes[i];
+        h *= MLC_HASH_PRIME;
+    }
+    return mlc_hash_u64(h);
+}
+
+/* FNV-1a over a NUL-terminated string */
+static inline uint64_t mlc_hash_str(const char *str) {
+    uint64_t h = MLC_HASH_SEED;
+    for (; *str; str++) {
+        h ^= (unsigned char)*str;
+        h *= MLC_HASH_PRIME;
+    }
+    return mlc_hash_u64(h);
+}
+
+/* Combines two hashes, used for multi-column keys */
+static inline uint64_t mlc_hash_combine(const uint64_t a, const uint64_t b) {
+    return mlc_hash_u64(a ^ (b + 0x9e3779b97f4a7c15ULL + (a << 6) + (a >> 2)));
+}
+
+#endif
@@ -0,0 +1,129 @@
+#ifndef MLC_CORE_NUMBER_H
+#define MLC_CORE_NUMBER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Buffer size that fits any number formatted by this module,
+ * including the terminating NUL.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+#define MLC_NUMBER_MAX 32
+
+/**
+ * @brief Parses a decimal floating point number.
+ *
+ * Accepts an optional sign, digits with an optional decimal point, an
+ * optional exponent, and `inf`, `infinity` or `nan` in any case. The
+ * result is correctly rounded, like `strtod`: short inputs take an exact
+ * fast path, others the Eisel-Lemire algorithm, and the rare inputs it
+ * cannot decide fall back to `strtod`. Leading whitespace and hexadecimal
+ * floats are not accepted.
+ *
+ * @param begin First character to parse.
+ * @param end One past the last character that may be read.
+ * @param out Pointer to receive the value.
+ * @return Pointer past the number. NULL if there is none, leaving `out`
+ * untouched.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+const char *mlc_parse_double(const char *begin, const char *end, double *out);
+
+/**
+ * @brief Parses a decimal floating point number as a `float`.
+ *
+ * Follows `mlc_parse_double`, rounding once, directly to `float`.
+ *
+ * @param begin First character to parse.
+ * @param end One past the last character that may be read.
+ * @param out Pointer to receive the value.
+ * @return Pointer past the number. NULL if there is none, leaving `out`
+ * untouched.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+const char *mlc_parse_float(const char *begin, const char *end, float *out);
+
+/**
+ * @brief Parses a base 10 integer.
+ *
+ * Accepts an optional sign followed by digits, eight of which are
+ * converted at a time.
+ *
+ * @param begin First character to parse.
+ * @param end One past the last character that may be read.
+ * @param out Pointer to receive the value.
+ * @return Pointer past the number. NULL if there is none or it overflows
+ * `int64_t`, leaving `out` untouched.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+const char *mlc_parse_int64(const char *begin, const char *end, int64_t *out);
+
+/**
+ * @brief Formats a `double` with the fewest digits that parse back to it.
+ *
+ * Values with a decimal exponent in `[-5, 17)` use fixed notation, others
+ * scientific notation, such as `0.1`, `-42`, `1e+21` or `5e-324`.
+ * Non-finite values format as `nan`, `inf` and `-inf`.
+ *
+ * @param val Value to format.
+ * @param buf Buffer of at least `MLC_NUMBER_MAX` bytes, NUL-terminated on
+ * return.
+ * @return Number of characters written, excluding the NUL.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+size_t mlc_format_double(const double val, char *buf);
+
+/**
+ * @brief Formats a `float` with the fewest digits that parse back to it.
+ *
+ * Follows `mlc_format_double`, so `0.1f` formats as `0.1`.
+ *
+ * @param val Value to format.
+ * @param buf Buffer of at least `MLC_NUMBER_MAX` bytes, NUL-terminated on
+ * return.
+ * @return Number of characters written, excluding the NUL.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+size_t mlc_format_float(const float val, char *buf);
+
+/**
+ * @brief Formats an integer in base 10.
+ *
+ * @param val Value to format.
+ * @param buf Buffer of at least `MLC_NUMBER_MAX` bytes, NUL-terminated on
+ * return.
+ * @return Number of characters written, excluding the NUL.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+size_t mlc_format_int64(const int64_t val, char *buf);
+
+#endif
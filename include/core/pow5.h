@@ -0,0 +1,24 @@
+#ifndef MLC_CORE_POW5_H
+#define MLC_CORE_POW5_H
+
+#include <stdint.h>
+
+#define MLC_POW5_MIN (-342)
+#define MLC_POW5_MAX 342
+#define MLC_POW5_COUNT (MLC_POW5_MAX - MLC_POW5_MIN + 1)
+
+/**
+ * @brief Powers of five normalised to 128 bits, high word first. This
+ * serves as a helper for internal use.
+ *
+ * Entry `q - MLC_POW5_MIN` holds 5^q scaled by a power of two into
+ * `[2^127, 2^128)`. Since 10^q = 5^q * 2^q, it is the mantissa of 10^q too.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+extern const uint64_t mlc_pow5_table[MLC_POW5_COUNT][2];
+
+#endif
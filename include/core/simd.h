@@ -0,0 +1,18 @@
+#ifndef MLC_CORE_SIMD_H
+#define MLC_CORE_SIMD_H
+
+/*
+ * Per-function target attributes let AVX2/AVX-512 kernels live next to their
+ * scalar fallbacks without compiling the whole library for a newer ISA.
+ * Dispatch to them only after checking `mlc_cpu_isa`.
+ */
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define MLC_SIMD_X86 1
+#include <immintrin.h>
+#define MLC_TARGET_SSE2 __attribute__((target("sse2")))
+#define MLC_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define MLC_TARGET_AVX512 \
+    __attribute__((target("avx512f,avx512bw,avx512dq,avx512vl,avx2,fma")))
+#endif
+
+#endif
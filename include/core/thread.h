@@ -0,0 +1,68 @@
+#ifndef MLC_CORE_THREAD_H
+#define MLC_CORE_THREAD_H
+
+#include <stddef.h>
+
+/**
+ * @brief Task run by `mlc_parallel_for`.
+ *
+ * @param ctx Context passed to `mlc_parallel_for`.
+ * @param task Index of the task, below `n_tasks`.
+ */
+typedef void (*mlc_task_fn)(void *ctx, size_t task);
+
+/**
+ * @brief Returns the number of threads parallel kernels use by default.
+ *
+ * Defaults to the number of online CPUs, probed once, unless set with
+ * `mlc_thread_set_count`.
+ *
+ * @return Number of threads, at least one.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+size_t mlc_thread_count(void);
+
+/**
+ * @brief Sets the number of threads parallel kernels use by default.
+ *
+ * @param n_threads Number of threads. Zero restores the number of online
+ * CPUs.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+void mlc_thread_set_count(const size_t n_threads);
+
+/**
+ * @brief Runs `n_tasks` tasks on up to `n_threads` threads.
+ *
+ * The calling thread takes part, so a single thread runs every task
+ * inline. Tasks are handed out in index order as threads become free, and
+ * the call returns once all of them are done. If threads cannot be
+ * started, the remaining tasks still run on the calling thread.
+ *
+ * @param n_tasks Number of tasks.
+ * @param n_threads Maximum number of threads. Zero uses
+ * `mlc_thread_count`.
+ * @param fn Task to run for every index.
+ * @param ctx Context passed to every task.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+void mlc_parallel_for(
+    const size_t n_tasks,
+    size_t n_threads,
+    const mlc_task_fn fn,
+    void *ctx
+);
+
+#endif
@@ -5,5 +5,7 @@
 #include "dtypes/col/core/lifecycle.h"
 #include "dtypes/col/core/accessors.h"
 #include "dtypes/col/core/modifiers.h"
+#include "dtypes/col/core/category.h"
+#include "dtypes/col/core/span.h"
 
 #endif
@@ -165,7 +165,127 @@ static inline const char *col_string_at(
         return mlc_fail_null(COL_ERR_OUT_OF_BOUNDS, err_out);
     if (err_out)
         *err_out = COL_ERR_OK;
-    return ((const char **)col->data)[idx];
+    return col->strbuf.bytes + ((const size_t *)col->data)[idx];
+}
+
+/**
+ * @brief Accesses the code of a `category` at the specified index.
+ *
+ * @param col Target `col_t` to access.
+ * @param idx Target index of `col_t` to access.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Code at `col->data[idx]` widened to `int32_t`. -1 on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+static inline int32_t col_category_code_at(
+    const col_t *col, 
+    const size_t idx,
+    int *err_out
+) {
+    if (col->dtype != COL_DTYPE_CATEGORY)
+        return mlc_fail_neg(COL_ERR_INVALID_DTYPE, err_out);
+    if (idx >= col->n_rows)
+        return mlc_fail_neg(COL_ERR_OUT_OF_BOUNDS, err_out);
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    switch (col->stride) {
+        case sizeof(uint8_t):
+            return ((const uint8_t *)col->data)[idx];
+        case sizeof(uint16_t):
+            return ((const uint16_t *)col->data)[idx];
+        default:
+            return ((const int32_t *)col->data)[idx];
+    }
+}
+
+/**
+ * @brief Accesses the `category` at the specified index as a `char *`.
+ *
+ * @param col Target `col_t` to access.
+ * @param idx Target index of `col_t` to access.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to the category's string in the dictionary. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+static inline const char *col_category_at(
+    const col_t *col, 
+    const size_t idx,
+    int *err_out
+) {
+    const int32_t code = col_category_code_at(col, idx, err_out);
+    if (code < 0)
+        return NULL;
+    return col_string_at(col->dict->values, (size_t)code, err_out);
+}
+
+/**
+ * @brief Checks whether the value at the specified index is null.
+ *
+ * @param col Target `col_t` to access.
+ * @param idx Target index of `col_t` to access.
+ * @param err_out Optional pointer to receive error codes.
+ * @return 1 if null, 0 if valid. -1 on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+static inline int col_is_null(
+    const col_t *col, 
+    const size_t idx,
+    int *err_out
+) {
+    if (idx >= col->n_rows)
+        return mlc_fail_neg(COL_ERR_OUT_OF_BOUNDS, err_out);
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    if (!col->null_count)
+        return 0;
+    return !((col->validity[idx >> 3] >> (idx & 7)) & 1);
+}
+
+/**
+ * @brief Returns the number of null values in the `col_t`.
+ *
+ * Kernels can skip the validity bitmap entirely when this is zero.
+ *
+ * @param col Target `col_t` to access.
+ * @return Number of null values.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+static inline size_t col_null_count(const col_t *col) {
+    return col->null_count;
+}
+
+/**
+ * @brief Returns the read-only validity bitmap.
+ *
+ * Bit `i % 8` of byte `i / 8` is set if row `i` is valid. The bitmap is
+ * NULL when no value has ever been null.
+ *
+ * @param col Target `col_t` to access.
+ * @return Pointer to the packed validity bits. NULL if absent.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+static inline const uint8_t *col_validity_get(const col_t *col) {
+    return col->validity;
 }
 
 /**
@@ -267,23 +387,230 @@ static inline const uint8_t *col_uint8_get(const col_t *col, int *err_out) {
 }
 
 /**
- * @brief Returns a read-only `char **` data.
+ * @brief Returns the read-only byte offsets of a `string` column.
+ *
+ * Row `i` starts at `col_string_bytes_get(col)[offsets[i]]` and is
+ * NUL-terminated.
  *
  * @param col Target `col_t` to access.
  * @param err_out Optional pointer to receive error codes.
- * @return Typecasted `char **` pointer to `col->data`. NULL on error.
+ * @return Typecasted `size_t *` pointer to `col->data`. NULL on error.
  *
  * @author PeppermintSnow
  * @since 0.0.0
  * @version 0.0.0
- * @date 2026-03-27
+ * @date 2026-10-16
+ */
+static inline const size_t *col_string_offsets_get(
+    const col_t *col,
+    int *err_out
+) {
+    if (col->dtype != COL_DTYPE_STRING)
+        return mlc_fail_null(COL_ERR_INVALID_DTYPE, err_out);
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    return (const size_t *)col->data;
+}
+
+/**
+ * @brief Returns the read-only contiguous bytes of a `string` column.
+ *
+ * @param col Target `col_t` to access.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to the packed NUL-terminated strings. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
  */
-static inline const char **col_string_get(const col_t *col, int *err_out) {
+static inline const char *col_string_bytes_get(
+    const col_t *col,
+    int *err_out
+) {
     if (col->dtype != COL_DTYPE_STRING)
         return mlc_fail_null(COL_ERR_INVALID_DTYPE, err_out);
     if (err_out)
         *err_out = COL_ERR_OK;
-    return (const char **)col->data;
+    return col->strbuf.bytes;
+}
+
+/**
+ * @brief Returns the read-only codes of a `category` column.
+ *
+ * The width of each code is given by `col->stride`: 1 for `uint8_t`,
+ * 2 for `uint16_t` and 4 for `int32_t`.
+ *
+ * @param col Target `col_t` to access.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to `col->data`. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+static inline const void *col_category_codes_get(
+    const col_t *col,
+    int *err_out
+) {
+    if (col->dtype != COL_DTYPE_CATEGORY)
+        return mlc_fail_null(COL_ERR_INVALID_DTYPE, err_out);
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    return col->data;
+}
+
+/**
+ * @brief Returns the dictionary of a `category` column.
+ *
+ * Row `i` of the returned `string` column is the category with code `i`.
+ *
+ * @param col Target `col_t` to access.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Read-only `string` dtype `col_t`. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+static inline const col_t *col_category_dict_get(
+    const col_t *col,
+    int *err_out
+) {
+    if (col->dtype != COL_DTYPE_CATEGORY)
+        return mlc_fail_null(COL_ERR_INVALID_DTYPE, err_out);
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    return col->dict->values;
+}
+
+/* unchecked accessors
+ *
+ * These skip the error reporting of the accessors above for use in hot
+ * loops. Their dtype and bounds checks are assertions, compiled out by
+ * defining `MLC_NDEBUG` (or `NDEBUG`); out of range access is then
+ * undefined behavior. */
+
+/**
+ * @brief Reads a C `double` at the specified index without error reporting.
+ *
+ * @param col Target `col_t` of `double` dtype.
+ * @param idx Target index, below `col->n_rows`.
+ * @return The `double` at `col->data[idx]`.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+static inline double col_double_at_unchecked(
+    const col_t *col,
+    const size_t idx
+) {
+    MLC_ASSERT(col->dtype == COL_DTYPE_DOUBLE && idx < col->n_rows);
+    return ((const double *)col->data)[idx];
+}
+
+/**
+ * @brief Reads a C `float` at the specified index without error reporting.
+ *
+ * @param col Target `col_t` of `float` dtype.
+ * @param idx Target index, below `col->n_rows`.
+ * @return The `float` at `col->data[idx]`.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+static inline float col_float_at_unchecked(
+    const col_t *col,
+    const size_t idx
+) {
+    MLC_ASSERT(col->dtype == COL_DTYPE_FLOAT && idx < col->n_rows);
+    return ((const float *)col->data)[idx];
+}
+
+/**
+ * @brief Reads an `int64_t` at the specified index without error reporting.
+ *
+ * @param col Target `col_t` of `int64` dtype.
+ * @param idx Target index, below `col->n_rows`.
+ * @return The `int64_t` at `col->data[idx]`.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+static inline int64_t col_int64_at_unchecked(
+    const col_t *col,
+    const size_t idx
+) {
+    MLC_ASSERT(col->dtype == COL_DTYPE_INT64 && idx < col->n_rows);
+    return ((const int64_t *)col->data)[idx];
+}
+
+/**
+ * @brief Reads an `int32_t` at the specified index without error reporting.
+ *
+ * @param col Target `col_t` of `int32` dtype.
+ * @param idx Target index, below `col->n_rows`.
+ * @return The `int32_t` at `col->data[idx]`.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+static inline int32_t col_int32_at_unchecked(
+    const col_t *col,
+    const size_t idx
+) {
+    MLC_ASSERT(col->dtype == COL_DTYPE_INT32 && idx < col->n_rows);
+    return ((const int32_t *)col->data)[idx];
+}
+
+/**
+ * @brief Reads an `uint8_t` at the specified index without error reporting.
+ *
+ * @param col Target `col_t` of `uint8` dtype.
+ * @param idx Target index, below `col->n_rows`.
+ * @return The `uint8_t` at `col->data[idx]`.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+static inline uint8_t col_uint8_at_unchecked(
+    const col_t *col,
+    const size_t idx
+) {
+    MLC_ASSERT(col->dtype == COL_DTYPE_UINT8 && idx < col->n_rows);
+    return ((const uint8_t *)col->data)[idx];
+}
+
+/**
+ * @brief Reads a `char *` at the specified index without error reporting.
+ *
+ * @param col Target `col_t` of `string` dtype.
+ * @param idx Target index, below `col->n_rows`.
+ * @return Pointer to the string at `col->data[idx]`.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+static inline const char *col_string_at_unchecked(
+    const col_t *col,
+    const size_t idx
+) {
+    MLC_ASSERT(col->dtype == COL_DTYPE_STRING && idx < col->n_rows);
+    return col->strbuf.bytes + ((const size_t *)col->data)[idx];
 }
 
 #endif
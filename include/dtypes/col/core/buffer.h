@@ -0,0 +1,163 @@
+#ifndef COL_CORE_BUFFER_H
+#define COL_CORE_BUFFER_H
+
+#include <stddef.h>
+
+#include "core/alloc.h"
+#include "dtypes/col/core/type.h"
+
+/**
+ * @brief Number of bytes reserved for a data buffer of `capacity` rows.
+ *
+ * The size is rounded up to a multiple of `COL_DATA_ALIGN` so that a full
+ * vector load at the last row never leaves the allocation. This serves as
+ * a helper for internal use.
+ *
+ * @param capacity Number of rows.
+ * @param stride Byte size of one row.
+ * @return Padded byte size. Zero if `capacity` is zero or the size
+ * overflows.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+size_t col_data_bytes(const size_t capacity, const size_t stride);
+
+/**
+ * @brief Allocates a `COL_DATA_ALIGN` aligned data buffer.
+ *
+ * The tail padding past `capacity * stride` is zeroed; the rows themselves
+ * are left uninitialized. This serves as a helper for internal use.
+ *
+ * @param allocator Allocator to draw from.
+ * @param capacity Number of rows.
+ * @param stride Byte size of one row.
+ * @return Pointer to the buffer. NULL if `capacity` is zero or on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+void *col_data_alloc(
+    const mlc_allocator_t *allocator,
+    const size_t capacity,
+    const size_t stride
+);
+
+/**
+ * @brief Resizes a data buffer to `capacity` rows, preserving its first
+ * `n_bytes`.
+ *
+ * Plain `realloc` does not preserve alignment, so growth and shrinking go
+ * through this instead. On error the old buffer is left untouched. This
+ * serves as a helper for internal use.
+ *
+ * @param allocator Allocator `data` came from.
+ * @param data Buffer from `col_data_alloc`, or NULL.
+ * @param n_bytes Number of bytes to keep, at most the new row bytes.
+ * @param capacity Number of rows of the new buffer.
+ * @param stride Byte size of one row.
+ * @return Pointer to the new buffer. NULL if `capacity` is zero or on
+ * error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+void *col_data_realloc(
+    const mlc_allocator_t *allocator,
+    void *data,
+    const size_t n_bytes,
+    const size_t capacity,
+    const size_t stride
+);
+
+/**
+ * @brief Frees a buffer from `col_data_alloc` or `col_data_realloc`.
+ *
+ * This serves as a helper for internal use.
+ *
+ * @param allocator Allocator `data` came from.
+ * @param data Buffer to free, or NULL.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+void col_data_free(const mlc_allocator_t *allocator, void *data);
+
+/**
+ * @brief Adds a reference to the storage of `col` for a new clone.
+ *
+ * Creates the shared count on the first clone. Safe to call from several
+ * threads on the same `col`. This serves as a helper for internal use.
+ *
+ * @param col Source `col_t` whose storage the clone will share.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_share_acquire(col_t *col);
+
+/**
+ * @brief Drops the reference `col` holds on shared storage.
+ *
+ * Clears `col->share`. When the last reference is dropped, the share's
+ * `release` hook runs. This serves as a helper for internal use.
+ *
+ * @param col Target `col_t`.
+ * @return Non-zero if `col` held the last reference, or none, and must
+ * free owned storage itself.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_share_release(col_t *col);
+
+/**
+ * @brief Checks whether `col` is the only column using its storage.
+ *
+ * Drops the shared count when every other clone is gone. This serves as a
+ * helper for internal use.
+ *
+ * @param col Target `col_t`.
+ * @return Non-zero if `col` owns its storage exclusively.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_data_exclusive(col_t *col);
+
+/**
+ * @brief Gives a borrowed or shared column storage of its own.
+ *
+ * Copies the rows, the live strings of a `string` column and the
+ * dictionary of a `category` column, then clears `COL_FLAG_BORROWED` and
+ * the shared reference. The last column holding shared storage takes it
+ * over without copying. Does nothing for columns that own their storage
+ * exclusively. Every mutating call runs this before writing. This serves
+ * as a helper for internal use.
+ *
+ * @param col Target `col_t`.
+ * @return Zero on success. Non-zero on error, leaving `col` as is.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_data_detach(col_t *col);
+
+#endif
@@ -0,0 +1,153 @@
+#ifndef COL_CORE_CATEGORY_H
+#define COL_CORE_CATEGORY_H
+
+#include <stdint.h>
+
+#include "dtypes/col/core/type.h"
+
+/**
+ * @brief Dictionary-encodes a `string` column into a `category` column.
+ *
+ * The codes use the narrowest width that fits the number of distinct
+ * values: `uint8_t` up to 256 categories, then `uint16_t`, then `int32_t`.
+ * Categories are numbered in order of first appearance.
+ *
+ * @param col Source `string` dtype `col_t`.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to the newly created `col_t`. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+col_t *col_category_from_string(const col_t *col, int *err_out);
+
+/**
+ * @brief Decodes a `category` column back into a `string` column.
+ *
+ * @param col Source `category` dtype `col_t`.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to the newly created `col_t`. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+col_t *col_category_to_string(const col_t *col, int *err_out);
+
+/**
+ * @brief Looks up the code of a category without inserting it.
+ *
+ * Useful to compare a `category` column against a value using codes only.
+ *
+ * @param col Target `category` dtype `col_t`.
+ * @param val Category to look up.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Code of the category. -1 on error or if the category is absent.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int32_t col_category_code_of(const col_t *col, const char *val, int *err_out);
+
+/**
+ * @brief Returns the code of `val`, adding it to the dictionary if absent.
+ *
+ * Adding a category may widen the column's codes, which replaces `data`
+ * and `stride`. This serves as a helper for internal use.
+ *
+ * @param col Target `category` dtype `col_t`.
+ * @param val Category to encode.
+ * @param code_out Pointer to receive the code.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_category_encode(col_t *col, const char *val, int32_t *code_out);
+
+/**
+ * @brief Gives an empty `category` column a copy of another's dictionary.
+ * This serves as a helper for internal use.
+ *
+ * Codes are widened to `src`'s width, so codes of `src` can be copied into
+ * `col` as they are.
+ *
+ * @param col Target `category` dtype `col_t` with no rows.
+ * @param src `category` dtype `col_t` whose dictionary is copied.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_category_adopt(col_t *col, const col_t *src);
+
+/**
+ * @brief Creates an empty dictionary. This serves as a helper for internal use.
+ *
+ * @param allocator Allocator for the dictionary and its buffers.
+ * @return Pointer to the newly created `col_dict_t`. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+col_dict_t *col_dict_create(const mlc_allocator_t *allocator);
+
+/**
+ * @brief Deep-copies a dictionary. This serves as a helper for internal use.
+ *
+ * @param dict Target `col_dict_t` to clone.
+ * @param allocator Allocator for the copy.
+ * @return Pointer to the cloned `col_dict_t`. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+col_dict_t *col_dict_clone(
+    const col_dict_t *dict,
+    const mlc_allocator_t *allocator
+);
+
+/**
+ * @brief Creates a dictionary indexing an existing `string` column of
+ * distinct values. This serves as a helper for internal use.
+ *
+ * On success the dictionary takes ownership of `values`.
+ *
+ * @param values `string` column of distinct categories.
+ * @return Pointer to the newly created `col_dict_t`. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+col_dict_t *col_dict_wrap(col_t *values);
+
+/**
+ * @brief Frees a dictionary. This serves as a helper for internal use.
+ *
+ * Memory goes back to the allocator the dictionary was created with.
+ *
+ * @param dict Target `col_dict_t` to free.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+void col_dict_free(col_dict_t *dict);
+
+#endif
@@ -14,7 +14,8 @@ static size_t col_dtype_strides[] = {
     [COL_DTYPE_INT64] = sizeof(int64_t),
     [COL_DTYPE_INT32] = sizeof(int32_t),
     [COL_DTYPE_UINT8] = sizeof(uint8_t),
-    [COL_DTYPE_STRING] = sizeof(char *)
+    [COL_DTYPE_STRING] = sizeof(size_t),
+    [COL_DTYPE_CATEGORY] = sizeof(uint8_t)
 };
 
 static size_t col_dtype_strides_len = (
@@ -30,4 +31,105 @@ static inline int col_dtype_validate(const col_dtype_t dtype) {
     return dtype >= col_dtype_strides_len;
 }
 
+/* Numeric dtypes are the contiguous run `double` through `uint8` */
+static inline int col_dtype_is_numeric(const col_dtype_t dtype) {
+    return dtype <= COL_DTYPE_UINT8;
+}
+
+/* A scalar operand converted to a numeric column's element type */
+typedef union col_scalar {
+    double f64;
+    float f32;
+    int64_t i64;
+    int32_t i32;
+    uint8_t u8;
+} col_scalar_t;
+
+/* Reads a `category` code stored with the given width */
+static inline int32_t col_code_read(
+    const void *data,
+    const size_t stride,
+    const size_t idx
+) {
+    switch (stride) {
+        case sizeof(uint8_t):
+            return ((const uint8_t *)data)[idx];
+        case sizeof(uint16_t):
+            return ((const uint16_t *)data)[idx];
+        default:
+            return ((const int32_t *)data)[idx];
+    }
+}
+
+/* Writes a `category` code with the given width */
+static inline void col_code_write(
+    void *data,
+    const size_t stride,
+    const size_t idx,
+    const int32_t code
+) {
+    switch (stride) {
+        case sizeof(uint8_t):
+            ((uint8_t *)data)[idx] = (uint8_t)code;
+            break;
+        case sizeof(uint16_t):
+            ((uint16_t *)data)[idx] = (uint16_t)code;
+            break;
+        default:
+            ((int32_t *)data)[idx] = code;
+            break;
+    }
+}
+
+/* Smallest code width able to index `n_categories` categories */
+static inline size_t col_code_stride(const size_t n_categories) {
+    if (n_categories <= (size_t)UINT8_MAX + 1)
+        return sizeof(uint8_t);
+    if (n_categories <= (size_t)UINT16_MAX + 1)
+        return sizeof(uint16_t);
+    return sizeof(int32_t);
+}
+
+/* Number of bytes needed to hold one validity bit per row */
+static inline size_t col_validity_bytes(const size_t n_rows) {
+    return n_rows / 8 + (n_rows % 8 != 0);
+}
+
+static inline int col_bit_get(const uint8_t *bits, const size_t idx) {
+    return (bits[idx >> 3] >> (idx & 7)) & 1;
+}
+
+static inline void col_bit_set(uint8_t *bits, const size_t idx, const int val) {
+    if (val)
+        bits[idx >> 3] |= (uint8_t)(1u << (idx & 7));
+    else
+        bits[idx >> 3] &= (uint8_t)~(1u << (idx & 7));
+}
+
+/* Whether the rows of `a` and `b` share memory, as a slice and its source */
+static inline int col_rows_overlap(const col_t *a, const col_t *b) {
+    const char *a_data = a->data, *b_data = b->data;
+    if (a->strbuf.bytes && a->strbuf.bytes == b->strbuf.bytes)
+        return 1;
+    return a_data && b_data
+        && a_data < b_data + b->n_rows * b->stride
+        && b_data < a_data + a->n_rows * a->stride;
+}
+
+#define COL_MIN_CAPACITY 8
+
+/* Geometric (x2) growth so that repeated appends are amortized O(1) */
+static inline size_t col_capacity_grow(
+    const size_t capacity,
+    const size_t required
+) {
+    size_t new_capacity = capacity ? capacity : COL_MIN_CAPACITY;
+    while (new_capacity < required) {
+        if (new_capacity > SIZE_MAX / 2)
+            return required;
+        new_capacity *= 2;
+    }
+    return new_capacity;
+}
+
 #endif
@@ -1,6 +1,7 @@
 #ifndef COL_CORE_LIFECYCLE_H
 #define COL_CORE_LIFECYCLE_H
 
+#include "core/alloc.h"
 #include "dtypes/col/core/type.h"
 
 /**
@@ -24,6 +25,56 @@ col_t *col_create(
     int *err_out
 );
 
+/**
+ * @brief Creates an empty `col_t` with preallocated storage.
+ *
+ * The column starts with zero rows but can grow up to `capacity` rows
+ * without reallocating.
+ *
+ * @param name Name of the column.
+ * @param capacity Number of rows to preallocate.
+ * @param dtype Datatype of the column.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to the newly created `col_t`. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+col_t *col_create_with_capacity(
+    const char *name,
+    const size_t capacity,
+    const col_dtype_t dtype,
+    int *err_out
+);
+
+/**
+ * @brief Creates an empty `col_t` whose memory comes from `allocator`.
+ *
+ * `col_create` and `col_create_with_capacity` use the global allocator.
+ *
+ * @param name Name of the column.
+ * @param capacity Number of rows to preallocate.
+ * @param dtype Datatype of the column.
+ * @param allocator Allocator for the column and its buffers, copied into
+ * the column. NULL uses the global allocator.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to the newly created `col_t`. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+col_t *col_create_with_allocator(
+    const char *name,
+    const size_t capacity,
+    const col_dtype_t dtype,
+    const mlc_allocator_t *allocator,
+    int *err_out
+);
+
 /**
  * @brief Creates a `col_t` initialized from an array.
  *
@@ -47,9 +98,98 @@ col_t *col_create_array(
     int *err_out
 );
 
+/**
+ * @brief Creates a `col_t` initialized from an array, whose memory comes
+ * from `allocator`.
+ *
+ * @param name Name of the column.
+ * @param data Array of column elements.
+ * @param n_rows Number of rows in the data parameter.
+ * @param dtype Datatype of the column.
+ * @param allocator Allocator for the column and its buffers, copied into
+ * the column. NULL uses the global allocator.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to the newly created `col_t`. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+col_t *col_create_array_with_allocator(
+    const char *name,
+    const void *data, 
+    const size_t n_rows, 
+    const col_dtype_t dtype,
+    const mlc_allocator_t *allocator,
+    int *err_out
+);
+
+/**
+ * @brief Creates a numeric `col_t` that borrows `data` without copying it.
+ *
+ * The column reads `data` in place and never writes to or frees it. The
+ * first mutating call copies the rows into storage the column owns. `data`
+ * must outlive every read of the column and carries no alignment
+ * guarantee.
+ *
+ * @param name Name of the column.
+ * @param data Array of `n_rows` elements of `dtype`.
+ * @param n_rows Number of rows in the data parameter.
+ * @param dtype Numeric datatype of the column.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to the newly created `col_t`. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+col_t *col_wrap(
+    const char *name,
+    const void *data,
+    const size_t n_rows,
+    const col_dtype_t dtype,
+    int *err_out
+);
+
+/**
+ * @brief Creates a view of rows `[start, start + len)` of a `col_t`.
+ *
+ * The view shares the rows, strings and dictionary of `col` without
+ * copying them; only the validity bits of the range are copied. It behaves
+ * like a column borrowed with `col_wrap`: mutating it copies its rows
+ * first, and `col` is never written through it. `col` must outlive the
+ * view and must not be mutated while the view is read.
+ *
+ * @param col Target `col_t` to view.
+ * @param start Index of the first row.
+ * @param len Number of rows.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to the newly created view. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+col_t *col_slice(
+    const col_t *col,
+    const size_t start,
+    const size_t len,
+    int *err_out
+);
+
 /**
  * @brief Clones the `col_t` instance.
  *
+ * The clone shares the rows, strings and dictionary of `col` and copies
+ * only its name and validity bits, so cloning is O(1) in the data size.
+ * Whichever of the two is mutated first copies the shared storage then.
+ * The clone uses the same allocator as `col`. Cloning a borrowed column
+ * copies its rows into storage the clone owns. Empty columns clone to
+ * empty columns of the same dtype.
+ *
  * @param col Target `col_t` to clone.
  * @param err_out Optional pointer to receive error codes.
  * @return Pointer to the cloned `col_t`. NULL on error.
@@ -61,9 +201,64 @@ col_t *col_create_array(
  */
 col_t *col_clone(const col_t *col, int *err_out);
 
+/**
+ * @brief Clones the `col_t` instance into memory from `allocator`.
+ *
+ * @param col Target `col_t` to clone.
+ * @param allocator Allocator for the clone. NULL uses the allocator of
+ * `col`. Storage is shared as in `col_clone` only when both allocators are
+ * the same; otherwise it is copied.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to the cloned `col_t`. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+col_t *col_clone_with_allocator(
+    const col_t *col,
+    const mlc_allocator_t *allocator,
+    int *err_out
+);
+
+/**
+ * @brief Ensures the `col_t` can hold at least `capacity` rows.
+ *
+ * Does nothing if the current capacity is already large enough.
+ *
+ * @param col Target `col_t` to modify.
+ * @param capacity Minimum number of rows to allocate.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_reserve(col_t *col, const size_t capacity);
+
+/**
+ * @brief Releases unused capacity so that `capacity == n_rows`.
+ *
+ * @param col Target `col_t` to modify.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_shrink_to_fit(col_t *col);
+
 /**
  * @brief Frees the `col_t` instance and its properties from memory.
  *
+ * Memory goes back to the column's allocator. Borrowed storage is left to
+ * its owner. Columns from an allocator
+ * without a `free` hook, such as an arena, may also be dropped without
+ * calling this.
+ *
  * @param col Target `col_t` to free.
  * @return Zero on success. Non-zero on error.
  *
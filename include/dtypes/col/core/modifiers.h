@@ -22,6 +22,15 @@
  */
 int col_set(col_t *col, const void *val, const size_t idx);
 
+/* Whether a fixed-width row can be stored in place, skipping `col_set`: the
+ * column owns its storage and has no null row to clear */
+static inline int col_set_in_place(const col_t *col, const size_t idx) {
+    return idx < col->n_rows
+        && !col->null_count
+        && !col->share
+        && !(col->flags & COL_FLAG_BORROWED);
+}
+
 /**
  * @brief Modifies the value at the specified index. Used for `double` dtypes.
  *
@@ -38,6 +47,10 @@ int col_set(col_t *col, const void *val, const size_t idx);
 static inline int col_double_set(col_t *col, const double val, const size_t idx) {
     if (col->dtype != COL_DTYPE_DOUBLE)
         return COL_ERR_INVALID_DTYPE;
+    if (col_set_in_place(col, idx)) {
+        ((double *)col->data)[idx] = val;
+        return COL_ERR_OK;
+    }
     return col_set(col, &val, idx);
 }
 
@@ -57,6 +70,10 @@ static inline int col_double_set(col_t *col, const double val, const size_t idx)
 static inline int col_float_set(col_t *col, const float val, const size_t idx) {
     if (col->dtype != COL_DTYPE_FLOAT)
         return COL_ERR_INVALID_DTYPE;
+    if (col_set_in_place(col, idx)) {
+        ((float *)col->data)[idx] = val;
+        return COL_ERR_OK;
+    }
     return col_set(col, &val, idx);
 }
 
@@ -76,6 +93,10 @@ static inline int col_float_set(col_t *col, const float val, const size_t idx) {
 static inline int col_int64_set(col_t *col, const int64_t val, const size_t idx) {
     if (col->dtype != COL_DTYPE_INT64)
         return COL_ERR_INVALID_DTYPE;
+    if (col_set_in_place(col, idx)) {
+        ((int64_t *)col->data)[idx] = val;
+        return COL_ERR_OK;
+    }
     return col_set(col, &val, idx);
 }
 
@@ -95,6 +116,10 @@ static inline int col_int64_set(col_t *col, const int64_t val, const size_t idx)
 static inline int col_int32_set(col_t *col, const int32_t val, const size_t idx) {
     if (col->dtype != COL_DTYPE_INT32)
         return COL_ERR_INVALID_DTYPE;
+    if (col_set_in_place(col, idx)) {
+        ((int32_t *)col->data)[idx] = val;
+        return COL_ERR_OK;
+    }
     return col_set(col, &val, idx);
 }
 
@@ -114,6 +139,10 @@ static inline int col_int32_set(col_t *col, const int32_t val, const size_t idx)
 static inline int col_uint8_set(col_t *col, const uint8_t val, const size_t idx) {
     if (col->dtype != COL_DTYPE_UINT8)
         return COL_ERR_INVALID_DTYPE;
+    if (col_set_in_place(col, idx)) {
+        ((uint8_t *)col->data)[idx] = val;
+        return COL_ERR_OK;
+    }
     return col_set(col, &val, idx);
 }
 
@@ -136,6 +165,27 @@ static inline int col_string_set(col_t *col, const char *val, const size_t idx)
     return col_set(col, val, idx);
 }
 
+/**
+ * @brief Modifies the value at the specified index. Used for `category` dtypes.
+ *
+ * The category is added to the dictionary if absent.
+ *
+ * @param col Target `col_t` to modify.
+ * @param val Value to set it to.
+ * @param idx Target index to modify.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+static inline int col_category_set(col_t *col, const char *val, const size_t idx) {
+    if (col->dtype != COL_DTYPE_CATEGORY)
+        return COL_ERR_INVALID_DTYPE;
+    return col_set(col, val, idx);
+}
+
 /**
  * @brief Appends a value to the `col_t`'s data.
  *
@@ -261,6 +311,116 @@ static inline int col_string_append(col_t *col, const char *val) {
     return col_append(col, val);
 }
 
+/**
+ * @brief Appends a value to the `col_t`'s data. Used for `category` dtypes.
+ *
+ * The category is added to the dictionary if absent.
+ *
+ * @param col Target `col_t` to modify.
+ * @param val Value to append.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+static inline int col_category_append(col_t *col, const char *val) {
+    if (col->dtype != COL_DTYPE_CATEGORY)
+        return COL_ERR_INVALID_DTYPE;
+    return col_append(col, val);
+}
+
+/**
+ * @brief Marks the value at the specified index as null.
+ *
+ * The validity bitmap is allocated on the first call. The underlying value
+ * is left in place and becomes unspecified. Setting a value with `col_set`
+ * or the type-safe setters marks the row valid again.
+ *
+ * @param col Target `col_t` to modify.
+ * @param idx Target index to modify.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_set_null(col_t *col, const size_t idx);
+
+/**
+ * @brief Appends a null value to the `col_t`'s data.
+ *
+ * The underlying value is zeroed, or an empty string for `string` dtypes.
+ *
+ * @param col Target `col_t` to modify.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_append_null(col_t *col);
+
+/**
+ * @brief Inserts a block of values before the specified index.
+ *
+ * The column grows at most once and the block is copied in a single pass.
+ * Inserting at `col->n_rows` appends the block. For `string` and
+ * `category` dtypes, `data` is an array of `char *`. String bytes are
+ * copied into the column's string storage and must not point into the
+ * column itself. Storage is reserved before the column is modified, so the
+ * column is left untouched on error.
+ *
+ * @param col Target `col_t` to modify.
+ * @param idx Index where the first inserted value will be placed.
+ * @param data Array of `n` values matching the `col_t`'s dtype.
+ * @param n Number of values in the data parameter.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_insert_range(
+    col_t *col,
+    const size_t idx,
+    const void *data,
+    const size_t n
+);
+
+/**
+ * @brief Appends a block of values to the `col_t`'s data.
+ *
+ * @param col Target `col_t` to modify.
+ * @param data Array of `n` values matching the `col_t`'s dtype.
+ * @param n Number of values in the data parameter.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_extend(col_t *col, const void *data, const size_t n);
+
+/**
+ * @brief Appends every row of `src` to `dst`.
+ *
+ * @param dst Target `col_t` to modify.
+ * @param src `col_t` to copy rows from. Must share the dtype of `dst`.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_concat(col_t *dst, const col_t *src);
+
 /**
  * @brief Removes the specified index from the `col_t`'s data.
  *
@@ -275,6 +435,53 @@ static inline int col_string_append(col_t *col, const char *val) {
  */
 int col_remove(col_t *col, const size_t idx);
 
+/**
+ * @brief Removes `n` consecutive rows starting at the specified index.
+ *
+ * @param col Target `col_t` to modify.
+ * @param idx Index of the first row to remove.
+ * @param n Number of rows to remove.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_remove_range(col_t *col, const size_t idx, const size_t n);
+
+/**
+ * @brief Removes every row listed in `idx` in a single pass.
+ *
+ * The indices must be strictly increasing. They are validated before the
+ * column is modified, so the column is left untouched on error.
+ *
+ * @param col Target `col_t` to modify.
+ * @param idx Strictly increasing array of indices to remove.
+ * @param k Number of indices in the idx parameter.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_remove_indices(col_t *col, const size_t *idx, const size_t k);
+
+/**
+ * @brief Keeps only the rows whose mask entry is non-zero.
+ *
+ * @param col Target `col_t` to modify.
+ * @param mask Array of `col->n_rows` flags. Zero drops the row.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_retain_mask(col_t *col, const uint8_t *mask);
+
 /**
  * @brief Renames a `col_t`'s `name` property.
  *
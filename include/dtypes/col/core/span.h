@@ -0,0 +1,457 @@
+#ifndef COL_CORE_SPAN_H
+#define COL_CORE_SPAN_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "core/error.h"
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/buffer.h"
+
+/*
+ * Spans check the dtype of a column once and hand out its rows as a plain
+ * typed array, so loops over them carry no per-row check and vectorize
+ * like loops over a C array.
+ *
+ * A span is valid until the column is next mutated or freed: appending or
+ * reserving may move its rows. Values written through a mutable span leave
+ * the validity bits as they are.
+ */
+
+/* structs */
+
+/**
+ * @brief Read-only rows of a `double` column.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+typedef struct col_double_cspan {
+    const double *ptr;          /**< First row, NULL if empty*/
+    size_t len;                 /**< Number of rows*/
+} col_double_cspan_t;
+
+/**
+ * @brief Mutable rows of a `double` column.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+typedef struct col_double_span {
+    double *ptr;                /**< First row, NULL if empty*/
+    size_t len;                 /**< Number of rows*/
+} col_double_span_t;
+
+/**
+ * @brief Read-only rows of a `float` column.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+typedef struct col_float_cspan {
+    const float *ptr;           /**< First row, NULL if empty*/
+    size_t len;                 /**< Number of rows*/
+} col_float_cspan_t;
+
+/**
+ * @brief Mutable rows of a `float` column.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+typedef struct col_float_span {
+    float *ptr;                 /**< First row, NULL if empty*/
+    size_t len;                 /**< Number of rows*/
+} col_float_span_t;
+
+/**
+ * @brief Read-only rows of a `int64` column.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+typedef struct col_int64_cspan {
+    const int64_t *ptr;         /**< First row, NULL if empty*/
+    size_t len;                 /**< Number of rows*/
+} col_int64_cspan_t;
+
+/**
+ * @brief Mutable rows of a `int64` column.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+typedef struct col_int64_span {
+    int64_t *ptr;               /**< First row, NULL if empty*/
+    size_t len;                 /**< Number of rows*/
+} col_int64_span_t;
+
+/**
+ * @brief Read-only rows of a `int32` column.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+typedef struct col_int32_cspan {
+    const int32_t *ptr;         /**< First row, NULL if empty*/
+    size_t len;                 /**< Number of rows*/
+} col_int32_cspan_t;
+
+/**
+ * @brief Mutable rows of a `int32` column.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+typedef struct col_int32_span {
+    int32_t *ptr;               /**< First row, NULL if empty*/
+    size_t len;                 /**< Number of rows*/
+} col_int32_span_t;
+
+/**
+ * @brief Read-only rows of a `uint8` column.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+typedef struct col_uint8_cspan {
+    const uint8_t *ptr;         /**< First row, NULL if empty*/
+    size_t len;                 /**< Number of rows*/
+} col_uint8_cspan_t;
+
+/**
+ * @brief Mutable rows of a `uint8` column.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+typedef struct col_uint8_span {
+    uint8_t *ptr;               /**< First row, NULL if empty*/
+    size_t len;                 /**< Number of rows*/
+} col_uint8_span_t;
+
+/* read-only spans */
+
+/**
+ * @brief Returns the rows of a `double` column as a read-only span.
+ *
+ * @param col Target `col_t` to access.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Span over `col->data`. Empty on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+static inline col_double_cspan_t col_double_cspan(
+    const col_t *col,
+    int *err_out
+) {
+    col_double_cspan_t span = {NULL, 0};
+    if (col->dtype != COL_DTYPE_DOUBLE) {
+        mlc_fail_null(COL_ERR_INVALID_DTYPE, err_out);
+        return span;
+    }
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    span.ptr = (const double *)col->data;
+    span.len = col->n_rows;
+    return span;
+}
+
+/**
+ * @brief Returns the rows of a `float` column as a read-only span.
+ *
+ * @param col Target `col_t` to access.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Span over `col->data`. Empty on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+static inline col_float_cspan_t col_float_cspan(
+    const col_t *col,
+    int *err_out
+) {
+    col_float_cspan_t span = {NULL, 0};
+    if (col->dtype != COL_DTYPE_FLOAT) {
+        mlc_fail_null(COL_ERR_INVALID_DTYPE, err_out);
+        return span;
+    }
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    span.ptr = (const float *)col->data;
+    span.len = col->n_rows;
+    return span;
+}
+
+/**
+ * @brief Returns the rows of a `int64` column as a read-only span.
+ *
+ * @param col Target `col_t` to access.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Span over `col->data`. Empty on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+static inline col_int64_cspan_t col_int64_cspan(
+    const col_t *col,
+    int *err_out
+) {
+    col_int64_cspan_t span = {NULL, 0};
+    if (col->dtype != COL_DTYPE_INT64) {
+        mlc_fail_null(COL_ERR_INVALID_DTYPE, err_out);
+        return span;
+    }
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    span.ptr = (const int64_t *)col->data;
+    span.len = col->n_rows;
+    return span;
+}
+
+/**
+ * @brief Returns the rows of a `int32` column as a read-only span.
+ *
+ * @param col Target `col_t` to access.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Span over `col->data`. Empty on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+static inline col_int32_cspan_t col_int32_cspan(
+    const col_t *col,
+    int *err_out
+) {
+    col_int32_cspan_t span = {NULL, 0};
+    if (col->dtype != COL_DTYPE_INT32) {
+        mlc_fail_null(COL_ERR_INVALID_DTYPE, err_out);
+        return span;
+    }
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    span.ptr = (const int32_t *)col->data;
+    span.len = col->n_rows;
+    return span;
+}
+
+/**
+ * @brief Returns the rows of a `uint8` column as a read-only span.
+ *
+ * @param col Target `col_t` to access.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Span over `col->data`. Empty on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+static inline col_uint8_cspan_t col_uint8_cspan(
+    const col_t *col,
+    int *err_out
+) {
+    col_uint8_cspan_t span = {NULL, 0};
+    if (col->dtype != COL_DTYPE_UINT8) {
+        mlc_fail_null(COL_ERR_INVALID_DTYPE, err_out);
+        return span;
+    }
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    span.ptr = (const uint8_t *)col->data;
+    span.len = col->n_rows;
+    return span;
+}
+
+/* mutable spans */
+
+/**
+ * @brief Returns the rows of a `double` column as a mutable span.
+ *
+ * A borrowed or shared column first copies its rows into storage of its
+ * own, as any mutating call does.
+ *
+ * @param col Target `col_t` to access.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Span over `col->data`. Empty on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+static inline col_double_span_t col_double_span(col_t *col, int *err_out) {
+    col_double_span_t span = {NULL, 0};
+    if (col->dtype != COL_DTYPE_DOUBLE) {
+        mlc_fail_null(COL_ERR_INVALID_DTYPE, err_out);
+        return span;
+    }
+    if (col_data_detach(col)) {
+        mlc_fail_null(COL_ERR_OOM, err_out);
+        return span;
+    }
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    span.ptr = (double *)col->data;
+    span.len = col->n_rows;
+    return span;
+}
+
+/**
+ * @brief Returns the rows of a `float` column as a mutable span.
+ *
+ * A borrowed or shared column first copies its rows into storage of its
+ * own, as any mutating call does.
+ *
+ * @param col Target `col_t` to access.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Span over `col->data`. Empty on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+static inline col_float_span_t col_float_span(col_t *col, int *err_out) {
+    col_float_span_t span = {NULL, 0};
+    if (col->dtype != COL_DTYPE_FLOAT) {
+        mlc_fail_null(COL_ERR_INVALID_DTYPE, err_out);
+        return span;
+    }
+    if (col_data_detach(col)) {
+        mlc_fail_null(COL_ERR_OOM, err_out);
+        return span;
+    }
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    span.ptr = (float *)col->data;
+    span.len = col->n_rows;
+    return span;
+}
+
+/**
+ * @brief Returns the rows of a `int64` column as a mutable span.
+ *
+ * A borrowed or shared column first copies its rows into storage of its
+ * own, as any mutating call does.
+ *
+ * @param col Target `col_t` to access.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Span over `col->data`. Empty on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+static inline col_int64_span_t col_int64_span(col_t *col, int *err_out) {
+    col_int64_span_t span = {NULL, 0};
+    if (col->dtype != COL_DTYPE_INT64) {
+        mlc_fail_null(COL_ERR_INVALID_DTYPE, err_out);
+        return span;
+    }
+    if (col_data_detach(col)) {
+        mlc_fail_null(COL_ERR_OOM, err_out);
+        return span;
+    }
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    span.ptr = (int64_t *)col->data;
+    span.len = col->n_rows;
+    return span;
+}
+
+/**
+ * @brief Returns the rows of a `int32` column as a mutable span.
+ *
+ * A borrowed or shared column first copies its rows into storage of its
+ * own, as any mutating call does.
+ *
+ * @param col Target `col_t` to access.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Span over `col->data`. Empty on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+static inline col_int32_span_t col_int32_span(col_t *col, int *err_out) {
+    col_int32_span_t span = {NULL, 0};
+    if (col->dtype != COL_DTYPE_INT32) {
+        mlc_fail_null(COL_ERR_INVALID_DTYPE, err_out);
+        return span;
+    }
+    if (col_data_detach(col)) {
+        mlc_fail_null(COL_ERR_OOM, err_out);
+        return span;
+    }
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    span.ptr = (int32_t *)col->data;
+    span.len = col->n_rows;
+    return span;
+}
+
+/**
+ * @brief Returns the rows of a `uint8` column as a mutable span.
+ *
+ * A borrowed or shared column first copies its rows into storage of its
+ * own, as any mutating call does.
+ *
+ * @param col Target `col_t` to access.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Span over `col->data`. Empty on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+static inline col_uint8_span_t col_uint8_span(col_t *col, int *err_out) {
+    col_uint8_span_t span = {NULL, 0};
+    if (col->dtype != COL_DTYPE_UINT8) {
+        mlc_fail_null(COL_ERR_INVALID_DTYPE, err_out);
+        return span;
+    }
+    if (col_data_detach(col)) {
+        mlc_fail_null(COL_ERR_OOM, err_out);
+        return span;
+    }
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    span.ptr = (uint8_t *)col->data;
+    span.len = col->n_rows;
+    return span;
+}
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef COL_CORE_STRBUF_H
+#define COL_CORE_STRBUF_H
+
+#include <stddef.h>
+
+#include "dtypes/col/core/type.h"
+
+/**
+ * @brief Ensures the string storage has room for `extra` more bytes.
+ *
+ * When at least half of the used bytes are waste, the storage is compacted
+ * before growing. Compaction rewrites the offsets of the first `n_rows`
+ * rows, so callers must not hold offsets that are not yet stored in the
+ * column. This serves as a helper for internal use.
+ *
+ * @param col Target `string` dtype `col_t`.
+ * @param extra Number of bytes that will be pushed.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_strbuf_reserve(col_t *col, const size_t extra);
+
+/**
+ * @brief Copies a string into the storage and returns its offset.
+ *
+ * `str` may point into the column's own storage. This serves as a helper
+ * for internal use.
+ *
+ * @param col Target `string` dtype `col_t`.
+ * @param str NUL-terminated string to copy.
+ * @param offset_out Pointer to receive the byte offset of the copy.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_strbuf_push(col_t *col, const char *str, size_t *offset_out);
+
+/**
+ * @brief Marks the strings of `n` rows starting at `idx` as waste.
+ *
+ * This serves as a helper for internal use.
+ *
+ * @param col Target `string` dtype `col_t`.
+ * @param idx Index of the first released row.
+ * @param n Number of released rows.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+void col_strbuf_release(col_t *col, const size_t idx, const size_t n);
+
+/**
+ * @brief Repacks the live strings in row order, dropping all waste.
+ *
+ * This serves as a helper for internal use.
+ *
+ * @param col Target `string` dtype `col_t`.
+ * @param shrink Non-zero to also release unused capacity.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_strbuf_compact(col_t *col, const int shrink);
+
+#endif
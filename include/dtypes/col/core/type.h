@@ -2,6 +2,9 @@
 #define COL_CORE_TYPE_H
 
 #include <stddef.h>
+#include <stdint.h>
+
+#include "core/alloc.h"
 
 /* enums */
 
@@ -22,6 +25,8 @@ typedef enum col_err {
     COL_ERR_INVALID_DTYPE,
     COL_ERR_EMPTY_NAME,
     COL_ERR_NOT_FOUND,
+    COL_ERR_INVALID_ARG,
+    COL_ERR_PARSE,
 } col_err_t;
 
 /**
@@ -38,14 +43,114 @@ typedef enum col_dtype {
     COL_DTYPE_INT64,        /**< int64_t (64-bit signed integer) */
     COL_DTYPE_INT32,        /**< int32_t (32-bit signed integer) */
     COL_DTYPE_UINT8,        /**< uint8_t (8-bit unsigned integer) */
-    COL_DTYPE_STRING        /**< char* (null-terminated string) */
+    COL_DTYPE_STRING,       /**< size_t offset of a null-terminated string in `strbuf` */
+    COL_DTYPE_CATEGORY      /**< Dictionary-encoded string */
 } col_dtype_t;
 
+/* constants */
+
+/**
+ * @brief Byte alignment of every column `data` buffer.
+ *
+ * Matches one AVX-512 vector and a cache line.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+#define COL_DATA_ALIGN 64
+
+/**
+ * @brief Ownership flags of a `col_t`.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+typedef enum col_flag {
+    COL_FLAG_BORROWED = 1 << 0  /**< `data`, `strbuf` and `dict` are not owned*/
+} col_flag_t;
+
 /* structs */
 
+/**
+ * @brief Contiguous byte storage backing `string` dtype columns.
+ *
+ * Strings are stored NUL-terminated and back to back. The column's `data`
+ * holds one `size_t` byte offset into `bytes` per row. Bytes of overwritten
+ * or removed rows are counted in `waste` and reclaimed by compaction.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+typedef struct col_strbuf {
+    char *bytes;                /**< Packed NUL-terminated strings*/
+    size_t len;                 /**< Number of bytes in use*/
+    size_t capacity;            /**< Number of bytes allocated*/
+    size_t waste;               /**< Bytes no longer referenced by a row*/
+} col_strbuf_t;
+
+struct col;
+
+/**
+ * @brief Dictionary backing `category` dtype columns.
+ *
+ * The column's `data` holds one code per row indexing into `values`. Codes
+ * are `uint8_t`, `uint16_t` or `int32_t` depending on the number of
+ * categories, as reported by the column's `stride`.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+typedef struct col_dict {
+    struct col *values;         /**< `string` column of distinct categories*/
+    uint32_t *slots;            /**< Hash index into `values`, 0 if empty*/
+    size_t n_slots;             /**< Number of slots, a power of two*/
+} col_dict_t;
+
+/**
+ * @brief Reference count of storage shared by copy-on-write clones.
+ *
+ * Borrowed storage that must be released once unused, such as a mapped
+ * file, sets `release`. It runs when the last reference is dropped.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+typedef struct col_share {
+    size_t refs;                /**< Number of columns sharing the storage*/
+    void (*release)(void *ctx); /**< Releases borrowed storage, or NULL*/
+    void *ctx;                  /**< Argument passed to `release`*/
+} col_share_t;
+
 /**
  * @brief Represents a column containing an array of data in a dataframe.
  *
+ * A non-NULL `data` is aligned to `COL_DATA_ALIGN` bytes, and its
+ * allocation is padded so that bytes up to the next `COL_DATA_ALIGN`
+ * boundary past `capacity * stride` can be read. Kernels may therefore use
+ * aligned vector loads from the first row and a full vector at the tail.
+ * Rows past `n_rows` and the padding hold unspecified values.
+ *
+ * Columns with `COL_FLAG_BORROWED` set, from `col_wrap` or `col_slice`,
+ * read storage they do not own and carry no alignment guarantee. Any
+ * mutating call first copies their rows into storage of their own.
+ *
+ * Clones share `data`, `strbuf` and `dict` with their source through
+ * `share` until either side is mutated, at which point the mutated column
+ * copies the storage.
+ *
+ * Every buffer the column owns, the column itself included, comes from
+ * `allocator`, which is fixed when the column is created.
+ *
  * @author PeppermintSnow
  * @since 0.0.0
  * @version 0.0.0
@@ -55,8 +160,16 @@ typedef struct col {
     char *name;                 /**< Name of the column*/
     void *data;                 /**< Array of data in the column*/
     size_t n_rows;              /**< Number of rows*/
+    size_t capacity;            /**< Number of rows allocated in `data`*/
     const col_dtype_t dtype;    /**< Datatype  of the column*/
     const size_t stride;        /**< Byte offset of the datatype*/
+    col_strbuf_t strbuf;        /**< String storage for `string` dtypes*/
+    col_dict_t *dict;           /**< Dictionary for `category` dtypes*/
+    uint8_t *validity;          /**< Packed validity bits, 1 if not null*/
+    size_t null_count;          /**< Number of null rows*/
+    uint32_t flags;             /**< Bitwise OR of `col_flag_t`*/
+    col_share_t *share;         /**< Shared storage count, NULL if exclusive*/
+    mlc_allocator_t allocator;  /**< Allocator owning every buffer above*/
 } col_t;
 
 #endif
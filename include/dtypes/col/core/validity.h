@@ -0,0 +1,101 @@
+#ifndef COL_CORE_VALIDITY_H
+#define COL_CORE_VALIDITY_H
+
+#include <stddef.h>
+
+#include "dtypes/col/core/type.h"
+
+/**
+ * @brief Allocates the validity bitmap with every row marked valid.
+ *
+ * Does nothing if the bitmap already exists. This serves as a helper for
+ * internal use.
+ *
+ * @param col Target `col_t`.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_validity_init(col_t *col);
+
+/**
+ * @brief Resizes an existing validity bitmap to hold `capacity` rows.
+ *
+ * This serves as a helper for internal use.
+ *
+ * @param col Target `col_t`.
+ * @param capacity Number of rows the bitmap must cover.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_validity_reserve(col_t *col, const size_t capacity);
+
+/**
+ * @brief Counts the null rows in `[idx, idx + n)`.
+ *
+ * This serves as a helper for internal use.
+ *
+ * @param col Target `col_t`.
+ * @param idx Index of the first row.
+ * @param n Number of rows.
+ * @return Number of null rows.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+size_t col_validity_count(const col_t *col, const size_t idx, const size_t n);
+
+/**
+ * @brief Moves `n` validity bits from `src` to `dst`, like `memmove`.
+ *
+ * This serves as a helper for internal use.
+ *
+ * @param col Target `col_t` with an allocated bitmap.
+ * @param dst Index of the first destination row.
+ * @param src Index of the first source row.
+ * @param n Number of rows.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+void col_validity_move(
+    col_t *col,
+    const size_t dst,
+    const size_t src,
+    const size_t n
+);
+
+/**
+ * @brief Marks `[idx, idx + n)` as valid or null without touching counts.
+ *
+ * This serves as a helper for internal use.
+ *
+ * @param col Target `col_t` with an allocated bitmap.
+ * @param idx Index of the first row.
+ * @param n Number of rows.
+ * @param valid Non-zero to mark the rows valid.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+void col_validity_fill(
+    col_t *col,
+    const size_t idx,
+    const size_t n,
+    const int valid
+);
+
+#endif
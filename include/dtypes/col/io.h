@@ -0,0 +1,7 @@
+#ifndef COL_IO_H
+#define COL_IO_H
+
+#include "dtypes/col/io/csv.h"
+#include "dtypes/col/io/file.h"
+
+#endif
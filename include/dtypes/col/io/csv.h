@@ -0,0 +1,222 @@
+#ifndef COL_IO_CSV_H
+#define COL_IO_CSV_H
+
+#include <stddef.h>
+
+#include "dtypes/col/core/type.h"
+
+/**
+ * @brief Options of the CSV reader and writer.
+ *
+ * Start from `col_csv_options_default` and override fields as needed. The
+ * writer uses `delim`, `quote`, `header`, `n_threads` and `chunk_bytes`.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+typedef struct col_csv_options {
+    char delim;                 /**< Field delimiter*/
+    char quote;                 /**< Quote character, doubled to escape*/
+    int header;                 /**< Non-zero if the first row holds names*/
+    const col_dtype_t *dtypes;  /**< Dtype of every column, or NULL to infer*/
+    size_t n_dtypes;            /**< Number of entries in `dtypes`*/
+    size_t infer_rows;          /**< Rows sampled to infer dtypes*/
+    size_t n_threads;           /**< Worker threads, 0 for the default*/
+    size_t chunk_bytes;         /**< Bytes of text handled per chunk*/
+} col_csv_options_t;
+
+/**
+ * @brief Streaming CSV reader over a file.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+typedef struct col_csv_reader col_csv_reader_t;
+
+/**
+ * @brief Returns the default CSV options.
+ *
+ * Comma delimited, double quoted, with a header row. Dtypes are inferred
+ * from the first 1000 rows, `mlc_thread_count` threads parse chunks of
+ * 64 MiB.
+ *
+ * @return Default `col_csv_options_t`.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+col_csv_options_t col_csv_options_default(void);
+
+/**
+ * @brief Opens a CSV file for reading in chunks.
+ *
+ * The first chunk is read to find the column names and, unless given,
+ * infer each column's dtype as `int64`, `double` or `string`. Later rows
+ * must fit the inferred dtypes, so pass `dtypes` when they may not.
+ *
+ * Fields follow RFC 4180. Empty unquoted fields are null rows, quoted
+ * empty fields are empty strings. Blank lines are skipped, and rows with
+ * fewer fields than the header are padded with nulls.
+ *
+ * @param path Path of the file to read.
+ * @param options Reader options, or NULL for the defaults.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to the newly created `col_csv_reader_t`. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+col_csv_reader_t *col_csv_open(
+    const char *path,
+    const col_csv_options_t *options,
+    int *err_out
+);
+
+/**
+ * @brief Returns the number of columns of a CSV reader.
+ *
+ * @param reader Target `col_csv_reader_t`.
+ * @return Number of columns in every chunk.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+size_t col_csv_n_cols(const col_csv_reader_t *reader);
+
+/**
+ * @brief Parses the next chunk of rows into new columns.
+ *
+ * At most `chunk_bytes` of input, rounded up to whole rows, are held at a
+ * time, so files larger than memory can be processed chunk by chunk. The
+ * chunk is split at row boundaries and parsed in parallel.
+ *
+ * @param reader Target `col_csv_reader_t`.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Array of `col_csv_n_cols` columns, to be freed with
+ * `col_csv_cols_free`. NULL at the end of the file or on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+col_t **col_csv_next(col_csv_reader_t *reader, int *err_out);
+
+/**
+ * @brief Closes a CSV reader.
+ *
+ * @param reader Target `col_csv_reader_t` to free.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+void col_csv_close(col_csv_reader_t *reader);
+
+/**
+ * @brief Reads a whole CSV file into new columns.
+ *
+ * Equivalent to concatenating every chunk of `col_csv_next`.
+ *
+ * @param path Path of the file to read.
+ * @param options Reader options, or NULL for the defaults.
+ * @param n_cols_out Pointer to receive the number of columns.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Array of `*n_cols_out` columns, to be freed with
+ * `col_csv_cols_free`. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+col_t **col_read_csv(
+    const char *path,
+    const col_csv_options_t *options,
+    size_t *n_cols_out,
+    int *err_out
+);
+
+/**
+ * @brief Frees an array of columns returned by the CSV reader.
+ *
+ * @param cols Array of columns to free.
+ * @param n_cols Number of columns in `cols`.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+void col_csv_cols_free(col_t **cols, const size_t n_cols);
+
+/**
+ * @brief Writes columns to a CSV file.
+ *
+ * Rows are formatted in chunks of about `chunk_bytes`, split across
+ * threads into separate buffers and written in order with one large write
+ * each. Floats are written with the fewest digits that read back to the
+ * same value, integral ones with a trailing ".0". Null rows are empty
+ * fields. Strings and categories are quoted if they are empty or hold the
+ * delimiter, the quote character or a line break.
+ *
+ * `col_read_csv` given the dtypes of the columns reads the file back to
+ * equal columns. Inferring them instead restores `int64` and `double`
+ * columns, while other dtypes read back as one of `int64`, `double` or
+ * `string`, and strings that look like numbers as numbers.
+ *
+ * @param cols Array of columns with equal row counts.
+ * @param n_cols Number of columns in `cols`.
+ * @param path Path of the file to create or truncate.
+ * @param options Writer options, or NULL for the defaults.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_write_csv(
+    col_t *const *cols,
+    const size_t n_cols,
+    const char *path,
+    const col_csv_options_t *options
+);
+
+/**
+ * @brief Writes columns as CSV to a file descriptor.
+ *
+ * Follows `col_write_csv`, writing with `write` so pipes and sockets can
+ * be targets. The descriptor is left open. Only available on POSIX hosts,
+ * elsewhere it fails with `COL_ERR_IO`.
+ *
+ * @param cols Array of columns with equal row counts.
+ * @param n_cols Number of columns in `cols`.
+ * @param fd Open file descriptor to write to.
+ * @param options Writer options, or NULL for the defaults.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_write_csv_fd(
+    col_t *const *cols,
+    const size_t n_cols,
+    const int fd,
+    const col_csv_options_t *options
+);
+
+#endif
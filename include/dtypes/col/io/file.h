@@ -0,0 +1,74 @@
+#ifndef COL_IO_FILE_H
+#define COL_IO_FILE_H
+
+#include "dtypes/col/core/type.h"
+
+/**
+ * @brief Version of the binary column file format written by `col_save`.
+ *
+ * A file starts with a 128-byte header followed by the NUL-terminated
+ * column name. Every section then starts on a `COL_DATA_ALIGN` boundary:
+ *
+ * 1. Data: `n_rows` values of `stride` bytes. `string` columns store
+ *    `uint64_t` offsets into the string bytes, `category` columns their
+ *    codes.
+ * 2. Validity: bitmap of `n_rows` bits, present only with null rows.
+ * 3. String bytes: packed NUL-terminated strings of a `string` column.
+ * 4. Dictionary: `uint64_t` offsets and string bytes of the categories of
+ *    a `category` column.
+ *
+ * Integers are stored in host byte order. Files written on a host of the
+ * other endianness are rejected.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+#define COL_FILE_VERSION 1
+
+/**
+ * @brief Writes a column to a binary column file.
+ *
+ * Strings are repacked, so bytes of overwritten rows are not written.
+ *
+ * @param col Source `col_t` to write.
+ * @param path Path of the file to create or truncate.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_save(const col_t *col, const char *path);
+
+/**
+ * @brief Opens a binary column file by mapping it into memory.
+ *
+ * Nothing is parsed or copied beyond the header, the name, the validity
+ * bitmap and the category dictionary index, so opening costs the same for
+ * any number of rows. Pages are read on first access and shared with every
+ * process mapping the same file.
+ *
+ * The column borrows the mapping and copies it on its first mutation.
+ * Clones and slices keep the mapping alive, which is released with the
+ * last of them. Only the header, section bounds and category dictionary
+ * are validated: row string offsets and category codes are trusted, as
+ * checking them would read every row. The file must not be modified while
+ * mapped.
+ *
+ * @param path Path of the file to open.
+ * @param err_out Optional pointer to receive error codes. `COL_ERR_IO` if
+ * the file cannot be read, `COL_ERR_PARSE` if it is not a valid column
+ * file of a supported version.
+ * @return Pointer to the mapped `col_t`. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+col_t *col_open_mmap(const char *path, int *err_out);
+
+#endif
@@ -0,0 +1,12 @@
+#ifndef COL_OPS_H
+#define COL_OPS_H
+
+#include "dtypes/col/ops/arith.h"
+#include "dtypes/col/ops/cast.h"
+#include "dtypes/col/ops/distinct.h"
+#include "dtypes/col/ops/filter.h"
+#include "dtypes/col/ops/gather.h"
+#include "dtypes/col/ops/reduce.h"
+#include "dtypes/col/ops/sort.h"
+
+#endif
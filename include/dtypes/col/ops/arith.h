@@ -0,0 +1,393 @@
+#ifndef COL_OPS_ARITH_H
+#define COL_OPS_ARITH_H
+
+#include "dtypes/col/core/type.h"
+
+/*
+ * Element-wise kernels over numeric columns. Operands must share a dtype and
+ * length (convert with `col_cast` first), and the result has the same
+ * dtype. A result row is null if any operand row is.
+ *
+ * Every operation comes in three forms:
+ *   - `col_x(...)` allocates and returns a new column named after `a`.
+ *   - `col_x_into(dst, ...)` writes into an existing column of the same
+ *     dtype, growing it if needed. `dst` may alias any operand.
+ *   - `col_x_inplace(a, ...)` overwrites `a`.
+ *
+ * Integer arithmetic wraps on overflow. Integer division by zero yields a
+ * null row. Scalar operands for integer columns must be integral and in
+ * range. `double` and `float` kernels use AVX2 or AVX-512 when available, in
+ * which case `fma` is fused.
+ */
+
+/* enums */
+
+/**
+ * @brief Binary element-wise operations.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+typedef enum col_binop {
+    COL_OP_ADD = 0,     /**< a + b */
+    COL_OP_SUB,         /**< a - b */
+    COL_OP_MUL,         /**< a * b */
+    COL_OP_DIV,         /**< a / b */
+    COL_BINOPS
+} col_binop_t;
+
+/**
+ * @brief Unary element-wise operations.
+ *
+ * Only `COL_OP_ABS` accepts integer columns.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+typedef enum col_unop {
+    COL_OP_ABS = 0,     /**< |a| */
+    COL_OP_SQRT,        /**< sqrt(a) */
+    COL_OP_LOG,         /**< natural logarithm of a */
+    COL_OP_EXP,         /**< e^a */
+    COL_UNOPS
+} col_unop_t;
+
+/* binary: column operand */
+
+/**
+ * @brief Applies `op` element-wise to two columns.
+ *
+ * @param a Left operand.
+ * @param b Right operand, same dtype and length as `a`.
+ * @param op Operation to apply.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to a new `col_t` holding the result. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+col_t *col_binary(
+    const col_t *a,
+    const col_t *b,
+    const col_binop_t op,
+    int *err_out
+);
+
+/**
+ * @brief Applies `op` element-wise to two columns, writing into `dst`.
+ *
+ * @param dst Destination `col_t` with the same dtype as `a`.
+ * @param a Left operand.
+ * @param b Right operand, same dtype and length as `a`.
+ * @param op Operation to apply.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_binary_into(
+    col_t *dst,
+    const col_t *a,
+    const col_t *b,
+    const col_binop_t op
+);
+
+/**
+ * @brief Applies `op` element-wise to two columns, overwriting `a`.
+ *
+ * @param a Left operand and destination.
+ * @param b Right operand, same dtype and length as `a`.
+ * @param op Operation to apply.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_binary_inplace(col_t *a, const col_t *b, const col_binop_t op);
+
+/* binary: scalar operand */
+
+/**
+ * @brief Applies `op` element-wise between a column and a scalar.
+ *
+ * @param a Left operand.
+ * @param s Right operand, converted to the dtype of `a`.
+ * @param op Operation to apply.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to a new `col_t` holding the result. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+col_t *col_binary_scalar(
+    const col_t *a,
+    const double s,
+    const col_binop_t op,
+    int *err_out
+);
+
+/**
+ * @brief Applies `op` element-wise between a column and a scalar, writing
+ * into `dst`.
+ *
+ * @param dst Destination `col_t` with the same dtype as `a`.
+ * @param a Left operand.
+ * @param s Right operand, converted to the dtype of `a`.
+ * @param op Operation to apply.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_binary_scalar_into(
+    col_t *dst,
+    const col_t *a,
+    const double s,
+    const col_binop_t op
+);
+
+/**
+ * @brief Applies `op` element-wise between a column and a scalar,
+ * overwriting `a`.
+ *
+ * @param a Left operand and destination.
+ * @param s Right operand, converted to the dtype of `a`.
+ * @param op Operation to apply.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_binary_scalar_inplace(col_t *a, const double s, const col_binop_t op);
+
+/* fused multiply-add */
+
+/**
+ * @brief Computes `a * b + c` element-wise.
+ *
+ * @param a Multiplicand.
+ * @param b Multiplier, same dtype and length as `a`.
+ * @param c Addend, same dtype and length as `a`.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to a new `col_t` holding the result. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+col_t *col_fma(const col_t *a, const col_t *b, const col_t *c, int *err_out);
+
+/**
+ * @brief Computes `a * b + c` element-wise, writing into `dst`.
+ *
+ * @param dst Destination `col_t` with the same dtype as `a`.
+ * @param a Multiplicand.
+ * @param b Multiplier, same dtype and length as `a`.
+ * @param c Addend, same dtype and length as `a`.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_fma_into(col_t *dst, const col_t *a, const col_t *b, const col_t *c);
+
+/**
+ * @brief Computes `a * b + c` element-wise, overwriting `a`.
+ *
+ * @param a Multiplicand and destination.
+ * @param b Multiplier, same dtype and length as `a`.
+ * @param c Addend, same dtype and length as `a`.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_fma_inplace(col_t *a, const col_t *b, const col_t *c);
+
+/**
+ * @brief Computes the affine transform `a * mul + add` element-wise.
+ *
+ * @param a Multiplicand.
+ * @param mul Scalar multiplier, converted to the dtype of `a`.
+ * @param add Scalar addend, converted to the dtype of `a`.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to a new `col_t` holding the result. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+col_t *col_fma_scalar(
+    const col_t *a,
+    const double mul,
+    const double add,
+    int *err_out
+);
+
+/**
+ * @brief Computes `a * mul + add` element-wise, writing into `dst`.
+ *
+ * @param dst Destination `col_t` with the same dtype as `a`.
+ * @param a Multiplicand.
+ * @param mul Scalar multiplier, converted to the dtype of `a`.
+ * @param add Scalar addend, converted to the dtype of `a`.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_fma_scalar_into(
+    col_t *dst,
+    const col_t *a,
+    const double mul,
+    const double add
+);
+
+/**
+ * @brief Computes `a * mul + add` element-wise, overwriting `a`.
+ *
+ * @param a Multiplicand and destination.
+ * @param mul Scalar multiplier, converted to the dtype of `a`.
+ * @param add Scalar addend, converted to the dtype of `a`.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_fma_scalar_inplace(col_t *a, const double mul, const double add);
+
+/* unary */
+
+/**
+ * @brief Applies `op` to every element.
+ *
+ * @param a Operand.
+ * @param op Operation to apply.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to a new `col_t` holding the result. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+col_t *col_unary(const col_t *a, const col_unop_t op, int *err_out);
+
+/**
+ * @brief Applies `op` to every element, writing into `dst`.
+ *
+ * @param dst Destination `col_t` with the same dtype as `a`.
+ * @param a Operand.
+ * @param op Operation to apply.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_unary_into(col_t *dst, const col_t *a, const col_unop_t op);
+
+/**
+ * @brief Applies `op` to every element, overwriting `a`.
+ *
+ * @param a Operand and destination.
+ * @param op Operation to apply.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_unary_inplace(col_t *a, const col_unop_t op);
+
+/* clip */
+
+/**
+ * @brief Limits every element to `[lo, hi]`.
+ *
+ * NaN elements are left unchanged. For integer columns the bounds are
+ * rounded inwards to the nearest representable values.
+ *
+ * @param a Operand.
+ * @param lo Lower bound.
+ * @param hi Upper bound, no less than `lo`.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to a new `col_t` holding the result. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+col_t *col_clip(
+    const col_t *a,
+    const double lo,
+    const double hi,
+    int *err_out
+);
+
+/**
+ * @brief Limits every element to `[lo, hi]`, writing into `dst`.
+ *
+ * @param dst Destination `col_t` with the same dtype as `a`.
+ * @param a Operand.
+ * @param lo Lower bound.
+ * @param hi Upper bound, no less than `lo`.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_clip_into(
+    col_t *dst,
+    const col_t *a,
+    const double lo,
+    const double hi
+);
+
+/**
+ * @brief Limits every element to `[lo, hi]`, overwriting `a`.
+ *
+ * @param a Operand and destination.
+ * @param lo Lower bound.
+ * @param hi Upper bound, no less than `lo`.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_clip_inplace(col_t *a, const double lo, const double hi);
+
+#endif
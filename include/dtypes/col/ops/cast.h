@@ -0,0 +1,107 @@
+#ifndef COL_OPS_CAST_H
+#define COL_OPS_CAST_H
+
+#include <stddef.h>
+
+#include "dtypes/col/core/type.h"
+
+/**
+ * @brief Converts a column to another dtype.
+ *
+ * Numeric to numeric conversions follow C conversion rules, except that
+ * values an integer target cannot represent (NaN, out of range) become
+ * null rows instead of invoking undefined behavior. Floats are truncated
+ * towards zero. `double` to `float` rounds to nearest, saturating values
+ * beyond the `float` range to infinities of their sign and keeping NaN.
+ *
+ * `string` and `category` columns are parsed into numeric dtypes as by
+ * `col_parse`, and convert into each other. Converting a column to its own
+ * dtype returns a clone.
+ *
+ * @param col Source `col_t`.
+ * @param dtype Target dtype.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to a new `col_t` holding the converted values. NULL on
+ * error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+col_t *col_cast(const col_t *col, const col_dtype_t dtype, int *err_out);
+
+/**
+ * @brief Converts a numeric column in place to a dtype of equal or smaller
+ * stride, releasing the unused part of the buffer.
+ *
+ * Follows the same rules as `col_cast`. For example, `double` to `float`
+ * halves the column's memory.
+ *
+ * @param col Target `col_t` to modify.
+ * @param dtype Target numeric dtype with `stride <= col->stride`.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_cast_inplace(col_t *col, const col_dtype_t dtype);
+
+/**
+ * @brief Parses a `string` or `category` column into a numeric dtype.
+ *
+ * Leading and trailing whitespace is ignored. Empty strings become null
+ * rows. Integers are parsed in base 10 and must fit the target dtype;
+ * floats accept everything `strtod` does, including `nan` and `inf`.
+ *
+ * @param col Source `string` or `category` column.
+ * @param dtype Target numeric dtype.
+ * @param err_row Optional pointer to receive the first row that failed to
+ * parse. Set to `SIZE_MAX` on success.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to a new `col_t` holding the parsed values. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+col_t *col_parse(
+    const col_t *col,
+    const col_dtype_t dtype,
+    size_t *err_row,
+    int *err_out
+);
+
+/**
+ * @brief Parses one string into a numeric value. This serves as a helper
+ * for internal use.
+ *
+ * Follows the rules of `col_parse`, through the fast parsers of
+ * `core/number.h`. Float syntax they do not accept, such as hexadecimal,
+ * is left to `strtod`.
+ *
+ * @param str String to parse, not necessarily NUL-terminated.
+ * @param len Length of `str`.
+ * @param dtype Numeric dtype of `out`.
+ * @param out Pointer to receive the value.
+ * @param is_null Pointer set to non-zero, leaving `out` untouched, if
+ * `str` is empty or all whitespace.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_parse_value(
+    const char *str,
+    const size_t len,
+    const col_dtype_t dtype,
+    void *out,
+    int *is_null
+);
+
+#endif
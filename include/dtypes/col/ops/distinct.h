@@ -0,0 +1,201 @@
+#ifndef COL_OPS_DISTINCT_H
+#define COL_OPS_DISTINCT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "dtypes/col/core/type.h"
+
+/*
+ * Distinct values are found by a hash group-by over the column, in
+ * parallel for large columns. Values compare as group-by keys do: every
+ * NaN is one value, `-0.0` equals `0.0`, and all nulls are one value.
+ * Values are listed in order of first appearance.
+ *
+ * `col_hll_t` sketches estimate the number of distinct non-null values in
+ * a fixed `2^precision` bytes, with a relative standard error of about
+ * `1.04 / sqrt(2^precision)`: 0.8% at the default precision of 14.
+ * Sketches of chunks of a column, or of columns of one dtype, merge into
+ * the sketch of their union, so they can be built apart and combined.
+ * `category` columns are sketched by code, so only sketches of columns
+ * sharing a dictionary merge meaningfully.
+ */
+
+/* Bounds and default of the precision of a `col_hll_t` */
+#define COL_HLL_PRECISION_MIN 4
+#define COL_HLL_PRECISION_MAX 18
+#define COL_HLL_PRECISION_DEFAULT 14
+
+/* structs */
+
+/**
+ * @brief HyperLogLog sketch of a set of values.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+typedef struct col_hll {
+    uint8_t *registers;         /**< Largest rank seen by every register*/
+    size_t n_registers;         /**< Number of registers, `2^precision`*/
+    unsigned precision;         /**< Number of hash bits selecting a register*/
+} col_hll_t;
+
+/* exact */
+
+/**
+ * @brief Collects the distinct values of a column.
+ *
+ * A null row, if any, is kept once as a null value.
+ *
+ * @param col Target `col_t`.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to the newly created `col_t` of distinct values, of the
+ * dtype and name of `col`. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+col_t *col_unique(const col_t *col, int *err_out);
+
+/**
+ * @brief Counts the rows of every distinct value of a column.
+ *
+ * Values are those of `col_unique`, listed in order of first appearance,
+ * or from the most frequent down if `sort` is set, ties keeping that
+ * order.
+ *
+ * @param col Target `col_t`.
+ * @param sort Non-zero to sort by descending count.
+ * @param values_out Receives the `col_t` of distinct values, named as
+ * `col`.
+ * @param counts_out Receives the `int64` dtype `col_t` of their counts,
+ * named "count".
+ * @return Zero on success. Non-zero on error, leaving both outputs NULL.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+int col_value_counts(
+    const col_t *col,
+    const int sort,
+    col_t **values_out,
+    col_t **counts_out
+);
+
+/**
+ * @brief Counts the distinct non-null values of a column.
+ *
+ * @param col Target `col_t`.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Number of distinct values. `SIZE_MAX` on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+size_t col_ndistinct(const col_t *col, int *err_out);
+
+/* approximate */
+
+/**
+ * @brief Creates an empty HyperLogLog sketch.
+ *
+ * @param precision Number of hash bits selecting a register, from
+ * `COL_HLL_PRECISION_MIN` to `COL_HLL_PRECISION_MAX`.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to the newly created `col_hll_t`. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+col_hll_t *col_hll_create(const unsigned precision, int *err_out);
+
+/**
+ * @brief Frees a HyperLogLog sketch.
+ *
+ * @param hll Target `col_hll_t` to free. May be NULL.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+void col_hll_free(col_hll_t *hll);
+
+/**
+ * @brief Adds the non-null values of a column to a sketch.
+ *
+ * Large columns are split into one chunk per thread, each sketched apart
+ * and merged into `hll`.
+ *
+ * @param hll Target `col_hll_t`.
+ * @param col Source `col_t`.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+int col_hll_add(col_hll_t *hll, const col_t *col);
+
+/**
+ * @brief Merges a sketch into another.
+ *
+ * `dst` then sketches the union of both sets of values.
+ *
+ * @param dst Target `col_hll_t`.
+ * @param src Source `col_hll_t`, of the precision of `dst`.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+int col_hll_merge(col_hll_t *dst, const col_hll_t *src);
+
+/**
+ * @brief Estimates the number of distinct values of a sketch.
+ *
+ * Small sets are estimated by linear counting of the empty registers.
+ *
+ * @param hll Target `col_hll_t`.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Estimated number of distinct values. NaN on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+double col_hll_estimate(const col_hll_t *hll, int *err_out);
+
+/**
+ * @brief Estimates the number of distinct non-null values of a column.
+ *
+ * Shorthand for sketching the column alone with `col_hll_add`.
+ *
+ * @param col Target `col_t`.
+ * @param precision Precision of the sketch, 0 for
+ * `COL_HLL_PRECISION_DEFAULT`.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Estimated number of distinct values. NaN on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+double col_ndistinct_hll(const col_t *col, const unsigned precision, int *err_out);
+
+#endif
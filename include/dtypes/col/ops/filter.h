@@ -0,0 +1,324 @@
+#ifndef COL_OPS_FILTER_H
+#define COL_OPS_FILTER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "dtypes/col/core/type.h"
+
+/*
+ * Predicates evaluate a column into a bitmask or a selection vector
+ * without copying any value. Bitmasks hold one bit per row in the layout
+ * of `validity`, least significant bit first. Selection vectors hold the
+ * ascending indices of the selected rows and can be refined by further
+ * predicates, so a chain of filters reads each column once and
+ * materializes rows only at the end, with `col_filter` or `col_take`.
+ *
+ * Null rows never match. Values compare exactly against `double` operands,
+ * so `x < 2.5` on an integer column matches integers up to 2, and NaN only
+ * matches `COL_CMP_NE`. Range kernels are selected at runtime for the best
+ * instruction set the CPU supports (see `mlc_cpu_isa`).
+ */
+
+/* enums */
+
+/**
+ * @brief Comparison operators for predicates.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+typedef enum col_cmp {
+    COL_CMP_LT = 0,         /**< value < operand*/
+    COL_CMP_LE,             /**< value <= operand*/
+    COL_CMP_GT,             /**< value > operand*/
+    COL_CMP_GE,             /**< value >= operand*/
+    COL_CMP_EQ,             /**< value == operand*/
+    COL_CMP_NE,             /**< value != operand*/
+    COL_CMPS                /**< Number of operators*/
+} col_cmp_t;
+
+/* structs */
+
+/**
+ * @brief Ascending indices of the rows selected by a predicate.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+typedef struct col_sel {
+    size_t *idx;                /**< Selected row indices, ascending*/
+    size_t n;                   /**< Number of selected rows*/
+    size_t capacity;            /**< Number of indices allocated*/
+} col_sel_t;
+
+/* helpers */
+
+/**
+ * @brief Number of bytes of a bitmask over `n_rows` rows.
+ *
+ * @param n_rows Number of rows.
+ * @return Size of the bitmask in bytes.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+static inline size_t col_mask_bytes(const size_t n_rows) {
+    return n_rows / 8 + (n_rows % 8 != 0);
+}
+
+/* selection vectors */
+
+/**
+ * @brief Creates an empty selection vector.
+ *
+ * @param capacity Number of indices to preallocate.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to the newly created `col_sel_t`. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+col_sel_t *col_sel_create(const size_t capacity, int *err_out);
+
+/**
+ * @brief Frees a selection vector.
+ *
+ * @param sel Target `col_sel_t` to free. May be NULL.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+void col_sel_free(col_sel_t *sel);
+
+/**
+ * @brief Collects the indices of the set bits of a bitmask.
+ *
+ * @param mask Bitmask over `n_rows` rows.
+ * @param n_rows Number of rows.
+ * @param out Selection vector receiving the indices, replacing its contents.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_sel_from_mask(const uint8_t *mask, const size_t n_rows, col_sel_t *out);
+
+/* bitmask predicates */
+
+/**
+ * @brief Marks the rows of a numeric column comparing true to `value`.
+ *
+ * @param col Target numeric `col_t`.
+ * @param cmp Comparison operator.
+ * @param value Right-hand operand.
+ * @param mask Bitmask of `col_mask_bytes(col->n_rows)` bytes to overwrite.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_mask_cmp(
+    const col_t *col,
+    const col_cmp_t cmp,
+    const double value,
+    uint8_t *mask
+);
+
+/**
+ * @brief Marks the rows of a numeric column within `[lo, hi]`.
+ *
+ * @param col Target numeric `col_t`.
+ * @param lo Inclusive lower bound.
+ * @param hi Inclusive upper bound.
+ * @param mask Bitmask of `col_mask_bytes(col->n_rows)` bytes to overwrite.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_mask_between(
+    const col_t *col,
+    const double lo,
+    const double hi,
+    uint8_t *mask
+);
+
+/**
+ * @brief Marks the rows of a numeric column equal to any of `values`.
+ *
+ * @param col Target numeric `col_t`.
+ * @param values Values to match. May be NULL if `n_values` is zero.
+ * @param n_values Number of values.
+ * @param mask Bitmask of `col_mask_bytes(col->n_rows)` bytes to overwrite.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_mask_isin(
+    const col_t *col,
+    const double *values,
+    const size_t n_values,
+    uint8_t *mask
+);
+
+/**
+ * @brief Marks the rows of a `string` or `category` column equal to any of
+ * `values`.
+ *
+ * @param col Target `string` or `category` dtype `col_t`.
+ * @param values Strings to match. May be NULL if `n_values` is zero.
+ * @param n_values Number of strings.
+ * @param mask Bitmask of `col_mask_bytes(col->n_rows)` bytes to overwrite.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_mask_isin_str(
+    const col_t *col,
+    const char *const *values,
+    const size_t n_values,
+    uint8_t *mask
+);
+
+/* selection predicates */
+
+/**
+ * @brief Selects the rows of a numeric column comparing true to `value`.
+ *
+ * Only rows in `in` are tested, or every row if `in` is NULL. A large
+ * selection is refined through the vectorized bitmask kernels, a small one
+ * by testing its rows one by one.
+ *
+ * @param col Target numeric `col_t`.
+ * @param cmp Comparison operator.
+ * @param value Right-hand operand.
+ * @param in Rows to test, or NULL for every row.
+ * @param out Selection vector receiving the matches. May be `in`.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_sel_cmp(
+    const col_t *col,
+    const col_cmp_t cmp,
+    const double value,
+    const col_sel_t *in,
+    col_sel_t *out
+);
+
+/**
+ * @brief Selects the rows of a numeric column within `[lo, hi]`.
+ *
+ * @param col Target numeric `col_t`.
+ * @param lo Inclusive lower bound.
+ * @param hi Inclusive upper bound.
+ * @param in Rows to test, or NULL for every row.
+ * @param out Selection vector receiving the matches. May be `in`.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_sel_between(
+    const col_t *col,
+    const double lo,
+    const double hi,
+    const col_sel_t *in,
+    col_sel_t *out
+);
+
+/**
+ * @brief Selects the rows of a numeric column equal to any of `values`.
+ *
+ * @param col Target numeric `col_t`.
+ * @param values Values to match. May be NULL if `n_values` is zero.
+ * @param n_values Number of values.
+ * @param in Rows to test, or NULL for every row.
+ * @param out Selection vector receiving the matches. May be `in`.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_sel_isin(
+    const col_t *col,
+    const double *values,
+    const size_t n_values,
+    const col_sel_t *in,
+    col_sel_t *out
+);
+
+/**
+ * @brief Selects the rows of a `string` or `category` column equal to any
+ * of `values`.
+ *
+ * @param col Target `string` or `category` dtype `col_t`.
+ * @param values Strings to match. May be NULL if `n_values` is zero.
+ * @param n_values Number of strings.
+ * @param in Rows to test, or NULL for every row.
+ * @param out Selection vector receiving the matches. May be `in`.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_sel_isin_str(
+    const col_t *col,
+    const char *const *values,
+    const size_t n_values,
+    const col_sel_t *in,
+    col_sel_t *out
+);
+
+/* materialization */
+
+/**
+ * @brief Copies the selected rows into a new column.
+ *
+ * Equivalent to `col_take` over the indices of `sel`.
+ *
+ * @param col Target `col_t`.
+ * @param sel Rows to copy, all within bounds.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to the newly created `col_t`. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+col_t *col_filter(const col_t *col, const col_sel_t *sel, int *err_out);
+
+#endif
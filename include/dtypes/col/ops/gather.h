@@ -0,0 +1,161 @@
+#ifndef COL_OPS_GATHER_H
+#define COL_OPS_GATHER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "dtypes/col/core/type.h"
+
+/*
+ * Gathers (`col_take`) copy rows at arbitrary indices into a new column,
+ * scatters (`col_scatter`) write the rows of one column to arbitrary
+ * indices of another. Indices may be `size_t`, `int32_t` or `int64_t`, and
+ * are bounds checked once, before any row moves, so the kernels run
+ * without a branch per row.
+ *
+ * Gathers of 32 and 64-bit rows use AVX2 hardware gathers when the CPU
+ * supports them (see `mlc_cpu_isa`). Sources too large for the caches are
+ * gathered by scalar loops prefetching the rows ahead of their use, which
+ * hide more misses than hardware gathers do.
+ */
+
+/* gather */
+
+/**
+ * @brief Copies the rows at `idx` into a new column.
+ *
+ * Rows may repeat and come in any order. Every dtype is supported, along
+ * with null rows. A `category` column copies its codes with a copy of the
+ * dictionary. A `string` column taking each of most of its rows at most
+ * once, such as a shuffle, copies its string buffer whole and gathers only
+ * the offsets; other gathers copy each string once into a buffer sized up
+ * front.
+ *
+ * @param col Target `col_t`.
+ * @param idx Row indices to copy. May be NULL if `n` is zero.
+ * @param n Number of indices.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to the newly created `col_t` of `n` rows. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+col_t *col_take(
+    const col_t *col,
+    const size_t *idx,
+    const size_t n,
+    int *err_out
+);
+
+/**
+ * @brief Copies the rows at `int32_t` indices into a new column.
+ *
+ * See `col_take`. Negative indices are out of bounds.
+ *
+ * @param col Target `col_t`.
+ * @param idx Row indices to copy. May be NULL if `n` is zero.
+ * @param n Number of indices.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to the newly created `col_t` of `n` rows. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+col_t *col_take_int32(
+    const col_t *col,
+    const int32_t *idx,
+    const size_t n,
+    int *err_out
+);
+
+/**
+ * @brief Copies the rows at `int64_t` indices into a new column.
+ *
+ * See `col_take`. Negative indices are out of bounds.
+ *
+ * @param col Target `col_t`.
+ * @param idx Row indices to copy. May be NULL if `n` is zero.
+ * @param n Number of indices.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to the newly created `col_t` of `n` rows. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+col_t *col_take_int64(
+    const col_t *col,
+    const int64_t *idx,
+    const size_t n,
+    int *err_out
+);
+
+/* scatter */
+
+/**
+ * @brief Writes row `i` of `src` to row `idx[i]` of `dst`.
+ *
+ * Both columns must share a dtype. Null rows of `src` make their targets
+ * null, valid ones make them valid. If an index repeats, the last write
+ * wins. A `category` source is re-encoded into the dictionary of `dst`,
+ * and the strings a `string` target held count as waste until compaction.
+ * `src` may view the rows of `dst`, as a slice of it does. Indices are
+ * bounds checked before any row is written.
+ *
+ * @param dst Target `col_t` to write to.
+ * @param src Source `col_t` of one row per index. Must not be `dst`.
+ * @param idx Row indices of `dst`, one per row of `src`. May be NULL if
+ * `src` has no rows.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_scatter(col_t *dst, const col_t *src, const size_t *idx);
+
+/**
+ * @brief Writes row `i` of `src` to row `idx[i]` of `dst`, at `int32_t`
+ * indices.
+ *
+ * See `col_scatter`. Negative indices are out of bounds.
+ *
+ * @param dst Target `col_t` to write to.
+ * @param src Source `col_t` of one row per index. Must not be `dst`.
+ * @param idx Row indices of `dst`, one per row of `src`. May be NULL if
+ * `src` has no rows.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_scatter_int32(col_t *dst, const col_t *src, const int32_t *idx);
+
+/**
+ * @brief Writes row `i` of `src` to row `idx[i]` of `dst`, at `int64_t`
+ * indices.
+ *
+ * See `col_scatter`. Negative indices are out of bounds.
+ *
+ * @param dst Target `col_t` to write to.
+ * @param src Source `col_t` of one row per index. Must not be `dst`.
+ * @param idx Row indices of `dst`, one per row of `src`. May be NULL if
+ * `src` has no rows.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int col_scatter_int64(col_t *dst, const col_t *src, const int64_t *idx);
+
+#endif
@@ -0,0 +1,157 @@
+#ifndef COL_OPS_REDUCE_H
+#define COL_OPS_REDUCE_H
+
+#include <stddef.h>
+
+#include "dtypes/col/core/type.h"
+
+/*
+ * Reductions accept every numeric dtype and return a `double`. Null rows are
+ * skipped. Kernels are selected at runtime for the best instruction set the
+ * CPU supports (see `mlc_cpu_isa`), and sums are accumulated pairwise in
+ * SIMD lanes with Neumaier-compensated combination across blocks.
+ */
+
+/**
+ * @brief Sums the non-null values of a numeric column.
+ *
+ * @param col Target `col_t`.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Sum of the values, zero for an empty column. NaN on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+double col_sum(const col_t *col, int *err_out);
+
+/**
+ * @brief Computes the arithmetic mean of the non-null values.
+ *
+ * @param col Target `col_t`.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Mean of the values. NaN on error or if there are no values.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+double col_mean(const col_t *col, int *err_out);
+
+/**
+ * @brief Computes the variance of the non-null values.
+ *
+ * Uses two passes: one for the mean and one for the squared deviations.
+ *
+ * @param col Target `col_t`.
+ * @param ddof Delta degrees of freedom: 0 for population, 1 for sample.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Variance of the values. NaN on error or if there are no more than
+ * `ddof` values.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+double col_var(const col_t *col, const size_t ddof, int *err_out);
+
+/**
+ * @brief Finds the smallest non-null value.
+ *
+ * NaN values are ignored. If every value is NaN, the result is NaN.
+ *
+ * @param col Target `col_t`.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Smallest value. NaN on error or if there are no values.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+double col_min(const col_t *col, int *err_out);
+
+/**
+ * @brief Finds the largest non-null value.
+ *
+ * NaN values are ignored. If every value is NaN, the result is NaN.
+ *
+ * @param col Target `col_t`.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Largest value. NaN on error or if there are no values.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+double col_max(const col_t *col, int *err_out);
+
+/**
+ * @brief Finds the index of the first occurrence of the smallest value.
+ *
+ * NaN and null values are ignored. If every non-null value is NaN, the index
+ * of the first non-null row is returned.
+ *
+ * @param col Target `col_t`.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Index of the smallest value. `SIZE_MAX` on error or if there are
+ * no values.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+size_t col_argmin(const col_t *col, int *err_out);
+
+/**
+ * @brief Finds the index of the first occurrence of the largest value.
+ *
+ * NaN and null values are ignored. If every non-null value is NaN, the index
+ * of the first non-null row is returned.
+ *
+ * @param col Target `col_t`.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Index of the largest value. `SIZE_MAX` on error or if there are
+ * no values.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+size_t col_argmax(const col_t *col, int *err_out);
+
+/**
+ * @brief Computes the L1 norm (sum of absolute values).
+ *
+ * @param col Target `col_t`.
+ * @param err_out Optional pointer to receive error codes.
+ * @return L1 norm of the values, zero for an empty column. NaN on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+double col_norm_l1(const col_t *col, int *err_out);
+
+/**
+ * @brief Computes the L2 norm (square root of the sum of squares).
+ *
+ * @param col Target `col_t`.
+ * @param err_out Optional pointer to receive error codes.
+ * @return L2 norm of the values, zero for an empty column. NaN on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+double col_norm_l2(const col_t *col, int *err_out);
+
+#endif
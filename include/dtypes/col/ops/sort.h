@@ -0,0 +1,97 @@
+#ifndef COL_OPS_SORT_H
+#define COL_OPS_SORT_H
+
+#include <stddef.h>
+
+#include "dtypes/col/core/type.h"
+
+/*
+ * Sorts are stable: rows with equal values keep their input order, so
+ * sorting by one column after another orders by several keys.
+ *
+ * Numbers are sorted by an LSD radix sort over keys that order as the
+ * values do, skipping the digits every key shares. Floats order `-0.0`
+ * before `0.0`, with NaN after every number in either direction.
+ * `string` columns are radix sorted on 8-byte prefixes, refining only the
+ * rows whose prefixes tie, and `category` columns by the strings of their
+ * categories. Null rows come last unless `nulls_first` is set.
+ *
+ * Large columns are split into one chunk per thread, sorted in parallel,
+ * then merged pairwise, every merge split evenly across the threads.
+ */
+
+/* structs */
+
+/**
+ * @brief Options of `col_sort` and `col_argsort`.
+ *
+ * Start from `col_sort_options_default` and override fields as needed.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+typedef struct col_sort_options {
+    int descending;             /**< Non-zero to sort largest first*/
+    int nulls_first;            /**< Non-zero to place null rows first*/
+    size_t n_threads;           /**< Worker threads, 0 for the default*/
+} col_sort_options_t;
+
+/**
+ * @brief Returns the default sort options.
+ *
+ * Ascending, nulls last, on `mlc_thread_count` threads.
+ *
+ * @return Default `col_sort_options_t`.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+col_sort_options_t col_sort_options_default(void);
+
+/**
+ * @brief Sorts the rows of a column in place.
+ *
+ * Rows move along with their validity. Strings are reordered by their
+ * offsets, without copying any string. In place sorting writes every NaN
+ * as the canonical quiet NaN.
+ *
+ * @param col Target `col_t` to sort.
+ * @param options Sort options, or NULL for the defaults.
+ * @return Zero on success. Non-zero on error, leaving `col` as is.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+int col_sort(col_t *col, const col_sort_options_t *options);
+
+/**
+ * @brief Returns the row indices that sort a column.
+ *
+ * Row `i` of the result is the index of the row of `col` that sorts to
+ * position `i`, so `col_take_int64` with its data returns the sorted
+ * column.
+ *
+ * @param col Target `col_t`.
+ * @param options Sort options, or NULL for the defaults.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to the newly created `int64` dtype `col_t` of
+ * `col->n_rows` rows. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+col_t *col_argsort(
+    const col_t *col,
+    const col_sort_options_t *options,
+    int *err_out
+);
+
+#endif
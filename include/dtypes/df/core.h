@@ -0,0 +1,9 @@
+#ifndef DF_CORE_H
+#define DF_CORE_H
+
+#include "dtypes/df/core/type.h"
+#include "dtypes/df/core/lifecycle.h"
+#include "dtypes/df/core/accessors.h"
+#include "dtypes/df/core/modifiers.h"
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef DF_CORE_ACCESSORS_H
+#define DF_CORE_ACCESSORS_H
+
+#include <stddef.h>
+
+#include "core/error.h"
+#include "dtypes/df/core/type.h"
+
+/**
+ * @brief Returns the number of rows of a `df_t`.
+ *
+ * @param df Target `df_t`.
+ * @return Number of rows of every column.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+static inline size_t df_n_rows(const df_t *df) {
+    return df->n_rows;
+}
+
+/**
+ * @brief Returns the number of columns of a `df_t`.
+ *
+ * @param df Target `df_t`.
+ * @return Number of columns.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+static inline size_t df_n_cols(const df_t *df) {
+    return df->n_cols;
+}
+
+/**
+ * @brief Accesses the column at the specified position.
+ *
+ * @param df Target `df_t` to access.
+ * @param idx Position of the column.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to the column, still owned by `df`. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+static inline col_t *df_col_at(const df_t *df, const size_t idx, int *err_out) {
+    if (idx >= df->n_cols)
+        return mlc_fail_null(COL_ERR_OUT_OF_BOUNDS, err_out);
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    return df->cols[idx];
+}
+
+/**
+ * @brief Finds the position of a column by name, in constant time.
+ *
+ * @param df Target `df_t` to search.
+ * @param name Name of the column.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Position of the column. `SIZE_MAX` on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+size_t df_col_index(const df_t *df, const char *name, int *err_out);
+
+/**
+ * @brief Accesses a column by name, in constant time.
+ *
+ * @param df Target `df_t` to access.
+ * @param name Name of the column.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to the column, still owned by `df`. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+col_t *df_col(const df_t *df, const char *name, int *err_out);
+
+#endif
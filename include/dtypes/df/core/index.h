@@ -0,0 +1,41 @@
+#ifndef DF_CORE_INDEX_H
+#define DF_CORE_INDEX_H
+
+#include <stddef.h>
+
+#include "dtypes/df/core/type.h"
+
+/**
+ * @brief Finds the slot of a column name in a frame's index. This serves
+ * as a helper for internal use.
+ *
+ * @param df Target `df_t`.
+ * @param name Column name to look up.
+ * @return Index of the slot holding `name`, or of the empty slot where it
+ * belongs.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+size_t df_index_probe(const df_t *df, const char *name);
+
+/**
+ * @brief Rebuilds a frame's index over its current columns. This serves
+ * as a helper for internal use.
+ *
+ * The index is grown to keep it at most half full, and never shrinks, so
+ * rebuilding after removing or renaming columns cannot fail.
+ *
+ * @param df Target `df_t`.
+ * @return Zero on success. Non-zero on error, leaving the index unchanged.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int df_index_rebuild(df_t *df);
+
+#endif
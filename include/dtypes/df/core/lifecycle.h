@@ -0,0 +1,120 @@
+#ifndef DF_CORE_LIFECYCLE_H
+#define DF_CORE_LIFECYCLE_H
+
+#include <stddef.h>
+
+#include "dtypes/df/core/type.h"
+
+/**
+ * @brief Creates an empty `df_t`.
+ *
+ * The frame has no columns and no rows. The first column added sets its
+ * row count.
+ *
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to the newly created `df_t`. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+df_t *df_create(int *err_out);
+
+/**
+ * @brief Creates a `df_t` from an array of columns.
+ *
+ * The frame takes ownership of the columns on success, without copying
+ * them. On error the caller keeps ownership.
+ *
+ * @param cols Array of columns with equal row counts and unique names.
+ * @param n_cols Number of columns in `cols`.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to the newly created `df_t`. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+df_t *df_from_cols(col_t *const *cols, const size_t n_cols, int *err_out);
+
+/**
+ * @brief Frees a `df_t` and every column it owns.
+ *
+ * @param df Target `df_t` to free.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+void df_free(df_t *df);
+
+/**
+ * @brief Clones a `df_t`.
+ *
+ * Every column is cloned with `col_clone`, so the clone shares storage
+ * with `df` until either side is mutated.
+ *
+ * @param df Target `df_t` to clone.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to the cloned `df_t`. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+df_t *df_clone(const df_t *df, int *err_out);
+
+/**
+ * @brief Creates a `df_t` from some columns of another, in the given
+ * order.
+ *
+ * Columns are cloned with `col_clone`, so no data is copied.
+ *
+ * @param df Source `df_t`.
+ * @param names Names of the columns to select.
+ * @param n_names Number of entries in `names`.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to the newly created `df_t`. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+df_t *df_select(
+    const df_t *df,
+    const char *const *names,
+    const size_t n_names,
+    int *err_out
+);
+
+/**
+ * @brief Creates a view of rows `[start, start + len)` of a `df_t`.
+ *
+ * Every column is a `col_slice` of the matching column of `df`, with the
+ * same lifetime rules: `df` must outlive the view and must not be mutated
+ * while the view is read.
+ *
+ * @param df Source `df_t`.
+ * @param start Index of the first row.
+ * @param len Number of rows.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to the newly created view. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+df_t *df_slice(
+    const df_t *df,
+    const size_t start,
+    const size_t len,
+    int *err_out
+);
+
+#endif
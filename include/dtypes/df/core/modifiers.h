@@ -0,0 +1,71 @@
+#ifndef DF_CORE_MODIFIERS_H
+#define DF_CORE_MODIFIERS_H
+
+#include "dtypes/df/core/type.h"
+
+/**
+ * @brief Appends a column to a `df_t`.
+ *
+ * The frame takes ownership of `col` on success, without copying it. On
+ * error the caller keeps ownership. The first column of an empty frame
+ * sets its row count; later ones must match it.
+ *
+ * @param df Target `df_t` to modify.
+ * @param col Column to append, whose name is not yet in `df`.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int df_add_col(df_t *df, col_t *col);
+
+/**
+ * @brief Removes a column from a `df_t` and returns it.
+ *
+ * Ownership of the column passes to the caller. The remaining columns keep
+ * their order. Removing the last column resets the row count to zero.
+ *
+ * @param df Target `df_t` to modify.
+ * @param name Name of the column.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to the removed column. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+col_t *df_take_col(df_t *df, const char *name, int *err_out);
+
+/**
+ * @brief Removes a column from a `df_t` and frees it.
+ *
+ * @param df Target `df_t` to modify.
+ * @param name Name of the column.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int df_drop_col(df_t *df, const char *name);
+
+/**
+ * @brief Renames a column of a `df_t`.
+ *
+ * @param df Target `df_t` to modify.
+ * @param name Current name of the column.
+ * @param new_name New name, not yet in `df`.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+int df_rename_col(df_t *df, const char *name, const char *new_name);
+
+#endif
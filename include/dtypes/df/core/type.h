@@ -0,0 +1,37 @@
+#ifndef DF_CORE_TYPE_H
+#define DF_CORE_TYPE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "dtypes/col/core/type.h"
+
+/* structs */
+
+/**
+ * @brief Represents a dataframe: an ordered set of named `col_t` columns
+ * of equal length.
+ *
+ * The frame owns its columns. Names are unique and indexed by a hash
+ * table, so lookups by name take constant time whatever the number of
+ * columns. Errors are reported with `col_err_t` codes.
+ *
+ * Column values may be modified in place through `df_col`, but the row
+ * count and name of a column must only change through the `df_`
+ * functions, which keep `n_rows` and the index consistent.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-16
+ */
+typedef struct df {
+    col_t **cols;               /**< Columns in order, owned by the frame*/
+    size_t n_cols;              /**< Number of columns*/
+    size_t capacity;            /**< Number of entries allocated in `cols`*/
+    size_t n_rows;              /**< Number of rows of every column*/
+    uint32_t *slots;            /**< Hash index into `cols`, 0 if empty*/
+    size_t n_slots;             /**< Number of slots, a power of two*/
+} df_t;
+
+#endif
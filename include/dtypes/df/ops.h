@@ -0,0 +1,7 @@
+#ifndef DF_OPS_H
+#define DF_OPS_H
+
+#include "dtypes/df/ops/groupby.h"
+#include "dtypes/df/ops/join.h"
+
+#endif
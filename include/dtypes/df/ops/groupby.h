@@ -0,0 +1,122 @@
+#ifndef DF_OPS_GROUPBY_H
+#define DF_OPS_GROUPBY_H
+
+#include <stddef.h>
+
+#include "dtypes/df/core/type.h"
+
+/*
+ * Rows are grouped by the values of one or more key columns of any dtype.
+ * Null keys form a group of their own, as do NaN keys, and `-0.0` groups
+ * with `0.0`.
+ *
+ * Keys are hashed a column at a time over blocks of rows. Large frames are
+ * then split into partitions by hash, each aggregated on its own thread
+ * into an open-addressing table, and the partitions merged into the
+ * result. Groups are numbered the same whatever the thread count, and
+ * their sums are accumulated in row order.
+ */
+
+/* enums */
+
+/**
+ * @brief Aggregations of `df_groupby`.
+ *
+ * Null values are skipped. Every aggregation but `DF_AGG_COUNT` requires a
+ * numeric column and, as `col_sum` does, computes a `double`.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+typedef enum df_agg_op {
+    DF_AGG_COUNT = 0,       /**< Number of non-null values, as `int64`*/
+    DF_AGG_SUM,             /**< Sum of the values, zero if there are none*/
+    DF_AGG_MEAN,            /**< Mean of the values, null if there are none*/
+    DF_AGG_MIN,             /**< Smallest value ignoring NaN, null if none*/
+    DF_AGG_MAX              /**< Largest value ignoring NaN, null if none*/
+} df_agg_op_t;
+
+/* structs */
+
+/**
+ * @brief One aggregated column of a `df_groupby` result.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+typedef struct df_agg {
+    const char *col;            /**< Value column, NULL to count every row*/
+    df_agg_op_t op;             /**< Aggregation to compute*/
+    const char *name;           /**< Result name, NULL for "<col>_<op>"*/
+} df_agg_t;
+
+/**
+ * @brief Options of `df_groupby`.
+ *
+ * Start from `df_groupby_options_default` and override fields as needed.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+typedef struct df_groupby_options {
+    int sort;                   /**< Non-zero to order groups by their keys*/
+    size_t n_threads;           /**< Worker threads, 0 for the default*/
+} df_groupby_options_t;
+
+/* functions */
+
+/**
+ * @brief Returns the default group-by options.
+ *
+ * Groups in order of first appearance, on `mlc_thread_count` threads.
+ *
+ * @return Default `df_groupby_options_t`.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+df_groupby_options_t df_groupby_options_default(void);
+
+/**
+ * @brief Groups the rows of a frame by key columns and aggregates each
+ * group.
+ *
+ * The result has one row per distinct key, holding the key columns under
+ * their names followed by one column per aggregation. Groups are ordered
+ * by the row their key first appears in, or with `sort` set by the keys,
+ * as `col_sort` orders them, the first key column first. A `DF_AGG_COUNT`
+ * without a value column is named "count" unless `name` is given.
+ *
+ * @param df Target `df_t`.
+ * @param keys Names of the key columns.
+ * @param n_keys Number of key columns, at least one.
+ * @param aggs Aggregations to compute. May be NULL if `n_aggs` is zero.
+ * @param n_aggs Number of aggregations.
+ * @param options Group-by options, or NULL for the defaults.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to the newly created `df_t`. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+df_t *df_groupby(
+    const df_t *df,
+    const char *const *keys,
+    const size_t n_keys,
+    const df_agg_t *aggs,
+    const size_t n_aggs,
+    const df_groupby_options_t *options,
+    int *err_out
+);
+
+#endif
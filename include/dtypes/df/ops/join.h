@@ -0,0 +1,137 @@
+#ifndef DF_OPS_JOIN_H
+#define DF_OPS_JOIN_H
+
+#include <stddef.h>
+
+#include "dtypes/df/core/type.h"
+
+/*
+ * Joins match rows of a left and a right frame whose key columns are
+ * equal. Keys are `int32`, `int64` or `string` columns, the key columns
+ * of both sides pairwise of one dtype. Null keys match nothing.
+ *
+ * The right frame is the build side: its rows are radix partitioned by
+ * key hash into tables small enough for the cache, and the left frame
+ * probes them in parallel chunks. Put the smaller frame on the right.
+ * Matches are collected as row index vectors, from which every column
+ * is gathered at once.
+ *
+ * Results list the left rows in order, each followed by its matches in
+ * right row order, whatever the thread count.
+ */
+
+/* enums */
+
+/**
+ * @brief Kinds of join.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+typedef enum df_join_type {
+    DF_JOIN_INNER = 0,      /**< Only left rows with a match*/
+    DF_JOIN_LEFT            /**< Every left row, null right columns if none*/
+} df_join_type_t;
+
+/* structs */
+
+/**
+ * @brief Options of `df_join` and `df_join_index`.
+ *
+ * Start from `df_join_options_default` and override fields as needed.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+typedef struct df_join_options {
+    df_join_type_t type;        /**< Kind of join*/
+    const char *suffix;         /**< Appended to right names taken on the left*/
+    size_t n_threads;           /**< Worker threads, 0 for the default*/
+} df_join_options_t;
+
+/* functions */
+
+/**
+ * @brief Returns the default join options.
+ *
+ * An inner join, suffix "_right", on `mlc_thread_count` threads.
+ *
+ * @return Default `df_join_options_t`.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+df_join_options_t df_join_options_default(void);
+
+/**
+ * @brief Computes the row pairs of a join.
+ *
+ * Row `i` of the join is row `left_out[i]` of `left` with row
+ * `right_out[i]` of `right`, which is -1 for left rows without a match of
+ * a left join. `col_take_int64` with the left indices gathers any column
+ * of `left` to the join.
+ *
+ * @param left Left (probe) `df_t`.
+ * @param right Right (build) `df_t`.
+ * @param left_on Names of the key columns of `left`.
+ * @param right_on Names of the key columns of `right`.
+ * @param n_keys Number of key columns, at least one.
+ * @param options Join options, or NULL for the defaults.
+ * @param left_out Receives the `int64` dtype `col_t` of left rows.
+ * @param right_out Receives the `int64` dtype `col_t` of right rows.
+ * @return Zero on success. Non-zero on error, leaving both outputs NULL.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+int df_join_index(
+    const df_t *left,
+    const df_t *right,
+    const char *const *left_on,
+    const char *const *right_on,
+    const size_t n_keys,
+    const df_join_options_t *options,
+    col_t **left_out,
+    col_t **right_out
+);
+
+/**
+ * @brief Joins two frames on key columns.
+ *
+ * The result holds every column of `left`, then every column of `right`
+ * but its keys, whose values are those of the left keys. Right names
+ * already used on the left take `suffix`.
+ *
+ * @param left Left (probe) `df_t`.
+ * @param right Right (build) `df_t`.
+ * @param left_on Names of the key columns of `left`.
+ * @param right_on Names of the key columns of `right`.
+ * @param n_keys Number of key columns, at least one.
+ * @param options Join options, or NULL for the defaults.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to the newly created `df_t`. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+df_t *df_join(
+    const df_t *left,
+    const df_t *right,
+    const char *const *left_on,
+    const char *const *right_on,
+    const size_t n_keys,
+    const df_join_options_t *options,
+    int *err_out
+);
+
+#endif
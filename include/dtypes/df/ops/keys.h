@@ -0,0 +1,152 @@
+#ifndef DF_OPS_KEYS_H
+#define DF_OPS_KEYS_H
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/internal.h"
+
+/**
+ * @brief Hashes rows `[start, start + n)` of a set of key columns. This
+ * serves as a helper for internal use.
+ *
+ * Rows equal under `df_keys_equal` hash equally, in any columns of the
+ * same dtypes. Null keys hash to a fixed value. `category` keys hash
+ * their codes, so only rows of one column compare.
+ *
+ * Columns are hashed a block of rows at a time with the best kernel the
+ * CPU supports (see `mlc_cpu_isa`).
+ *
+ * @param keys Key columns, of at least `start + n` rows.
+ * @param n_keys Number of key columns, at least one.
+ * @param start Index of the first row.
+ * @param n Number of rows.
+ * @param hashes Receives the hash of every row.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+void df_keys_hash(
+    const col_t *const *keys,
+    const size_t n_keys,
+    const size_t start,
+    const size_t n,
+    uint64_t *hashes
+);
+
+/**
+ * @brief Returns whether a row holds a null in any key column. This
+ * serves as a helper for internal use.
+ *
+ * @param keys Key columns.
+ * @param n_keys Number of key columns.
+ * @param idx Index of the row.
+ * @return Non-zero if any key of the row is null.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+static inline int df_keys_null(
+    const col_t *const *keys,
+    const size_t n_keys,
+    const size_t idx
+) {
+    for (size_t k = 0; k < n_keys; k++) {
+        if (keys[k]->null_count && !col_bit_get(keys[k]->validity, idx))
+            return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Returns whether row `a` of key columns `ka` equals row `b` of key
+ * columns `kb`. This serves as a helper for internal use.
+ *
+ * Nulls equal nulls and NaN equals NaN. Columns at the same position must
+ * share a dtype, and `category` columns their dictionary.
+ *
+ * @param ka Key columns of row `a`.
+ * @param a Index of the first row.
+ * @param kb Key columns of row `b`.
+ * @param b Index of the second row.
+ * @param n_keys Number of key columns.
+ * @return Non-zero if every key is equal.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+static inline int df_keys_equal(
+    const col_t *const *ka,
+    const size_t a,
+    const col_t *const *kb,
+    const size_t b,
+    const size_t n_keys
+) {
+    #define DF_KEYS_AT(col, T, i) (((const T *)(col)->data)[i])
+    #define DF_KEYS_NE_FLOAT(T)                                             \
+        {                                                                   \
+            const T x = DF_KEYS_AT(ca, T, a);                               \
+            const T y = DF_KEYS_AT(cb, T, b);                               \
+            if (x != y && !(isnan(x) && isnan(y)))                          \
+                return 0;                                                   \
+        }                                                                   \
+        break;
+    #define DF_KEYS_NE(T)                                                   \
+        if (DF_KEYS_AT(ca, T, a) != DF_KEYS_AT(cb, T, b))                   \
+            return 0;                                                       \
+        break;
+
+    for (size_t k = 0; k < n_keys; k++) {
+        const col_t *ca = ka[k];
+        const col_t *cb = kb[k];
+        if (ca->null_count || cb->null_count) {
+            const int valid = !ca->null_count || col_bit_get(ca->validity, a);
+            if (valid != (!cb->null_count || col_bit_get(cb->validity, b)))
+                return 0;
+            if (!valid)
+                continue;
+        }
+
+        switch (ca->dtype) {
+            case COL_DTYPE_DOUBLE:
+                DF_KEYS_NE_FLOAT(double)
+            case COL_DTYPE_FLOAT:
+                DF_KEYS_NE_FLOAT(float)
+            case COL_DTYPE_INT64:
+                DF_KEYS_NE(int64_t)
+            case COL_DTYPE_INT32:
+                DF_KEYS_NE(int32_t)
+            case COL_DTYPE_UINT8:
+                DF_KEYS_NE(uint8_t)
+            case COL_DTYPE_STRING:
+                if (strcmp(
+                    ca->strbuf.bytes + DF_KEYS_AT(ca, size_t, a),
+                    cb->strbuf.bytes + DF_KEYS_AT(cb, size_t, b)
+                ))
+                    return 0;
+                break;
+            case COL_DTYPE_CATEGORY:
+                if (col_code_read(ca->data, ca->stride, a)
+                    != col_code_read(cb->data, cb->stride, b))
+                    return 0;
+                break;
+        }
+    }
+
+    #undef DF_KEYS_NE
+    #undef DF_KEYS_NE_FLOAT
+    #undef DF_KEYS_AT
+
+    return 1;
+}
+
+#endif
@@ -0,0 +1,160 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+#include "core/alloc.h"
+
+/* Alignment every `malloc` result is guaranteed to have */
+#define MLC_MALLOC_ALIGN (2 * sizeof(void *))
+
+static void *mlc_libc_alloc(void *ctx, size_t size, size_t align) {
+    (void)ctx;
+#ifdef _WIN32
+    return _aligned_malloc(size, align);
+#else
+    if (align <= MLC_MALLOC_ALIGN)
+        return malloc(size);
+
+    void *ptr;
+    if (posix_memalign(&ptr, align, size))
+        return NULL;
+    return ptr;
+#endif
+}
+
+static void *mlc_libc_realloc(
+    void *ctx,
+    void *ptr,
+    size_t old_size,
+    size_t size,
+    size_t align
+) {
+#ifdef _WIN32
+    (void)ctx;
+    (void)old_size;
+    return _aligned_realloc(ptr, size, align);
+#else
+    if (align <= MLC_MALLOC_ALIGN)
+        return realloc(ptr, size);
+
+    /* `realloc` may drop the alignment */
+    void *tmp = mlc_libc_alloc(ctx, size, align);
+    if (!tmp)
+        return NULL;
+    if (ptr)
+        memcpy(tmp, ptr, old_size < size ? old_size : size);
+    free(ptr);
+    return tmp;
+#endif
+}
+
+static void mlc_libc_free(void *ctx, void *ptr) {
+    (void)ctx;
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    free(ptr);
+#endif
+}
+
+static const mlc_allocator_t mlc_allocator_libc = {
+    mlc_libc_alloc,
+    mlc_libc_realloc,
+    mlc_libc_free,
+    NULL
+};
+
+static mlc_allocator_t mlc_allocator_current = {
+    mlc_libc_alloc,
+    mlc_libc_realloc,
+    mlc_libc_free,
+    NULL
+};
+
+const mlc_allocator_t *mlc_allocator_default(void) {
+    return &mlc_allocator_libc;
+}
+
+const mlc_allocator_t *mlc_allocator_global(void) {
+    return &mlc_allocator_current;
+}
+
+void mlc_allocator_set_global(const mlc_allocator_t *allocator) {
+    if (!allocator)
+        allocator = &mlc_allocator_libc;
+    if (!allocator->alloc)
+        return;
+
+    mlc_allocator_current = *allocator;
+}
+
+void *mlc_alloc(
+    const mlc_allocator_t *allocator,
+    const size_t size,
+    const size_t align
+) {
+    if (!size)
+        return NULL;
+
+    return allocator->alloc(allocator->ctx, size, align);
+}
+
+void *mlc_calloc(
+    const mlc_allocator_t *allocator,
+    const size_t n,
+    const size_t size
+) {
+    if (size && n > SIZE_MAX / size)
+        return NULL;
+
+    void *ptr = mlc_alloc(allocator, n * size, MLC_MALLOC_ALIGN);
+    if (ptr)
+        memset(ptr, 0, n * size);
+
+    return ptr;
+}
+
+void *mlc_realloc(
+    const mlc_allocator_t *allocator,
+    void *ptr,
+    const size_t old_size,
+    const size_t size,
+    const size_t align
+) {
+    if (!size) {
+        mlc_free(allocator, ptr);
+        return NULL;
+    }
+    if (!ptr)
+        return mlc_alloc(allocator, size, align);
+
+    if (allocator->realloc)
+        return allocator->realloc(allocator->ctx, ptr, old_size, size, align);
+
+    void *tmp = mlc_alloc(allocator, size, align);
+    if (!tmp)
+        return NULL;
+    memcpy(tmp, ptr, old_size < size ? old_size : size);
+    mlc_free(allocator, ptr);
+
+    return tmp;
+}
+
+void mlc_free(const mlc_allocator_t *allocator, void *ptr) {
+    if (ptr && allocator->free)
+        allocator->free(allocator->ctx, ptr);
+}
+
+char *mlc_strdup(const mlc_allocator_t *allocator, const char *str) {
+    const size_t len = strlen(str) + 1;
+
+    char *copy = mlc_alloc(allocator, len, 1);
+    if (copy)
+        memcpy(copy, str, len);
+
+    return copy;
+}
@@ -0,0 +1,182 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/alloc.h"
+#include "core/arena.h"
+
+#define MLC_ARENA_BLOCK_SIZE ((size_t)1 << 20)
+
+typedef struct mlc_arena_block {
+    struct mlc_arena_block *next;
+    size_t size;                /**< Bytes usable after the header*/
+    size_t used;
+} mlc_arena_block_t;
+
+struct mlc_arena {
+    mlc_arena_block_t *head;    /**< Block allocations are carved from*/
+    size_t block_size;
+    size_t max_bytes;
+    size_t n_bytes;             /**< Bytes of every block, headers included*/
+    void *last;                 /**< Most recent allocation, can grow in place*/
+    mlc_arena_block_t *last_block;  /**< Block holding `last`*/
+};
+
+static char *mlc_arena_block_data(mlc_arena_block_t *block) {
+    return (char *)(block + 1);
+}
+
+/* Offset into `block` where an `align` aligned allocation would start */
+static size_t mlc_arena_block_offset(
+    mlc_arena_block_t *block,
+    const size_t align
+) {
+    const uintptr_t addr = (uintptr_t)(mlc_arena_block_data(block) + block->used);
+    return block->used + ((align - (addr & (align - 1))) & (align - 1));
+}
+
+static mlc_arena_block_t *mlc_arena_block_push(
+    mlc_arena_t *arena,
+    const size_t size,
+    const size_t align
+) {
+    /* room for the worst case padding */
+    if (size > SIZE_MAX - align - sizeof(mlc_arena_block_t))
+        return NULL;
+
+    size_t block_size = size + align;
+    if (block_size < arena->block_size)
+        block_size = arena->block_size;
+
+    const size_t n_bytes = sizeof(mlc_arena_block_t) + block_size;
+    if (arena->max_bytes && n_bytes > arena->max_bytes - arena->n_bytes)
+        return NULL;
+
+    mlc_arena_block_t *block = malloc(n_bytes);
+    if (!block)
+        return NULL;
+
+    block->size = block_size;
+    block->used = 0;
+    arena->n_bytes += n_bytes;
+
+    /* an oversized block is filled at once, keep carving from the head */
+    if (arena->head && block_size > arena->block_size) {
+        block->next = arena->head->next;
+        arena->head->next = block;
+    } else {
+        block->next = arena->head;
+        arena->head = block;
+    }
+
+    return block;
+}
+
+static void *mlc_arena_alloc(void *ctx, size_t size, size_t align) {
+    mlc_arena_t *arena = ctx;
+    mlc_arena_block_t *block = arena->head;
+
+    size_t offset = block ? mlc_arena_block_offset(block, align) : 0;
+    if (!block || offset > block->size || size > block->size - offset) {
+        block = mlc_arena_block_push(arena, size, align);
+        if (!block)
+            return NULL;
+        offset = mlc_arena_block_offset(block, align);
+    }
+
+    void *ptr = mlc_arena_block_data(block) + offset;
+    block->used = offset + size;
+    arena->last = ptr;
+    arena->last_block = block;
+
+    return ptr;
+}
+
+static void *mlc_arena_realloc(
+    void *ctx,
+    void *ptr,
+    size_t old_size,
+    size_t size,
+    size_t align
+) {
+    mlc_arena_t *arena = ctx;
+    mlc_arena_block_t *block = arena->last_block;
+
+    /* the most recent allocation grows or shrinks in place */
+    if (ptr == arena->last && ((uintptr_t)ptr & (align - 1)) == 0) {
+        const size_t offset = (size_t)((char *)ptr - mlc_arena_block_data(block));
+        if (size <= block->size - offset) {
+            block->used = offset + size;
+            return ptr;
+        }
+    }
+
+    void *tmp = mlc_arena_alloc(ctx, size, align);
+    if (!tmp)
+        return NULL;
+    memcpy(tmp, ptr, old_size < size ? old_size : size);
+
+    return tmp;
+}
+
+mlc_arena_t *mlc_arena_create(const size_t block_size, const size_t max_bytes) {
+    mlc_arena_t *arena = malloc(sizeof(mlc_arena_t));
+    if (!arena)
+        return NULL;
+
+    arena->head = NULL;
+    arena->block_size = block_size ? block_size : MLC_ARENA_BLOCK_SIZE;
+    arena->max_bytes = max_bytes;
+    arena->n_bytes = 0;
+    arena->last = NULL;
+    arena->last_block = NULL;
+
+    return arena;
+}
+
+mlc_allocator_t mlc_arena_allocator(mlc_arena_t *arena) {
+    mlc_allocator_t allocator = {
+        mlc_arena_alloc,
+        mlc_arena_realloc,
+        NULL,
+        arena
+    };
+    return allocator;
+}
+
+size_t mlc_arena_bytes(const mlc_arena_t *arena) {
+    return arena->n_bytes;
+}
+
+void mlc_arena_reset(mlc_arena_t *arena) {
+    mlc_arena_block_t *block = arena->head;
+    if (!block)
+        return;
+
+    /* keep the oldest block, it was sized for the common case */
+    while (block->next) {
+        mlc_arena_block_t *next = block->next;
+        arena->n_bytes -= sizeof(mlc_arena_block_t) + block->size;
+        free(block);
+        block = next;
+    }
+
+    block->used = 0;
+    arena->head = block;
+    arena->last = NULL;
+    arena->last_block = NULL;
+}
+
+void mlc_arena_free(mlc_arena_t *arena) {
+    if (!arena)
+        return;
+
+    mlc_arena_block_t *block = arena->head;
+    while (block) {
+        mlc_arena_block_t *next = block->next;
+        free(block);
+        block = next;
+    }
+
+    free(arena);
+}
@@ -0,0 +1,39 @@
+#include "core/cpu.h"
+#include "core/simd.h"
+
+static int mlc_cpu_detected = -1;
+static mlc_isa_t mlc_cpu_cap = MLC_ISA_COUNT;
+
+mlc_isa_t mlc_cpu_isa_detect(void) {
+    if (mlc_cpu_detected >= 0)
+        return (mlc_isa_t)mlc_cpu_detected;
+
+    mlc_isa_t isa = MLC_ISA_SCALAR;
+#ifdef MLC_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse2"))
+        isa = MLC_ISA_SSE2;
+    if (isa == MLC_ISA_SSE2
+        && __builtin_cpu_supports("avx2")
+        && __builtin_cpu_supports("fma"))
+        isa = MLC_ISA_AVX2;
+    if (isa == MLC_ISA_AVX2
+        && __builtin_cpu_supports("avx512f")
+        && __builtin_cpu_supports("avx512bw")
+        && __builtin_cpu_supports("avx512dq")
+        && __builtin_cpu_supports("avx512vl"))
+        isa = MLC_ISA_AVX512;
+#endif
+
+    mlc_cpu_detected = (int)isa;
+    return isa;
+}
+
+mlc_isa_t mlc_cpu_isa(void) {
+    const mlc_isa_t isa = mlc_cpu_isa_detect();
+    return isa < mlc_cpu_cap ? isa : mlc_cpu_cap;
+}
+
+void mlc_cpu_isa_limit(const mlc_isa_t isa) {
+    mlc_cpu_cap = isa;
+}
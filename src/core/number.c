@@ -0,0 +1,758 @@
+#include <float.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/number.h"
+#include "core/pow5.h"
+
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+#define MLC_NUMBER_FAST_PATH 1
+#endif
+
+#define MLC_NUMBER_MAX_DIGITS 19
+#define MLC_NUMBER_FALLBACK 64
+
+/* Binary floating point format, parameterising Eisel-Lemire */
+typedef struct mlc_binary_format {
+    int mantissa_bits;          /* explicit mantissa bits */
+    int min_exponent;           /* exponent bias, negated */
+    int infinite_power;         /* biased exponent of infinity */
+    int min_round_to_even;      /* decimal exponents where ties can occur */
+    int max_round_to_even;
+    int min_pow10;              /* decimal exponents below round to zero */
+    int max_pow10;              /* decimal exponents above overflow */
+    int max_fast_pow10;         /* exact powers of ten for the fast path */
+    int min_digits;             /* digits that always round trip */
+    int max_digits;             /* digits that are always enough */
+} mlc_binary_format_t;
+
+static const mlc_binary_format_t mlc_binary64 = {
+    52, -1023, 0x7FF, -4, 23, -342, 308, 22, DBL_DIG, 17
+};
+
+static const mlc_binary_format_t mlc_binary32 = {
+    23, -127, 0xFF, -17, 10, -65, 38, 10, FLT_DIG, 9
+};
+
+/* A parsed decimal: `mantissa * 10^exponent` */
+typedef struct mlc_decimal {
+    uint64_t mantissa;
+    int64_t exponent;
+    int negative;
+    int truncated;              /* digits beyond the first 19 were dropped */
+} mlc_decimal_t;
+
+static const double mlc_pow10_double[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static const float mlc_pow10_float[] = {
+    1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+};
+
+static const uint64_t mlc_pow10_u64[] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+    10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+    100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+    100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+    100000000000000000ULL, 1000000000000000000ULL,
+    10000000000000000000ULL
+};
+
+static const char mlc_digits2[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static inline int mlc_is_digit(const char c) {
+    return (unsigned char)(c - '0') < 10;
+}
+
+/* Full 64x64 bit product, returning the low half */
+static inline uint64_t mlc_mul128(const uint64_t a, const uint64_t b, uint64_t *hi) {
+#ifdef __SIZEOF_INT128__
+    __extension__ const unsigned __int128 r = (unsigned __int128)a * b;
+    *hi = (uint64_t)(r >> 64);
+    return (uint64_t)r;
+#else
+    const uint64_t a_lo = (uint32_t)a, a_hi = a >> 32;
+    const uint64_t b_lo = (uint32_t)b, b_hi = b >> 32;
+    const uint64_t lo_lo = a_lo * b_lo;
+    const uint64_t hi_lo = a_hi * b_lo;
+    const uint64_t lo_hi = a_lo * b_hi;
+    const uint64_t cross = (lo_lo >> 32) + (uint32_t)hi_lo + lo_hi;
+    *hi = a_hi * b_hi + (hi_lo >> 32) + (cross >> 32);
+    return (cross << 32) | (uint32_t)lo_lo;
+#endif
+}
+
+/* Loads 8 characters so the first one is the least significant byte */
+static inline uint64_t mlc_load8(const char *p) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    v = __builtin_bswap64(v);
+#endif
+    return v;
+}
+
+/* Whether all 8 bytes are ASCII digits */
+static inline int mlc_is_8digits(const uint64_t v) {
+    return !(((v + 0x4646464646464646ULL) | (v - 0x3030303030303030ULL))
+        & 0x8080808080808080ULL);
+}
+
+/* Converts 8 ASCII digits with three multiplications (SWAR) */
+static inline uint32_t mlc_parse_8digits(uint64_t v) {
+    const uint64_t mask = 0x000000FF000000FFULL;
+    const uint64_t mul1 = 100 + (1000000ULL << 32);
+    const uint64_t mul2 = 1 + (10000ULL << 32);
+
+    v -= 0x3030303030303030ULL;
+    v = (v * 10) + (v >> 8);
+    v = (((v & mask) * mul1) + (((v >> 16) & mask) * mul2)) >> 32;
+    return (uint32_t)v;
+}
+
+/* Accumulates digits into `*w`, eight at a time where possible */
+static const char *mlc_scan_digits(const char *p, const char *end, uint64_t *w) {
+    uint64_t v = *w;
+
+    while (end - p >= 8) {
+        const uint64_t chunk = mlc_load8(p);
+        if (!mlc_is_8digits(chunk))
+            break;
+        v = v * 100000000 + mlc_parse_8digits(chunk);
+        p += 8;
+    }
+    while (p < end && mlc_is_digit(*p)) {
+        v = v * 10 + (uint64_t)(*p - '0');
+        p++;
+    }
+
+    *w = v;
+    return p;
+}
+
+/* Matches `word`, lowercase, case-insensitively */
+static int mlc_match(const char *p, const char *end, const char *word) {
+    const size_t len = strlen(word);
+    if ((size_t)(end - p) < len)
+        return 0;
+    for (size_t i = 0; i < len; i++) {
+        if ((p[i] | 0x20) != word[i])
+            return 0;
+    }
+    return 1;
+}
+
+/* Collects the first 19 significant digits of a long mantissa */
+static void mlc_truncate(
+    const char *int_begin,
+    const char *int_end,
+    const char *frac_begin,
+    const char *frac_end,
+    mlc_decimal_t *dec,
+    const int64_t exponent
+) {
+    uint64_t w = 0;
+    int n = 0;
+    const char *p = int_begin;
+
+    while (p < int_end && *p == '0')
+        p++;
+    for (; p < int_end && n < MLC_NUMBER_MAX_DIGITS; p++, n++)
+        w = w * 10 + (uint64_t)(*p - '0');
+
+    /* integer digits that did not fit scale the mantissa */
+    int64_t shift = (int64_t)(int_end - p);
+    if (p == int_end) {
+        p = frac_begin;
+        if (!n) {
+            while (p < frac_end && *p == '0')
+                p++;
+        }
+        for (; p < frac_end && n < MLC_NUMBER_MAX_DIGITS; p++, n++)
+            w = w * 10 + (uint64_t)(*p - '0');
+        shift = -(int64_t)(p - frac_begin);
+    }
+
+    dec->mantissa = w;
+    dec->exponent = exponent + shift;
+    dec->truncated = 1;
+}
+
+/* Scans a decimal number. NULL if there is none. */
+static const char *mlc_scan_decimal(
+    const char *p,
+    const char *end,
+    mlc_decimal_t *dec
+) {
+    dec->negative = 0;
+    dec->truncated = 0;
+    if (p < end && (*p == '-' || *p == '+')) {
+        dec->negative = *p == '-';
+        p++;
+    }
+
+    /* mantissa */
+    uint64_t w = 0;
+    const char *int_begin = p;
+    p = mlc_scan_digits(p, end, &w);
+    const char *int_end = p;
+
+    const char *frac_begin = p;
+    const char *frac_end = p;
+    if (p < end && *p == '.') {
+        frac_begin = ++p;
+        p = mlc_scan_digits(p, end, &w);
+        frac_end = p;
+    }
+
+    const int64_t n_int = int_end - int_begin;
+    const int64_t n_frac = frac_end - frac_begin;
+    if (!n_int && !n_frac)
+        return NULL;
+
+    /* exponent, only if digits follow */
+    int64_t exponent = 0;
+    if (p < end && (*p | 0x20) == 'e') {
+        const char *q = p + 1;
+        int negative = 0;
+        if (q < end && (*q == '-' || *q == '+')) {
+            negative = *q == '-';
+            q++;
+        }
+        if (q < end && mlc_is_digit(*q)) {
+            for (; q < end && mlc_is_digit(*q); q++) {
+                if (exponent < 0x10000000)
+                    exponent = exponent * 10 + (*q - '0');
+            }
+            exponent = negative ? -exponent : exponent;
+            p = q;
+        }
+    }
+
+    dec->mantissa = w;
+    dec->exponent = exponent - n_frac;
+
+    /* leading zeros aside, more than 19 digits wrapped `w` */
+    if (n_int + n_frac > MLC_NUMBER_MAX_DIGITS) {
+        int64_t n_digits = n_int + n_frac;
+        const char *z = int_begin;
+        while (z < int_end && *z == '0') {
+            z++;
+            n_digits--;
+        }
+        if (z == int_end) {
+            for (z = frac_begin; z < frac_end && *z == '0'; z++)
+                n_digits--;
+        }
+        if (n_digits > MLC_NUMBER_MAX_DIGITS)
+            mlc_truncate(int_begin, int_end, frac_begin, frac_end, dec, exponent);
+    }
+
+    return p;
+}
+
+/*
+ * Eisel-Lemire: the correctly rounded binary mantissa and biased exponent
+ * of `w * 10^q`, or -1 in the rare cases it cannot decide.
+ */
+static int mlc_eisel_lemire(
+    const mlc_binary_format_t *fmt,
+    const int64_t q,
+    uint64_t w,
+    uint64_t *mantissa_out,
+    int32_t *power2_out
+) {
+    if (!w || q < fmt->min_pow10) {
+        *mantissa_out = 0;
+        *power2_out = 0;
+        return 0;
+    }
+    if (q > fmt->max_pow10) {
+        *mantissa_out = 0;
+        *power2_out = fmt->infinite_power;
+        return 0;
+    }
+
+    /* the top bits of w * 5^q, refined with the low word when ambiguous */
+    const int lz = __builtin_clzll(w);
+    w <<= lz;
+
+    const uint64_t *pow5 = mlc_pow5_table[q - MLC_POW5_MIN];
+    uint64_t hi;
+    uint64_t lo = mlc_mul128(w, pow5[0], &hi);
+
+    const uint64_t precision_mask = UINT64_MAX >> (fmt->mantissa_bits + 3);
+    if ((hi & precision_mask) == precision_mask) {
+        uint64_t hi2;
+        mlc_mul128(w, pow5[1], &hi2);
+        lo += hi2;
+        if (hi2 > lo)
+            hi++;
+    }
+    if (lo == UINT64_MAX && (q < -27 || q > 55))
+        return -1;
+
+    const int upperbit = (int)(hi >> 63);
+    const int shift = upperbit + 64 - fmt->mantissa_bits - 3;
+    uint64_t mantissa = hi >> shift;
+    int32_t power2 = (int32_t)(((217706 * q) >> 16) + 63 + upperbit - lz
+        - fmt->min_exponent);
+
+    /* subnormal */
+    if (power2 <= 0) {
+        if (-power2 + 1 >= 64) {
+            *mantissa_out = 0;
+            *power2_out = 0;
+            return 0;
+        }
+        mantissa >>= -power2 + 1;
+        mantissa += mantissa & 1;
+        mantissa >>= 1;
+        *mantissa_out = mantissa;
+        *power2_out = mantissa < ((uint64_t)1 << fmt->mantissa_bits) ? 0 : 1;
+        return 0;
+    }
+
+    /* exact halfway cases round to even */
+    if (lo <= 1
+        && q >= fmt->min_round_to_even
+        && q <= fmt->max_round_to_even
+        && (mantissa & 3) == 1
+        && (mantissa << shift) == hi)
+        mantissa &= ~(uint64_t)1;
+
+    mantissa += mantissa & 1;
+    mantissa >>= 1;
+    if (mantissa >= ((uint64_t)2 << fmt->mantissa_bits)) {
+        mantissa = (uint64_t)1 << fmt->mantissa_bits;
+        power2++;
+    }
+    mantissa &= ~((uint64_t)1 << fmt->mantissa_bits);
+
+    if (power2 >= fmt->infinite_power) {
+        mantissa = 0;
+        power2 = fmt->infinite_power;
+    }
+
+    *mantissa_out = mantissa;
+    *power2_out = power2;
+    return 0;
+}
+
+/* Bits of the nearest value to `w * 10^q`, or -1 if undecided */
+static int mlc_decimal_to_bits(
+    const mlc_binary_format_t *fmt,
+    const uint64_t w,
+    const int64_t q,
+    uint64_t *bits
+) {
+    uint64_t mantissa;
+    int32_t power2;
+    if (mlc_eisel_lemire(fmt, q, w, &mantissa, &power2))
+        return -1;
+
+    *bits = mantissa | ((uint64_t)power2 << fmt->mantissa_bits);
+    return 0;
+}
+
+/* Parses through `strtod` or `strtof`, for inputs Eisel-Lemire cannot decide */
+static int mlc_parse_fallback(
+    const char *begin,
+    const char *end,
+    const int is_float,
+    void *out
+) {
+    char stack[MLC_NUMBER_FALLBACK];
+    const size_t len = (size_t)(end - begin);
+    char *str = len < sizeof(stack) ? stack : malloc(len + 1);
+    if (!str)
+        return -1;
+
+    memcpy(str, begin, len);
+    str[len] = '\0';
+    if (is_float)
+        *(float *)out = strtof(str, NULL);
+    else
+        *(double *)out = strtod(str, NULL);
+
+    if (str != stack)
+        free(str);
+    return 0;
+}
+
+/* Parses `inf`, `infinity` or `nan` */
+static const char *mlc_parse_special(
+    const char *p,
+    const char *end,
+    const int is_float,
+    void *out
+) {
+    int negative = 0;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        p++;
+    }
+
+    double val;
+    if (mlc_match(p, end, "infinity")) {
+        val = negative ? -HUGE_VAL : HUGE_VAL;
+        p += 8;
+    } else if (mlc_match(p, end, "inf")) {
+        val = negative ? -HUGE_VAL : HUGE_VAL;
+        p += 3;
+    } else if (mlc_match(p, end, "nan")) {
+        val = negative ? -NAN : NAN;
+        p += 3;
+    } else {
+        return NULL;
+    }
+
+    if (is_float)
+        *(float *)out = (float)val;
+    else
+        *(double *)out = val;
+    return p;
+}
+
+static const char *mlc_parse_binary(
+    const char *begin,
+    const char *end,
+    const mlc_binary_format_t *fmt,
+    void *out
+) {
+    const int is_float = fmt == &mlc_binary32;
+
+    mlc_decimal_t dec;
+    const char *p = mlc_scan_decimal(begin, end, &dec);
+    if (!p)
+        return mlc_parse_special(begin, end, is_float, out);
+
+#ifdef MLC_NUMBER_FAST_PATH
+    /* both operands are exact, so one rounding gives the right answer */
+    if (!dec.truncated
+        && dec.exponent >= -fmt->max_fast_pow10
+        && dec.exponent <= fmt->max_fast_pow10
+        && dec.mantissa <= ((uint64_t)2 << fmt->mantissa_bits)) {
+        if (is_float) {
+            float val = (float)dec.mantissa;
+            val = dec.exponent < 0
+                ? val / mlc_pow10_float[-dec.exponent]
+                : val * mlc_pow10_float[dec.exponent];
+            *(float *)out = dec.negative ? -val : val;
+        } else {
+            double val = (double)dec.mantissa;
+            val = dec.exponent < 0
+                ? val / mlc_pow10_double[-dec.exponent]
+                : val * mlc_pow10_double[dec.exponent];
+            *(double *)out = dec.negative ? -val : val;
+        }
+        return p;
+    }
+#endif
+
+    uint64_t bits;
+    int undecided = mlc_decimal_to_bits(fmt, dec.mantissa, dec.exponent, &bits);
+
+    /* dropped digits lie between w and w + 1 */
+    if (!undecided && dec.truncated) {
+        uint64_t upper;
+        undecided = mlc_decimal_to_bits(
+            fmt,
+            dec.mantissa + 1,
+            dec.exponent,
+            &upper
+        ) || upper != bits;
+    }
+
+    if (undecided) {
+        if (mlc_parse_fallback(begin, p, is_float, out))
+            return NULL;
+        return p;
+    }
+
+    if (is_float) {
+        const uint32_t bits32 = (uint32_t)bits | ((uint32_t)dec.negative << 31);
+        memcpy(out, &bits32, sizeof(bits32));
+    } else {
+        bits |= (uint64_t)dec.negative << 63;
+        memcpy(out, &bits, sizeof(bits));
+    }
+    return p;
+}
+
+const char *mlc_parse_double(const char *begin, const char *end, double *out) {
+    return mlc_parse_binary(begin, end, &mlc_binary64, out);
+}
+
+const char *mlc_parse_float(const char *begin, const char *end, float *out) {
+    return mlc_parse_binary(begin, end, &mlc_binary32, out);
+}
+
+const char *mlc_parse_int64(const char *begin, const char *end, int64_t *out) {
+    const char *p = begin;
+    int negative = 0;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        p++;
+    }
+
+    const char *digits = p;
+    while (p < end && *p == '0')
+        p++;
+
+    uint64_t v = 0;
+    const char *significant = p;
+    p = mlc_scan_digits(p, end, &v);
+    if (p == digits)
+        return NULL;
+
+    /* 19 digits never wrap, so the range check is exact */
+    if (p - significant > MLC_NUMBER_MAX_DIGITS)
+        return NULL;
+    if (v > (uint64_t)INT64_MAX + (uint64_t)negative)
+        return NULL;
+
+    *out = negative ? -(int64_t)(v - 1) - 1 : (int64_t)v;
+    return p;
+}
+
+/* Writes the digits of `v`, returning their count */
+static size_t mlc_format_u64(uint64_t v, char *buf) {
+    char tmp[20];
+    size_t i = sizeof(tmp);
+
+    while (v >= 100) {
+        const size_t d = (size_t)(v % 100) * 2;
+        v /= 100;
+        tmp[--i] = mlc_digits2[d + 1];
+        tmp[--i] = mlc_digits2[d];
+    }
+    if (v >= 10) {
+        const size_t d = (size_t)v * 2;
+        tmp[--i] = mlc_digits2[d + 1];
+        tmp[--i] = mlc_digits2[d];
+    } else {
+        tmp[--i] = (char)('0' + v);
+    }
+
+    const size_t len = sizeof(tmp) - i;
+    memcpy(buf, tmp + i, len);
+    return len;
+}
+
+size_t mlc_format_int64(const int64_t val, char *buf) {
+    size_t len = 0;
+    uint64_t v = (uint64_t)val;
+    if (val < 0) {
+        buf[len++] = '-';
+        v = 0 - v;
+    }
+
+    len += mlc_format_u64(v, buf + len);
+    buf[len] = '\0';
+    return len;
+}
+
+/*
+ * 18 or 19 leading decimal digits of the positive finite `val`, such that
+ * val ~= *digits * 10^-*k, from the 128-bit power of ten table.
+ */
+static uint64_t mlc_leading_digits(const double val, int *k) {
+    uint64_t bits;
+    memcpy(&bits, &val, sizeof(bits));
+
+    const int biased = (int)(bits >> 52);
+    uint64_t m = bits & (((uint64_t)1 << 52) - 1);
+    int e = -1074;
+    if (biased) {
+        m |= (uint64_t)1 << 52;
+        e = biased - 1075;
+    }
+
+    /* val = M * 2^E, with the top bit of M set */
+    const int lz = __builtin_clzll(m);
+    const uint64_t M = m << lz;
+    const int64_t E = e - lz;
+
+    /* floor(log10(val)) is d, d + 1 or rarely d + 2 */
+    const int64_t d = ((E + 63) * 78913) >> 18;
+    *k = (int)(17 - d);
+
+    const uint64_t *pow10 = mlc_pow5_table[*k - MLC_POW5_MIN];
+    const int64_t P = ((217706 * (int64_t)*k) >> 16) - 127;
+
+    uint64_t hi, hi2;
+    const uint64_t lo = mlc_mul128(M, pow10[0], &hi);
+    mlc_mul128(M, pow10[1], &hi2);
+    const uint64_t mid = lo + hi2;
+    hi += mid < lo;
+
+    /* val * 10^k = (hi:mid) * 2^(64 + E + P) */
+    const int r = (int)(-(64 + E + P));
+    return r >= 64 ? hi >> (r - 64) : (hi << (64 - r)) | (mid >> r);
+}
+
+/* Number of decimal digits of `v` */
+static int mlc_count_digits(const uint64_t v) {
+    int n = 1;
+    while (n < 20 && v >= mlc_pow10_u64[n])
+        n++;
+    return n;
+}
+
+/* Shortest digits `*w * 10^*q` of the positive finite `val` that round trip */
+static void mlc_shortest(
+    const mlc_binary_format_t *fmt,
+    const double val,
+    uint64_t *w,
+    int *q
+) {
+    uint64_t bits;
+    if (fmt == &mlc_binary32) {
+        const float f = (float)val;
+        uint32_t bits32;
+        memcpy(&bits32, &f, sizeof(bits32));
+        bits = bits32;
+    } else {
+        memcpy(&bits, &val, sizeof(bits));
+    }
+
+    int k;
+    const uint64_t digits = mlc_leading_digits(val, &k);
+    const int n_digits = mlc_count_digits(digits);
+
+    /*
+     * Rounding to n digits gives the nearest n-digit decimal, so the first
+     * rounding that parses back to `val` is also the shortest one. Normal
+     * values are at least `min_digits` precise, so shorter decimals that
+     * round trip are found as `min_digits` ones with trailing zeros.
+     */
+    const int subnormal = !(bits >> fmt->mantissa_bits);
+    for (int n = subnormal ? 1 : fmt->min_digits; n <= fmt->max_digits; n++) {
+        const int drop = n_digits - n;
+        const uint64_t scale = mlc_pow10_u64[drop];
+        uint64_t cand = digits / scale;
+        int exp10 = drop - k;
+        if ((digits % scale) * 2 >= scale)
+            cand++;
+        if (cand == mlc_pow10_u64[n]) {
+            cand /= 10;
+            exp10++;
+        }
+
+        uint64_t parsed;
+        if (!mlc_decimal_to_bits(fmt, cand, exp10, &parsed) && parsed == bits) {
+            while (cand % 10 == 0) {
+                cand /= 10;
+                exp10++;
+            }
+            *w = cand;
+            *q = exp10;
+            return;
+        }
+    }
+
+    /* unreachable in practice, defer to the C library */
+    char buf[MLC_NUMBER_MAX];
+    snprintf(buf, sizeof(buf), "%.*e", fmt->max_digits - 1, val);
+    uint64_t cand = (uint64_t)(buf[0] - '0');
+    for (int i = 2; i <= fmt->max_digits; i++)
+        cand = cand * 10 + (uint64_t)(buf[i] - '0');
+    *w = cand;
+    *q = atoi(buf + fmt->max_digits + 2) - (fmt->max_digits - 1);
+}
+
+static size_t mlc_format_binary(
+    const mlc_binary_format_t *fmt,
+    const double val,
+    char *buf
+) {
+    size_t len = 0;
+
+    if (val != val) {
+        memcpy(buf, "nan", 4);
+        return 3;
+    }
+    if (signbit(val))
+        buf[len++] = '-';
+
+    const double mag = fabs(val);
+    if (mag == HUGE_VAL) {
+        memcpy(buf + len, "inf", 4);
+        return len + 3;
+    }
+    if (mag == 0) {
+        memcpy(buf + len, "0", 2);
+        return len + 1;
+    }
+
+    uint64_t w;
+    int q;
+    mlc_shortest(fmt, mag, &w, &q);
+
+    char digits[20];
+    const int n = (int)mlc_format_u64(w, digits);
+    const int sci = q + n - 1;
+
+    if (sci >= -5 && sci < 17) {
+        if (q >= 0) {
+            /* 1200 */
+            memcpy(buf + len, digits, (size_t)n);
+            len += (size_t)n;
+            memset(buf + len, '0', (size_t)q);
+            len += (size_t)q;
+        } else if (sci >= 0) {
+            /* 12.5 */
+            memcpy(buf + len, digits, (size_t)sci + 1);
+            len += (size_t)sci + 1;
+            buf[len++] = '.';
+            memcpy(buf + len, digits + sci + 1, (size_t)(n - sci - 1));
+            len += (size_t)(n - sci - 1);
+        } else {
+            /* 0.0125 */
+            buf[len++] = '0';
+            buf[len++] = '.';
+            memset(buf + len, '0', (size_t)(-sci - 1));
+            len += (size_t)(-sci - 1);
+            memcpy(buf + len, digits, (size_t)n);
+            len += (size_t)n;
+        }
+    } else {
+        /* 1.25e+21 */
+        buf[len++] = digits[0];
+        if (n > 1) {
+            buf[len++] = '.';
+            memcpy(buf + len, digits + 1, (size_t)n - 1);
+            len += (size_t)n - 1;
+        }
+        buf[len++] = 'e';
+        buf[len++] = sci < 0 ? '-' : '+';
+        len += mlc_format_u64((uint64_t)(sci < 0 ? -sci : sci), buf + len);
+    }
+
+    buf[len] = '\0';
+    return len;
+}
+
+size_t mlc_format_double(const double val, char *buf) {
+    return mlc_format_binary(&mlc_binary64, val, buf);
+}
+
+size_t mlc_format_float(const float val, char *buf) {
+    return mlc_format_binary(&mlc_binary32, val, buf);
+}
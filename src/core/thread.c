@@ -0,0 +1,94 @@
+#include <stddef.h>
+#include <stdlib.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define MLC_THREAD_PTHREAD 1
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#include "core/thread.h"
+
+#define MLC_THREAD_MAX 256
+
+static size_t mlc_thread_n = 0;
+
+typedef struct mlc_parallel {
+    size_t n_tasks;
+    size_t next;
+    mlc_task_fn fn;
+    void *ctx;
+} mlc_parallel_t;
+
+static size_t mlc_thread_detect(void) {
+#ifdef MLC_THREAD_PTHREAD
+    const long n = sysconf(_SC_NPROCESSORS_ONLN);
+    if (n > 0)
+        return n < MLC_THREAD_MAX ? (size_t)n : MLC_THREAD_MAX;
+#endif
+    return 1;
+}
+
+size_t mlc_thread_count(void) {
+    size_t n = __atomic_load_n(&mlc_thread_n, __ATOMIC_RELAXED);
+    if (!n) {
+        n = mlc_thread_detect();
+        __atomic_store_n(&mlc_thread_n, n, __ATOMIC_RELAXED);
+    }
+    return n;
+}
+
+void mlc_thread_set_count(const size_t n_threads) {
+    const size_t n = n_threads < MLC_THREAD_MAX ? n_threads : MLC_THREAD_MAX;
+    __atomic_store_n(&mlc_thread_n, n, __ATOMIC_RELAXED);
+}
+
+/* Runs tasks until none are left */
+static void *mlc_parallel_worker(void *arg) {
+    mlc_parallel_t *par = arg;
+
+    for (;;) {
+        const size_t task = __atomic_fetch_add(&par->next, 1, __ATOMIC_RELAXED);
+        if (task >= par->n_tasks)
+            break;
+        par->fn(par->ctx, task);
+    }
+
+    return NULL;
+}
+
+void mlc_parallel_for(
+    const size_t n_tasks,
+    size_t n_threads,
+    const mlc_task_fn fn,
+    void *ctx
+) {
+    /* args */
+    if (!n_tasks)
+        return;
+    if (!n_threads)
+        n_threads = mlc_thread_count();
+    if (n_threads > n_tasks)
+        n_threads = n_tasks;
+    if (n_threads > MLC_THREAD_MAX)
+        n_threads = MLC_THREAD_MAX;
+
+    mlc_parallel_t par = { n_tasks, 0, fn, ctx };
+
+#ifdef MLC_THREAD_PTHREAD
+    pthread_t threads[MLC_THREAD_MAX];
+    size_t n_started = 0;
+    while (n_started + 1 < n_threads) {
+        if (pthread_create(&threads[n_started], NULL, mlc_parallel_worker, &par))
+            break;
+        n_started++;
+    }
+
+    mlc_parallel_worker(&par);
+
+    for (size_t i = 0; i < n_started; i++)
+        pthread_join(threads[i], NULL);
+#else
+    mlc_parallel_worker(&par);
+#endif
+}
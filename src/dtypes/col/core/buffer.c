@@ -0,0 +1,226 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/alloc.h"
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/buffer.h"
+#include "dtypes/col/core/category.h"
+
+size_t col_data_bytes(const size_t capacity, const size_t stride) {
+    if (!capacity || capacity > SIZE_MAX / stride)
+        return 0;
+
+    const size_t n_bytes = capacity * stride;
+    if (n_bytes > SIZE_MAX - (COL_DATA_ALIGN - 1))
+        return 0;
+
+    return (n_bytes + (COL_DATA_ALIGN - 1)) & ~(size_t)(COL_DATA_ALIGN - 1);
+}
+
+void *col_data_alloc(
+    const mlc_allocator_t *allocator,
+    const size_t capacity,
+    const size_t stride
+) {
+    /* args */
+    const size_t n_bytes = col_data_bytes(capacity, stride);
+    if (!n_bytes)
+        return NULL;
+
+    /* malloc */
+    void *data = mlc_alloc(allocator, n_bytes, COL_DATA_ALIGN);
+    if (!data)
+        return NULL;
+
+    /* assign */
+    const size_t n_used = capacity * stride;
+    memset((char *)data + n_used, 0, n_bytes - n_used);
+
+    return data;
+}
+
+void *col_data_realloc(
+    const mlc_allocator_t *allocator,
+    void *data,
+    const size_t n_bytes,
+    const size_t capacity,
+    const size_t stride
+) {
+    /* args */
+    const size_t new_bytes = col_data_bytes(capacity, stride);
+    if (!new_bytes)
+        return NULL;
+
+    /* malloc */
+    void *tmp_data = mlc_realloc(
+        allocator,
+        data,
+        n_bytes,
+        new_bytes,
+        COL_DATA_ALIGN
+    );
+    if (!tmp_data)
+        return NULL;
+
+    /* assign */
+    const size_t n_used = capacity * stride;
+    memset((char *)tmp_data + n_used, 0, new_bytes - n_used);
+
+    return tmp_data;
+}
+
+void col_data_free(const mlc_allocator_t *allocator, void *data) {
+    mlc_free(allocator, data);
+}
+
+/* Frees storage no column refers to anymore */
+static void col_storage_free(
+    const mlc_allocator_t *allocator,
+    void *data,
+    char *bytes,
+    col_dict_t *dict
+) {
+    col_data_free(allocator, data);
+    mlc_free(allocator, bytes);
+    col_dict_free(dict);
+}
+
+int col_share_acquire(col_t *col) {
+    /* the first clone turns exclusive storage into shared storage */
+    if (!__atomic_load_n(&col->share, __ATOMIC_ACQUIRE)) {
+        col_share_t *share = mlc_alloc(
+            &col->allocator,
+            sizeof(col_share_t),
+            sizeof(size_t)
+        );
+        if (!share)
+            return COL_ERR_OOM;
+        share->refs = 1;
+        share->release = NULL;
+        share->ctx = NULL;
+
+        /* another clone may have raced us to it */
+        col_share_t *expected = NULL;
+        if (!__atomic_compare_exchange_n(
+            &col->share,
+            &expected,
+            share,
+            0,
+            __ATOMIC_ACQ_REL,
+            __ATOMIC_ACQUIRE
+        ))
+            mlc_free(&col->allocator, share);
+    }
+
+    __atomic_add_fetch(&col->share->refs, 1, __ATOMIC_ACQ_REL);
+
+    return COL_ERR_OK;
+}
+
+int col_share_release(col_t *col) {
+    col_share_t *share = col->share;
+    if (!share)
+        return 1;
+
+    col->share = NULL;
+    if (__atomic_sub_fetch(&share->refs, 1, __ATOMIC_ACQ_REL))
+        return 0;
+
+    if (share->release)
+        share->release(share->ctx);
+    mlc_free(&col->allocator, share);
+    return 1;
+}
+
+int col_data_exclusive(col_t *col) {
+    if (col->flags & COL_FLAG_BORROWED)
+        return 0;
+    if (!col->share)
+        return 1;
+
+    /* the other clones are gone, the storage is ours alone */
+    if (__atomic_load_n(&col->share->refs, __ATOMIC_ACQUIRE) == 1) {
+        col_share_release(col);
+        return 1;
+    }
+
+    return 0;
+}
+
+int col_data_detach(col_t *col) {
+    /* args */
+    if (col_data_exclusive(col))
+        return COL_ERR_OK;
+
+    const int borrowed = (col->flags & COL_FLAG_BORROWED) != 0;
+
+    const mlc_allocator_t *allocator = &col->allocator;
+    const size_t n_rows = col->n_rows;
+    const size_t capacity = col->capacity;
+
+    /* alloc */
+    void *tmp_data = NULL;
+    char *tmp_bytes = NULL;
+    col_dict_t *tmp_dict = NULL;
+    size_t n_bytes = 0;
+
+    tmp_data = col_data_alloc(allocator, capacity, col->stride);
+    if (!tmp_data && capacity)
+        goto fail_tmp_data;
+
+    if (col->dtype == COL_DTYPE_STRING) {
+        const size_t *offsets = col->data;
+        for (size_t i = 0; i < n_rows; i++)
+            n_bytes += strlen(col->strbuf.bytes + offsets[i]) + 1;
+
+        tmp_bytes = mlc_alloc(allocator, n_bytes, 1);
+        if (!tmp_bytes && n_bytes)
+            goto fail_tmp_bytes;
+    }
+
+    if (col->dict) {
+        tmp_dict = col_dict_clone(col->dict, allocator);
+        if (!tmp_dict)
+            goto fail_tmp_dict;
+    }
+
+    /* assign */
+    if (col->dtype == COL_DTYPE_STRING) {
+        /* repack only the strings this column references */
+        const size_t *offsets = col->data;
+        size_t *tmp_offsets = tmp_data;
+        size_t len = 0;
+        for (size_t i = 0; i < n_rows; i++) {
+            const char *str = col->strbuf.bytes + offsets[i];
+            const size_t str_len = strlen(str) + 1;
+            memcpy(tmp_bytes + len, str, str_len);
+            tmp_offsets[i] = len;
+            len += str_len;
+        }
+    } else if (n_rows) {
+        memcpy(tmp_data, col->data, n_rows * col->stride);
+    }
+
+    /* the other clones may have been freed meanwhile */
+    const int last = col_share_release(col);
+    if (!borrowed && last)
+        col_storage_free(allocator, col->data, col->strbuf.bytes, col->dict);
+
+    col->data = tmp_data;
+    col->strbuf.bytes = tmp_bytes;
+    col->strbuf.len = n_bytes;
+    col->strbuf.capacity = n_bytes;
+    col->strbuf.waste = 0;
+    col->dict = tmp_dict;
+    col->flags &= ~(uint32_t)COL_FLAG_BORROWED;
+
+    return COL_ERR_OK;
+
+fail_tmp_dict:
+    mlc_free(allocator, tmp_bytes);
+fail_tmp_bytes:
+    col_data_free(allocator, tmp_data);
+fail_tmp_data:
+    return COL_ERR_OOM;
+}
@@ -0,0 +1,374 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/alloc.h"
+#include "core/error.h"
+#include "core/hash.h"
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/accessors.h"
+#include "dtypes/col/core/buffer.h"
+#include "dtypes/col/core/category.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/col/core/modifiers.h"
+#include "dtypes/col/core/strbuf.h"
+#include "dtypes/col/core/validity.h"
+#include "dtypes/col/core/internal.h"
+
+#define COL_DICT_MIN_SLOTS 16
+
+/* Returns the slot holding `val`, or the empty slot where it belongs */
+static size_t col_dict_probe(const col_dict_t *dict, const char *val) {
+    const size_t mask = dict->n_slots - 1;
+    size_t i = mlc_hash_str(val) & mask;
+
+    while (dict->slots[i]) {
+        const char *cur = col_string_at(dict->values, dict->slots[i] - 1, NULL);
+        if (strcmp(cur, val) == 0)
+            break;
+        i = (i + 1) & mask;
+    }
+
+    return i;
+}
+
+static int col_dict_rehash(col_dict_t *dict, const size_t n_slots) {
+    const mlc_allocator_t *allocator = &dict->values->allocator;
+
+    /* malloc */
+    uint32_t *slots = mlc_calloc(allocator, n_slots, sizeof(uint32_t));
+    if (!slots)
+        return COL_ERR_OOM;
+
+    /* assign */
+    mlc_free(allocator, dict->slots);
+    dict->slots = slots;
+    dict->n_slots = n_slots;
+
+    for (size_t i = 0; i < dict->values->n_rows; i++) {
+        const char *val = col_string_at(dict->values, i, NULL);
+        dict->slots[col_dict_probe(dict, val)] = (uint32_t)(i + 1);
+    }
+
+    return COL_ERR_OK;
+}
+
+col_dict_t *col_dict_create(const mlc_allocator_t *allocator) {
+    /* alloc */
+    col_dict_t *dict = mlc_alloc(allocator, sizeof(col_dict_t), sizeof(void *));
+    if (!dict)
+        goto fail_dict;
+
+    dict->values = col_create_with_allocator(
+        "categories",
+        0,
+        COL_DTYPE_STRING,
+        allocator,
+        NULL
+    );
+    if (!dict->values)
+        goto fail_values;
+
+    dict->n_slots = COL_DICT_MIN_SLOTS;
+    dict->slots = mlc_calloc(allocator, dict->n_slots, sizeof(uint32_t));
+    if (!dict->slots)
+        goto fail_slots;
+
+    return dict;
+
+fail_slots:
+    col_free(dict->values);
+fail_values:
+    mlc_free(allocator, dict);
+fail_dict:
+    return NULL;
+}
+
+col_dict_t *col_dict_clone(
+    const col_dict_t *dict,
+    const mlc_allocator_t *allocator
+) {
+    /* alloc */
+    col_dict_t *new_dict = mlc_alloc(
+        allocator,
+        sizeof(col_dict_t),
+        sizeof(void *)
+    );
+    if (!new_dict)
+        goto fail_dict;
+
+    new_dict->values = col_clone_with_allocator(dict->values, allocator, NULL);
+    if (!new_dict->values)
+        goto fail_values;
+
+    new_dict->n_slots = dict->n_slots;
+    new_dict->slots = mlc_alloc(
+        allocator,
+        dict->n_slots * sizeof(uint32_t),
+        sizeof(uint32_t)
+    );
+    if (!new_dict->slots)
+        goto fail_slots;
+
+    /* assign */
+    memcpy(new_dict->slots, dict->slots, dict->n_slots * sizeof(uint32_t));
+
+    return new_dict;
+
+fail_slots:
+    col_free(new_dict->values);
+fail_values:
+    mlc_free(allocator, new_dict);
+fail_dict:
+    return NULL;
+}
+
+col_dict_t *col_dict_wrap(col_t *values) {
+    const mlc_allocator_t *allocator = &values->allocator;
+
+    /* alloc */
+    col_dict_t *dict = mlc_alloc(allocator, sizeof(col_dict_t), sizeof(void *));
+    if (!dict)
+        return NULL;
+
+    /* init */
+    size_t n_slots = COL_DICT_MIN_SLOTS;
+    while (values->n_rows * 2 > n_slots)
+        n_slots *= 2;
+
+    dict->values = values;
+    dict->slots = NULL;
+    dict->n_slots = 0;
+    if (col_dict_rehash(dict, n_slots)) {
+        mlc_free(allocator, dict);
+        return NULL;
+    }
+
+    return dict;
+}
+
+void col_dict_free(col_dict_t *dict) {
+    if (!dict)
+        return;
+
+    /* the values column is freed last, it holds the allocator */
+    col_t *values = dict->values;
+    const mlc_allocator_t *allocator = &values->allocator;
+
+    mlc_free(allocator, dict->slots);
+    mlc_free(allocator, dict);
+    col_free(values);
+}
+
+/* Re-encodes every code with a wider integer type */
+static int col_category_widen(col_t *col, const size_t stride) {
+    /* malloc */
+    if (col->capacity && !col_data_bytes(col->capacity, stride))
+        return COL_ERR_OOM;
+
+    void *data = col_data_alloc(&col->allocator, col->capacity, stride);
+    if (!data && col->capacity)
+        return COL_ERR_OOM;
+
+    /* assign */
+    for (size_t i = 0; i < col->n_rows; i++)
+        col_code_write(data, stride, i, col_code_read(col->data, col->stride, i));
+
+    col_data_free(&col->allocator, col->data);
+    col->data = data;
+    memcpy((void *)&col->stride, &stride, sizeof(size_t));
+
+    return COL_ERR_OK;
+}
+
+int col_category_encode(col_t *col, const char *val, int32_t *code_out) {
+    col_dict_t *dict = col->dict;
+
+    /* lookup */
+    size_t slot = col_dict_probe(dict, val);
+    if (dict->slots[slot]) {
+        *code_out = (int32_t)(dict->slots[slot] - 1);
+        return COL_ERR_OK;
+    }
+
+    /* insert */
+    const size_t n_categories = dict->values->n_rows;
+    if (n_categories >= INT32_MAX)
+        return COL_ERR_OUT_OF_BOUNDS;
+
+    const size_t stride = col_code_stride(n_categories + 1);
+    if (stride > col->stride && col_category_widen(col, stride))
+        return COL_ERR_OOM;
+
+    if ((n_categories + 1) * 2 > dict->n_slots) {
+        if (col_dict_rehash(dict, dict->n_slots * 2))
+            return COL_ERR_OOM;
+        slot = col_dict_probe(dict, val);
+    }
+
+    if (col_append(dict->values, val))
+        return COL_ERR_OOM;
+
+    dict->slots[slot] = (uint32_t)(n_categories + 1);
+    *code_out = (int32_t)n_categories;
+
+    return COL_ERR_OK;
+}
+
+int col_category_adopt(col_t *col, const col_t *src) {
+    /* malloc */
+    col_dict_t *dict = col_dict_clone(src->dict, &col->allocator);
+    if (!dict)
+        return COL_ERR_OOM;
+
+    if (src->stride > col->stride && col_category_widen(col, src->stride)) {
+        col_dict_free(dict);
+        return COL_ERR_OOM;
+    }
+
+    /* assign */
+    col_dict_free(col->dict);
+    col->dict = dict;
+
+    return COL_ERR_OK;
+}
+
+int32_t col_category_code_of(const col_t *col, const char *val, int *err_out) {
+    /* args */
+    if (!col)
+        return mlc_fail_neg(COL_ERR_NO_DATA, err_out);
+    if (col->dtype != COL_DTYPE_CATEGORY)
+        return mlc_fail_neg(COL_ERR_INVALID_DTYPE, err_out);
+    if (!val)
+        return mlc_fail_neg(COL_ERR_NO_DATA, err_out);
+
+    /* lookup */
+    const size_t slot = col_dict_probe(col->dict, val);
+    if (!col->dict->slots[slot])
+        return mlc_fail_neg(COL_ERR_NOT_FOUND, err_out);
+
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    return (int32_t)(col->dict->slots[slot] - 1);
+}
+
+static inline int col_category_row_valid(const col_t *col, const size_t idx) {
+    return !col->validity || col_bit_get(col->validity, idx);
+}
+
+col_t *col_category_from_string(const col_t *col, int *err_out) {
+    /* args */
+    if (!col)
+        return mlc_fail_null(COL_ERR_NO_DATA, err_out);
+    if (col->dtype != COL_DTYPE_STRING)
+        return mlc_fail_null(COL_ERR_INVALID_DTYPE, err_out);
+
+    /* init */
+    int err_code = COL_ERR_OK;
+    col_t *new_col = col_create_with_capacity(
+        col->name,
+        col->n_rows,
+        COL_DTYPE_CATEGORY,
+        &err_code
+    );
+    if (!new_col)
+        return mlc_fail_null(err_code, err_out);
+
+    if (col->validity && col_validity_init(new_col)) {
+        col_free(new_col);
+        return mlc_fail_null(COL_ERR_OOM, err_out);
+    }
+
+    /* assign */
+    for (size_t i = 0; i < col->n_rows; i++) {
+        int32_t code = 0;
+        if (col_category_row_valid(col, i)) {
+            err_code = col_category_encode(
+                new_col,
+                col_string_at(col, i, NULL),
+                &code
+            );
+            if (err_code) {
+                col_free(new_col);
+                return mlc_fail_null(err_code, err_out);
+            }
+        }
+        col_code_write(new_col->data, new_col->stride, i, code);
+        new_col->n_rows += 1;
+    }
+
+    if (col->validity) {
+        memcpy(new_col->validity, col->validity, col_validity_bytes(col->n_rows));
+        new_col->null_count = col->null_count;
+    }
+
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    return new_col;
+}
+
+col_t *col_category_to_string(const col_t *col, int *err_out) {
+    /* args */
+    if (!col)
+        return mlc_fail_null(COL_ERR_NO_DATA, err_out);
+    if (col->dtype != COL_DTYPE_CATEGORY)
+        return mlc_fail_null(COL_ERR_INVALID_DTYPE, err_out);
+
+    /* init */
+    int err_code = COL_ERR_OK;
+    col_t *new_col = col_create_with_capacity(
+        col->name,
+        col->n_rows,
+        COL_DTYPE_STRING,
+        &err_code
+    );
+    if (!new_col)
+        return mlc_fail_null(err_code, err_out);
+
+    /* malloc */
+    const col_t *values = col->dict->values;
+    size_t *lens = malloc((values->n_rows + 1) * sizeof(size_t));
+    if (!lens)
+        goto fail_lens;
+
+    /* null rows decode to an empty string */
+    size_t n_bytes = 0;
+    for (size_t i = 0; i < values->n_rows; i++)
+        lens[i] = strlen(col_string_at(values, i, NULL)) + 1;
+    for (size_t i = 0; i < col->n_rows; i++)
+        n_bytes += col_category_row_valid(col, i)
+            ? lens[col_code_read(col->data, col->stride, i)]
+            : 1;
+
+    if (col_strbuf_reserve(new_col, n_bytes))
+        goto fail_reserve;
+    if (col->validity && col_validity_init(new_col))
+        goto fail_reserve;
+
+    /* assign */
+    size_t *offsets = new_col->data;
+    for (size_t i = 0; i < col->n_rows; i++) {
+        const char *val = col_category_row_valid(col, i)
+            ? col_string_at(values, col_code_read(col->data, col->stride, i), NULL)
+            : "";
+        col_strbuf_push(new_col, val, &offsets[i]);
+    }
+    new_col->n_rows = col->n_rows;
+
+    if (col->validity) {
+        memcpy(new_col->validity, col->validity, col_validity_bytes(col->n_rows));
+        new_col->null_count = col->null_count;
+    }
+
+    free(lens);
+
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    return new_col;
+
+fail_reserve:
+    free(lens);
+fail_lens:
+    col_free(new_col);
+    return mlc_fail_null(COL_ERR_OOM, err_out);
+}
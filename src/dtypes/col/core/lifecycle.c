@@ -2,9 +2,14 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "core/alloc.h"
 #include "core/error.h"
 #include "dtypes/col/core/type.h"
+#include "dtypes/col/core/buffer.h"
+#include "dtypes/col/core/category.h"
 #include "dtypes/col/core/lifecycle.h"
+#include "dtypes/col/core/strbuf.h"
+#include "dtypes/col/core/validity.h"
 #include "dtypes/col/core/internal.h"
 
 static col_err_t col_args_validate(
@@ -27,53 +32,169 @@ static col_err_t col_args_validate(
 static col_t *col_init(
     const char *name, 
     const size_t n_rows,
-    const col_dtype_t dtype
+    const size_t capacity,
+    const col_dtype_t dtype,
+    const mlc_allocator_t *allocator
 ) {
     const size_t stride = col_dtype_stride(dtype);
+    if (!allocator)
+        allocator = mlc_allocator_global();
 
     /* alloc */
-
-    struct col *col = malloc(sizeof(struct col));
+    char *tmp_name = NULL;
+    void *tmp_data = NULL;
+    col_dict_t *tmp_dict = NULL;
+
+    struct col *col = mlc_alloc(
+        allocator,
+        sizeof(struct col),
+        sizeof(void *)
+    );
     if (!col)
         goto fail_col;
 
-    void *tmp_data = n_rows ? malloc(n_rows * stride) : NULL;
-    if (!tmp_data && n_rows)
+    if (capacity && !col_data_bytes(capacity, stride))
         goto fail_tmp_data;
 
-    char *tmp_name = strdup(name);
+    tmp_data = col_data_alloc(allocator, capacity, stride);
+    if (!tmp_data && capacity)
+        goto fail_tmp_data;
+
+    tmp_name = mlc_strdup(allocator, name);
     if (!tmp_name)
         goto fail_tmp_name;
 
+    if (dtype == COL_DTYPE_CATEGORY) {
+        tmp_dict = col_dict_create(allocator);
+        if (!tmp_dict)
+            goto fail_tmp_dict;
+    }
+
     /* init */
     struct col tmp_col = { 
         tmp_name, 
         tmp_data, 
         n_rows, 
+        capacity,
         dtype, 
-        stride 
+        stride,
+        { NULL, 0, 0, 0 },
+        tmp_dict,
+        NULL,
+        0,
+        0,
+        NULL,
+        *allocator
     };
     memcpy(col, &tmp_col, sizeof(struct col));
 
     return col;
 
+fail_tmp_dict:
 fail_tmp_name:
-    free(tmp_name);
+    mlc_free(allocator, tmp_name);
 fail_tmp_data:
-    free(tmp_data);
+    col_data_free(allocator, tmp_data);
 fail_col:
-    free(col);
+    mlc_free(allocator, col);
+    return NULL;
+}
+
+/* Creates a column over rows `[start, start + len)` of `col`'s storage */
+static col_t *col_view_init(
+    const col_t *col,
+    const size_t start,
+    const size_t len,
+    const mlc_allocator_t *allocator
+) {
+    /* alloc */
+    char *tmp_name = NULL;
+
+    struct col *view = mlc_alloc(
+        allocator,
+        sizeof(struct col),
+        sizeof(void *)
+    );
+    if (!view)
+        goto fail_view;
+
+    tmp_name = mlc_strdup(allocator, col->name);
+    if (!tmp_name)
+        goto fail_tmp_name;
+
+    /* init */
+    struct col tmp_col = {
+        tmp_name,
+        col->data ? (char *)col->data + (col->stride * start) : NULL,
+        len,
+        len,
+        col->dtype,
+        col->stride,
+        col->strbuf,
+        col->dict,
+        NULL,
+        0,
+        COL_FLAG_BORROWED,
+        NULL,
+        *allocator
+    };
+    memcpy(view, &tmp_col, sizeof(struct col));
+
+    /* validity bits are not byte aligned at `start`, so they are copied */
+    const size_t null_count = col_validity_count(col, start, len);
+    if (null_count) {
+        if (col_validity_init(view))
+            goto fail_validity;
+        for (size_t i = 0; i < len; i++)
+            col_bit_set(view->validity, i, col_bit_get(col->validity, start + i));
+        view->null_count = null_count;
+    }
+
+    /* released borrowed storage, like a mapped file, stays alive for us */
+    const int counted = (col->flags & COL_FLAG_BORROWED) && col->share;
+    if (counted) {
+        if (col_share_acquire((col_t *)col))
+            goto fail_share;
+        view->share = col->share;
+    }
+
+    return view;
+
+fail_share:
+    mlc_free(allocator, view->validity);
+fail_validity:
+    mlc_free(allocator, tmp_name);
+fail_tmp_name:
+    mlc_free(allocator, view);
+fail_view:
     return NULL;
 }
 
 static int col_data_fill(col_t *col, const void *data){
     if (col->dtype == COL_DTYPE_STRING) {
         const char **src = (const char **)data;
-        char **dst = col->data;
-        for (size_t i = 0; i < col->n_rows; i++) {
-            dst[i] = strdup(src[i]);
-            if (!dst[i])
+        size_t *dst = col->data;
+
+        size_t n_bytes = 0;
+        for (size_t i = 0; i < col->n_rows; i++)
+            n_bytes += strlen(src[i]) + 1;
+        if (col_strbuf_reserve(col, n_bytes))
+            return COL_ERR_OOM;
+
+        for (size_t i = 0; i < col->n_rows; i++)
+            col_strbuf_push(col, src[i], &dst[i]);
+    } else if (col->dtype == COL_DTYPE_CATEGORY) {
+        const char **src = (const char **)data;
+        const size_t n_rows = col->n_rows;
+
+        /* encoding may widen the codes, so only count filled rows */
+        col->n_rows = 0;
+        for (size_t i = 0; i < n_rows; i++) {
+            int32_t code;
+            if (col_category_encode(col, src[i], &code))
                 return COL_ERR_OOM;
+            col_code_write(col->data, col->stride, i, code);
+            col->n_rows += 1;
         }
     } else {
         memcpy(col->data, data, col->n_rows * col->stride);
@@ -86,6 +207,25 @@ col_t *col_create(
     const char *name,
     const col_dtype_t dtype,
     int *err_out
+) {
+    return col_create_with_allocator(name, 0, dtype, NULL, err_out);
+}
+
+col_t *col_create_with_capacity(
+    const char *name,
+    const size_t capacity,
+    const col_dtype_t dtype,
+    int *err_out
+) {
+    return col_create_with_allocator(name, capacity, dtype, NULL, err_out);
+}
+
+col_t *col_create_with_allocator(
+    const char *name,
+    const size_t capacity,
+    const col_dtype_t dtype,
+    const mlc_allocator_t *allocator,
+    int *err_out
 ) {
     /* args */ 
     enum col_err err_code = col_args_validate(name, NULL, 0, dtype, 0);
@@ -93,7 +233,7 @@ col_t *col_create(
         return mlc_fail_null(err_code, err_out);
 
     /* init */
-    struct col *col = col_init(name, 0, dtype);
+    struct col *col = col_init(name, 0, capacity, dtype, allocator);
     if (!col)
         return mlc_fail_null(COL_ERR_OOM, err_out);
 
@@ -106,6 +246,24 @@ col_t *col_create_array(
     const size_t n_rows, 
     const col_dtype_t dtype,
     int *err_out
+) {
+    return col_create_array_with_allocator(
+        name,
+        data,
+        n_rows,
+        dtype,
+        NULL,
+        err_out
+    );
+}
+
+col_t *col_create_array_with_allocator(
+    const char *name,
+    const void *data, 
+    const size_t n_rows, 
+    const col_dtype_t dtype,
+    const mlc_allocator_t *allocator,
+    int *err_out
 ) {
     /* args */ 
     enum col_err err_code = col_args_validate(name, data, n_rows, dtype, 1);
@@ -113,7 +271,7 @@ col_t *col_create_array(
         return mlc_fail_null(err_code, err_out);
 
     /* init */ 
-    struct col *col = col_init(name, n_rows, dtype);
+    struct col *col = col_init(name, n_rows, n_rows, dtype, allocator);
     if (!col)
         return mlc_fail_null(COL_ERR_OOM, err_out);
 
@@ -127,78 +285,351 @@ col_t *col_create_array(
     return col;
 }
 
+col_t *col_wrap(
+    const char *name,
+    const void *data,
+    const size_t n_rows,
+    const col_dtype_t dtype,
+    int *err_out
+) {
+    /* args */
+    enum col_err err_code = col_args_validate(name, data, n_rows, dtype, 1);
+    if (err_code)
+        return mlc_fail_null(err_code, err_out);
+    if (!col_dtype_is_numeric(dtype))
+        return mlc_fail_null(COL_ERR_INVALID_DTYPE, err_out);
+
+    /* init */
+    const size_t stride = col_dtype_stride(dtype);
+    const struct col src = {
+        (char *)name,
+        (void *)data,
+        n_rows,
+        n_rows,
+        dtype,
+        stride,
+        { NULL, 0, 0, 0 },
+        NULL,
+        NULL,
+        0,
+        0,
+        NULL,
+        *mlc_allocator_global()
+    };
+    struct col *col = col_view_init(&src, 0, n_rows, mlc_allocator_global());
+    if (!col)
+        return mlc_fail_null(COL_ERR_OOM, err_out);
+
+    return col;
+}
+
+col_t *col_slice(
+    const col_t *col,
+    const size_t start,
+    const size_t len,
+    int *err_out
+) {
+    /* args */
+    if (!col)
+        return mlc_fail_null(COL_ERR_NO_DATA, err_out);
+    if (start > col->n_rows || len > col->n_rows - start)
+        return mlc_fail_null(COL_ERR_OUT_OF_BOUNDS, err_out);
+
+    /* init */
+    struct col *view = col_view_init(col, start, len, &col->allocator);
+    if (!view)
+        return mlc_fail_null(COL_ERR_OOM, err_out);
+
+    return view;
+}
+
+static int col_allocator_equal(
+    const mlc_allocator_t *a,
+    const mlc_allocator_t *b
+) {
+    return a->alloc == b->alloc
+        && a->realloc == b->realloc
+        && a->free == b->free
+        && a->ctx == b->ctx;
+}
+
+/* Creates a clone sharing the storage of `col` until either is mutated */
+static col_t *col_clone_shared(const col_t *col) {
+    const mlc_allocator_t *allocator = &col->allocator;
+
+    /* alloc */
+    char *tmp_name = NULL;
+    uint8_t *tmp_validity = NULL;
+
+    struct col *new_col = mlc_alloc(
+        allocator,
+        sizeof(struct col),
+        sizeof(void *)
+    );
+    if (!new_col)
+        goto fail_new_col;
+
+    const size_t n_validity = col_validity_bytes(col->n_rows);
+    if (col->validity) {
+        tmp_validity = mlc_alloc(allocator, n_validity, 1);
+        if (!tmp_validity)
+            goto fail_tmp_validity;
+    }
+
+    tmp_name = mlc_strdup(allocator, col->name);
+    if (!tmp_name)
+        goto fail_tmp_name;
+
+    /* the source is logically unchanged, only its share count grows */
+    if (col_share_acquire((col_t *)col))
+        goto fail_share;
+
+    /* assign */
+    if (tmp_validity)
+        memcpy(tmp_validity, col->validity, n_validity);
+
+    memcpy(new_col, col, sizeof(struct col));
+    new_col->name = tmp_name;
+    new_col->capacity = col->n_rows;
+    new_col->validity = tmp_validity;
+
+    return new_col;
+
+fail_share:
+    mlc_free(allocator, tmp_name);
+fail_tmp_name:
+    mlc_free(allocator, tmp_validity);
+fail_tmp_validity:
+    mlc_free(allocator, new_col);
+fail_new_col:
+    return NULL;
+}
+
 col_t *col_clone(const col_t *col, int *err_out) {
+    return col_clone_with_allocator(col, NULL, err_out);
+}
+
+col_t *col_clone_with_allocator(
+    const col_t *col,
+    const mlc_allocator_t *allocator,
+    int *err_out
+) {
     /* args */
     if (!col)
         return mlc_fail_null(COL_ERR_NO_DATA, err_out);
+    if (!allocator)
+        allocator = &col->allocator;
 
+    /* empty columns clone too, as rows are only required when counted */
     enum col_err err_code = col_args_validate(
         col->name, 
         col->data, 
         col->n_rows, 
         col->dtype, 
-        1
+        col->n_rows != 0
     );
     if (err_code)
         return mlc_fail_null(err_code, err_out);
 
+    /* a plain borrowed column copies only the strings it references */
+    if ((col->flags & COL_FLAG_BORROWED) && !col->share) {
+        struct col *view = col_view_init(col, 0, col->n_rows, allocator);
+        if (!view || col_data_detach(view)) {
+            col_free(view);
+            return mlc_fail_null(COL_ERR_OOM, err_out);
+        }
+        return view;
+    }
+
+    if (col_allocator_equal(allocator, &col->allocator)) {
+        struct col *new_col = col_clone_shared(col);
+        if (!new_col)
+            return mlc_fail_null(COL_ERR_OOM, err_out);
+        return new_col;
+    }
+
     /* alloc */
     err_code = COL_ERR_OOM;
 
-    struct col *new_col = malloc(sizeof(struct col));
+    char *tmp_name = NULL;
+    void *tmp_data = NULL;
+    char *tmp_bytes = NULL;
+    col_dict_t *tmp_dict = NULL;
+    uint8_t *tmp_validity = NULL;
+
+    struct col *new_col = mlc_alloc(
+        allocator,
+        sizeof(struct col),
+        sizeof(void *)
+    );
     if (!new_col)
         goto fail_new_col;
 
-    void *tmp_data = col->n_rows ? malloc(col->n_rows * col->stride) : NULL;
+    tmp_data = col_data_alloc(allocator, col->n_rows, col->stride);
     if (!tmp_data && col->n_rows)
         goto fail_tmp_data;
 
-    char *tmp_name = strdup(col->name);
+    const size_t n_bytes = col->strbuf.len;
+    if (n_bytes) {
+        tmp_bytes = mlc_alloc(allocator, n_bytes, 1);
+        if (!tmp_bytes)
+            goto fail_tmp_bytes;
+    }
+
+    if (col->dict) {
+        tmp_dict = col_dict_clone(col->dict, allocator);
+        if (!tmp_dict)
+            goto fail_tmp_dict;
+    }
+
+    const size_t n_validity = col_validity_bytes(col->n_rows);
+    if (col->validity) {
+        tmp_validity = mlc_alloc(allocator, n_validity, 1);
+        if (!tmp_validity)
+            goto fail_tmp_validity;
+    }
+
+    tmp_name = mlc_strdup(allocator, col->name);
     if (!tmp_name)
         goto fail_tmp_name;
 
     /* assign */
+    if (col->n_rows)
+        memcpy(tmp_data, col->data, col->n_rows * col->stride);
+    if (n_bytes)
+        memcpy(tmp_bytes, col->strbuf.bytes, n_bytes);
+    if (tmp_validity)
+        memcpy(tmp_validity, col->validity, n_validity);
+
     memcpy(new_col, col, sizeof(struct col));
     new_col->name = tmp_name;
     new_col->data = tmp_data;
-
-    tmp_name = NULL;
-    tmp_data = NULL;
-
-    err_code = col_data_fill(new_col, col->data);
-    if (err_code)
-        goto fail_fill;
+    new_col->capacity = col->n_rows;
+    new_col->strbuf.bytes = tmp_bytes;
+    new_col->strbuf.capacity = n_bytes;
+    new_col->dict = tmp_dict;
+    new_col->validity = tmp_validity;
+    new_col->flags = 0;
+    new_col->share = NULL;
+    new_col->allocator = *allocator;
 
     return new_col;
 
-fail_fill:
 fail_tmp_name:
-    free(tmp_name);
+    mlc_free(allocator, tmp_name);
+    mlc_free(allocator, tmp_validity);
+fail_tmp_validity:
+    col_dict_free(tmp_dict);
+fail_tmp_dict:
+fail_tmp_bytes:
+    mlc_free(allocator, tmp_bytes);
 fail_tmp_data:
-    free(tmp_data);
+    col_data_free(allocator, tmp_data);
 fail_new_col:
-    free(new_col);
+    mlc_free(allocator, new_col);
     return mlc_fail_null(err_code, err_out);
 }
 
+int col_reserve(col_t *col, const size_t capacity) {
+    /* args */
+    if (!col)
+        return COL_ERR_NO_DATA;
+    if (capacity <= col->capacity)
+        return COL_ERR_OK;
+    if (!col_data_bytes(capacity, col->stride))
+        return COL_ERR_OOM;
+
+    /* malloc */
+    if (col_data_detach(col))
+        return COL_ERR_OOM;
+    if (col_validity_reserve(col, capacity))
+        return COL_ERR_OOM;
+
+    void *tmp_data = col_data_realloc(
+        &col->allocator,
+        col->data,
+        col->n_rows * col->stride,
+        capacity,
+        col->stride
+    );
+    if (!tmp_data)
+        return COL_ERR_OOM;
+
+    /* assign */
+    col->data = tmp_data;
+    col->capacity = capacity;
+
+    return COL_ERR_OK;
+}
+
+int col_shrink_to_fit(col_t *col) {
+    /* args */
+    if (!col)
+        return COL_ERR_NO_DATA;
+
+    /* borrowed or shared storage is not ours to shrink */
+    if (!col_data_exclusive(col))
+        return COL_ERR_OK;
+
+    if (col->dtype == COL_DTYPE_STRING && col_strbuf_compact(col, 1))
+        return COL_ERR_OOM;
+
+    if (col->capacity == col->n_rows)
+        return COL_ERR_OK;
+
+    if (!col->n_rows) {
+        col_data_free(&col->allocator, col->data);
+        col->data = NULL;
+        col->capacity = 0;
+        return col_validity_reserve(col, 0);
+    }
+
+    /* malloc */
+    void *tmp_data = col_data_realloc(
+        &col->allocator,
+        col->data,
+        col->n_rows * col->stride,
+        col->n_rows,
+        col->stride
+    );
+    if (!tmp_data)
+        return COL_ERR_OOM;
+
+    /* assign */
+    col->data = tmp_data;
+    col->capacity = col->n_rows;
+
+    /* a bitmap larger than the capacity is still consistent */
+    return col_validity_reserve(col, col->n_rows);
+}
+
 int col_free(col_t *col) {
     if (!col)
         return COL_ERR_NO_DATA;
 
+    /* the column itself is released last, through its own allocator */
+    const mlc_allocator_t allocator = col->allocator;
+
     if (col->name)
-        free(col->name);
-
-    if (col->data) {
-        if (col->dtype == COL_DTYPE_STRING) {
-            char **data = col->data;
-            for (size_t i = 0; i < col->n_rows; i++)
-                if (data[i])
-                    free(data[i]);
-        }
-        free(col->data);
-    }
+        mlc_free(&allocator, col->name);
+
+    /* borrowed storage is left to its owner, shared to the last clone */
+    const int last = col_share_release(col);
+    const int owned = !(col->flags & COL_FLAG_BORROWED) && last;
+
+    if (col->data && owned)
+        col_data_free(&allocator, col->data);
+
+    if (col->strbuf.bytes && owned)
+        mlc_free(&allocator, col->strbuf.bytes);
+
+    if (col->dict && owned)
+        col_dict_free(col->dict);
+
+    if (col->validity)
+        mlc_free(&allocator, col->validity);
 
-    free(col);
+    mlc_free(&allocator, col);
 
     return COL_ERR_OK;
 }
@@ -2,11 +2,63 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "core/alloc.h"
 #include "core/error.h"
 #include "dtypes/col/core/type.h"
+#include "dtypes/col/core/accessors.h"
+#include "dtypes/col/core/buffer.h"
+#include "dtypes/col/core/category.h"
+#include "dtypes/col/core/lifecycle.h"
 #include "dtypes/col/core/modifiers.h"
+#include "dtypes/col/core/strbuf.h"
+#include "dtypes/col/core/validity.h"
 #include "dtypes/col/core/internal.h"
 
+/* Grows geometrically so that `n` more rows fit */
+static int col_rows_reserve(col_t *col, const size_t n) {
+    if (n > SIZE_MAX - col->n_rows)
+        return COL_ERR_OOM;
+    if (col->n_rows + n <= col->capacity)
+        return COL_ERR_OK;
+
+    const size_t capacity = col_capacity_grow(col->capacity, col->n_rows + n);
+    return col_reserve(col, capacity);
+}
+
+/* Drops the payload and null count of rows that are about to be removed */
+static void col_rows_release(col_t *col, const size_t idx, const size_t n) {
+    if (col->dtype == COL_DTYPE_STRING)
+        col_strbuf_release(col, idx, n);
+    col->null_count -= col_validity_count(col, idx, n);
+}
+
+/* Moves `n` rows and their validity bits, like `memmove` */
+static void col_rows_move(
+    col_t *col,
+    const size_t dst,
+    const size_t src,
+    const size_t n
+) {
+    if (dst == src || !n)
+        return;
+
+    memmove(
+        (char *)col->data + (col->stride * dst),
+        (char *)col->data + (col->stride * src),
+        col->stride * n
+    );
+    col_validity_move(col, dst, src, n);
+}
+
+/* Marks rows as valid after a value was written to them */
+static void col_rows_validate(col_t *col, const size_t idx, const size_t n) {
+    if (!col->validity)
+        return;
+
+    col->null_count -= col_validity_count(col, idx, n);
+    col_validity_fill(col, idx, n, 1);
+}
+
 int col_set(col_t *col, const void *val, const size_t idx) {
     /* args */
     if (idx >= col->n_rows)
@@ -14,18 +66,31 @@ int col_set(col_t *col, const void *val, const size_t idx) {
     if (!val)
         return COL_ERR_NO_DATA;
 
+    /* malloc */
+    if (col_data_detach(col))
+        return COL_ERR_OOM;
+
     /* assign */
     if (col->dtype == COL_DTYPE_STRING) {
-        char *buf = strdup(val);
-        if (!buf)
+        size_t offset;
+        if (col_strbuf_push(col, val, &offset))
             return COL_ERR_OOM;
 
-        free(((char **)col->data)[idx]);
-        ((char **)col->data)[idx] = buf;
+        col_rows_release(col, idx, 1);
+        ((size_t *)col->data)[idx] = offset;
+    } else if (col->dtype == COL_DTYPE_CATEGORY) {
+        int32_t code;
+        const int err_code = col_category_encode(col, val, &code);
+        if (err_code)
+            return err_code;
+
+        col_code_write(col->data, col->stride, idx, code);
     } else {
         memcpy((char *)col->data + (col->stride * idx), val, col->stride);
     }
 
+    col_rows_validate(col, idx, 1);
+
     return COL_ERR_OK;
 }
 
@@ -35,79 +100,491 @@ int col_append(col_t *col, const void *val) {
         return COL_ERR_NO_DATA;
 
     /* malloc */
-    char *strbuf = NULL;
-    if (col->dtype == COL_DTYPE_STRING) {
-        strbuf = strdup(val);
-        if (!strbuf)
-            goto fail_strbuf;
-    }
-
-    void *tmp_data = realloc(col->data, (col->n_rows + 1) * col->stride);
-    if (!tmp_data)
-        goto fail_tmp_data;
+    if (col_data_detach(col) || col_rows_reserve(col, 1))
+        return COL_ERR_OOM;
 
     /* assign */
-    col->data = tmp_data;
+    if (col->dtype == COL_DTYPE_STRING) {
+        size_t offset;
+        if (col_strbuf_push(col, val, &offset))
+            return COL_ERR_OOM;
 
-    if (col->dtype == COL_DTYPE_STRING) 
-        ((char **)col->data)[col->n_rows] = strbuf;
-    else
+        ((size_t *)col->data)[col->n_rows] = offset;
+    } else if (col->dtype == COL_DTYPE_CATEGORY) {
+        int32_t code;
+        const int err_code = col_category_encode(col, val, &code);
+        if (err_code)
+            return err_code;
+
+        col_code_write(col->data, col->stride, col->n_rows, code);
+    } else {
         memcpy(
             (char *)col->data + (col->stride * col->n_rows),
             val,
             col->stride
         );
+    }
+
+    if (col->validity)
+        col_validity_fill(col, col->n_rows, 1, 1);
 
     col->n_rows += 1;
 
     return COL_ERR_OK;
-
-fail_tmp_data:
-fail_strbuf:
-    free(strbuf);
-    return COL_ERR_OOM;
 }
 
-int col_remove(col_t *col, const size_t idx) {
+int col_set_null(col_t *col, const size_t idx) {
     /* args */
     if (idx >= col->n_rows)
         return COL_ERR_OUT_OF_BOUNDS;
 
+    /* malloc */
+    if (col_validity_init(col))
+        return COL_ERR_OOM;
+
     /* assign */
-    if (col->dtype == COL_DTYPE_STRING)
-        free(((char **)col->data)[idx]);
+    if (col_bit_get(col->validity, idx)) {
+        col_bit_set(col->validity, idx, 0);
+        col->null_count += 1;
+    }
 
-    memmove(
-        (char *)col->data + (col->stride * idx),
-        (char *)col->data + (col->stride * (idx + 1)),
-        col->stride * (col->n_rows - idx - 1)
-    );
+    return COL_ERR_OK;
+}
+
+int col_append_null(col_t *col) {
+    /* malloc */
+    if (col_data_detach(col) || col_rows_reserve(col, 1))
+        return COL_ERR_OOM;
+    if (col_validity_init(col))
+        return COL_ERR_OOM;
+
+    /* assign */
+    if (col->dtype == COL_DTYPE_STRING) {
+        size_t offset;
+        if (col_strbuf_push(col, "", &offset))
+            return COL_ERR_OOM;
+
+        ((size_t *)col->data)[col->n_rows] = offset;
+    } else {
+        /* category nulls hold code 0, which is never looked up */
+        memset((char *)col->data + (col->stride * col->n_rows), 0, col->stride);
+    }
+
+    col_bit_set(col->validity, col->n_rows, 0);
+    col->null_count += 1;
+    col->n_rows += 1;
+
+    return COL_ERR_OK;
+}
 
-    col->n_rows -= 1;
+/**
+ * @brief Copies the strings that point into a string buffer, which growing
+ * or compacting it would invalidate. This serves as a helper for internal
+ * use.
+ *
+ * @param buf Target `col_strbuf_t` that is about to grow.
+ * @param strs Pointer to the strings, redirected to the copy if any string
+ * needed one.
+ * @param n Number of strings.
+ * @param copy_out Receives the copy to free, or NULL if none was made.
+ * @return Zero on success. Non-zero on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+static int col_strings_unalias(
+    const col_strbuf_t *buf,
+    const char *const **strs,
+    const size_t n,
+    void **copy_out
+) {
+    const char *const *src = *strs;
+    *copy_out = NULL;
 
-    if (col->n_rows == 0)
+    /* args */
+    if (!buf->bytes)
+        return COL_ERR_OK;
+
+    size_t n_bytes = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (src[i] >= buf->bytes && src[i] < buf->bytes + buf->len)
+            n_bytes += strlen(src[i]) + 1;
+    }
+    if (!n_bytes)
         return COL_ERR_OK;
 
-    /* ?malloc */
-    void *tmp_data = realloc(col->data, (col->n_rows) * col->stride);
-    if (tmp_data)
-        col->data = tmp_data;
+    /* malloc: the pointers, followed by the bytes of the copied strings */
+    const char **copy = malloc((n * sizeof(char *)) + n_bytes);
+    if (!copy)
+        return COL_ERR_OOM;
+
+    /* assign */
+    char *bytes = (char *)(copy + n);
+    for (size_t i = 0; i < n; i++) {
+        copy[i] = src[i];
+        if (src[i] >= buf->bytes && src[i] < buf->bytes + buf->len) {
+            const size_t len = strlen(src[i]) + 1;
+            memcpy(bytes, src[i], len);
+            copy[i] = bytes;
+            bytes += len;
+        }
+    }
+
+    *strs = copy;
+    *copy_out = copy;
+
+    return COL_ERR_OK;
+}
+
+/* Encodes every label first, since encoding may widen the codes */
+static int col_category_insert_range(
+    col_t *col,
+    const size_t idx,
+    const char *const *data,
+    const size_t n
+) {
+    /* malloc: encoding may grow the dictionary that labels point into */
+    void *copy;
+    if (col_strings_unalias(&col->dict->values->strbuf, &data, n, &copy))
+        return COL_ERR_OOM;
+
+    int32_t *codes = malloc(n * sizeof(int32_t));
+    if (!codes) {
+        free(copy);
+        return COL_ERR_OOM;
+    }
+
+    int err_code = COL_ERR_OK;
+    for (size_t i = 0; i < n && !err_code; i++)
+        err_code = col_category_encode(col, data[i], &codes[i]);
+    free(copy);
+    if (!err_code)
+        err_code = col_rows_reserve(col, n);
+    if (err_code) {
+        free(codes);
+        return err_code;
+    }
+
+    /* assign */
+    col_rows_move(col, idx + n, idx, col->n_rows - idx);
+    for (size_t i = 0; i < n; i++)
+        col_code_write(col->data, col->stride, idx + i, codes[i]);
+
+    if (col->validity)
+        col_validity_fill(col, idx, n, 1);
+
+    col->n_rows += n;
+
+    free(codes);
+
+    return COL_ERR_OK;
+}
+
+/* Translates the codes of `src` through a mapping into `dst`'s dictionary */
+static int col_category_concat(col_t *dst, const col_t *src) {
+    const col_t *values = src->dict->values;
+    const size_t n_rows = src->n_rows;
+
+    /* malloc */
+    int32_t *map = malloc((values->n_rows + 1) * sizeof(int32_t));
+    if (!map)
+        return COL_ERR_OOM;
+
+    int err_code = COL_ERR_OK;
+    for (size_t i = 0; i < values->n_rows && !err_code; i++)
+        err_code = col_category_encode(
+            dst,
+            col_string_at(values, i, NULL),
+            &map[i]
+        );
+    if (err_code) {
+        free(map);
+        return err_code;
+    }
+
+    /* assign */
+    for (size_t i = 0; i < n_rows; i++) {
+        const int32_t code = col_code_read(src->data, src->stride, i);
+        const int valid = !src->validity || col_bit_get(src->validity, i);
+        col_code_write(
+            dst->data,
+            dst->stride,
+            dst->n_rows + i,
+            valid ? map[code] : 0
+        );
+    }
+
+    dst->n_rows += n_rows;
+
+    free(map);
 
     return COL_ERR_OK;
 }
 
+int col_insert_range(
+    col_t *col,
+    const size_t idx,
+    const void *data,
+    const size_t n
+) {
+    /* args */
+    if (idx > col->n_rows)
+        return COL_ERR_OUT_OF_BOUNDS;
+    if (!data)
+        return COL_ERR_NO_DATA;
+    if (!n)
+        return COL_ERR_OK;
+    if (col_data_detach(col))
+        return COL_ERR_OOM;
+
+    if (col->dtype == COL_DTYPE_CATEGORY)
+        return col_category_insert_range(col, idx, data, n);
+
+    /* malloc */
+    if (col_rows_reserve(col, n))
+        return COL_ERR_OOM;
+
+    const char *const *strs = data;
+    void *copy = NULL;
+    if (col->dtype == COL_DTYPE_STRING) {
+        if (col_strings_unalias(&col->strbuf, &strs, n, &copy))
+            return COL_ERR_OOM;
+
+        size_t n_bytes = 0;
+        for (size_t i = 0; i < n; i++)
+            n_bytes += strlen(strs[i]) + 1;
+        if (col_strbuf_reserve(col, n_bytes)) {
+            free(copy);
+            return COL_ERR_OOM;
+        }
+    }
+
+    /* assign */
+    col_rows_move(col, idx + n, idx, col->n_rows - idx);
+
+    char *dst = (char *)col->data + (col->stride * idx);
+    if (col->dtype == COL_DTYPE_STRING) {
+        size_t *offsets = (size_t *)dst;
+        for (size_t i = 0; i < n; i++)
+            col_strbuf_push(col, strs[i], &offsets[i]);
+        free(copy);
+    } else {
+        memcpy(dst, data, col->stride * n);
+    }
+
+    if (col->validity)
+        col_validity_fill(col, idx, n, 1);
+
+    col->n_rows += n;
+
+    return COL_ERR_OK;
+}
+
+int col_extend(col_t *col, const void *data, const size_t n) {
+    return col_insert_range(col, col->n_rows, data, n);
+}
+
+/* Copies the strings of `src` after the rows of `dst` */
+static int col_string_concat(col_t *dst, const col_t *src) {
+    const size_t n_rows = src->n_rows;
+
+    /* malloc */
+    if (col_strbuf_reserve(dst, src->strbuf.len - src->strbuf.waste))
+        return COL_ERR_OOM;
+
+    /* assign */
+    const size_t *src_offsets = src->data;
+    size_t *dst_offsets = (size_t *)dst->data + dst->n_rows;
+
+    if (src != dst && !src->strbuf.waste && !(src->flags & COL_FLAG_BORROWED)) {
+        /* the live bytes are already packed, copy them as one block */
+        const size_t base = dst->strbuf.len;
+        memcpy(dst->strbuf.bytes + base, src->strbuf.bytes, src->strbuf.len);
+        dst->strbuf.len += src->strbuf.len;
+        for (size_t i = 0; i < n_rows; i++)
+            dst_offsets[i] = base + src_offsets[i];
+    } else {
+        for (size_t i = 0; i < n_rows; i++)
+            col_strbuf_push(
+                dst,
+                src->strbuf.bytes + src_offsets[i],
+                &dst_offsets[i]
+            );
+    }
+
+    dst->n_rows += n_rows;
+
+    return COL_ERR_OK;
+}
+
+/* Appends the rows of `src`, which may be `dst` itself but no other view
+ * of its rows */
+static int col_concat_rows(col_t *dst, const col_t *src) {
+    /* 
+     * Reserve before reading `src->data` since `src` may alias `dst`,
+     * in which case growing would invalidate the source pointers.
+     */
+    const size_t n_rows = src->n_rows;
+    const size_t dst_rows = dst->n_rows;
+    const size_t src_nulls = src->null_count;
+    if (col_data_detach(dst) || col_rows_reserve(dst, n_rows))
+        return COL_ERR_OOM;
+    if (src_nulls && col_validity_init(dst))
+        return COL_ERR_OOM;
+
+    /* assign */
+    int err_code;
+    if (dst->dtype == COL_DTYPE_CATEGORY)
+        err_code = col_category_concat(dst, src);
+    else if (dst->dtype == COL_DTYPE_STRING)
+        err_code = col_string_concat(dst, src);
+    else
+        err_code = col_insert_range(dst, dst_rows, src->data, n_rows);
+    if (err_code)
+        return err_code;
+
+    if (dst->validity) {
+        for (size_t i = 0; i < n_rows; i++)
+            col_bit_set(
+                dst->validity,
+                dst_rows + i,
+                !src->validity || col_bit_get(src->validity, i)
+            );
+        dst->null_count += src_nulls;
+    }
+
+    return COL_ERR_OK;
+}
+
+int col_concat(col_t *dst, const col_t *src) {
+    /* args */
+    if (!src)
+        return COL_ERR_NO_DATA;
+    if (dst->dtype != src->dtype)
+        return COL_ERR_INVALID_DTYPE;
+    if (!src->n_rows)
+        return COL_ERR_OK;
+
+    /* a view of the rows of `dst` is copied before they are reallocated */
+    col_t *tmp = NULL;
+    if (src != dst && col_rows_overlap(dst, src)) {
+        int err_code = COL_ERR_OK;
+        tmp = col_clone(src, &err_code);
+        if (!tmp)
+            return err_code;
+        src = tmp;
+    }
+
+    /* assign */
+    const int err_code = col_concat_rows(dst, src);
+    col_free(tmp);
+    return err_code;
+}
+
+int col_remove_range(col_t *col, const size_t idx, const size_t n) {
+    /* args */
+    if (idx > col->n_rows || n > col->n_rows - idx)
+        return COL_ERR_OUT_OF_BOUNDS;
+    if (!n)
+        return COL_ERR_OK;
+
+    /* malloc */
+    if (col_data_detach(col))
+        return COL_ERR_OOM;
+
+    /* assign */
+    col_rows_release(col, idx, n);
+    col_rows_move(col, idx, idx + n, col->n_rows - idx - n);
+
+    col->n_rows -= n;
+
+    return COL_ERR_OK;
+}
+
+int col_remove_indices(col_t *col, const size_t *idx, const size_t k) {
+    /* args */
+    if (!k)
+        return COL_ERR_OK;
+    if (!idx)
+        return COL_ERR_NO_DATA;
+    for (size_t i = 0; i < k; i++) {
+        if (idx[i] >= col->n_rows)
+            return COL_ERR_OUT_OF_BOUNDS;
+        if (i && idx[i] <= idx[i - 1])
+            return COL_ERR_INVALID_ARG;
+    }
+
+    /* malloc */
+    if (col_data_detach(col))
+        return COL_ERR_OOM;
+
+    /* assign */
+    size_t dst = idx[0];
+    for (size_t i = 0; i < k; i++) {
+        col_rows_release(col, idx[i], 1);
+
+        /* shift the run of kept rows between this index and the next */
+        const size_t run_start = idx[i] + 1;
+        const size_t run_end = i + 1 < k ? idx[i + 1] : col->n_rows;
+        col_rows_move(col, dst, run_start, run_end - run_start);
+        dst += run_end - run_start;
+    }
+
+    col->n_rows -= k;
+
+    return COL_ERR_OK;
+}
+
+int col_retain_mask(col_t *col, const uint8_t *mask) {
+    /* args */
+    if (!mask)
+        return COL_ERR_NO_DATA;
+
+    /* malloc */
+    if (col_data_detach(col))
+        return COL_ERR_OOM;
+
+    /* assign */
+    size_t dst = 0;
+    size_t i = 0;
+    while (i < col->n_rows) {
+        /* drop a run of masked-out rows */
+        const size_t drop_start = i;
+        while (i < col->n_rows && !mask[i])
+            i++;
+        col_rows_release(col, drop_start, i - drop_start);
+
+        /* keep a run of rows */
+        const size_t keep_start = i;
+        while (i < col->n_rows && mask[i])
+            i++;
+        col_rows_move(col, dst, keep_start, i - keep_start);
+        dst += i - keep_start;
+    }
+
+    col->n_rows = dst;
+
+    return COL_ERR_OK;
+}
+
+int col_remove(col_t *col, const size_t idx) {
+    return col_remove_range(col, idx, 1);
+}
+
 int col_rename(col_t *col, const char *name) {
     /* args */
     if (!name)
         return COL_ERR_EMPTY_NAME;
 
     /* malloc */
-    char *tmp_name = strdup(name);
+    char *tmp_name = mlc_strdup(&col->allocator, name);
     if (!tmp_name)
         return COL_ERR_OOM;
 
     /* assign */
-    free(col->name);
+    mlc_free(&col->allocator, col->name);
     col->name = tmp_name;
 
     return COL_ERR_OK;
@@ -0,0 +1,135 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/alloc.h"
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/strbuf.h"
+#include "dtypes/col/core/internal.h"
+
+/* THIS FUNCTION ASSUMES CAPACITY FITS EVERY LIVE STRING */
+static int col_strbuf_repack(col_t *col, const size_t capacity) {
+    col_strbuf_t *buf = &col->strbuf;
+
+    /* malloc */
+    char *bytes = mlc_alloc(&col->allocator, capacity, 1);
+    if (!bytes && capacity)
+        return COL_ERR_OOM;
+
+    /* assign */
+    size_t *offsets = col->data;
+    size_t len = 0;
+    for (size_t i = 0; i < col->n_rows; i++) {
+        const char *str = buf->bytes + offsets[i];
+        const size_t str_len = strlen(str) + 1;
+        memcpy(bytes + len, str, str_len);
+        offsets[i] = len;
+        len += str_len;
+    }
+
+    mlc_free(&col->allocator, buf->bytes);
+    buf->bytes = bytes;
+    buf->len = len;
+    buf->capacity = capacity;
+    buf->waste = 0;
+
+    return COL_ERR_OK;
+}
+
+int col_strbuf_reserve(col_t *col, const size_t extra) {
+    col_strbuf_t *buf = &col->strbuf;
+
+    /* args */
+    if (extra <= buf->capacity - buf->len)
+        return COL_ERR_OK;
+
+    const int compact = buf->waste && buf->waste >= buf->len / 2;
+    const size_t used = compact ? buf->len - buf->waste : buf->len;
+    if (extra > SIZE_MAX - used)
+        return COL_ERR_OOM;
+
+    const size_t capacity = col_capacity_grow(buf->capacity, used + extra);
+    if (compact)
+        return col_strbuf_repack(col, capacity);
+
+    /* malloc */
+    char *bytes = mlc_realloc(&col->allocator, buf->bytes, buf->len, capacity, 1);
+    if (!bytes)
+        return COL_ERR_OOM;
+
+    /* assign */
+    buf->bytes = bytes;
+    buf->capacity = capacity;
+
+    return COL_ERR_OK;
+}
+
+int col_strbuf_push(col_t *col, const char *str, size_t *offset_out) {
+    col_strbuf_t *buf = &col->strbuf;
+    const size_t len = strlen(str) + 1;
+
+    /* malloc */
+    char *tmp_str = NULL;
+    if (len > buf->capacity - buf->len) {
+        /* growing or compacting would invalidate a string we point into */
+        const int aliased = buf->bytes
+            && str >= buf->bytes
+            && str < buf->bytes + buf->capacity;
+        if (aliased) {
+            tmp_str = strdup(str);
+            if (!tmp_str)
+                return COL_ERR_OOM;
+            str = tmp_str;
+        }
+
+        if (col_strbuf_reserve(col, len)) {
+            free(tmp_str);
+            return COL_ERR_OOM;
+        }
+    }
+
+    /* assign */
+    memcpy(buf->bytes + buf->len, str, len);
+    *offset_out = buf->len;
+    buf->len += len;
+
+    free(tmp_str);
+
+    return COL_ERR_OK;
+}
+
+void col_strbuf_release(col_t *col, const size_t idx, const size_t n) {
+    col_strbuf_t *buf = &col->strbuf;
+    const size_t *offsets = col->data;
+
+    for (size_t i = idx; i < idx + n; i++)
+        buf->waste += strlen(buf->bytes + offsets[i]) + 1;
+}
+
+int col_strbuf_compact(col_t *col, const int shrink) {
+    col_strbuf_t *buf = &col->strbuf;
+
+    if (!buf->waste && (!shrink || buf->len == buf->capacity))
+        return COL_ERR_OK;
+
+    if (!buf->waste) {
+        /* a zero length frees the bytes */
+        char *bytes = mlc_realloc(
+            &col->allocator,
+            buf->bytes,
+            buf->len,
+            buf->len,
+            1
+        );
+        if (!bytes && buf->len)
+            return COL_ERR_OOM;
+        buf->bytes = bytes;
+        buf->capacity = buf->len;
+        return COL_ERR_OK;
+    }
+
+    return col_strbuf_repack(
+        col,
+        shrink ? buf->len - buf->waste : buf->capacity
+    );
+}
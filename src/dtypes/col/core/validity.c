@@ -0,0 +1,116 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/alloc.h"
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/validity.h"
+#include "dtypes/col/core/internal.h"
+
+int col_validity_init(col_t *col) {
+    /* args */
+    if (col->validity)
+        return COL_ERR_OK;
+
+    /* malloc */
+    const size_t n_bytes = col_validity_bytes(col->capacity ? col->capacity : 1);
+    uint8_t *validity = mlc_alloc(&col->allocator, n_bytes, 1);
+    if (!validity)
+        return COL_ERR_OOM;
+
+    /* assign */
+    memset(validity, 0xFF, n_bytes);
+    col->validity = validity;
+    col->null_count = 0;
+
+    return COL_ERR_OK;
+}
+
+int col_validity_reserve(col_t *col, const size_t capacity) {
+    /* args */
+    if (!col->validity)
+        return COL_ERR_OK;
+
+    /* malloc */
+    const size_t n_bytes = col_validity_bytes(capacity ? capacity : 1);
+    const size_t old_bytes = col_validity_bytes(col->capacity ? col->capacity : 1);
+    uint8_t *validity = mlc_realloc(
+        &col->allocator,
+        col->validity,
+        old_bytes,
+        n_bytes,
+        1
+    );
+    if (!validity)
+        return COL_ERR_OOM;
+
+    /* assign */
+    col->validity = validity;
+
+    return COL_ERR_OK;
+}
+
+size_t col_validity_count(const col_t *col, const size_t idx, const size_t n) {
+    if (!col->validity || !col->null_count)
+        return 0;
+
+    size_t n_valid = 0;
+    size_t i = idx;
+    const size_t end = idx + n;
+
+    /* leading bits up to a byte boundary */
+    for (; i < end && (i & 7); i++)
+        n_valid += col_bit_get(col->validity, i);
+
+    /* whole bytes */
+    for (; i + 8 <= end; i += 8)
+        n_valid += (size_t)__builtin_popcount(col->validity[i >> 3]);
+
+    /* trailing bits */
+    for (; i < end; i++)
+        n_valid += col_bit_get(col->validity, i);
+
+    return n - n_valid;
+}
+
+void col_validity_move(
+    col_t *col,
+    const size_t dst,
+    const size_t src,
+    const size_t n
+) {
+    uint8_t *bits = col->validity;
+    if (!bits || dst == src)
+        return;
+
+    /* byte-aligned moves need no bit shuffling, except for the tail */
+    if (!(dst & 7) && !(src & 7)) {
+        const size_t n_whole = n & ~(size_t)7;
+        if (dst > src)
+            for (size_t i = n; i > n_whole; i--)
+                col_bit_set(bits, dst + i - 1, col_bit_get(bits, src + i - 1));
+        memmove(bits + (dst >> 3), bits + (src >> 3), n >> 3);
+        if (dst < src)
+            for (size_t i = n_whole; i < n; i++)
+                col_bit_set(bits, dst + i, col_bit_get(bits, src + i));
+        return;
+    }
+
+    if (dst < src) {
+        for (size_t i = 0; i < n; i++)
+            col_bit_set(bits, dst + i, col_bit_get(bits, src + i));
+    } else {
+        for (size_t i = n; i > 0; i--)
+            col_bit_set(bits, dst + i - 1, col_bit_get(bits, src + i - 1));
+    }
+}
+
+void col_validity_fill(
+    col_t *col,
+    const size_t idx,
+    const size_t n,
+    const int valid
+) {
+    for (size_t i = idx; i < idx + n; i++)
+        col_bit_set(col->validity, i, valid);
+}
@@ -0,0 +1,794 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/error.h"
+#include "core/thread.h"
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/category.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/col/core/modifiers.h"
+#include "dtypes/col/core/strbuf.h"
+#include "dtypes/col/core/validity.h"
+#include "dtypes/col/io/csv.h"
+#include "dtypes/col/ops/cast.h"
+#include "dtypes/col/core/internal.h"
+
+#define COL_CSV_CHUNK_BYTES ((size_t)64 << 20)
+#define COL_CSV_INFER_ROWS 1000
+#define COL_CSV_MIN_PIECE ((size_t)1 << 20)
+#define COL_CSV_NAME_MAX 32
+
+struct col_csv_reader {
+    FILE *file;
+    col_csv_options_t options;
+    size_t n_cols;
+    char **names;
+    col_dtype_t *dtypes;
+    size_t row_bytes;           /* average bytes per row, for preallocation */
+    char *buf;
+    size_t len;
+    size_t capacity;
+    int eof;
+};
+
+/* One field of a row, pointing into the input or a scratch buffer */
+typedef struct col_csv_field {
+    const char *str;
+    size_t len;
+    int quoted;
+} col_csv_field_t;
+
+/* Growable buffer for unescaped and NUL-terminated fields */
+typedef struct col_csv_scratch {
+    char *buf;
+    size_t capacity;
+} col_csv_scratch_t;
+
+/* A run of whole rows parsed by one thread */
+typedef struct col_csv_task {
+    const col_csv_reader_t *reader;
+    const char *begin;
+    const char *end;
+    col_t **cols;
+    col_csv_scratch_t scratch;
+    int err;
+} col_csv_task_t;
+
+col_csv_options_t col_csv_options_default(void) {
+    const col_csv_options_t options = {
+        ',',
+        '"',
+        1,
+        NULL,
+        0,
+        COL_CSV_INFER_ROWS,
+        0,
+        COL_CSV_CHUNK_BYTES
+    };
+    return options;
+}
+
+void col_csv_cols_free(col_t **cols, const size_t n_cols) {
+    if (!cols)
+        return;
+
+    for (size_t i = 0; i < n_cols; i++)
+        col_free(cols[i]);
+    free(cols);
+}
+
+static char *col_csv_scratch_reserve(col_csv_scratch_t *scratch, size_t n) {
+    if (n <= scratch->capacity)
+        return scratch->buf;
+
+    size_t capacity = scratch->capacity ? scratch->capacity : 64;
+    while (capacity < n)
+        capacity *= 2;
+
+    char *buf = realloc(scratch->buf, capacity);
+    if (!buf)
+        return NULL;
+
+    scratch->buf = buf;
+    scratch->capacity = capacity;
+    return buf;
+}
+
+/* Returns the field as a NUL-terminated string. NULL on error. */
+static const char *col_csv_cstr(
+    col_csv_scratch_t *scratch,
+    const col_csv_field_t *field
+) {
+    if (field->str == scratch->buf)
+        return scratch->buf;
+
+    char *buf = col_csv_scratch_reserve(scratch, field->len + 1);
+    if (!buf)
+        return NULL;
+
+    memcpy(buf, field->str, field->len);
+    buf[field->len] = '\0';
+    return buf;
+}
+
+/* Splits the field at `p` and returns where the next one starts. `eol` is
+ * set when the field ends its row. Quoted fields holding escaped quotes
+ * are unescaped into `scratch`. NULL on error. */
+static const char *col_csv_field(
+    const char *p,
+    const char *end,
+    const char delim,
+    const char quote,
+    col_csv_scratch_t *scratch,
+    col_csv_field_t *field,
+    int *eol
+) {
+    field->quoted = p < end && *p == quote;
+
+    if (field->quoted) {
+        const char *start = ++p;
+        int escaped = 0;
+        for (;;) {
+            const char *q = memchr(p, quote, (size_t)(end - p));
+            if (!q) {
+                /* unterminated, take the rest of the input */
+                field->len = (size_t)(end - start);
+                p = end;
+                break;
+            }
+            if (q + 1 < end && q[1] == quote) {
+                escaped = 1;
+                p = q + 2;
+                continue;
+            }
+            field->len = (size_t)(q - start);
+            p = q + 1;
+            break;
+        }
+        field->str = start;
+
+        if (escaped) {
+            char *buf = col_csv_scratch_reserve(scratch, field->len + 1);
+            if (!buf)
+                return NULL;
+
+            size_t n = 0;
+            for (size_t i = 0; i < field->len; i++) {
+                buf[n++] = start[i];
+                if (start[i] == quote)
+                    i++;
+            }
+            buf[n] = '\0';
+            field->str = buf;
+            field->len = n;
+        }
+
+        /* anything between the closing quote and the delimiter is dropped */
+        while (p < end && *p != delim && *p != '\n')
+            p++;
+    } else {
+        const char *start = p;
+        while (p < end && *p != delim && *p != '\n')
+            p++;
+        field->str = start;
+        field->len = (size_t)(p - start);
+
+        if ((p == end || *p == '\n') && field->len && start[field->len - 1] == '\r')
+            field->len--;
+    }
+
+    *eol = p == end || *p == '\n';
+    return p == end ? end : p + 1;
+}
+
+/* Skips a blank line at `p`, returning where the next row starts */
+static const char *col_csv_skip_blank(const char *p, const char *end) {
+    while (p < end) {
+        if (*p == '\n')
+            p++;
+        else if (*p == '\r' && p + 1 < end && p[1] == '\n')
+            p += 2;
+        else
+            break;
+    }
+    return p;
+}
+
+/* Returns the end of the last complete row in `buf`, 0 if there is none */
+static size_t col_csv_rows_end(const char *buf, const size_t len, const char quote) {
+    if (!memchr(buf, quote, len)) {
+        for (size_t i = len; i > 0; i--) {
+            if (buf[i - 1] == '\n')
+                return i;
+        }
+        return 0;
+    }
+
+    /* newlines inside quotes do not end rows */
+    size_t rows_end = 0;
+    int in_quote = 0;
+    for (size_t i = 0; i < len; i++) {
+        if (buf[i] == quote)
+            in_quote = !in_quote;
+        else if (buf[i] == '\n' && !in_quote)
+            rows_end = i + 1;
+    }
+    return rows_end;
+}
+
+/* Splits `buf` into `n` runs of whole rows of about equal size */
+static void col_csv_split(
+    const char *buf,
+    const size_t len,
+    const char quote,
+    const size_t n,
+    size_t *bounds
+) {
+    const int quoted = memchr(buf, quote, len) != NULL;
+    size_t pos = 0;
+    int in_quote = 0;
+
+    bounds[0] = 0;
+    for (size_t k = 1; k < n; k++) {
+        size_t target = k * (len / n);
+        if (target < bounds[k - 1])
+            target = bounds[k - 1];
+
+        if (!quoted) {
+            const char *nl = memchr(buf + target, '\n', len - target);
+            bounds[k] = nl ? (size_t)(nl - buf) + 1 : len;
+            continue;
+        }
+
+        for (; pos < len; pos++) {
+            if (buf[pos] == quote)
+                in_quote = !in_quote;
+            else if (buf[pos] == '\n' && !in_quote && pos >= target)
+                break;
+        }
+        pos = pos < len ? pos + 1 : len;
+        bounds[k] = pos;
+    }
+    bounds[n] = len;
+}
+
+/* Appends one field to `col`, which has room for the row */
+static int col_csv_push(
+    col_t *col,
+    const col_csv_field_t *field,
+    col_csv_scratch_t *scratch
+) {
+    const size_t idx = col->n_rows;
+    int is_null = !field->quoted && !field->len;
+
+    /* assign */
+    if (col->dtype == COL_DTYPE_STRING) {
+        if (col_strbuf_reserve(col, field->len + 1))
+            return COL_ERR_OOM;
+
+        char *dst = col->strbuf.bytes + col->strbuf.len;
+        if (field->len)
+            memcpy(dst, field->str, field->len);
+        dst[field->len] = '\0';
+        ((size_t *)col->data)[idx] = col->strbuf.len;
+        col->strbuf.len += field->len + 1;
+    } else if (is_null) {
+        /* category nulls hold code 0, which is never looked up */
+        memset((char *)col->data + idx * col->stride, 0, col->stride);
+    } else if (col->dtype == COL_DTYPE_CATEGORY) {
+        const char *str = col_csv_cstr(scratch, field);
+        if (!str)
+            return COL_ERR_OOM;
+
+        int32_t code;
+        const int err_code = col_category_encode(col, str, &code);
+        if (err_code)
+            return err_code;
+        col_code_write(col->data, col->stride, idx, code);
+    } else {
+        char *dst = (char *)col->data + idx * col->stride;
+        if (col_parse_value(field->str, field->len, col->dtype, dst, &is_null))
+            return COL_ERR_PARSE;
+        if (is_null)
+            memset(dst, 0, col->stride);
+    }
+
+    if (is_null && col_validity_init(col))
+        return COL_ERR_OOM;
+    if (col->validity)
+        col_bit_set(col->validity, idx, !is_null);
+    col->null_count += is_null;
+    col->n_rows += 1;
+
+    return COL_ERR_OK;
+}
+
+/* Ensures every column has room for one more row */
+static int col_csv_reserve_row(col_t **cols, const size_t n_cols) {
+    const size_t n_rows = cols[0]->n_rows;
+    if (n_rows < cols[0]->capacity)
+        return COL_ERR_OK;
+
+    const size_t capacity = col_capacity_grow(cols[0]->capacity, n_rows + 1);
+    for (size_t j = 0; j < n_cols; j++) {
+        if (col_reserve(cols[j], capacity))
+            return COL_ERR_OOM;
+    }
+
+    return COL_ERR_OK;
+}
+
+static int col_csv_parse_rows(col_csv_task_t *task) {
+    const col_csv_reader_t *reader = task->reader;
+    const size_t n_cols = reader->n_cols;
+    const char delim = reader->options.delim;
+    const char quote = reader->options.quote;
+    const char *end = task->end;
+    const char *p = col_csv_skip_blank(task->begin, end);
+
+    while (p < end) {
+        if (col_csv_reserve_row(task->cols, n_cols))
+            return COL_ERR_OOM;
+
+        size_t j = 0;
+        int eol = 0;
+        while (!eol) {
+            col_csv_field_t field;
+            p = col_csv_field(p, end, delim, quote, &task->scratch, &field, &eol);
+            if (!p)
+                return COL_ERR_OOM;
+            if (j >= n_cols)
+                return COL_ERR_PARSE;
+
+            const int err_code = col_csv_push(task->cols[j], &field, &task->scratch);
+            if (err_code)
+                return err_code;
+            j++;
+        }
+
+        const col_csv_field_t null_field = { NULL, 0, 0 };
+        for (; j < n_cols; j++) {
+            const int err_code = col_csv_push(task->cols[j], &null_field, NULL);
+            if (err_code)
+                return err_code;
+        }
+
+        p = col_csv_skip_blank(p, end);
+    }
+
+    return COL_ERR_OK;
+}
+
+static void col_csv_task_run(void *ctx, size_t idx) {
+    col_csv_task_t *task = (col_csv_task_t *)ctx + idx;
+    const col_csv_reader_t *reader = task->reader;
+
+    /* alloc */
+    task->cols = calloc(reader->n_cols, sizeof(col_t *));
+    if (!task->cols) {
+        task->err = COL_ERR_OOM;
+        return;
+    }
+
+    const size_t n_bytes = (size_t)(task->end - task->begin);
+    const size_t capacity = n_bytes / reader->row_bytes + 16;
+    for (size_t j = 0; j < reader->n_cols; j++) {
+        task->cols[j] = col_create_with_capacity(
+            reader->names[j],
+            capacity,
+            reader->dtypes[j],
+            &task->err
+        );
+        if (!task->cols[j])
+            return;
+    }
+
+    /* parse */
+    task->err = col_csv_parse_rows(task);
+}
+
+/* Parses the whole rows in `buf` on up to `n_threads` threads */
+static col_t **col_csv_parse(
+    const col_csv_reader_t *reader,
+    const char *buf,
+    const size_t len,
+    int *err_out
+) {
+    size_t n = len / COL_CSV_MIN_PIECE + 1;
+    const size_t n_threads = reader->options.n_threads
+        ? reader->options.n_threads
+        : mlc_thread_count();
+    if (n > n_threads)
+        n = n_threads;
+
+    /* alloc */
+    col_t **cols = NULL;
+    size_t *bounds = malloc((n + 1) * sizeof(size_t));
+    col_csv_task_t *tasks = calloc(n, sizeof(col_csv_task_t));
+    if (!bounds || !tasks) {
+        *err_out = COL_ERR_OOM;
+        goto cleanup;
+    }
+
+    /* parse */
+    col_csv_split(buf, len, reader->options.quote, n, bounds);
+    for (size_t k = 0; k < n; k++) {
+        tasks[k].reader = reader;
+        tasks[k].begin = buf + bounds[k];
+        tasks[k].end = buf + bounds[k + 1];
+    }
+
+    mlc_parallel_for(n, n, col_csv_task_run, tasks);
+
+    *err_out = COL_ERR_OK;
+    for (size_t k = 0; k < n && !*err_out; k++)
+        *err_out = tasks[k].err;
+
+    /* merge, in input order */
+    for (size_t k = 1; k < n && !*err_out; k++) {
+        for (size_t j = 0; j < reader->n_cols && !*err_out; j++)
+            *err_out = col_concat(tasks[0].cols[j], tasks[k].cols[j]);
+    }
+
+    if (!*err_out) {
+        cols = tasks[0].cols;
+        tasks[0].cols = NULL;
+    }
+
+cleanup:
+    for (size_t k = 0; tasks && k < n; k++) {
+        if (tasks[k].cols)
+            col_csv_cols_free(tasks[k].cols, reader->n_cols);
+        free(tasks[k].scratch.buf);
+    }
+    free(tasks);
+    free(bounds);
+    return cols;
+}
+
+/* Reads until the buffer is full or the file ends */
+static int col_csv_fill(col_csv_reader_t *reader) {
+    while (!reader->eof && reader->len < reader->capacity) {
+        const size_t n = fread(
+            reader->buf + reader->len,
+            1,
+            reader->capacity - reader->len,
+            reader->file
+        );
+        reader->len += n;
+
+        if (n)
+            continue;
+        if (ferror(reader->file))
+            return COL_ERR_IO;
+        reader->eof = 1;
+    }
+
+    return COL_ERR_OK;
+}
+
+/* Fills the buffer, growing it until it holds a complete row. Returns the
+ * end of the complete rows through `rows_end`. */
+static int col_csv_fill_rows(col_csv_reader_t *reader, size_t *rows_end) {
+    for (;;) {
+        const int err_code = col_csv_fill(reader);
+        if (err_code)
+            return err_code;
+
+        *rows_end = reader->eof
+            ? reader->len
+            : col_csv_rows_end(reader->buf, reader->len, reader->options.quote);
+        if (*rows_end || reader->eof)
+            return COL_ERR_OK;
+
+        /* a single row is larger than the buffer */
+        if (reader->capacity > SIZE_MAX / 2)
+            return COL_ERR_OOM;
+        char *buf = realloc(reader->buf, reader->capacity * 2);
+        if (!buf)
+            return COL_ERR_OOM;
+        reader->buf = buf;
+        reader->capacity *= 2;
+    }
+}
+
+/* Drops the first `n` buffered bytes */
+static void col_csv_consume(col_csv_reader_t *reader, const size_t n) {
+    memmove(reader->buf, reader->buf + n, reader->len - n);
+    reader->len -= n;
+}
+
+/* Reads the names, and dtypes unless given, from the first rows */
+static int col_csv_read_header(col_csv_reader_t *reader) {
+    const col_csv_options_t *options = &reader->options;
+    col_csv_scratch_t scratch = { NULL, 0 };
+    int err_code;
+
+    size_t rows_end;
+    err_code = col_csv_fill_rows(reader, &rows_end);
+    if (err_code)
+        return err_code;
+
+    /* a UTF-8 byte order mark is not part of the first name */
+    if (rows_end >= 3 && memcmp(reader->buf, "\xEF\xBB\xBF", 3) == 0) {
+        col_csv_consume(reader, 3);
+        rows_end -= 3;
+    }
+
+    const char *end = reader->buf + rows_end;
+    const char *p = col_csv_skip_blank(reader->buf, end);
+    if (p == end)
+        return COL_ERR_NO_DATA;
+
+    /* names */
+    const char *row = p;
+    int eol = 0;
+    while (!eol) {
+        col_csv_field_t field;
+        p = col_csv_field(p, end, options->delim, options->quote, &scratch, &field, &eol);
+        if (!p)
+            goto fail_oom;
+
+        char **names = realloc(reader->names, (reader->n_cols + 1) * sizeof(char *));
+        if (!names)
+            goto fail_oom;
+        reader->names = names;
+
+        char *name;
+        if (options->header && field.len) {
+            name = malloc(field.len + 1);
+            if (name) {
+                memcpy(name, field.str, field.len);
+                name[field.len] = '\0';
+            }
+        } else {
+            name = malloc(COL_CSV_NAME_MAX);
+            if (name)
+                snprintf(name, COL_CSV_NAME_MAX, "column_%zu", reader->n_cols);
+        }
+        if (!name)
+            goto fail_oom;
+        reader->names[reader->n_cols++] = name;
+    }
+    if (!options->header)
+        p = row;
+
+    reader->dtypes = malloc(reader->n_cols * sizeof(col_dtype_t));
+    if (!reader->dtypes)
+        goto fail_oom;
+
+    col_csv_consume(reader, (size_t)(p - reader->buf));
+    err_code = col_csv_fill_rows(reader, &rows_end);
+    if (err_code) {
+        free(scratch.buf);
+        return err_code;
+    }
+    end = reader->buf + rows_end;
+    p = reader->buf;
+
+    if (options->dtypes) {
+        free(scratch.buf);
+        if (options->n_dtypes != reader->n_cols)
+            return COL_ERR_INVALID_ARG;
+        for (size_t j = 0; j < reader->n_cols; j++) {
+            if (col_dtype_validate(options->dtypes[j]))
+                return COL_ERR_INVALID_DTYPE;
+            reader->dtypes[j] = options->dtypes[j];
+        }
+        reader->row_bytes = 2 * reader->n_cols;
+        return COL_ERR_OK;
+    }
+
+    /*
+     * dtypes: int64 if every sampled value is, else double, else string.
+     * Columns without sampled values are read as double.
+     */
+    col_dtype_t *inferred = reader->dtypes;
+    for (size_t j = 0; j < reader->n_cols; j++)
+        inferred[j] = COL_DTYPE_CATEGORY;
+
+    size_t n_rows = 0;
+    p = col_csv_skip_blank(p, end);
+    while (p < end && n_rows < options->infer_rows) {
+        eol = 0;
+        for (size_t j = 0; !eol; j++) {
+            col_csv_field_t field;
+            p = col_csv_field(p, end, options->delim, options->quote, &scratch, &field, &eol);
+            if (!p) {
+                err_code = COL_ERR_OOM;
+                break;
+            }
+            if (j >= reader->n_cols || (!field.quoted && !field.len))
+                continue;
+
+            int64_t i64;
+            double f64;
+            int is_null;
+            if (inferred[j] == COL_DTYPE_CATEGORY)
+                inferred[j] = COL_DTYPE_INT64;
+            if (inferred[j] == COL_DTYPE_INT64
+                && col_parse_value(field.str, field.len, COL_DTYPE_INT64, &i64, &is_null))
+                inferred[j] = COL_DTYPE_DOUBLE;
+            if (inferred[j] == COL_DTYPE_DOUBLE
+                && col_parse_value(field.str, field.len, COL_DTYPE_DOUBLE, &f64, &is_null))
+                inferred[j] = COL_DTYPE_STRING;
+        }
+        if (err_code)
+            break;
+
+        n_rows++;
+        p = col_csv_skip_blank(p, end);
+    }
+
+    for (size_t j = 0; j < reader->n_cols; j++) {
+        if (inferred[j] == COL_DTYPE_CATEGORY)
+            inferred[j] = COL_DTYPE_DOUBLE;
+    }
+
+    reader->row_bytes = n_rows ? (size_t)(p - reader->buf) / n_rows : 0;
+    if (!reader->row_bytes)
+        reader->row_bytes = 2 * reader->n_cols;
+
+    free(scratch.buf);
+    return err_code;
+
+fail_oom:
+    free(scratch.buf);
+    return COL_ERR_OOM;
+}
+
+col_csv_reader_t *col_csv_open(
+    const char *path,
+    const col_csv_options_t *options,
+    int *err_out
+) {
+    /* args */
+    if (!path)
+        return mlc_fail_null(COL_ERR_NO_DATA, err_out);
+
+    /* alloc */
+    col_csv_reader_t *reader = calloc(1, sizeof(col_csv_reader_t));
+    if (!reader)
+        return mlc_fail_null(COL_ERR_OOM, err_out);
+
+    reader->options = options ? *options : col_csv_options_default();
+    if (!reader->options.chunk_bytes)
+        reader->options.chunk_bytes = COL_CSV_CHUNK_BYTES;
+    if (!reader->options.infer_rows)
+        reader->options.infer_rows = COL_CSV_INFER_ROWS;
+
+    int err_code = COL_ERR_INVALID_ARG;
+    if (reader->options.delim == reader->options.quote
+        || reader->options.delim == '\n'
+        || reader->options.quote == '\n')
+        goto fail;
+
+    err_code = COL_ERR_OOM;
+    reader->capacity = reader->options.chunk_bytes;
+    reader->buf = malloc(reader->capacity);
+    if (!reader->buf)
+        goto fail;
+
+    err_code = COL_ERR_IO;
+    reader->file = fopen(path, "rb");
+    if (!reader->file)
+        goto fail;
+
+    /* init */
+    err_code = col_csv_read_header(reader);
+    if (err_code)
+        goto fail;
+
+    return reader;
+
+fail:
+    col_csv_close(reader);
+    return mlc_fail_null(err_code, err_out);
+}
+
+size_t col_csv_n_cols(const col_csv_reader_t *reader) {
+    return reader->n_cols;
+}
+
+col_t **col_csv_next(col_csv_reader_t *reader, int *err_out) {
+    /* args */
+    if (!reader)
+        return mlc_fail_null(COL_ERR_NO_DATA, err_out);
+
+    int err_code;
+    for (;;) {
+        size_t rows_end;
+        err_code = col_csv_fill_rows(reader, &rows_end);
+        if (err_code)
+            return mlc_fail_null(err_code, err_out);
+
+        /* end of file */
+        if (!rows_end)
+            break;
+
+        col_t **cols = col_csv_parse(reader, reader->buf, rows_end, &err_code);
+        if (!cols)
+            return mlc_fail_null(err_code, err_out);
+        col_csv_consume(reader, rows_end);
+
+        /* a chunk of blank lines holds no rows */
+        if (cols[0]->n_rows) {
+            if (err_out)
+                *err_out = COL_ERR_OK;
+            return cols;
+        }
+        col_csv_cols_free(cols, reader->n_cols);
+    }
+
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    return NULL;
+}
+
+void col_csv_close(col_csv_reader_t *reader) {
+    if (!reader)
+        return;
+
+    if (reader->file)
+        fclose(reader->file);
+    for (size_t j = 0; j < reader->n_cols; j++)
+        free(reader->names[j]);
+    free(reader->names);
+    free(reader->dtypes);
+    free(reader->buf);
+    free(reader);
+}
+
+col_t **col_read_csv(
+    const char *path,
+    const col_csv_options_t *options,
+    size_t *n_cols_out,
+    int *err_out
+) {
+    /* args */
+    if (!n_cols_out)
+        return mlc_fail_null(COL_ERR_NO_DATA, err_out);
+
+    int err_code;
+    col_csv_reader_t *reader = col_csv_open(path, options, &err_code);
+    if (!reader)
+        return mlc_fail_null(err_code, err_out);
+
+    /* read */
+    const size_t n_cols = reader->n_cols;
+    col_t **cols = NULL;
+    col_t **chunk;
+    while ((chunk = col_csv_next(reader, &err_code))) {
+        if (!cols) {
+            cols = chunk;
+            continue;
+        }
+        for (size_t j = 0; j < n_cols && !err_code; j++)
+            err_code = col_concat(cols[j], chunk[j]);
+        col_csv_cols_free(chunk, n_cols);
+        if (err_code)
+            break;
+    }
+
+    /* a header without rows still names its columns */
+    if (!err_code && !cols) {
+        cols = calloc(n_cols, sizeof(col_t *));
+        err_code = cols ? COL_ERR_OK : COL_ERR_OOM;
+        for (size_t j = 0; cols && j < n_cols && !err_code; j++) {
+            cols[j] = col_create(reader->names[j], reader->dtypes[j], &err_code);
+        }
+    }
+
+    col_csv_close(reader);
+    if (err_code) {
+        col_csv_cols_free(cols, n_cols);
+        return mlc_fail_null(err_code, err_out);
+    }
+
+    *n_cols_out = n_cols;
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    return cols;
+}
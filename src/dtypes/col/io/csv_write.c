@@ -0,0 +1,349 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define COL_CSV_FD 1
+#include <errno.h>
+#include <unistd.h>
+#endif
+
+#include "core/error.h"
+#include "core/number.h"
+#include "core/thread.h"
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/internal.h"
+#include "dtypes/col/io/csv.h"
+
+#define COL_CSV_CHUNK_BYTES ((size_t)64 << 20)
+
+/* Destination of the formatted bytes: a file, or a descriptor if NULL */
+typedef struct col_csv_sink {
+    FILE *file;
+    int fd;
+} col_csv_sink_t;
+
+/* A run of rows formatted by one thread into its own buffer */
+typedef struct col_csv_out {
+    col_t *const *cols;
+    size_t n_cols;
+    const col_csv_options_t *options;
+    size_t begin;
+    size_t end;
+    char *buf;
+    size_t len;
+    size_t capacity;
+    int err;
+} col_csv_out_t;
+
+/* Ensures room for `n` more bytes. Zero on success. */
+static int col_csv_out_reserve(col_csv_out_t *out, const size_t n) {
+    if (out->len + n <= out->capacity)
+        return COL_ERR_OK;
+
+    size_t capacity = out->capacity ? out->capacity : 4096;
+    while (capacity < out->len + n)
+        capacity *= 2;
+
+    char *buf = realloc(out->buf, capacity);
+    if (!buf)
+        return COL_ERR_OOM;
+
+    out->buf = buf;
+    out->capacity = capacity;
+    return COL_ERR_OK;
+}
+
+/* Appends one character. Zero on success. */
+static int col_csv_out_char(col_csv_out_t *out, const char c) {
+    if (col_csv_out_reserve(out, 1))
+        return COL_ERR_OOM;
+
+    out->buf[out->len++] = c;
+    return COL_ERR_OK;
+}
+
+/* Appends a string, quoted if it holds special characters or is empty */
+static int col_csv_out_string(col_csv_out_t *out, const char *str) {
+    const char delim = out->options->delim;
+    const char quote = out->options->quote;
+
+    size_t len = 0;
+    size_t n_quotes = 0;
+    int quoted = !*str;
+    for (; str[len]; len++) {
+        const char c = str[len];
+        n_quotes += c == quote;
+        quoted |= c == delim || c == quote || c == '\n' || c == '\r';
+    }
+
+    if (col_csv_out_reserve(out, len + n_quotes + 2))
+        return COL_ERR_OOM;
+
+    char *dst = out->buf + out->len;
+    if (!quoted) {
+        memcpy(dst, str, len);
+        out->len += len;
+        return COL_ERR_OK;
+    }
+
+    /* quotes inside are doubled */
+    *dst++ = quote;
+    for (size_t i = 0; i < len; i++) {
+        if (str[i] == quote)
+            *dst++ = quote;
+        *dst++ = str[i];
+    }
+    *dst++ = quote;
+    out->len = (size_t)(dst - out->buf);
+    return COL_ERR_OK;
+}
+
+/* Appends ".0" to a formatted integral value, so floating point columns
+ * are not inferred as integers when read back */
+static size_t col_csv_out_fraction(char *dst, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        if (dst[i] != '-' && (dst[i] < '0' || dst[i] > '9'))
+            return len;
+    }
+    dst[len++] = '.';
+    dst[len++] = '0';
+    dst[len] = '\0';
+    return len;
+}
+
+/* Appends row `i` of `col`, leaving null rows empty */
+static int col_csv_out_value(col_csv_out_t *out, const col_t *col, const size_t i) {
+    if (col->null_count && !col_bit_get(col->validity, i))
+        return COL_ERR_OK;
+
+    if (col->dtype == COL_DTYPE_STRING) {
+        const size_t *offsets = col->data;
+        return col_csv_out_string(out, col->strbuf.bytes + offsets[i]);
+    }
+    if (col->dtype == COL_DTYPE_CATEGORY) {
+        const col_t *values = col->dict->values;
+        const size_t *offsets = values->data;
+        const int32_t code = col_code_read(col->data, col->stride, i);
+        return col_csv_out_string(out, values->strbuf.bytes + offsets[code]);
+    }
+
+    if (col_csv_out_reserve(out, MLC_NUMBER_MAX))
+        return COL_ERR_OOM;
+
+    char *dst = out->buf + out->len;
+    switch (col->dtype) {
+        case COL_DTYPE_DOUBLE:
+            out->len += col_csv_out_fraction(
+                dst,
+                mlc_format_double(((const double *)col->data)[i], dst)
+            );
+            break;
+        case COL_DTYPE_FLOAT:
+            out->len += col_csv_out_fraction(
+                dst,
+                mlc_format_float(((const float *)col->data)[i], dst)
+            );
+            break;
+        case COL_DTYPE_INT64:
+            out->len += mlc_format_int64(((const int64_t *)col->data)[i], dst);
+            break;
+        case COL_DTYPE_INT32:
+            out->len += mlc_format_int64(((const int32_t *)col->data)[i], dst);
+            break;
+        case COL_DTYPE_UINT8:
+            out->len += mlc_format_int64(((const uint8_t *)col->data)[i], dst);
+            break;
+        default:
+            return COL_ERR_INVALID_DTYPE;
+    }
+
+    return COL_ERR_OK;
+}
+
+static void col_csv_out_run(void *ctx, size_t idx) {
+    col_csv_out_t *out = (col_csv_out_t *)ctx + idx;
+    const char delim = out->options->delim;
+
+    out->len = 0;
+    for (size_t i = out->begin; i < out->end && !out->err; i++) {
+        for (size_t j = 0; j < out->n_cols && !out->err; j++) {
+            if (j)
+                out->err = col_csv_out_char(out, delim);
+            if (!out->err)
+                out->err = col_csv_out_value(out, out->cols[j], i);
+        }
+        if (!out->err)
+            out->err = col_csv_out_char(out, '\n');
+    }
+}
+
+/* Writes all of `buf`. Zero on success. */
+static int col_csv_sink_write(const col_csv_sink_t *sink, const char *buf, size_t len) {
+    if (sink->file)
+        return fwrite(buf, 1, len, sink->file) == len ? COL_ERR_OK : COL_ERR_IO;
+
+#ifdef COL_CSV_FD
+    while (len) {
+        const ssize_t n = write(sink->fd, buf, len);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return COL_ERR_IO;
+        buf += n;
+        len -= (size_t)n;
+    }
+    return COL_ERR_OK;
+#else
+    return COL_ERR_IO;
+#endif
+}
+
+/* Rough formatted width of a row, to size the chunks */
+static size_t col_csv_row_bytes(col_t *const *cols, const size_t n_cols) {
+    size_t n = 1;
+    for (size_t j = 0; j < n_cols; j++) {
+        const col_t *col = cols[j];
+        switch (col->dtype) {
+            case COL_DTYPE_DOUBLE:
+                n += 20;
+                break;
+            case COL_DTYPE_FLOAT:
+                n += 12;
+                break;
+            case COL_DTYPE_INT64:
+                n += 12;
+                break;
+            case COL_DTYPE_INT32:
+                n += 8;
+                break;
+            case COL_DTYPE_STRING:
+                n += col->n_rows ? col->strbuf.len / col->n_rows + 2 : 2;
+                break;
+            default:
+                n += 4;
+                break;
+        }
+    }
+    return n;
+}
+
+static int col_csv_write(
+    col_t *const *cols,
+    const size_t n_cols,
+    const col_csv_sink_t *sink,
+    const col_csv_options_t *options
+) {
+    /* args */
+    if (!cols || !n_cols)
+        return COL_ERR_NO_DATA;
+    for (size_t j = 0; j < n_cols; j++) {
+        if (!cols[j])
+            return COL_ERR_NO_DATA;
+        if (cols[j]->n_rows != cols[0]->n_rows)
+            return COL_ERR_INVALID_ARG;
+    }
+
+    col_csv_options_t opts = options ? *options : col_csv_options_default();
+    if (opts.delim == opts.quote || opts.delim == '\n' || opts.quote == '\n')
+        return COL_ERR_INVALID_ARG;
+    if (!opts.chunk_bytes)
+        opts.chunk_bytes = COL_CSV_CHUNK_BYTES;
+
+    const size_t n_rows = cols[0]->n_rows;
+    const size_t n_threads = opts.n_threads ? opts.n_threads : mlc_thread_count();
+    size_t task_rows = opts.chunk_bytes / n_threads / col_csv_row_bytes(cols, n_cols);
+    if (!task_rows)
+        task_rows = 1;
+
+    /* alloc */
+    col_csv_out_t *outs = calloc(n_threads, sizeof(col_csv_out_t));
+    if (!outs)
+        return COL_ERR_OOM;
+    for (size_t k = 0; k < n_threads; k++) {
+        outs[k].cols = cols;
+        outs[k].n_cols = n_cols;
+        outs[k].options = &opts;
+    }
+
+    /* header */
+    int err_code = COL_ERR_OK;
+    if (opts.header) {
+        for (size_t j = 0; j < n_cols && !err_code; j++) {
+            if (j)
+                err_code = col_csv_out_char(outs, opts.delim);
+            if (!err_code)
+                err_code = col_csv_out_string(outs, cols[j]->name);
+        }
+        if (!err_code)
+            err_code = col_csv_out_char(outs, '\n');
+        if (!err_code)
+            err_code = col_csv_sink_write(sink, outs->buf, outs->len);
+    }
+
+    /* format a chunk per thread, then write the chunks in order */
+    for (size_t row = 0; row < n_rows && !err_code; ) {
+        size_t n = 0;
+        for (; n < n_threads && row < n_rows; n++) {
+            outs[n].begin = row;
+            outs[n].end = n_rows - row < task_rows ? n_rows : row + task_rows;
+            row = outs[n].end;
+        }
+
+        mlc_parallel_for(n, n_threads, col_csv_out_run, outs);
+
+        for (size_t k = 0; k < n && !err_code; k++) {
+            err_code = outs[k].err;
+            if (!err_code)
+                err_code = col_csv_sink_write(sink, outs[k].buf, outs[k].len);
+        }
+    }
+
+    /* cleanup */
+    for (size_t k = 0; k < n_threads; k++)
+        free(outs[k].buf);
+    free(outs);
+    return err_code;
+}
+
+int col_write_csv(
+    col_t *const *cols,
+    const size_t n_cols,
+    const char *path,
+    const col_csv_options_t *options
+) {
+    /* args */
+    if (!path)
+        return COL_ERR_NO_DATA;
+
+    FILE *file = fopen(path, "wb");
+    if (!file)
+        return COL_ERR_IO;
+
+    /* chunks are written whole, so stdio buffering only adds a copy */
+    setvbuf(file, NULL, _IONBF, 0);
+
+    const col_csv_sink_t sink = {file, -1};
+    int err_code = col_csv_write(cols, n_cols, &sink, options);
+    if (fclose(file) && !err_code)
+        err_code = COL_ERR_IO;
+
+    if (err_code)
+        remove(path);
+    return err_code;
+}
+
+int col_write_csv_fd(
+    col_t *const *cols,
+    const size_t n_cols,
+    const int fd,
+    const col_csv_options_t *options
+) {
+    /* args */
+    if (fd < 0)
+        return COL_ERR_IO;
+
+    const col_csv_sink_t sink = {NULL, fd};
+    return col_csv_write(cols, n_cols, &sink, options);
+}
@@ -0,0 +1,611 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define COL_FILE_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "core/alloc.h"
+#include "core/error.h"
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/buffer.h"
+#include "dtypes/col/core/category.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/col/core/validity.h"
+#include "dtypes/col/io/file.h"
+#include "dtypes/col/core/internal.h"
+
+#define COL_FILE_ENDIAN 0x01020304u
+#define COL_FILE_CHUNK 1024
+
+static const char col_file_magic[8] = { 'M', 'L', 'C', 'C', 'O', 'L', 0, 0 };
+
+/* Fixed 128-byte header, followed by the NUL-terminated column name */
+typedef struct col_file_header {
+    char magic[8];
+    uint32_t version;
+    uint32_t endian;
+    uint32_t dtype;
+    uint32_t stride;
+    uint64_t n_rows;
+    uint64_t null_count;
+    uint64_t name_len;          /* including the NUL */
+    uint64_t data_offset;
+    uint64_t validity_offset;   /* 0 without null rows */
+    uint64_t bytes_offset;
+    uint64_t bytes_len;
+    uint64_t dict_rows;
+    uint64_t dict_offset;
+    uint64_t dict_bytes_offset;
+    uint64_t dict_bytes_len;
+    uint64_t file_len;
+} col_file_header_t;
+
+/* A mapped file and what must be released with it */
+typedef struct col_file_map {
+    void *addr;
+    size_t len;
+    col_dict_t *dict;
+    mlc_allocator_t allocator;
+} col_file_map_t;
+
+static uint64_t col_file_align(const uint64_t pos) {
+    return (pos + COL_DATA_ALIGN - 1) & ~(uint64_t)(COL_DATA_ALIGN - 1);
+}
+
+/* Number of bytes the packed strings of a `string` column take */
+static uint64_t col_file_strings_len(const col_t *col) {
+    const size_t *offsets = col->data;
+    uint64_t len = 0;
+
+    for (size_t i = 0; i < col->n_rows; i++)
+        len += strlen(col->strbuf.bytes + offsets[i]) + 1;
+
+    return len;
+}
+
+static int col_file_write(
+    FILE *file,
+    const void *buf,
+    const size_t n,
+    uint64_t *pos
+) {
+    if (n && fwrite(buf, 1, n, file) != n)
+        return COL_ERR_IO;
+    *pos += n;
+    return COL_ERR_OK;
+}
+
+/* Pads with zeros up to `offset`, the start of the next section */
+static int col_file_pad(FILE *file, const uint64_t offset, uint64_t *pos) {
+    static const char zeros[COL_DATA_ALIGN] = { 0 };
+    return col_file_write(file, zeros, (size_t)(offset - *pos), pos);
+}
+
+/* Writes the packed offsets of a `string` column's rows */
+static int col_file_write_offsets(FILE *file, const col_t *col, uint64_t *pos) {
+    const size_t *offsets = col->data;
+    uint64_t chunk[COL_FILE_CHUNK];
+    uint64_t offset = 0;
+
+    for (size_t i = 0; i < col->n_rows; i += COL_FILE_CHUNK) {
+        const size_t n = col->n_rows - i < COL_FILE_CHUNK
+            ? col->n_rows - i
+            : COL_FILE_CHUNK;
+        for (size_t j = 0; j < n; j++) {
+            chunk[j] = offset;
+            offset += strlen(col->strbuf.bytes + offsets[i + j]) + 1;
+        }
+        if (col_file_write(file, chunk, n * sizeof(uint64_t), pos))
+            return COL_ERR_IO;
+    }
+
+    return COL_ERR_OK;
+}
+
+/* Writes the strings of a `string` column's rows back to back */
+static int col_file_write_strings(FILE *file, const col_t *col, uint64_t *pos) {
+    const size_t *offsets = col->data;
+
+    for (size_t i = 0; i < col->n_rows; i++) {
+        const char *str = col->strbuf.bytes + offsets[i];
+        if (col_file_write(file, str, strlen(str) + 1, pos))
+            return COL_ERR_IO;
+    }
+
+    return COL_ERR_OK;
+}
+
+/* Lays out the sections of `col` in `header` */
+static void col_file_layout(const col_t *col, col_file_header_t *header) {
+    memset(header, 0, sizeof(col_file_header_t));
+    memcpy(header->magic, col_file_magic, sizeof(col_file_magic));
+    header->version = COL_FILE_VERSION;
+    header->endian = COL_FILE_ENDIAN;
+    header->dtype = (uint32_t)col->dtype;
+    header->stride = col->dtype == COL_DTYPE_STRING
+        ? (uint32_t)sizeof(uint64_t)
+        : (uint32_t)col->stride;
+    header->n_rows = col->n_rows;
+    header->null_count = col->null_count;
+    header->name_len = strlen(col->name) + 1;
+
+    uint64_t pos = sizeof(col_file_header_t) + header->name_len;
+
+    header->data_offset = col_file_align(pos);
+    pos = header->data_offset + header->n_rows * header->stride;
+
+    if (col->null_count) {
+        header->validity_offset = col_file_align(pos);
+        pos = header->validity_offset + col_validity_bytes(col->n_rows);
+    }
+
+    if (col->dtype == COL_DTYPE_STRING) {
+        header->bytes_offset = col_file_align(pos);
+        header->bytes_len = col_file_strings_len(col);
+        pos = header->bytes_offset + header->bytes_len;
+    }
+
+    if (col->dtype == COL_DTYPE_CATEGORY) {
+        const col_t *values = col->dict->values;
+        header->dict_rows = values->n_rows;
+        header->dict_offset = col_file_align(pos);
+        pos = header->dict_offset + header->dict_rows * sizeof(uint64_t);
+        header->dict_bytes_offset = col_file_align(pos);
+        header->dict_bytes_len = col_file_strings_len(values);
+        pos = header->dict_bytes_offset + header->dict_bytes_len;
+    }
+
+    header->file_len = col_file_align(pos);
+}
+
+int col_save(const col_t *col, const char *path) {
+    /* args */
+    if (!col || !path)
+        return COL_ERR_NO_DATA;
+
+    col_file_header_t header;
+    col_file_layout(col, &header);
+
+    FILE *file = fopen(path, "wb");
+    if (!file)
+        return COL_ERR_IO;
+
+    /* write */
+    uint64_t pos = 0;
+    int err_code = col_file_write(file, &header, sizeof(header), &pos);
+    if (!err_code)
+        err_code = col_file_write(file, col->name, header.name_len, &pos);
+
+    if (!err_code)
+        err_code = col_file_pad(file, header.data_offset, &pos);
+    if (!err_code && col->dtype == COL_DTYPE_STRING)
+        err_code = col_file_write_offsets(file, col, &pos);
+    else if (!err_code)
+        err_code = col_file_write(
+            file,
+            col->data,
+            col->n_rows * col->stride,
+            &pos
+        );
+
+    if (!err_code && header.validity_offset) {
+        err_code = col_file_pad(file, header.validity_offset, &pos);
+        if (!err_code)
+            err_code = col_file_write(
+                file,
+                col->validity,
+                col_validity_bytes(col->n_rows),
+                &pos
+            );
+    }
+
+    if (!err_code && col->dtype == COL_DTYPE_STRING) {
+        err_code = col_file_pad(file, header.bytes_offset, &pos);
+        if (!err_code)
+            err_code = col_file_write_strings(file, col, &pos);
+    }
+
+    if (!err_code && col->dtype == COL_DTYPE_CATEGORY) {
+        const col_t *values = col->dict->values;
+        err_code = col_file_pad(file, header.dict_offset, &pos);
+        if (!err_code)
+            err_code = col_file_write_offsets(file, values, &pos);
+        if (!err_code)
+            err_code = col_file_pad(file, header.dict_bytes_offset, &pos);
+        if (!err_code)
+            err_code = col_file_write_strings(file, values, &pos);
+    }
+
+    if (!err_code)
+        err_code = col_file_pad(file, header.file_len, &pos);
+
+    if (fclose(file) && !err_code)
+        err_code = COL_ERR_IO;
+    if (err_code)
+        remove(path);
+
+    return err_code;
+}
+
+/* Maps the whole file read-only, or reads it where mmap is unavailable */
+static int col_file_map(col_file_map_t *map, const char *path) {
+#ifdef COL_FILE_MMAP
+    const int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return COL_ERR_IO;
+
+    struct stat st;
+    if (fstat(fd, &st)) {
+        close(fd);
+        return COL_ERR_IO;
+    }
+    if (st.st_size <= 0) {
+        close(fd);
+        return COL_ERR_PARSE;
+    }
+
+    void *addr = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED)
+        return COL_ERR_IO;
+
+    map->addr = addr;
+    map->len = (size_t)st.st_size;
+#else
+    FILE *file = fopen(path, "rb");
+    if (!file)
+        return COL_ERR_IO;
+
+    long len = -1;
+    if (!fseek(file, 0, SEEK_END))
+        len = ftell(file);
+    if (len <= 0 || fseek(file, 0, SEEK_SET)) {
+        fclose(file);
+        return len ? COL_ERR_IO : COL_ERR_PARSE;
+    }
+
+    void *addr = mlc_alloc(&map->allocator, (size_t)len, COL_DATA_ALIGN);
+    if (!addr) {
+        fclose(file);
+        return COL_ERR_OOM;
+    }
+    if (fread(addr, 1, (size_t)len, file) != (size_t)len) {
+        mlc_free(&map->allocator, addr);
+        fclose(file);
+        return COL_ERR_IO;
+    }
+    fclose(file);
+
+    map->addr = addr;
+    map->len = (size_t)len;
+#endif
+
+    return COL_ERR_OK;
+}
+
+/* Releases a mapping once no column uses it */
+static void col_file_release(void *ctx) {
+    col_file_map_t *map = ctx;
+    const mlc_allocator_t allocator = map->allocator;
+
+    col_dict_free(map->dict);
+#ifdef COL_FILE_MMAP
+    munmap(map->addr, map->len);
+#else
+    mlc_free(&allocator, map->addr);
+#endif
+    mlc_free(&allocator, map);
+}
+
+/* Whether `n` bytes at `offset` lie within an aligned section of the file */
+static int col_file_section_valid(
+    const uint64_t offset,
+    const uint64_t n,
+    const uint64_t len
+) {
+    return offset % COL_DATA_ALIGN == 0 && offset <= len && n <= len - offset;
+}
+
+/* Whether the `n` bytes of packed strings at `offset` end with a NUL */
+static int col_file_strings_valid(
+    const char *base,
+    const uint64_t offset,
+    const uint64_t n,
+    const uint64_t n_rows,
+    const uint64_t len
+) {
+    if (!col_file_section_valid(offset, n, len))
+        return 0;
+    return n_rows ? n && base[offset + n - 1] == '\0' : 1;
+}
+
+/* Whether every one of `n_rows` string offsets at `offset` points into the
+ * `n_bytes` packed strings, whose last byte is a NUL */
+static int col_file_offsets_valid(
+    const char *base,
+    const uint64_t offset,
+    const uint64_t n_rows,
+    const uint64_t n_bytes
+) {
+    for (uint64_t i = 0; i < n_rows; i++) {
+        uint64_t str_offset;
+        memcpy(&str_offset, base + offset + (i * sizeof(uint64_t)), sizeof(uint64_t));
+        if (str_offset >= n_bytes)
+            return 0;
+    }
+    return 1;
+}
+
+static int col_file_header_valid(const col_file_map_t *map) {
+    const char *base = map->addr;
+    const uint64_t len = map->len;
+
+    if (len < sizeof(col_file_header_t))
+        return 0;
+
+    const col_file_header_t *header = map->addr;
+    if (memcmp(header->magic, col_file_magic, sizeof(col_file_magic)))
+        return 0;
+    if (header->endian != COL_FILE_ENDIAN)
+        return 0;
+    if (header->version != COL_FILE_VERSION)
+        return 0;
+    if (header->file_len != len)
+        return 0;
+
+    /* name */
+    const uint64_t name_end = sizeof(col_file_header_t) + header->name_len;
+    if (header->name_len < 2 || header->name_len > len || name_end > len)
+        return 0;
+    if (base[name_end - 1] != '\0')
+        return 0;
+
+    /* data */
+    if (col_dtype_validate((col_dtype_t)header->dtype))
+        return 0;
+
+    const col_dtype_t dtype = (col_dtype_t)header->dtype;
+    switch (dtype) {
+        case COL_DTYPE_STRING:
+            /* offsets are mapped as `size_t` */
+            if (sizeof(size_t) != sizeof(uint64_t))
+                return 0;
+            if (header->stride != sizeof(uint64_t))
+                return 0;
+            break;
+        case COL_DTYPE_CATEGORY:
+            if (header->stride != sizeof(uint8_t)
+                && header->stride != sizeof(uint16_t)
+                && header->stride != sizeof(int32_t))
+                return 0;
+            break;
+        default:
+            if (header->stride != col_dtype_stride(dtype))
+                return 0;
+    }
+
+    if (header->n_rows > len / header->stride)
+        return 0;
+    if (!col_file_section_valid(
+        header->data_offset,
+        header->n_rows * header->stride,
+        len
+    ))
+        return 0;
+
+    /* validity */
+    if (header->null_count > header->n_rows)
+        return 0;
+    if (header->null_count && !col_file_section_valid(
+        header->validity_offset,
+        col_validity_bytes(header->n_rows),
+        len
+    ))
+        return 0;
+
+    /* strings */
+    if (dtype == COL_DTYPE_STRING && !col_file_strings_valid(
+        base,
+        header->bytes_offset,
+        header->bytes_len,
+        header->n_rows,
+        len
+    ))
+        return 0;
+
+    if (dtype == COL_DTYPE_CATEGORY) {
+        if (header->dict_rows > INT32_MAX)
+            return 0;
+        if (!col_file_section_valid(
+            header->dict_offset,
+            header->dict_rows * sizeof(uint64_t),
+            len
+        ))
+            return 0;
+        if (!col_file_strings_valid(
+            base,
+            header->dict_bytes_offset,
+            header->dict_bytes_len,
+            header->dict_rows,
+            len
+        ))
+            return 0;
+        /* the dictionary is hashed on open, so its strings are read now */
+        if (!col_file_offsets_valid(
+            base,
+            header->dict_offset,
+            header->dict_rows,
+            header->dict_bytes_len
+        ))
+            return 0;
+    }
+
+    return 1;
+}
+
+/* Creates a borrowed column over mapped sections */
+static col_t *col_file_borrow(
+    const char *name,
+    const col_file_map_t *map,
+    const col_file_header_t *header,
+    const uint64_t data_offset,
+    const uint64_t n_rows,
+    const col_dtype_t dtype,
+    const uint64_t bytes_offset,
+    const uint64_t bytes_len
+) {
+    const mlc_allocator_t *allocator = &map->allocator;
+    char *base = map->addr;
+
+    /* alloc */
+    struct col *col = mlc_alloc(allocator, sizeof(struct col), sizeof(void *));
+    if (!col)
+        return NULL;
+
+    char *tmp_name = mlc_strdup(allocator, name);
+    if (!tmp_name) {
+        mlc_free(allocator, col);
+        return NULL;
+    }
+
+    /* assign */
+    const size_t stride = dtype == COL_DTYPE_STRING
+        ? sizeof(size_t)
+        : (size_t)header->stride;
+    const struct col src = {
+        tmp_name,
+        base + data_offset,
+        (size_t)n_rows,
+        (size_t)n_rows,
+        dtype,
+        stride,
+        {
+            dtype == COL_DTYPE_STRING ? base + bytes_offset : NULL,
+            (size_t)bytes_len,
+            (size_t)bytes_len,
+            0
+        },
+        NULL,
+        NULL,
+        0,
+        COL_FLAG_BORROWED,
+        NULL,
+        *allocator
+    };
+    memcpy(col, &src, sizeof(struct col));
+
+    return col;
+}
+
+col_t *col_open_mmap(const char *path, int *err_out) {
+    /* args */
+    if (!path)
+        return mlc_fail_null(COL_ERR_NO_DATA, err_out);
+
+    /* map */
+    const mlc_allocator_t *allocator = mlc_allocator_global();
+    col_file_map_t *map = mlc_alloc(
+        allocator,
+        sizeof(col_file_map_t),
+        sizeof(void *)
+    );
+    if (!map)
+        return mlc_fail_null(COL_ERR_OOM, err_out);
+    map->dict = NULL;
+    map->allocator = *allocator;
+
+    int err_code = col_file_map(map, path);
+    if (err_code) {
+        mlc_free(allocator, map);
+        return mlc_fail_null(err_code, err_out);
+    }
+
+    /* from here on, releasing the map undoes everything */
+    err_code = COL_ERR_PARSE;
+    if (!col_file_header_valid(map))
+        goto fail_header;
+
+    const col_file_header_t *header = map->addr;
+    const char *name = (const char *)map->addr + sizeof(col_file_header_t);
+    const col_dtype_t dtype = (col_dtype_t)header->dtype;
+
+    /* alloc */
+    err_code = COL_ERR_OOM;
+
+    if (dtype == COL_DTYPE_CATEGORY) {
+        col_t *values = col_file_borrow(
+            "categories",
+            map,
+            header,
+            header->dict_offset,
+            header->dict_rows,
+            COL_DTYPE_STRING,
+            header->dict_bytes_offset,
+            header->dict_bytes_len
+        );
+        if (!values)
+            goto fail_header;
+        map->dict = col_dict_wrap(values);
+        if (!map->dict) {
+            col_free(values);
+            goto fail_header;
+        }
+    }
+
+    col_share_t *share = mlc_alloc(
+        allocator,
+        sizeof(col_share_t),
+        sizeof(void *)
+    );
+    if (!share)
+        goto fail_header;
+    share->refs = 1;
+    share->release = col_file_release;
+    share->ctx = map;
+
+    struct col *col = col_file_borrow(
+        name,
+        map,
+        header,
+        header->data_offset,
+        header->n_rows,
+        dtype,
+        header->bytes_offset,
+        header->bytes_len
+    );
+    if (!col)
+        goto fail_col;
+
+    /* assign */
+    col->dict = map->dict;
+    col->share = share;
+
+    /* validity is small and mutated without a copy, so it is owned */
+    if (header->null_count) {
+        if (col_validity_init(col)) {
+            col_free(col);
+            return mlc_fail_null(COL_ERR_OOM, err_out);
+        }
+        memcpy(
+            col->validity,
+            (const char *)map->addr + header->validity_offset,
+            col_validity_bytes(col->n_rows)
+        );
+        col->null_count = (size_t)header->null_count;
+    }
+
+    return col;
+
+fail_col:
+    mlc_free(allocator, share);
+fail_header:
+    col_file_release(map);
+    return mlc_fail_null(err_code, err_out);
+}
@@ -0,0 +1,999 @@
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "core/cpu.h"
+#include "core/error.h"
+#include "core/simd.h"
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/buffer.h"
+#include "dtypes/col/core/internal.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/col/core/validity.h"
+#include "dtypes/col/ops/arith.h"
+
+/* `b` and `c` point either to a column's data or to one `col_scalar_t` */
+typedef void (*col_unary_fn)(void *dst, const void *a, const size_t n);
+
+typedef void (*col_binary_fn)(
+    void *dst,
+    const void *a,
+    const void *b,
+    const size_t n
+);
+
+typedef void (*col_ternary_fn)(
+    void *dst,
+    const void *a,
+    const void *b,
+    const void *c,
+    const size_t n
+);
+
+/* element helpers */
+
+#define COL_FLOAT_OPS(T, ABS, SQRT, LOG, EXP)                               \
+    static inline T col_op_add_##T(const T x, const T y) { return x + y; }  \
+    static inline T col_op_sub_##T(const T x, const T y) { return x - y; }  \
+    static inline T col_op_mul_##T(const T x, const T y) { return x * y; }  \
+    static inline T col_op_div_##T(const T x, const T y) { return x / y; }  \
+    static inline T col_op_fma_##T(const T x, const T y, const T z) {       \
+        return x * y + z;                                                   \
+    }                                                                       \
+    static inline T col_op_clip_##T(const T x, const T lo, const T hi) {    \
+        return x < lo ? lo : (x > hi ? hi : x);                             \
+    }                                                                       \
+    static inline T col_op_abs_##T(const T x) { return ABS(x); }            \
+    static inline T col_op_sqrt_##T(const T x) { return SQRT(x); }          \
+    static inline T col_op_log_##T(const T x) { return LOG(x); }            \
+    static inline T col_op_exp_##T(const T x) { return EXP(x); }
+
+/* Signed overflow is undefined, so integers wrap through unsigned `U` */
+#define COL_INT_OPS(T, U)                                                   \
+    static inline T col_op_add_##T(const T x, const T y) {                  \
+        return (T)((U)x + (U)y);                                            \
+    }                                                                       \
+    static inline T col_op_sub_##T(const T x, const T y) {                  \
+        return (T)((U)x - (U)y);                                            \
+    }                                                                       \
+    static inline T col_op_mul_##T(const T x, const T y) {                  \
+        return (T)((U)x * (U)y);                                            \
+    }                                                                       \
+    static inline T col_op_fma_##T(const T x, const T y, const T z) {       \
+        return (T)((U)x * (U)y + (U)z);                                     \
+    }                                                                       \
+    static inline T col_op_clip_##T(const T x, const T lo, const T hi) {    \
+        return x < lo ? lo : (x > hi ? hi : x);                             \
+    }
+
+/* Zero divisors are marked null by the driver, so their value is moot.
+ * `x / -1` is negation, which also covers `T_MIN / -1`. */
+#define COL_SINT_OPS(T, U)                                                  \
+    COL_INT_OPS(T, U)                                                       \
+    static inline T col_op_div_##T(const T x, const T y) {                  \
+        if (!y)                                                             \
+            return 0;                                                       \
+        if (y == -1)                                                        \
+            return (T)(0 - (U)x);                                           \
+        return x / y;                                                       \
+    }                                                                       \
+    static inline T col_op_abs_##T(const T x) {                             \
+        return x < 0 ? (T)(0 - (U)x) : x;                                   \
+    }
+
+COL_FLOAT_OPS(double, fabs, sqrt, log, exp)
+COL_FLOAT_OPS(float, fabsf, sqrtf, logf, expf)
+COL_SINT_OPS(int64_t, uint64_t)
+COL_SINT_OPS(int32_t, uint32_t)
+COL_INT_OPS(uint8_t, unsigned)
+
+static inline uint8_t col_op_div_uint8_t(const uint8_t x, const uint8_t y) {
+    return y ? x / y : 0;
+}
+
+static inline uint8_t col_op_abs_uint8_t(const uint8_t x) {
+    return x;
+}
+
+/* scalar kernels */
+
+#define COL_SCALAR_BINARY(T, op)                                            \
+    static void col_vv_scalar_##T##_##op(                                   \
+        void *dst,                                                          \
+        const void *a,                                                      \
+        const void *b,                                                      \
+        const size_t n                                                      \
+    ) {                                                                     \
+        T *d = dst;                                                         \
+        const T *x = a, *y = b;                                             \
+        for (size_t i = 0; i < n; i++)                                      \
+            d[i] = col_op_##op##_##T(x[i], y[i]);                           \
+    }                                                                       \
+    static void col_vs_scalar_##T##_##op(                                   \
+        void *dst,                                                          \
+        const void *a,                                                      \
+        const void *b,                                                      \
+        const size_t n                                                      \
+    ) {                                                                     \
+        T *d = dst;                                                         \
+        const T *x = a, s = *(const T *)b;                                  \
+        for (size_t i = 0; i < n; i++)                                      \
+            d[i] = col_op_##op##_##T(x[i], s);                              \
+    }
+
+#define COL_SCALAR_UNARY(T, op)                                             \
+    static void col_unary_scalar_##T##_##op(                                \
+        void *dst,                                                          \
+        const void *a,                                                      \
+        const size_t n                                                      \
+    ) {                                                                     \
+        T *d = dst;                                                         \
+        const T *x = a;                                                     \
+        for (size_t i = 0; i < n; i++)                                      \
+            d[i] = col_op_##op##_##T(x[i]);                                 \
+    }
+
+#define COL_SCALAR_TERNARY(T)                                               \
+    static void col_fma_vvv_scalar_##T(                                     \
+        void *dst,                                                          \
+        const void *a,                                                      \
+        const void *b,                                                      \
+        const void *c,                                                      \
+        const size_t n                                                      \
+    ) {                                                                     \
+        T *d = dst;                                                         \
+        const T *x = a, *y = b, *z = c;                                     \
+        for (size_t i = 0; i < n; i++)                                      \
+            d[i] = col_op_fma_##T(x[i], y[i], z[i]);                        \
+    }                                                                       \
+    static void col_fma_vss_scalar_##T(                                     \
+        void *dst,                                                          \
+        const void *a,                                                      \
+        const void *b,                                                      \
+        const void *c,                                                      \
+        const size_t n                                                      \
+    ) {                                                                     \
+        T *d = dst;                                                         \
+        const T *x = a, mul = *(const T *)b, add = *(const T *)c;           \
+        for (size_t i = 0; i < n; i++)                                      \
+            d[i] = col_op_fma_##T(x[i], mul, add);                          \
+    }                                                                       \
+    static void col_clip_scalar_##T(                                        \
+        void *dst,                                                          \
+        const void *a,                                                      \
+        const void *b,                                                      \
+        const void *c,                                                      \
+        const size_t n                                                      \
+    ) {                                                                     \
+        T *d = dst;                                                         \
+        const T *x = a, lo = *(const T *)b, hi = *(const T *)c;             \
+        for (size_t i = 0; i < n; i++)                                      \
+            d[i] = col_op_clip_##T(x[i], lo, hi);                           \
+    }
+
+#define COL_SCALAR_ALL(T)                                                   \
+    COL_SCALAR_BINARY(T, add)                                               \
+    COL_SCALAR_BINARY(T, sub)                                               \
+    COL_SCALAR_BINARY(T, mul)                                               \
+    COL_SCALAR_BINARY(T, div)                                               \
+    COL_SCALAR_UNARY(T, abs)                                                \
+    COL_SCALAR_TERNARY(T)
+
+COL_SCALAR_ALL(double)
+COL_SCALAR_ALL(float)
+COL_SCALAR_ALL(int64_t)
+COL_SCALAR_ALL(int32_t)
+COL_SCALAR_ALL(uint8_t)
+
+COL_SCALAR_UNARY(double, sqrt)
+COL_SCALAR_UNARY(double, log)
+COL_SCALAR_UNARY(double, exp)
+COL_SCALAR_UNARY(float, sqrt)
+COL_SCALAR_UNARY(float, log)
+COL_SCALAR_UNARY(float, exp)
+
+/* SIMD kernels
+ *
+ * Only `double` and `float` are vectorized by hand; `log` and `exp` stay on
+ * libm. Each (isa, T) pair provides: vec type, width, load/store/set1 and
+ * add/sub/mul/div/fma/abs/sqrt/min/max. Tails reuse the element helpers. */
+
+#ifdef MLC_SIMD_X86
+
+#define col_avx2_double_vec __m256d
+#define col_avx2_double_width 4
+#define col_avx2_double_load _mm256_loadu_pd
+#define col_avx2_double_store _mm256_storeu_pd
+#define col_avx2_double_set1 _mm256_set1_pd
+#define col_avx2_double_add _mm256_add_pd
+#define col_avx2_double_sub _mm256_sub_pd
+#define col_avx2_double_mul _mm256_mul_pd
+#define col_avx2_double_div _mm256_div_pd
+#define col_avx2_double_fma _mm256_fmadd_pd
+#define col_avx2_double_sqrt _mm256_sqrt_pd
+#define col_avx2_double_min _mm256_min_pd
+#define col_avx2_double_max _mm256_max_pd
+#define col_avx2_double_abs(v) _mm256_andnot_pd(_mm256_set1_pd(-0.0), (v))
+
+#define col_avx2_float_vec __m256
+#define col_avx2_float_width 8
+#define col_avx2_float_load _mm256_loadu_ps
+#define col_avx2_float_store _mm256_storeu_ps
+#define col_avx2_float_set1 _mm256_set1_ps
+#define col_avx2_float_add _mm256_add_ps
+#define col_avx2_float_sub _mm256_sub_ps
+#define col_avx2_float_mul _mm256_mul_ps
+#define col_avx2_float_div _mm256_div_ps
+#define col_avx2_float_fma _mm256_fmadd_ps
+#define col_avx2_float_sqrt _mm256_sqrt_ps
+#define col_avx2_float_min _mm256_min_ps
+#define col_avx2_float_max _mm256_max_ps
+#define col_avx2_float_abs(v) _mm256_andnot_ps(_mm256_set1_ps(-0.0f), (v))
+
+#define col_avx512_double_vec __m512d
+#define col_avx512_double_width 8
+#define col_avx512_double_load _mm512_loadu_pd
+#define col_avx512_double_store _mm512_storeu_pd
+#define col_avx512_double_set1 _mm512_set1_pd
+#define col_avx512_double_add _mm512_add_pd
+#define col_avx512_double_sub _mm512_sub_pd
+#define col_avx512_double_mul _mm512_mul_pd
+#define col_avx512_double_div _mm512_div_pd
+#define col_avx512_double_fma _mm512_fmadd_pd
+#define col_avx512_double_sqrt _mm512_sqrt_pd
+#define col_avx512_double_min _mm512_min_pd
+#define col_avx512_double_max _mm512_max_pd
+#define col_avx512_double_abs _mm512_abs_pd
+
+#define col_avx512_float_vec __m512
+#define col_avx512_float_width 16
+#define col_avx512_float_load _mm512_loadu_ps
+#define col_avx512_float_store _mm512_storeu_ps
+#define col_avx512_float_set1 _mm512_set1_ps
+#define col_avx512_float_add _mm512_add_ps
+#define col_avx512_float_sub _mm512_sub_ps
+#define col_avx512_float_mul _mm512_mul_ps
+#define col_avx512_float_div _mm512_div_ps
+#define col_avx512_float_fma _mm512_fmadd_ps
+#define col_avx512_float_sqrt _mm512_sqrt_ps
+#define col_avx512_float_min _mm512_min_ps
+#define col_avx512_float_max _mm512_max_ps
+#define col_avx512_float_abs _mm512_abs_ps
+
+#define COL_SIMD_BINARY(isa, TARGET, T, op)                                 \
+    TARGET static void col_vv_##isa##_##T##_##op(                           \
+        void *dst,                                                          \
+        const void *a,                                                      \
+        const void *b,                                                      \
+        const size_t n                                                      \
+    ) {                                                                     \
+        T *d = dst;                                                         \
+        const T *x = a, *y = b;                                             \
+        size_t i = 0;                                                       \
+        for (; i + col_##isa##_##T##_width <= n; i += col_##isa##_##T##_width)\
+            col_##isa##_##T##_store(d + i, col_##isa##_##T##_##op(          \
+                col_##isa##_##T##_load(x + i),                              \
+                col_##isa##_##T##_load(y + i)                               \
+            ));                                                             \
+        for (; i < n; i++)                                                  \
+            d[i] = col_op_##op##_##T(x[i], y[i]);                           \
+    }                                                                       \
+    TARGET static void col_vs_##isa##_##T##_##op(                           \
+        void *dst,                                                          \
+        const void *a,                                                      \
+        const void *b,                                                      \
+        const size_t n                                                      \
+    ) {                                                                     \
+        T *d = dst;                                                         \
+        const T *x = a, s = *(const T *)b;                                  \
+        const col_##isa##_##T##_vec vs = col_##isa##_##T##_set1(s);         \
+        size_t i = 0;                                                       \
+        for (; i + col_##isa##_##T##_width <= n; i += col_##isa##_##T##_width)\
+            col_##isa##_##T##_store(d + i, col_##isa##_##T##_##op(          \
+                col_##isa##_##T##_load(x + i), vs                           \
+            ));                                                             \
+        for (; i < n; i++)                                                  \
+            d[i] = col_op_##op##_##T(x[i], s);                              \
+    }
+
+#define COL_SIMD_UNARY(isa, TARGET, T, op)                                  \
+    TARGET static void col_unary_##isa##_##T##_##op(                        \
+        void *dst,                                                          \
+        const void *a,                                                      \
+        const size_t n                                                      \
+    ) {                                                                     \
+        T *d = dst;                                                         \
+        const T *x = a;                                                     \
+        size_t i = 0;                                                       \
+        for (; i + col_##isa##_##T##_width <= n; i += col_##isa##_##T##_width)\
+            col_##isa##_##T##_store(d + i, col_##isa##_##T##_##op(          \
+                col_##isa##_##T##_load(x + i)                               \
+            ));                                                             \
+        for (; i < n; i++)                                                  \
+            d[i] = col_op_##op##_##T(x[i]);                                 \
+    }
+
+/* `max(lo, x)` returns `x` when it is NaN, and so does `min(hi, ...)`,
+ * matching the scalar helper. */
+#define COL_SIMD_TERNARY(isa, TARGET, T)                                    \
+    TARGET static void col_fma_vvv_##isa##_##T(                             \
+        void *dst,                                                          \
+        const void *a,                                                      \
+        const void *b,                                                      \
+        const void *c,                                                      \
+        const size_t n                                                      \
+    ) {                                                                     \
+        T *d = dst;                                                         \
+        const T *x = a, *y = b, *z = c;                                     \
+        size_t i = 0;                                                       \
+        for (; i + col_##isa##_##T##_width <= n; i += col_##isa##_##T##_width)\
+            col_##isa##_##T##_store(d + i, col_##isa##_##T##_fma(           \
+                col_##isa##_##T##_load(x + i),                              \
+                col_##isa##_##T##_load(y + i),                              \
+                col_##isa##_##T##_load(z + i)                               \
+            ));                                                             \
+        for (; i < n; i++)                                                  \
+            d[i] = col_op_fma_##T(x[i], y[i], z[i]);                        \
+    }                                                                       \
+    TARGET static void col_fma_vss_##isa##_##T(                             \
+        void *dst,                                                          \
+        const void *a,                                                      \
+        const void *b,                                                      \
+        const void *c,                                                      \
+        const size_t n                                                      \
+    ) {                                                                     \
+        T *d = dst;                                                         \
+        const T *x = a, mul = *(const T *)b, add = *(const T *)c;           \
+        const col_##isa##_##T##_vec vm = col_##isa##_##T##_set1(mul);       \
+        const col_##isa##_##T##_vec va = col_##isa##_##T##_set1(add);       \
+        size_t i = 0;                                                       \
+        for (; i + col_##isa##_##T##_width <= n; i += col_##isa##_##T##_width)\
+            col_##isa##_##T##_store(d + i, col_##isa##_##T##_fma(           \
+                col_##isa##_##T##_load(x + i), vm, va                       \
+            ));                                                             \
+        for (; i < n; i++)                                                  \
+            d[i] = col_op_fma_##T(x[i], mul, add);                          \
+    }                                                                       \
+    TARGET static void col_clip_##isa##_##T(                                \
+        void *dst,                                                          \
+        const void *a,                                                      \
+        const void *b,                                                      \
+        const void *c,                                                      \
+        const size_t n                                                      \
+    ) {                                                                     \
+        T *d = dst;                                                         \
+        const T *x = a, lo = *(const T *)b, hi = *(const T *)c;             \
+        const col_##isa##_##T##_vec vlo = col_##isa##_##T##_set1(lo);       \
+        const col_##isa##_##T##_vec vhi = col_##isa##_##T##_set1(hi);       \
+        size_t i = 0;                                                       \
+        for (; i + col_##isa##_##T##_width <= n; i += col_##isa##_##T##_width)\
+            col_##isa##_##T##_store(d + i, col_##isa##_##T##_min(           \
+                vhi, col_##isa##_##T##_max(vlo, col_##isa##_##T##_load(x + i))\
+            ));                                                             \
+        for (; i < n; i++)                                                  \
+            d[i] = col_op_clip_##T(x[i], lo, hi);                           \
+    }
+
+#define COL_SIMD_ALL(isa, TARGET, T)                                        \
+    COL_SIMD_BINARY(isa, TARGET, T, add)                                    \
+    COL_SIMD_BINARY(isa, TARGET, T, sub)                                    \
+    COL_SIMD_BINARY(isa, TARGET, T, mul)                                    \
+    COL_SIMD_BINARY(isa, TARGET, T, div)                                    \
+    COL_SIMD_UNARY(isa, TARGET, T, abs)                                     \
+    COL_SIMD_UNARY(isa, TARGET, T, sqrt)                                    \
+    COL_SIMD_TERNARY(isa, TARGET, T)
+
+COL_SIMD_ALL(avx2, MLC_TARGET_AVX2, double)
+COL_SIMD_ALL(avx2, MLC_TARGET_AVX2, float)
+COL_SIMD_ALL(avx512, MLC_TARGET_AVX512, double)
+COL_SIMD_ALL(avx512, MLC_TARGET_AVX512, float)
+
+#endif
+
+/* dispatch tables, indexed by [isa][dtype](...). Integer dtypes only ever
+ * dispatch to the scalar row, see `col_arith_isa`. */
+
+#define COL_BINOPS_OF(kind, isa, T) {                                       \
+    [COL_OP_ADD] = col_##kind##_##isa##_##T##_add,                          \
+    [COL_OP_SUB] = col_##kind##_##isa##_##T##_sub,                          \
+    [COL_OP_MUL] = col_##kind##_##isa##_##T##_mul,                          \
+    [COL_OP_DIV] = col_##kind##_##isa##_##T##_div                           \
+}
+
+#define COL_BINARY_ROW(kind, isa) {                                         \
+    [COL_DTYPE_DOUBLE] = COL_BINOPS_OF(kind, isa, double),                  \
+    [COL_DTYPE_FLOAT] = COL_BINOPS_OF(kind, isa, float)                     \
+}
+
+#define COL_BINARY_ROW_SCALAR(kind) {                                       \
+    [COL_DTYPE_DOUBLE] = COL_BINOPS_OF(kind, scalar, double),               \
+    [COL_DTYPE_FLOAT] = COL_BINOPS_OF(kind, scalar, float),                 \
+    [COL_DTYPE_INT64] = COL_BINOPS_OF(kind, scalar, int64_t),               \
+    [COL_DTYPE_INT32] = COL_BINOPS_OF(kind, scalar, int32_t),               \
+    [COL_DTYPE_UINT8] = COL_BINOPS_OF(kind, scalar, uint8_t)                \
+}
+
+/* `log` and `exp` use libm on every ISA */
+#define COL_UNOPS_FLOAT(isa, T) {                                           \
+    [COL_OP_ABS] = col_unary_##isa##_##T##_abs,                             \
+    [COL_OP_SQRT] = col_unary_##isa##_##T##_sqrt,                           \
+    [COL_OP_LOG] = col_unary_scalar_##T##_log,                              \
+    [COL_OP_EXP] = col_unary_scalar_##T##_exp                               \
+}
+
+#define COL_UNARY_ROW(isa) {                                                \
+    [COL_DTYPE_DOUBLE] = COL_UNOPS_FLOAT(isa, double),                      \
+    [COL_DTYPE_FLOAT] = COL_UNOPS_FLOAT(isa, float)                         \
+}
+
+#define COL_TERNARY_ROW(kind, isa) {                                        \
+    [COL_DTYPE_DOUBLE] = col_##kind##_##isa##_double,                       \
+    [COL_DTYPE_FLOAT] = col_##kind##_##isa##_float                          \
+}
+
+#define COL_TERNARY_ROW_SCALAR(kind) {                                      \
+    [COL_DTYPE_DOUBLE] = col_##kind##_scalar_double,                        \
+    [COL_DTYPE_FLOAT] = col_##kind##_scalar_float,                          \
+    [COL_DTYPE_INT64] = col_##kind##_scalar_int64_t,                        \
+    [COL_DTYPE_INT32] = col_##kind##_scalar_int32_t,                        \
+    [COL_DTYPE_UINT8] = col_##kind##_scalar_uint8_t                         \
+}
+
+static const col_binary_fn
+col_vv_kernels[MLC_ISA_COUNT][COL_DTYPE_UINT8 + 1][COL_BINOPS] = {
+    [MLC_ISA_SCALAR] = COL_BINARY_ROW_SCALAR(vv),
+#ifdef MLC_SIMD_X86
+    [MLC_ISA_AVX2] = COL_BINARY_ROW(vv, avx2),
+    [MLC_ISA_AVX512] = COL_BINARY_ROW(vv, avx512)
+#endif
+};
+
+static const col_binary_fn
+col_vs_kernels[MLC_ISA_COUNT][COL_DTYPE_UINT8 + 1][COL_BINOPS] = {
+    [MLC_ISA_SCALAR] = COL_BINARY_ROW_SCALAR(vs),
+#ifdef MLC_SIMD_X86
+    [MLC_ISA_AVX2] = COL_BINARY_ROW(vs, avx2),
+    [MLC_ISA_AVX512] = COL_BINARY_ROW(vs, avx512)
+#endif
+};
+
+static const col_unary_fn
+col_unary_kernels[MLC_ISA_COUNT][COL_DTYPE_UINT8 + 1][COL_UNOPS] = {
+    [MLC_ISA_SCALAR] = {
+        [COL_DTYPE_DOUBLE] = COL_UNOPS_FLOAT(scalar, double),
+        [COL_DTYPE_FLOAT] = COL_UNOPS_FLOAT(scalar, float),
+        [COL_DTYPE_INT64] = { [COL_OP_ABS] = col_unary_scalar_int64_t_abs },
+        [COL_DTYPE_INT32] = { [COL_OP_ABS] = col_unary_scalar_int32_t_abs },
+        [COL_DTYPE_UINT8] = { [COL_OP_ABS] = col_unary_scalar_uint8_t_abs }
+    },
+#ifdef MLC_SIMD_X86
+    [MLC_ISA_AVX2] = COL_UNARY_ROW(avx2),
+    [MLC_ISA_AVX512] = COL_UNARY_ROW(avx512)
+#endif
+};
+
+static const col_ternary_fn
+col_fma_vvv_kernels[MLC_ISA_COUNT][COL_DTYPE_UINT8 + 1] = {
+    [MLC_ISA_SCALAR] = COL_TERNARY_ROW_SCALAR(fma_vvv),
+#ifdef MLC_SIMD_X86
+    [MLC_ISA_AVX2] = COL_TERNARY_ROW(fma_vvv, avx2),
+    [MLC_ISA_AVX512] = COL_TERNARY_ROW(fma_vvv, avx512)
+#endif
+};
+
+static const col_ternary_fn
+col_fma_vss_kernels[MLC_ISA_COUNT][COL_DTYPE_UINT8 + 1] = {
+    [MLC_ISA_SCALAR] = COL_TERNARY_ROW_SCALAR(fma_vss),
+#ifdef MLC_SIMD_X86
+    [MLC_ISA_AVX2] = COL_TERNARY_ROW(fma_vss, avx2),
+    [MLC_ISA_AVX512] = COL_TERNARY_ROW(fma_vss, avx512)
+#endif
+};
+
+static const col_ternary_fn
+col_clip_kernels[MLC_ISA_COUNT][COL_DTYPE_UINT8 + 1] = {
+    [MLC_ISA_SCALAR] = COL_TERNARY_ROW_SCALAR(clip),
+#ifdef MLC_SIMD_X86
+    [MLC_ISA_AVX2] = COL_TERNARY_ROW(clip, avx2),
+    [MLC_ISA_AVX512] = COL_TERNARY_ROW(clip, avx512)
+#endif
+};
+
+/* drivers */
+
+/* SSE2 is the x86-64 baseline the scalar loops are already compiled for */
+static mlc_isa_t col_arith_isa(const col_dtype_t dtype) {
+    if (dtype != COL_DTYPE_DOUBLE && dtype != COL_DTYPE_FLOAT)
+        return MLC_ISA_SCALAR;
+    const mlc_isa_t isa = mlc_cpu_isa();
+    return isa < MLC_ISA_AVX2 ? MLC_ISA_SCALAR : isa;
+}
+
+/* Checks that `b` is a valid operand alongside `a`. `b` may be NULL. */
+static int col_arith_validate(const col_t *a, const col_t *b) {
+    if (!a)
+        return COL_ERR_NO_DATA;
+    if (!col_dtype_is_numeric(a->dtype))
+        return COL_ERR_INVALID_DTYPE;
+    if (!b)
+        return COL_ERR_OK;
+    if (b->dtype != a->dtype)
+        return COL_ERR_INVALID_DTYPE;
+    if (b->n_rows != a->n_rows)
+        return COL_ERR_INVALID_ARG;
+    return COL_ERR_OK;
+}
+
+/* Sizes `dst` to hold the result of an operation over `a` */
+static int col_arith_prepare(col_t *dst, const col_t *a) {
+    if (!dst)
+        return COL_ERR_NO_DATA;
+    if (dst->dtype != a->dtype)
+        return COL_ERR_INVALID_DTYPE;
+    if (col_data_detach(dst))
+        return COL_ERR_OOM;
+    if (dst == a)
+        return COL_ERR_OK;
+    if (col_reserve(dst, a->n_rows))
+        return COL_ERR_OOM;
+    dst->n_rows = a->n_rows;
+    return COL_ERR_OK;
+}
+
+/* Sets the validity of `dst` to the AND of its operands. `b`, `c` may be
+ * NULL. Must run before the kernel when `dst` aliases an operand. */
+static int col_arith_validity(
+    col_t *dst,
+    const col_t *a,
+    const col_t *b,
+    const col_t *c
+) {
+    const col_t *srcs[] = { a, b, c };
+    const size_t n = dst->n_rows;
+
+    int any_nulls = 0;
+    for (size_t s = 0; s < 3; s++)
+        any_nulls |= srcs[s] && srcs[s]->null_count;
+
+    if (!any_nulls) {
+        if (dst->validity)
+            col_validity_fill(dst, 0, n, 1);
+        dst->null_count = 0;
+        return COL_ERR_OK;
+    }
+
+    if (col_validity_init(dst))
+        return COL_ERR_OOM;
+
+    const size_t n_bytes = col_validity_bytes(n);
+    size_t n_valid = 0;
+    for (size_t i = 0; i < n_bytes; i++) {
+        uint8_t bits = 0xFF;
+        for (size_t s = 0; s < 3; s++)
+            if (srcs[s] && srcs[s]->null_count)
+                bits &= srcs[s]->validity[i];
+        dst->validity[i] = bits;
+
+        /* ignore bits past the last row */
+        if (i == n_bytes - 1 && n % 8)
+            bits &= (uint8_t)((1u << (n % 8)) - 1);
+        n_valid += (size_t)__builtin_popcount(bits);
+    }
+    dst->null_count = n - n_valid;
+
+    return COL_ERR_OK;
+}
+
+/* Marks rows with a zero integer divisor as null */
+static int col_arith_div_nulls(col_t *dst, const col_t *b) {
+    for (size_t i = 0; i < b->n_rows; i++) {
+        int zero;
+        switch (b->dtype) {
+            case COL_DTYPE_INT64:
+                zero = !((const int64_t *)b->data)[i];
+                break;
+            case COL_DTYPE_INT32:
+                zero = !((const int32_t *)b->data)[i];
+                break;
+            default:
+                zero = !((const uint8_t *)b->data)[i];
+                break;
+        }
+        if (!zero || (dst->null_count && !col_bit_get(dst->validity, i)))
+            continue;
+        if (col_validity_init(dst))
+            return COL_ERR_OOM;
+        col_bit_set(dst->validity, i, 0);
+        dst->null_count++;
+    }
+    return COL_ERR_OK;
+}
+
+/* Converts `s` to the element type of `dtype`. Integer dtypes reject
+ * values they cannot hold exactly. */
+static int col_scalar_convert(
+    const col_dtype_t dtype,
+    const double s,
+    col_scalar_t *out
+) {
+    switch (dtype) {
+        case COL_DTYPE_DOUBLE:
+            out->f64 = s;
+            return COL_ERR_OK;
+        case COL_DTYPE_FLOAT:
+            out->f32 = (float)s;
+            return COL_ERR_OK;
+        default:
+            break;
+    }
+
+    /* also rejects NaN */
+    if (s != trunc(s))
+        return COL_ERR_INVALID_ARG;
+
+    switch (dtype) {
+        case COL_DTYPE_INT64:
+            if (s < -0x1p63 || s >= 0x1p63)
+                return COL_ERR_INVALID_ARG;
+            out->i64 = (int64_t)s;
+            return COL_ERR_OK;
+        case COL_DTYPE_INT32:
+            if (s < INT32_MIN || s > INT32_MAX)
+                return COL_ERR_INVALID_ARG;
+            out->i32 = (int32_t)s;
+            return COL_ERR_OK;
+        default:
+            if (s < 0 || s > UINT8_MAX)
+                return COL_ERR_INVALID_ARG;
+            out->u8 = (uint8_t)s;
+            return COL_ERR_OK;
+    }
+}
+
+/* Converts a clip bound, rounding integers towards the inside of the range
+ * and saturating at the dtype limits */
+static void col_bound_convert(
+    const col_dtype_t dtype,
+    const double v,
+    const int round_up,
+    col_scalar_t *out
+) {
+    const double r = round_up ? ceil(v) : floor(v);
+    switch (dtype) {
+        case COL_DTYPE_DOUBLE:
+            out->f64 = v;
+            break;
+        case COL_DTYPE_FLOAT:
+            out->f32 = (float)v;
+            break;
+        case COL_DTYPE_INT64:
+            out->i64 = r < -0x1p63 ? INT64_MIN
+                : r >= 0x1p63 ? INT64_MAX
+                : (int64_t)r;
+            break;
+        case COL_DTYPE_INT32:
+            out->i32 = r < INT32_MIN ? INT32_MIN
+                : r > INT32_MAX ? INT32_MAX
+                : (int32_t)r;
+            break;
+        default:
+            out->u8 = r < 0 ? 0 : r > UINT8_MAX ? UINT8_MAX : (uint8_t)r;
+            break;
+    }
+}
+
+static int col_scalar_less(
+    const col_dtype_t dtype,
+    const col_scalar_t *x,
+    const col_scalar_t *y
+) {
+    switch (dtype) {
+        case COL_DTYPE_DOUBLE:
+            return x->f64 < y->f64;
+        case COL_DTYPE_FLOAT:
+            return x->f32 < y->f32;
+        case COL_DTYPE_INT64:
+            return x->i64 < y->i64;
+        case COL_DTYPE_INT32:
+            return x->i32 < y->i32;
+        default:
+            return x->u8 < y->u8;
+    }
+}
+
+/* Wraps an `_into` call to allocate its destination */
+static col_t *col_arith_alloc(const col_t *a, int *err_out) {
+    if (!a)
+        return mlc_fail_null(COL_ERR_NO_DATA, err_out);
+    if (!col_dtype_is_numeric(a->dtype))
+        return mlc_fail_null(COL_ERR_INVALID_DTYPE, err_out);
+    return col_create_with_capacity(a->name, a->n_rows, a->dtype, err_out);
+}
+
+static col_t *col_arith_result(col_t *dst, const int err, int *err_out) {
+    if (err) {
+        col_free(dst);
+        return mlc_fail_null(err, err_out);
+    }
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    return dst;
+}
+
+/* binary */
+
+int col_binary_into(
+    col_t *dst,
+    const col_t *a,
+    const col_t *b,
+    const col_binop_t op
+) {
+    /* args */
+    int err = col_arith_validate(a, b);
+    if (err)
+        return err;
+    if (!b)
+        return COL_ERR_NO_DATA;
+    if ((unsigned)op >= COL_BINOPS)
+        return COL_ERR_INVALID_ARG;
+    if ((err = col_arith_prepare(dst, a)))
+        return err;
+
+    /* validity */
+    if (col_arith_validity(dst, a, b, NULL))
+        return COL_ERR_OOM;
+    if (op == COL_OP_DIV
+        && a->dtype != COL_DTYPE_DOUBLE
+        && a->dtype != COL_DTYPE_FLOAT
+        && col_arith_div_nulls(dst, b))
+        return COL_ERR_OOM;
+
+    /* compute */
+    col_vv_kernels[col_arith_isa(a->dtype)][a->dtype][op](
+        dst->data, a->data, b->data, a->n_rows
+    );
+
+    return COL_ERR_OK;
+}
+
+col_t *col_binary(
+    const col_t *a,
+    const col_t *b,
+    const col_binop_t op,
+    int *err_out
+) {
+    col_t *dst = col_arith_alloc(a, err_out);
+    if (!dst)
+        return NULL;
+    return col_arith_result(dst, col_binary_into(dst, a, b, op), err_out);
+}
+
+int col_binary_inplace(col_t *a, const col_t *b, const col_binop_t op) {
+    return col_binary_into(a, a, b, op);
+}
+
+int col_binary_scalar_into(
+    col_t *dst,
+    const col_t *a,
+    const double s,
+    const col_binop_t op
+) {
+    /* args */
+    int err = col_arith_validate(a, NULL);
+    if (err)
+        return err;
+    if ((unsigned)op >= COL_BINOPS)
+        return COL_ERR_INVALID_ARG;
+
+    col_scalar_t scalar;
+    if ((err = col_scalar_convert(a->dtype, s, &scalar)))
+        return err;
+    if (op == COL_OP_DIV && s == 0
+        && a->dtype != COL_DTYPE_DOUBLE
+        && a->dtype != COL_DTYPE_FLOAT)
+        return COL_ERR_INVALID_ARG;
+    if ((err = col_arith_prepare(dst, a)))
+        return err;
+
+    /* validity */
+    if (col_arith_validity(dst, a, NULL, NULL))
+        return COL_ERR_OOM;
+
+    /* compute */
+    col_vs_kernels[col_arith_isa(a->dtype)][a->dtype][op](
+        dst->data, a->data, &scalar, a->n_rows
+    );
+
+    return COL_ERR_OK;
+}
+
+col_t *col_binary_scalar(
+    const col_t *a,
+    const double s,
+    const col_binop_t op,
+    int *err_out
+) {
+    col_t *dst = col_arith_alloc(a, err_out);
+    if (!dst)
+        return NULL;
+    return col_arith_result(
+        dst, col_binary_scalar_into(dst, a, s, op), err_out
+    );
+}
+
+int col_binary_scalar_inplace(col_t *a, const double s, const col_binop_t op) {
+    return col_binary_scalar_into(a, a, s, op);
+}
+
+/* fused multiply-add */
+
+int col_fma_into(col_t *dst, const col_t *a, const col_t *b, const col_t *c) {
+    /* args */
+    int err = col_arith_validate(a, b);
+    if (err || (err = col_arith_validate(a, c)))
+        return err;
+    if (!b || !c)
+        return COL_ERR_NO_DATA;
+    if ((err = col_arith_prepare(dst, a)))
+        return err;
+
+    /* validity */
+    if (col_arith_validity(dst, a, b, c))
+        return COL_ERR_OOM;
+
+    /* compute */
+    col_fma_vvv_kernels[col_arith_isa(a->dtype)][a->dtype](
+        dst->data, a->data, b->data, c->data, a->n_rows
+    );
+
+    return COL_ERR_OK;
+}
+
+col_t *col_fma(const col_t *a, const col_t *b, const col_t *c, int *err_out) {
+    col_t *dst = col_arith_alloc(a, err_out);
+    if (!dst)
+        return NULL;
+    return col_arith_result(dst, col_fma_into(dst, a, b, c), err_out);
+}
+
+int col_fma_inplace(col_t *a, const col_t *b, const col_t *c) {
+    return col_fma_into(a, a, b, c);
+}
+
+int col_fma_scalar_into(
+    col_t *dst,
+    const col_t *a,
+    const double mul,
+    const double add
+) {
+    /* args */
+    int err = col_arith_validate(a, NULL);
+    if (err)
+        return err;
+
+    col_scalar_t scalar_mul, scalar_add;
+    if ((err = col_scalar_convert(a->dtype, mul, &scalar_mul)))
+        return err;
+    if ((err = col_scalar_convert(a->dtype, add, &scalar_add)))
+        return err;
+    if ((err = col_arith_prepare(dst, a)))
+        return err;
+
+    /* validity */
+    if (col_arith_validity(dst, a, NULL, NULL))
+        return COL_ERR_OOM;
+
+    /* compute */
+    col_fma_vss_kernels[col_arith_isa(a->dtype)][a->dtype](
+        dst->data, a->data, &scalar_mul, &scalar_add, a->n_rows
+    );
+
+    return COL_ERR_OK;
+}
+
+col_t *col_fma_scalar(
+    const col_t *a,
+    const double mul,
+    const double add,
+    int *err_out
+) {
+    col_t *dst = col_arith_alloc(a, err_out);
+    if (!dst)
+        return NULL;
+    return col_arith_result(
+        dst, col_fma_scalar_into(dst, a, mul, add), err_out
+    );
+}
+
+int col_fma_scalar_inplace(col_t *a, const double mul, const double add) {
+    return col_fma_scalar_into(a, a, mul, add);
+}
+
+/* unary */
+
+int col_unary_into(col_t *dst, const col_t *a, const col_unop_t op) {
+    /* args */
+    int err = col_arith_validate(a, NULL);
+    if (err)
+        return err;
+    if ((unsigned)op >= COL_UNOPS)
+        return COL_ERR_INVALID_ARG;
+
+    const col_unary_fn kernel =
+        col_unary_kernels[col_arith_isa(a->dtype)][a->dtype][op];
+    if (!kernel)
+        return COL_ERR_INVALID_DTYPE;
+    if ((err = col_arith_prepare(dst, a)))
+        return err;
+
+    /* validity */
+    if (col_arith_validity(dst, a, NULL, NULL))
+        return COL_ERR_OOM;
+
+    /* compute */
+    kernel(dst->data, a->data, a->n_rows);
+
+    return COL_ERR_OK;
+}
+
+col_t *col_unary(const col_t *a, const col_unop_t op, int *err_out) {
+    col_t *dst = col_arith_alloc(a, err_out);
+    if (!dst)
+        return NULL;
+    return col_arith_result(dst, col_unary_into(dst, a, op), err_out);
+}
+
+int col_unary_inplace(col_t *a, const col_unop_t op) {
+    return col_unary_into(a, a, op);
+}
+
+/* clip */
+
+int col_clip_into(
+    col_t *dst,
+    const col_t *a,
+    const double lo,
+    const double hi
+) {
+    /* args */
+    int err = col_arith_validate(a, NULL);
+    if (err)
+        return err;
+    if (isnan(lo) || isnan(hi) || lo > hi)
+        return COL_ERR_INVALID_ARG;
+
+    col_scalar_t scalar_lo, scalar_hi;
+    col_bound_convert(a->dtype, lo, 1, &scalar_lo);
+    col_bound_convert(a->dtype, hi, 0, &scalar_hi);
+    if (col_scalar_less(a->dtype, &scalar_hi, &scalar_lo))
+        return COL_ERR_INVALID_ARG;
+    if ((err = col_arith_prepare(dst, a)))
+        return err;
+
+    /* validity */
+    if (col_arith_validity(dst, a, NULL, NULL))
+        return COL_ERR_OOM;
+
+    /* compute */
+    col_clip_kernels[col_arith_isa(a->dtype)][a->dtype](
+        dst->data, a->data, &scalar_lo, &scalar_hi, a->n_rows
+    );
+
+    return COL_ERR_OK;
+}
+
+col_t *col_clip(
+    const col_t *a,
+    const double lo,
+    const double hi,
+    int *err_out
+) {
+    col_t *dst = col_arith_alloc(a, err_out);
+    if (!dst)
+        return NULL;
+    return col_arith_result(dst, col_clip_into(dst, a, lo, hi), err_out);
+}
+
+int col_clip_inplace(col_t *a, const double lo, const double hi) {
+    return col_clip_into(a, a, lo, hi);
+}
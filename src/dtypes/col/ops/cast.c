@@ -0,0 +1,742 @@
+#include <ctype.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/cpu.h"
+#include "core/error.h"
+#include "core/number.h"
+#include "core/simd.h"
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/buffer.h"
+#include "dtypes/col/core/category.h"
+#include "dtypes/col/core/internal.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/col/core/validity.h"
+#include "dtypes/col/ops/cast.h"
+
+/* Rows converted per bounce-buffer round trip by in-place casts */
+#define COL_CAST_CHUNK 256
+
+/* Conversions where every source value has a target value */
+typedef void (*col_conv_fn)(void *dst, const void *src, const size_t n);
+
+/* Conversions that may meet unrepresentable values, which are written as
+ * zero and marked null in `col` at row `offset + i` */
+typedef int (*col_conv_checked_fn)(
+    void *dst,
+    const void *src,
+    const size_t n,
+    col_t *col,
+    const size_t offset
+);
+
+static int col_cast_null(col_t *col, const size_t idx) {
+    if (col->null_count && !col_bit_get(col->validity, idx))
+        return COL_ERR_OK;
+    if (col_validity_init(col))
+        return COL_ERR_OOM;
+    col_bit_set(col->validity, idx, 0);
+    col->null_count++;
+    return COL_ERR_OK;
+}
+
+/* scalar kernels */
+
+#define COL_CONV_SCALAR(S, D)                                               \
+    static void col_conv_scalar_##S##_##D(                                  \
+        void *dst,                                                          \
+        const void *src,                                                    \
+        const size_t n                                                      \
+    ) {                                                                     \
+        D *d = dst;                                                         \
+        const S *s = src;                                                   \
+        for (size_t i = 0; i < n; i++)                                      \
+            d[i] = (D)s[i];                                                 \
+    }
+
+/* Floats truncate towards zero, so the open interval is the valid range */
+#define COL_FITS_INT64(v) ((v) >= -0x1p63 && (v) < 0x1p63)
+#define COL_FITS_INT32_F(v) ((v) > -2147483649.0 && (v) < 2147483648.0)
+#define COL_FITS_UINT8_F(v) ((v) > -1.0 && (v) < 256.0)
+#define COL_FITS_INT32(v) ((v) >= INT32_MIN && (v) <= INT32_MAX)
+#define COL_FITS_UINT8(v) ((v) >= 0 && (v) <= UINT8_MAX)
+
+#define COL_CONV_CHECKED(S, D, FITS)                                        \
+    static int col_conv_checked_##S##_##D(                                  \
+        void *dst,                                                          \
+        const void *src,                                                    \
+        const size_t n,                                                     \
+        col_t *col,                                                         \
+        const size_t offset                                                 \
+    ) {                                                                     \
+        D *d = dst;                                                         \
+        const S *s = src;                                                   \
+        for (size_t i = 0; i < n; i++) {                                    \
+            const S v = s[i];                                               \
+            if (FITS(v)) {                                                  \
+                d[i] = (D)v;                                                \
+                continue;                                                   \
+            }                                                               \
+            d[i] = 0;                                                       \
+            if (col_cast_null(col, offset + i))                             \
+                return COL_ERR_OOM;                                         \
+        }                                                                   \
+        return COL_ERR_OK;                                                  \
+    }
+
+COL_CONV_SCALAR(double, float)
+COL_CONV_SCALAR(float, double)
+COL_CONV_SCALAR(int64_t, double)
+COL_CONV_SCALAR(int64_t, float)
+COL_CONV_SCALAR(int32_t, double)
+COL_CONV_SCALAR(int32_t, float)
+COL_CONV_SCALAR(int32_t, int64_t)
+COL_CONV_SCALAR(uint8_t, double)
+COL_CONV_SCALAR(uint8_t, float)
+COL_CONV_SCALAR(uint8_t, int64_t)
+COL_CONV_SCALAR(uint8_t, int32_t)
+
+COL_CONV_CHECKED(double, int64_t, COL_FITS_INT64)
+COL_CONV_CHECKED(double, int32_t, COL_FITS_INT32_F)
+COL_CONV_CHECKED(double, uint8_t, COL_FITS_UINT8_F)
+COL_CONV_CHECKED(float, int64_t, COL_FITS_INT64)
+COL_CONV_CHECKED(float, int32_t, COL_FITS_INT32_F)
+COL_CONV_CHECKED(float, uint8_t, COL_FITS_UINT8_F)
+COL_CONV_CHECKED(int64_t, int32_t, COL_FITS_INT32)
+COL_CONV_CHECKED(int64_t, uint8_t, COL_FITS_UINT8)
+COL_CONV_CHECKED(int32_t, uint8_t, COL_FITS_UINT8)
+
+/* SIMD kernels
+ *
+ * Each step converts one vector's worth of elements; tails fall back to a
+ * plain C conversion. Steps load before they store, which the in-place
+ * bounce buffer does not rely on but keeps them safe to reuse. */
+
+#ifdef MLC_SIMD_X86
+
+/* AVX2 */
+
+MLC_TARGET_AVX2 static inline void col_avx2_step_double_float(
+    float *d,
+    const double *s
+) {
+    _mm_storeu_ps(d, _mm256_cvtpd_ps(_mm256_loadu_pd(s)));
+}
+
+MLC_TARGET_AVX2 static inline void col_avx2_step_float_double(
+    double *d,
+    const float *s
+) {
+    _mm256_storeu_pd(d, _mm256_cvtps_pd(_mm_loadu_ps(s)));
+}
+
+MLC_TARGET_AVX2 static inline void col_avx2_step_int32_t_double(
+    double *d,
+    const int32_t *s
+) {
+    _mm256_storeu_pd(d, _mm256_cvtepi32_pd(_mm_loadu_si128((const __m128i *)s)));
+}
+
+MLC_TARGET_AVX2 static inline void col_avx2_step_int32_t_float(
+    float *d,
+    const int32_t *s
+) {
+    _mm256_storeu_ps(
+        d, _mm256_cvtepi32_ps(_mm256_loadu_si256((const __m256i *)s))
+    );
+}
+
+MLC_TARGET_AVX2 static inline void col_avx2_step_int32_t_int64_t(
+    int64_t *d,
+    const int32_t *s
+) {
+    _mm256_storeu_si256(
+        (__m256i *)d, _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)s))
+    );
+}
+
+MLC_TARGET_AVX2 static inline __m128i col_avx2_load_u8x4(const uint8_t *s) {
+    int32_t bytes;
+    memcpy(&bytes, s, sizeof(bytes));
+    return _mm_cvtsi32_si128(bytes);
+}
+
+MLC_TARGET_AVX2 static inline void col_avx2_step_uint8_t_double(
+    double *d,
+    const uint8_t *s
+) {
+    _mm256_storeu_pd(
+        d, _mm256_cvtepi32_pd(_mm_cvtepu8_epi32(col_avx2_load_u8x4(s)))
+    );
+}
+
+MLC_TARGET_AVX2 static inline void col_avx2_step_uint8_t_float(
+    float *d,
+    const uint8_t *s
+) {
+    _mm256_storeu_ps(d, _mm256_cvtepi32_ps(
+        _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)s))
+    ));
+}
+
+MLC_TARGET_AVX2 static inline void col_avx2_step_uint8_t_int32_t(
+    int32_t *d,
+    const uint8_t *s
+) {
+    _mm256_storeu_si256(
+        (__m256i *)d,
+        _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)s))
+    );
+}
+
+MLC_TARGET_AVX2 static inline void col_avx2_step_uint8_t_int64_t(
+    int64_t *d,
+    const uint8_t *s
+) {
+    _mm256_storeu_si256(
+        (__m256i *)d, _mm256_cvtepu8_epi64(col_avx2_load_u8x4(s))
+    );
+}
+
+/* AVX-512 */
+
+MLC_TARGET_AVX512 static inline void col_avx512_step_double_float(
+    float *d,
+    const double *s
+) {
+    _mm256_storeu_ps(d, _mm512_cvtpd_ps(_mm512_loadu_pd(s)));
+}
+
+MLC_TARGET_AVX512 static inline void col_avx512_step_float_double(
+    double *d,
+    const float *s
+) {
+    _mm512_storeu_pd(d, _mm512_cvtps_pd(_mm256_loadu_ps(s)));
+}
+
+MLC_TARGET_AVX512 static inline void col_avx512_step_int64_t_double(
+    double *d,
+    const int64_t *s
+) {
+    _mm512_storeu_pd(d, _mm512_cvtepi64_pd(_mm512_loadu_si512(s)));
+}
+
+MLC_TARGET_AVX512 static inline void col_avx512_step_int64_t_float(
+    float *d,
+    const int64_t *s
+) {
+    _mm256_storeu_ps(d, _mm512_cvtepi64_ps(_mm512_loadu_si512(s)));
+}
+
+MLC_TARGET_AVX512 static inline void col_avx512_step_int32_t_double(
+    double *d,
+    const int32_t *s
+) {
+    _mm512_storeu_pd(
+        d, _mm512_cvtepi32_pd(_mm256_loadu_si256((const __m256i *)s))
+    );
+}
+
+MLC_TARGET_AVX512 static inline void col_avx512_step_int32_t_float(
+    float *d,
+    const int32_t *s
+) {
+    _mm512_storeu_ps(d, _mm512_cvtepi32_ps(_mm512_loadu_si512(s)));
+}
+
+MLC_TARGET_AVX512 static inline void col_avx512_step_int32_t_int64_t(
+    int64_t *d,
+    const int32_t *s
+) {
+    _mm512_storeu_si512(
+        d, _mm512_cvtepi32_epi64(_mm256_loadu_si256((const __m256i *)s))
+    );
+}
+
+MLC_TARGET_AVX512 static inline void col_avx512_step_uint8_t_double(
+    double *d,
+    const uint8_t *s
+) {
+    _mm512_storeu_pd(d, _mm512_cvtepi32_pd(
+        _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)s))
+    ));
+}
+
+MLC_TARGET_AVX512 static inline void col_avx512_step_uint8_t_float(
+    float *d,
+    const uint8_t *s
+) {
+    _mm512_storeu_ps(d, _mm512_cvtepi32_ps(
+        _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i *)s))
+    ));
+}
+
+MLC_TARGET_AVX512 static inline void col_avx512_step_uint8_t_int32_t(
+    int32_t *d,
+    const uint8_t *s
+) {
+    _mm512_storeu_si512(
+        d, _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i *)s))
+    );
+}
+
+MLC_TARGET_AVX512 static inline void col_avx512_step_uint8_t_int64_t(
+    int64_t *d,
+    const uint8_t *s
+) {
+    _mm512_storeu_si512(
+        d, _mm512_cvtepu8_epi64(_mm_loadl_epi64((const __m128i *)s))
+    );
+}
+
+#define COL_CONV_SIMD(isa, TARGET, S, D, W)                                 \
+    TARGET static void col_conv_##isa##_##S##_##D(                          \
+        void *dst,                                                          \
+        const void *src,                                                    \
+        const size_t n                                                      \
+    ) {                                                                     \
+        D *d = dst;                                                         \
+        const S *s = src;                                                   \
+        size_t i = 0;                                                       \
+        for (; i + (W) <= n; i += (W))                                      \
+            col_##isa##_step_##S##_##D(d + i, s + i);                       \
+        for (; i < n; i++)                                                  \
+            d[i] = (D)s[i];                                                 \
+    }
+
+COL_CONV_SIMD(avx2, MLC_TARGET_AVX2, double, float, 4)
+COL_CONV_SIMD(avx2, MLC_TARGET_AVX2, float, double, 4)
+COL_CONV_SIMD(avx2, MLC_TARGET_AVX2, int32_t, double, 4)
+COL_CONV_SIMD(avx2, MLC_TARGET_AVX2, int32_t, float, 8)
+COL_CONV_SIMD(avx2, MLC_TARGET_AVX2, int32_t, int64_t, 4)
+COL_CONV_SIMD(avx2, MLC_TARGET_AVX2, uint8_t, double, 4)
+COL_CONV_SIMD(avx2, MLC_TARGET_AVX2, uint8_t, float, 8)
+COL_CONV_SIMD(avx2, MLC_TARGET_AVX2, uint8_t, int32_t, 8)
+COL_CONV_SIMD(avx2, MLC_TARGET_AVX2, uint8_t, int64_t, 4)
+
+COL_CONV_SIMD(avx512, MLC_TARGET_AVX512, double, float, 8)
+COL_CONV_SIMD(avx512, MLC_TARGET_AVX512, float, double, 8)
+COL_CONV_SIMD(avx512, MLC_TARGET_AVX512, int64_t, double, 8)
+COL_CONV_SIMD(avx512, MLC_TARGET_AVX512, int64_t, float, 8)
+COL_CONV_SIMD(avx512, MLC_TARGET_AVX512, int32_t, double, 8)
+COL_CONV_SIMD(avx512, MLC_TARGET_AVX512, int32_t, float, 16)
+COL_CONV_SIMD(avx512, MLC_TARGET_AVX512, int32_t, int64_t, 8)
+COL_CONV_SIMD(avx512, MLC_TARGET_AVX512, uint8_t, double, 8)
+COL_CONV_SIMD(avx512, MLC_TARGET_AVX512, uint8_t, float, 16)
+COL_CONV_SIMD(avx512, MLC_TARGET_AVX512, uint8_t, int32_t, 16)
+COL_CONV_SIMD(avx512, MLC_TARGET_AVX512, uint8_t, int64_t, 8)
+
+#endif
+
+/* dispatch tables, indexed by [isa][from][to] and [from][to] */
+
+static const col_conv_fn
+col_conv_kernels[MLC_ISA_COUNT][COL_DTYPE_UINT8 + 1][COL_DTYPE_UINT8 + 1] = {
+    [MLC_ISA_SCALAR] = {
+        [COL_DTYPE_DOUBLE][COL_DTYPE_FLOAT] = col_conv_scalar_double_float,
+        [COL_DTYPE_FLOAT][COL_DTYPE_DOUBLE] = col_conv_scalar_float_double,
+        [COL_DTYPE_INT64][COL_DTYPE_DOUBLE] = col_conv_scalar_int64_t_double,
+        [COL_DTYPE_INT64][COL_DTYPE_FLOAT] = col_conv_scalar_int64_t_float,
+        [COL_DTYPE_INT32][COL_DTYPE_DOUBLE] = col_conv_scalar_int32_t_double,
+        [COL_DTYPE_INT32][COL_DTYPE_FLOAT] = col_conv_scalar_int32_t_float,
+        [COL_DTYPE_INT32][COL_DTYPE_INT64] = col_conv_scalar_int32_t_int64_t,
+        [COL_DTYPE_UINT8][COL_DTYPE_DOUBLE] = col_conv_scalar_uint8_t_double,
+        [COL_DTYPE_UINT8][COL_DTYPE_FLOAT] = col_conv_scalar_uint8_t_float,
+        [COL_DTYPE_UINT8][COL_DTYPE_INT64] = col_conv_scalar_uint8_t_int64_t,
+        [COL_DTYPE_UINT8][COL_DTYPE_INT32] = col_conv_scalar_uint8_t_int32_t
+    },
+#ifdef MLC_SIMD_X86
+    /* AVX2 has no packed int64 -> float conversion */
+    [MLC_ISA_AVX2] = {
+        [COL_DTYPE_DOUBLE][COL_DTYPE_FLOAT] = col_conv_avx2_double_float,
+        [COL_DTYPE_FLOAT][COL_DTYPE_DOUBLE] = col_conv_avx2_float_double,
+        [COL_DTYPE_INT64][COL_DTYPE_DOUBLE] = col_conv_scalar_int64_t_double,
+        [COL_DTYPE_INT64][COL_DTYPE_FLOAT] = col_conv_scalar_int64_t_float,
+        [COL_DTYPE_INT32][COL_DTYPE_DOUBLE] = col_conv_avx2_int32_t_double,
+        [COL_DTYPE_INT32][COL_DTYPE_FLOAT] = col_conv_avx2_int32_t_float,
+        [COL_DTYPE_INT32][COL_DTYPE_INT64] = col_conv_avx2_int32_t_int64_t,
+        [COL_DTYPE_UINT8][COL_DTYPE_DOUBLE] = col_conv_avx2_uint8_t_double,
+        [COL_DTYPE_UINT8][COL_DTYPE_FLOAT] = col_conv_avx2_uint8_t_float,
+        [COL_DTYPE_UINT8][COL_DTYPE_INT64] = col_conv_avx2_uint8_t_int64_t,
+        [COL_DTYPE_UINT8][COL_DTYPE_INT32] = col_conv_avx2_uint8_t_int32_t
+    },
+    [MLC_ISA_AVX512] = {
+        [COL_DTYPE_DOUBLE][COL_DTYPE_FLOAT] = col_conv_avx512_double_float,
+        [COL_DTYPE_FLOAT][COL_DTYPE_DOUBLE] = col_conv_avx512_float_double,
+        [COL_DTYPE_INT64][COL_DTYPE_DOUBLE] = col_conv_avx512_int64_t_double,
+        [COL_DTYPE_INT64][COL_DTYPE_FLOAT] = col_conv_avx512_int64_t_float,
+        [COL_DTYPE_INT32][COL_DTYPE_DOUBLE] = col_conv_avx512_int32_t_double,
+        [COL_DTYPE_INT32][COL_DTYPE_FLOAT] = col_conv_avx512_int32_t_float,
+        [COL_DTYPE_INT32][COL_DTYPE_INT64] = col_conv_avx512_int32_t_int64_t,
+        [COL_DTYPE_UINT8][COL_DTYPE_DOUBLE] = col_conv_avx512_uint8_t_double,
+        [COL_DTYPE_UINT8][COL_DTYPE_FLOAT] = col_conv_avx512_uint8_t_float,
+        [COL_DTYPE_UINT8][COL_DTYPE_INT64] = col_conv_avx512_uint8_t_int64_t,
+        [COL_DTYPE_UINT8][COL_DTYPE_INT32] = col_conv_avx512_uint8_t_int32_t
+    }
+#endif
+};
+
+static const col_conv_checked_fn
+col_conv_checked_kernels[COL_DTYPE_UINT8 + 1][COL_DTYPE_UINT8 + 1] = {
+    [COL_DTYPE_DOUBLE][COL_DTYPE_INT64] = col_conv_checked_double_int64_t,
+    [COL_DTYPE_DOUBLE][COL_DTYPE_INT32] = col_conv_checked_double_int32_t,
+    [COL_DTYPE_DOUBLE][COL_DTYPE_UINT8] = col_conv_checked_double_uint8_t,
+    [COL_DTYPE_FLOAT][COL_DTYPE_INT64] = col_conv_checked_float_int64_t,
+    [COL_DTYPE_FLOAT][COL_DTYPE_INT32] = col_conv_checked_float_int32_t,
+    [COL_DTYPE_FLOAT][COL_DTYPE_UINT8] = col_conv_checked_float_uint8_t,
+    [COL_DTYPE_INT64][COL_DTYPE_INT32] = col_conv_checked_int64_t_int32_t,
+    [COL_DTYPE_INT64][COL_DTYPE_UINT8] = col_conv_checked_int64_t_uint8_t,
+    [COL_DTYPE_INT32][COL_DTYPE_UINT8] = col_conv_checked_int32_t_uint8_t
+};
+
+/* drivers */
+
+/* SSE2 is the x86-64 baseline the scalar loops are already compiled for */
+static mlc_isa_t col_cast_isa(void) {
+    const mlc_isa_t isa = mlc_cpu_isa();
+    return isa < MLC_ISA_AVX2 ? MLC_ISA_SCALAR : isa;
+}
+
+/* Converts `n` values of dtype `from` at `src` into `col->data`. When `src`
+ * is `col->data` itself, each chunk is converted into a bounce buffer first,
+ * so no value is overwritten before it is read. */
+static int col_convert(
+    col_t *col,
+    const void *src,
+    const col_dtype_t from,
+    const col_dtype_t to,
+    const size_t n
+) {
+    const col_conv_checked_fn checked = col_conv_checked_kernels[from][to];
+    const col_conv_fn kernel = col_conv_kernels[col_cast_isa()][from][to];
+
+    if (src != col->data) {
+        if (checked)
+            return checked(col->data, src, n, col, 0);
+        kernel(col->data, src, n);
+        return COL_ERR_OK;
+    }
+
+    const size_t from_stride = col_dtype_stride(from);
+    const size_t to_stride = col_dtype_stride(to);
+    double bounce[COL_CAST_CHUNK];
+    for (size_t i = 0; i < n; i += COL_CAST_CHUNK) {
+        const size_t len = n - i < COL_CAST_CHUNK ? n - i : COL_CAST_CHUNK;
+        const char *in = (const char *)src + i * from_stride;
+        if (checked) {
+            if (checked(bounce, in, len, col, i))
+                return COL_ERR_OOM;
+        } else {
+            kernel(bounce, in, len);
+        }
+        memcpy((char *)col->data + i * to_stride, bounce, len * to_stride);
+    }
+
+    return COL_ERR_OK;
+}
+
+/* Creates an `n_rows`-row column of `dtype` with the validity of `src` */
+static col_t *col_cast_create(
+    const col_t *src,
+    const col_dtype_t dtype,
+    int *err_out
+) {
+    col_t *dst = col_create_with_capacity(src->name, src->n_rows, dtype, err_out);
+    if (!dst)
+        return NULL;
+
+    if (src->null_count) {
+        if (col_validity_init(dst)) {
+            col_free(dst);
+            return mlc_fail_null(COL_ERR_OOM, err_out);
+        }
+        memcpy(dst->validity, src->validity, col_validity_bytes(src->n_rows));
+        dst->null_count = src->null_count;
+    }
+    dst->n_rows = src->n_rows;
+
+    return dst;
+}
+
+static col_t *col_cast_numeric(
+    const col_t *col,
+    const col_dtype_t dtype,
+    int *err_out
+) {
+    col_t *dst = col_cast_create(col, dtype, err_out);
+    if (!dst)
+        return NULL;
+
+    if (col_convert(dst, col->data, col->dtype, dtype, col->n_rows)) {
+        col_free(dst);
+        return mlc_fail_null(COL_ERR_OOM, err_out);
+    }
+
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    return dst;
+}
+
+/* Parses through `strtod` or `strtof`, for syntax the fast parsers skip */
+static int col_parse_float_libc(
+    const char *str,
+    const size_t len,
+    const col_dtype_t dtype,
+    void *out
+) {
+    char stack[64];
+    char *buf = len < sizeof(stack) ? stack : malloc(len + 1);
+    if (!buf)
+        return COL_ERR_OOM;
+    memcpy(buf, str, len);
+    buf[len] = '\0';
+
+    char *end;
+    if (dtype == COL_DTYPE_DOUBLE)
+        *(double *)out = strtod(buf, &end);
+    else
+        *(float *)out = strtof(buf, &end);
+    const int err = end == buf + len ? COL_ERR_OK : COL_ERR_PARSE;
+
+    if (buf != stack)
+        free(buf);
+    return err;
+}
+
+int col_parse_value(
+    const char *str,
+    size_t len,
+    const col_dtype_t dtype,
+    void *out,
+    int *is_null
+) {
+    while (len && isspace((unsigned char)*str)) {
+        str++;
+        len--;
+    }
+    while (len && isspace((unsigned char)str[len - 1]))
+        len--;
+    *is_null = !len;
+    if (*is_null)
+        return COL_ERR_OK;
+
+    const char *end = str + len;
+    int64_t v = 0;
+    switch (dtype) {
+        case COL_DTYPE_DOUBLE:
+            if (mlc_parse_double(str, end, out) != end)
+                return col_parse_float_libc(str, len, dtype, out);
+            return COL_ERR_OK;
+        case COL_DTYPE_FLOAT:
+            if (mlc_parse_float(str, end, out) != end)
+                return col_parse_float_libc(str, len, dtype, out);
+            return COL_ERR_OK;
+        default:
+            if (mlc_parse_int64(str, end, &v) != end)
+                return COL_ERR_PARSE;
+            break;
+    }
+
+    switch (dtype) {
+        case COL_DTYPE_INT64:
+            *(int64_t *)out = v;
+            break;
+        case COL_DTYPE_INT32:
+            if (!COL_FITS_INT32(v))
+                return COL_ERR_PARSE;
+            *(int32_t *)out = (int32_t)v;
+            break;
+        case COL_DTYPE_UINT8:
+            if (!COL_FITS_UINT8(v))
+                return COL_ERR_PARSE;
+            *(uint8_t *)out = (uint8_t)v;
+            break;
+        default:
+            break;
+    }
+
+    return COL_ERR_OK;
+}
+
+static int col_parse_strings(col_t *dst, const col_t *col, size_t *err_row) {
+    const size_t *offsets = col->data;
+    char *data = dst->data;
+
+    for (size_t i = 0; i < col->n_rows; i++) {
+        if (col->null_count && !col_bit_get(col->validity, i))
+            continue;
+
+        int is_null;
+        const char *str = col->strbuf.bytes + offsets[i];
+        const size_t len = strlen(str);
+        if (col_parse_value(str, len, dst->dtype, data + i * dst->stride, &is_null)) {
+            *err_row = i;
+            return COL_ERR_PARSE;
+        }
+        if (is_null && col_cast_null(dst, i))
+            return COL_ERR_OOM;
+    }
+
+    return COL_ERR_OK;
+}
+
+/* Parses each distinct category once, then gathers by code */
+static int col_parse_categories(col_t *dst, const col_t *col, size_t *err_row) {
+    const col_t *values = col->dict->values;
+    const size_t *offsets = values->data;
+    const size_t n_cats = values->n_rows;
+
+    char *parsed = malloc((n_cats + 1) * dst->stride);
+    int *status = malloc((n_cats + 1) * sizeof(int));
+    if (!parsed || !status) {
+        free(parsed);
+        free(status);
+        return COL_ERR_OOM;
+    }
+
+    /* status: 0 parsed, 1 empty, -1 failed */
+    for (size_t c = 0; c < n_cats; c++) {
+        int is_null;
+        const char *str = values->strbuf.bytes + offsets[c];
+        const size_t len = strlen(str);
+        status[c] = col_parse_value(
+            str, len, dst->dtype, parsed + c * dst->stride, &is_null
+        ) ? -1 : is_null;
+    }
+
+    int err = COL_ERR_OK;
+    char *data = dst->data;
+    for (size_t i = 0; i < col->n_rows && !err; i++) {
+        if (col->null_count && !col_bit_get(col->validity, i))
+            continue;
+
+        const int32_t code = col_code_read(col->data, col->stride, i);
+        if (status[code] < 0) {
+            *err_row = i;
+            err = COL_ERR_PARSE;
+        } else if (status[code]) {
+            err = col_cast_null(dst, i);
+        } else {
+            memcpy(data + i * dst->stride, parsed + code * dst->stride, dst->stride);
+        }
+    }
+
+    free(parsed);
+    free(status);
+    return err;
+}
+
+col_t *col_parse(
+    const col_t *col,
+    const col_dtype_t dtype,
+    size_t *err_row,
+    int *err_out
+) {
+    /* args */
+    size_t row = SIZE_MAX;
+    if (err_row)
+        *err_row = row;
+    if (!col)
+        return mlc_fail_null(COL_ERR_NO_DATA, err_out);
+    if (col_dtype_validate(dtype) || !col_dtype_is_numeric(dtype))
+        return mlc_fail_null(COL_ERR_INVALID_DTYPE, err_out);
+    if (col->dtype != COL_DTYPE_STRING && col->dtype != COL_DTYPE_CATEGORY)
+        return mlc_fail_null(COL_ERR_INVALID_DTYPE, err_out);
+
+    /* malloc */
+    col_t *dst = col_cast_create(col, dtype, err_out);
+    if (!dst)
+        return NULL;
+    if (col->n_rows)
+        memset(dst->data, 0, col->n_rows * dst->stride);
+
+    /* parse */
+    const int err = col->dtype == COL_DTYPE_STRING
+        ? col_parse_strings(dst, col, &row)
+        : col_parse_categories(dst, col, &row);
+    if (err) {
+        col_free(dst);
+        if (err_row)
+            *err_row = row;
+        return mlc_fail_null(err, err_out);
+    }
+
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    return dst;
+}
+
+col_t *col_cast(const col_t *col, const col_dtype_t dtype, int *err_out) {
+    /* args */
+    if (!col)
+        return mlc_fail_null(COL_ERR_NO_DATA, err_out);
+    if (col_dtype_validate(dtype))
+        return mlc_fail_null(COL_ERR_INVALID_DTYPE, err_out);
+
+    if (dtype == col->dtype) {
+        col_t *clone = col_clone(col, err_out);
+        if (clone && err_out)
+            *err_out = COL_ERR_OK;
+        return clone;
+    }
+
+    const int from_numeric = col_dtype_is_numeric(col->dtype);
+    const int to_numeric = col_dtype_is_numeric(dtype);
+    if (from_numeric && to_numeric)
+        return col_cast_numeric(col, dtype, err_out);
+    if (to_numeric)
+        return col_parse(col, dtype, NULL, err_out);
+    if (dtype == COL_DTYPE_CATEGORY && col->dtype == COL_DTYPE_STRING)
+        return col_category_from_string(col, err_out);
+    if (dtype == COL_DTYPE_STRING && col->dtype == COL_DTYPE_CATEGORY)
+        return col_category_to_string(col, err_out);
+
+    /* formatting numbers into strings is not a cast */
+    return mlc_fail_null(COL_ERR_INVALID_DTYPE, err_out);
+}
+
+int col_cast_inplace(col_t *col, const col_dtype_t dtype) {
+    /* args */
+    if (!col)
+        return COL_ERR_NO_DATA;
+    if (col_dtype_validate(dtype)
+        || !col_dtype_is_numeric(dtype)
+        || !col_dtype_is_numeric(col->dtype))
+        return COL_ERR_INVALID_DTYPE;
+    if (dtype == col->dtype)
+        return COL_ERR_OK;
+
+    const size_t stride = col_dtype_stride(dtype);
+    if (stride > col->stride)
+        return COL_ERR_INVALID_ARG;
+
+    /* allocations happen up front, so a failure leaves `col` as is */
+    if (col_data_detach(col))
+        return COL_ERR_OOM;
+    if (col_conv_checked_kernels[col->dtype][dtype] && col_validity_init(col))
+        return COL_ERR_OOM;
+
+    /* convert */
+    col_convert(col, col->data, col->dtype, dtype, col->n_rows);
+
+    /* assign */
+    const size_t old_stride = col->stride;
+    memcpy((void *)&col->dtype, &dtype, sizeof(dtype));
+    memcpy((void *)&col->stride, &stride, sizeof(stride));
+
+    /* release the tail; the larger buffer remains valid if this fails */
+    if (stride < old_stride && col->capacity) {
+        void *tmp_data = col_data_realloc(
+            &col->allocator,
+            col->data,
+            col->n_rows * stride,
+            col->capacity,
+            stride
+        );
+        if (tmp_data)
+            col->data = tmp_data;
+    }
+
+    return COL_ERR_OK;
+}
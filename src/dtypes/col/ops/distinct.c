@@ -0,0 +1,381 @@
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/error.h"
+#include "core/thread.h"
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/internal.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/col/core/modifiers.h"
+#include "dtypes/col/ops/distinct.h"
+#include "dtypes/col/ops/gather.h"
+#include "dtypes/col/ops/sort.h"
+#include "dtypes/df/core/type.h"
+#include "dtypes/df/core/accessors.h"
+#include "dtypes/df/core/lifecycle.h"
+#include "dtypes/df/core/modifiers.h"
+#include "dtypes/df/ops/groupby.h"
+#include "dtypes/df/ops/keys.h"
+
+/* Fewest rows a chunk of a parallel sketch holds. Smaller columns are
+ * sketched on the calling thread alone. */
+#define COL_HLL_CHUNK_ROWS ((size_t)1 << 16)
+
+/* Rows hashed at once, so their hashes stay in L1 */
+#define COL_HLL_BLOCK_ROWS 512
+
+/* Chunks of a column sketched in parallel */
+typedef struct col_hll_ctx {
+    const col_t *col;
+    unsigned precision;
+    size_t n_chunks;
+    uint8_t *registers;         /* `n_chunks` sketches, one after another */
+} col_hll_ctx_t;
+
+/* Name of the counts of a column: "count", unless the column has it. The
+ * group-by frame holds only the two, so the names never collide. */
+static const char *col_distinct_count_name(const col_t *col) {
+    return strcmp(col->name, "count") ? "count" : "count_";
+}
+
+/**
+ * @brief Groups the rows of a column by value. This serves as a helper for
+ * internal use.
+ *
+ * @param col Target `col_t`.
+ * @param count Non-zero to count the rows of every group, named by
+ * `col_distinct_count_name`.
+ * @param err_out Optional pointer to receive error codes.
+ * @return Pointer to the `df_t` of groups, keyed by a column named as
+ * `col`. NULL on error.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+static df_t *col_distinct_groups(const col_t *col, const int count, int *err_out) {
+    /* args */
+    if (!col)
+        return mlc_fail_null(COL_ERR_NO_DATA, err_out);
+
+    /* init: clones share storage, so framing the column copies nothing */
+    int err_code = COL_ERR_OK;
+    col_t *clone = col_clone(col, &err_code);
+    if (!clone)
+        return mlc_fail_null(err_code, err_out);
+    df_t *df = df_from_cols(&clone, 1, &err_code);
+    if (!df) {
+        col_free(clone);
+        return mlc_fail_null(err_code, err_out);
+    }
+
+    /* assign */
+    const char *keys[] = {col->name};
+    const df_agg_t agg = {NULL, DF_AGG_COUNT, col_distinct_count_name(col)};
+    df_t *groups = df_groupby(df, keys, 1, &agg, count ? 1 : 0, NULL, err_out);
+    df_free(df);
+    return groups;
+}
+
+/* exact */
+
+col_t *col_unique(const col_t *col, int *err_out) {
+    /* init */
+    df_t *groups = col_distinct_groups(col, 0, err_out);
+    if (!groups)
+        return NULL;
+
+    /* assign */
+    col_t *values = df_take_col(groups, col->name, err_out);
+    df_free(groups);
+    return values;
+}
+
+int col_value_counts(
+    const col_t *col,
+    const int sort,
+    col_t **values_out,
+    col_t **counts_out
+) {
+    /* args */
+    if (!col || !values_out || !counts_out)
+        return COL_ERR_NO_DATA;
+    *values_out = NULL;
+    *counts_out = NULL;
+
+    /* init */
+    int err_code = COL_ERR_OK;
+    col_t *values = NULL;
+    col_t *counts = NULL;
+    col_t *order = NULL;
+    df_t *groups = col_distinct_groups(col, 1, &err_code);
+    if (!groups)
+        return err_code;
+    values = df_take_col(groups, col->name, &err_code);
+    if (values)
+        counts = df_take_col(groups, col_distinct_count_name(col), &err_code);
+    df_free(groups);
+    if (!counts)
+        goto cleanup;
+    err_code = col_rename(counts, "count");
+    if (err_code)
+        goto cleanup;
+
+    /* assign: the sort is stable, so ties keep their first appearance */
+    if (sort && counts->n_rows > 1) {
+        col_sort_options_t options = col_sort_options_default();
+        options.descending = 1;
+        order = col_argsort(counts, &options, &err_code);
+        if (!order)
+            goto cleanup;
+
+        col_t *sorted = col_take_int64(values, order->data, order->n_rows, &err_code);
+        if (!sorted)
+            goto cleanup;
+        col_free(values);
+        values = sorted;
+
+        sorted = col_take_int64(counts, order->data, order->n_rows, &err_code);
+        if (!sorted)
+            goto cleanup;
+        col_free(counts);
+        counts = sorted;
+    }
+
+    col_free(order);
+    *values_out = values;
+    *counts_out = counts;
+    return COL_ERR_OK;
+
+cleanup:
+    col_free(order);
+    col_free(counts);
+    col_free(values);
+    return err_code;
+}
+
+size_t col_ndistinct(const col_t *col, int *err_out) {
+    /* init */
+    df_t *groups = col_distinct_groups(col, 0, err_out);
+    if (!groups)
+        return SIZE_MAX;
+
+    /* assign: nulls form one group of their own */
+    const size_t n = df_n_rows(groups) - (col->null_count != 0);
+    df_free(groups);
+    return n;
+}
+
+/* approximate */
+
+/**
+ * @brief Adds rows `[start, start + n)` of a column to the registers of a
+ * sketch. This serves as a helper for internal use.
+ *
+ * A value lands in the register picked by the top `precision` bits of its
+ * hash, which keeps the largest rank seen: the position of the first set
+ * bit of the remaining bits.
+ *
+ * @param registers Registers of the sketch.
+ * @param precision Precision of the sketch.
+ * @param col Source `col_t`.
+ * @param start Index of the first row.
+ * @param n Number of rows.
+ *
+ * @author PeppermintSnow
+ * @since 0.0.0
+ * @version 0.0.0
+ * @date 2026-10-17
+ */
+static void col_hll_update(
+    uint8_t *registers,
+    const unsigned precision,
+    const col_t *col,
+    const size_t start,
+    const size_t n
+) {
+    const col_t *keys[] = {col};
+    const uint64_t stop = (uint64_t)1 << (precision - 1);
+    uint64_t hashes[COL_HLL_BLOCK_ROWS];
+    for (size_t b = 0; b < n; b += COL_HLL_BLOCK_ROWS) {
+        const size_t len = n - b < COL_HLL_BLOCK_ROWS ? n - b : COL_HLL_BLOCK_ROWS;
+        df_keys_hash(keys, 1, start + b, len, hashes);
+        for (size_t i = 0; i < len; i++) {
+            if (col->null_count && !col_bit_get(col->validity, start + b + i))
+                continue;
+            const uint64_t h = hashes[i];
+            /* `stop` caps the rank at `65 - precision` */
+            const uint8_t rank = (uint8_t)(__builtin_clzll((h << precision) | stop) + 1);
+            uint8_t *reg = registers + (h >> (64 - precision));
+            if (rank > *reg)
+                *reg = rank;
+        }
+    }
+}
+
+/* Sketches one chunk of the column into its own registers */
+static void col_hll_chunk_run(void *arg, size_t task) {
+    const col_hll_ctx_t *ctx = arg;
+    const size_t n_rows = ctx->col->n_rows;
+    const size_t start = n_rows * task / ctx->n_chunks;
+    const size_t end = n_rows * (task + 1) / ctx->n_chunks;
+    col_hll_update(
+        ctx->registers + (task << ctx->precision),
+        ctx->precision,
+        ctx->col,
+        start,
+        end - start
+    );
+}
+
+/* Keeps the larger rank of every register */
+static void col_hll_merge_registers(uint8_t *dst, const uint8_t *src, const size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        if (src[i] > dst[i])
+            dst[i] = src[i];
+    }
+}
+
+col_hll_t *col_hll_create(const unsigned precision, int *err_out) {
+    /* args */
+    if (precision < COL_HLL_PRECISION_MIN || precision > COL_HLL_PRECISION_MAX)
+        return mlc_fail_null(COL_ERR_INVALID_ARG, err_out);
+
+    /* alloc */
+    col_hll_t *hll = malloc(sizeof(col_hll_t));
+    if (!hll)
+        return mlc_fail_null(COL_ERR_OOM, err_out);
+    hll->n_registers = (size_t)1 << precision;
+    hll->registers = calloc(hll->n_registers, sizeof(uint8_t));
+    if (!hll->registers) {
+        free(hll);
+        return mlc_fail_null(COL_ERR_OOM, err_out);
+    }
+
+    /* assign */
+    hll->precision = precision;
+
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    return hll;
+}
+
+void col_hll_free(col_hll_t *hll) {
+    if (!hll)
+        return;
+
+    free(hll->registers);
+    free(hll);
+}
+
+int col_hll_add(col_hll_t *hll, const col_t *col) {
+    /* args */
+    if (!hll || !col)
+        return COL_ERR_NO_DATA;
+
+    const size_t n_threads = mlc_thread_count();
+    size_t n_chunks = col->n_rows / COL_HLL_CHUNK_ROWS;
+    if (n_chunks > n_threads)
+        n_chunks = n_threads;
+    if (n_chunks <= 1) {
+        col_hll_update(hll->registers, hll->precision, col, 0, col->n_rows);
+        return COL_ERR_OK;
+    }
+
+    /* alloc */
+    col_hll_ctx_t ctx = {
+        .col = col,
+        .precision = hll->precision,
+        .n_chunks = n_chunks,
+        .registers = calloc(n_chunks, hll->n_registers)
+    };
+    if (!ctx.registers)
+        return COL_ERR_OOM;
+
+    /* assign */
+    mlc_parallel_for(n_chunks, n_threads, col_hll_chunk_run, &ctx);
+    for (size_t c = 0; c < n_chunks; c++) {
+        col_hll_merge_registers(
+            hll->registers,
+            ctx.registers + c * hll->n_registers,
+            hll->n_registers
+        );
+    }
+
+    free(ctx.registers);
+    return COL_ERR_OK;
+}
+
+int col_hll_merge(col_hll_t *dst, const col_hll_t *src) {
+    /* args */
+    if (!dst || !src)
+        return COL_ERR_NO_DATA;
+    if (dst->precision != src->precision)
+        return COL_ERR_INVALID_ARG;
+
+    /* assign */
+    col_hll_merge_registers(dst->registers, src->registers, dst->n_registers);
+    return COL_ERR_OK;
+}
+
+double col_hll_estimate(const col_hll_t *hll, int *err_out) {
+    /* args */
+    if (!hll)
+        return mlc_fail_nan(COL_ERR_NO_DATA, err_out);
+
+    /* init: bias correction of the harmonic mean */
+    const double m = (double)hll->n_registers;
+    double alpha = 0.7213 / (1.0 + 1.079 / m);
+    if (hll->n_registers == 16)
+        alpha = 0.673;
+    else if (hll->n_registers == 32)
+        alpha = 0.697;
+    else if (hll->n_registers == 64)
+        alpha = 0.709;
+
+    /* assign */
+    double sum = 0;
+    size_t n_zeros = 0;
+    for (size_t i = 0; i < hll->n_registers; i++) {
+        sum += ldexp(1.0, -(int)hll->registers[i]);
+        n_zeros += hll->registers[i] == 0;
+    }
+    double estimate = alpha * m * m / sum;
+
+    /* small sets leave registers empty, which linear counting measures
+     * more precisely */
+    if (estimate <= 2.5 * m && n_zeros)
+        estimate = m * log(m / (double)n_zeros);
+
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    return estimate;
+}
+
+double col_ndistinct_hll(const col_t *col, const unsigned precision, int *err_out) {
+    /* args */
+    if (!col)
+        return mlc_fail_nan(COL_ERR_NO_DATA, err_out);
+
+    /* init */
+    int err_code = COL_ERR_OK;
+    col_hll_t *hll = col_hll_create(
+        precision ? precision : COL_HLL_PRECISION_DEFAULT,
+        &err_code
+    );
+    if (!hll)
+        return mlc_fail_nan(err_code, err_out);
+
+    /* assign */
+    err_code = col_hll_add(hll, col);
+    if (err_code) {
+        col_hll_free(hll);
+        return mlc_fail_nan(err_code, err_out);
+    }
+    const double estimate = col_hll_estimate(hll, err_out);
+    col_hll_free(hll);
+    return estimate;
+}
@@ -0,0 +1,1004 @@
+#include <float.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/cpu.h"
+#include "core/error.h"
+#include "core/hash.h"
+#include "core/simd.h"
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/category.h"
+#include "dtypes/col/core/internal.h"
+#include "dtypes/col/ops/filter.h"
+#include "dtypes/col/ops/gather.h"
+
+/* A selection covering at least 1/COL_SEL_DENSE of the rows is refined
+ * through a full bitmask, as the vector kernels then beat row lookups */
+#define COL_SEL_DENSE 8
+
+/* Every comparison reduces to an inclusive range of the column's element
+ * type. An `empty` range matches nothing, and `negate` flips the result,
+ * which turns `==` into `!=`. */
+typedef struct col_range {
+    col_scalar_t lo;
+    col_scalar_t hi;
+    int empty;
+    int negate;
+} col_range_t;
+
+typedef void (*col_range_fn)(
+    const void *data,
+    const size_t n,
+    const col_range_t *range,
+    uint8_t *mask
+);
+
+/* scalar kernels */
+
+/* Writes whole mask bytes from row `i`, a multiple of 8, up to `n` */
+#define COL_RANGE_SCALAR(T, F)                                              \
+    static inline void col_range_tail_##T(                                  \
+        const T *x,                                                         \
+        size_t i,                                                           \
+        const size_t n,                                                     \
+        const T lo,                                                         \
+        const T hi,                                                         \
+        uint8_t *mask                                                       \
+    ) {                                                                     \
+        for (; i < n; i += 8) {                                             \
+            const size_t m = n - i < 8 ? n - i : 8;                         \
+            unsigned bits = 0;                                              \
+            for (size_t k = 0; k < m; k++)                                  \
+                bits |= (unsigned)(x[i + k] >= lo && x[i + k] <= hi) << k;  \
+            mask[i >> 3] = (uint8_t)bits;                                   \
+        }                                                                   \
+    }                                                                       \
+    static void col_range_scalar_##T(                                       \
+        const void *data,                                                   \
+        const size_t n,                                                     \
+        const col_range_t *range,                                           \
+        uint8_t *mask                                                       \
+    ) {                                                                     \
+        col_range_tail_##T(data, 0, n, range->lo.F, range->hi.F, mask);     \
+    }
+
+COL_RANGE_SCALAR(double, f64)
+COL_RANGE_SCALAR(float, f32)
+COL_RANGE_SCALAR(int64_t, i64)
+COL_RANGE_SCALAR(int32_t, i32)
+COL_RANGE_SCALAR(uint8_t, u8)
+
+/* SIMD kernels */
+
+#ifdef MLC_SIMD_X86
+
+/* Each helper returns one bit per lane of the vector at `p`, set if the
+ * lane lies within `[lo, hi]`. Ordered compares leave NaN lanes unset. */
+
+MLC_TARGET_AVX2 static inline uint64_t col_avx2_in_double(
+    const double *p,
+    const double lo,
+    const double hi
+) {
+    const __m256d v = _mm256_loadu_pd(p);
+    return (uint64_t)_mm256_movemask_pd(_mm256_and_pd(
+        _mm256_cmp_pd(v, _mm256_set1_pd(lo), _CMP_GE_OQ),
+        _mm256_cmp_pd(v, _mm256_set1_pd(hi), _CMP_LE_OQ)
+    ));
+}
+
+MLC_TARGET_AVX2 static inline uint64_t col_avx2_in_float(
+    const float *p,
+    const float lo,
+    const float hi
+) {
+    const __m256 v = _mm256_loadu_ps(p);
+    return (uint64_t)_mm256_movemask_ps(_mm256_and_ps(
+        _mm256_cmp_ps(v, _mm256_set1_ps(lo), _CMP_GE_OQ),
+        _mm256_cmp_ps(v, _mm256_set1_ps(hi), _CMP_LE_OQ)
+    ));
+}
+
+/* AVX2 only has a signed greater-than, so the lanes outside are found */
+MLC_TARGET_AVX2 static inline uint64_t col_avx2_in_int64_t(
+    const int64_t *p,
+    const int64_t lo,
+    const int64_t hi
+) {
+    const __m256i v = _mm256_loadu_si256((const __m256i *)p);
+    const __m256i out = _mm256_or_si256(
+        _mm256_cmpgt_epi64(_mm256_set1_epi64x(lo), v),
+        _mm256_cmpgt_epi64(v, _mm256_set1_epi64x(hi))
+    );
+    return ~(uint64_t)_mm256_movemask_pd(_mm256_castsi256_pd(out)) & 0xF;
+}
+
+MLC_TARGET_AVX2 static inline uint64_t col_avx2_in_int32_t(
+    const int32_t *p,
+    const int32_t lo,
+    const int32_t hi
+) {
+    const __m256i v = _mm256_loadu_si256((const __m256i *)p);
+    const __m256i out = _mm256_or_si256(
+        _mm256_cmpgt_epi32(_mm256_set1_epi32(lo), v),
+        _mm256_cmpgt_epi32(v, _mm256_set1_epi32(hi))
+    );
+    return ~(uint64_t)_mm256_movemask_ps(_mm256_castsi256_ps(out)) & 0xFF;
+}
+
+/* Unsigned bytes: `x` is in range if clamping it changes nothing */
+MLC_TARGET_AVX2 static inline uint64_t col_avx2_in_uint8_t(
+    const uint8_t *p,
+    const uint8_t lo,
+    const uint8_t hi
+) {
+    const __m256i v = _mm256_loadu_si256((const __m256i *)p);
+    const __m256i in = _mm256_and_si256(
+        _mm256_cmpeq_epi8(_mm256_max_epu8(v, _mm256_set1_epi8((char)lo)), v),
+        _mm256_cmpeq_epi8(_mm256_min_epu8(v, _mm256_set1_epi8((char)hi)), v)
+    );
+    return (uint32_t)_mm256_movemask_epi8(in);
+}
+
+MLC_TARGET_AVX512 static inline uint64_t col_avx512_in_double(
+    const double *p,
+    const double lo,
+    const double hi
+) {
+    const __m512d v = _mm512_loadu_pd(p);
+    const __mmask8 ge = _mm512_cmp_pd_mask(v, _mm512_set1_pd(lo), _CMP_GE_OQ);
+    return _mm512_mask_cmp_pd_mask(ge, v, _mm512_set1_pd(hi), _CMP_LE_OQ);
+}
+
+MLC_TARGET_AVX512 static inline uint64_t col_avx512_in_float(
+    const float *p,
+    const float lo,
+    const float hi
+) {
+    const __m512 v = _mm512_loadu_ps(p);
+    const __mmask16 ge = _mm512_cmp_ps_mask(v, _mm512_set1_ps(lo), _CMP_GE_OQ);
+    return _mm512_mask_cmp_ps_mask(ge, v, _mm512_set1_ps(hi), _CMP_LE_OQ);
+}
+
+MLC_TARGET_AVX512 static inline uint64_t col_avx512_in_int64_t(
+    const int64_t *p,
+    const int64_t lo,
+    const int64_t hi
+) {
+    const __m512i v = _mm512_loadu_si512(p);
+    const __mmask8 ge = _mm512_cmp_epi64_mask(
+        v, _mm512_set1_epi64(lo), _MM_CMPINT_NLT
+    );
+    return _mm512_mask_cmp_epi64_mask(ge, v, _mm512_set1_epi64(hi), _MM_CMPINT_LE);
+}
+
+MLC_TARGET_AVX512 static inline uint64_t col_avx512_in_int32_t(
+    const int32_t *p,
+    const int32_t lo,
+    const int32_t hi
+) {
+    const __m512i v = _mm512_loadu_si512(p);
+    const __mmask16 ge = _mm512_cmp_epi32_mask(
+        v, _mm512_set1_epi32(lo), _MM_CMPINT_NLT
+    );
+    return _mm512_mask_cmp_epi32_mask(ge, v, _mm512_set1_epi32(hi), _MM_CMPINT_LE);
+}
+
+MLC_TARGET_AVX512 static inline uint64_t col_avx512_in_uint8_t(
+    const uint8_t *p,
+    const uint8_t lo,
+    const uint8_t hi
+) {
+    const __m512i v = _mm512_loadu_si512(p);
+    const __mmask64 ge = _mm512_cmp_epu8_mask(
+        v, _mm512_set1_epi8((char)lo), _MM_CMPINT_NLT
+    );
+    return _mm512_mask_cmp_epu8_mask(
+        ge, v, _mm512_set1_epi8((char)hi), _MM_CMPINT_LE
+    );
+}
+
+/* Blocks of 64 rows fill one 64-bit word of the mask, `W` lanes at a time.
+ * x86 is little-endian, so the word's bytes land in row order. */
+#define COL_RANGE_SIMD(isa, TARGET, T, F, W)                                \
+    TARGET static void col_range_##isa##_##T(                               \
+        const void *data,                                                   \
+        const size_t n,                                                     \
+        const col_range_t *range,                                           \
+        uint8_t *mask                                                       \
+    ) {                                                                     \
+        const T *x = data;                                                  \
+        const T lo = range->lo.F, hi = range->hi.F;                         \
+        size_t i = 0;                                                       \
+        for (; i + 64 <= n; i += 64) {                                      \
+            uint64_t bits = 0;                                              \
+            for (size_t j = 0; j < 64; j += (W))                            \
+                bits |= col_##isa##_in_##T(x + i + j, lo, hi) << j;         \
+            memcpy(mask + (i >> 3), &bits, sizeof(bits));                   \
+        }                                                                   \
+        col_range_tail_##T(x, i, n, lo, hi, mask);                          \
+    }
+
+#define COL_RANGE_SIMD_TYPES(isa, TARGET, BYTES)                            \
+    COL_RANGE_SIMD(isa, TARGET, double, f64, (BYTES) / 8)                   \
+    COL_RANGE_SIMD(isa, TARGET, float, f32, (BYTES) / 4)                    \
+    COL_RANGE_SIMD(isa, TARGET, int64_t, i64, (BYTES) / 8)                  \
+    COL_RANGE_SIMD(isa, TARGET, int32_t, i32, (BYTES) / 4)                  \
+    COL_RANGE_SIMD(isa, TARGET, uint8_t, u8, (BYTES))
+
+COL_RANGE_SIMD_TYPES(avx2, MLC_TARGET_AVX2, 32)
+COL_RANGE_SIMD_TYPES(avx512, MLC_TARGET_AVX512, 64)
+
+#endif
+
+/* dispatch table, indexed by [isa][dtype] */
+
+#define COL_RANGE_ROW(isa) {                                                \
+    [COL_DTYPE_DOUBLE] = col_range_##isa##_double,                          \
+    [COL_DTYPE_FLOAT] = col_range_##isa##_float,                            \
+    [COL_DTYPE_INT64] = col_range_##isa##_int64_t,                          \
+    [COL_DTYPE_INT32] = col_range_##isa##_int32_t,                          \
+    [COL_DTYPE_UINT8] = col_range_##isa##_uint8_t                           \
+}
+
+/* SSE2 is the x86-64 baseline the scalar loops are already compiled for */
+static const col_range_fn
+col_range_kernels[MLC_ISA_COUNT][COL_DTYPE_UINT8 + 1] = {
+    [MLC_ISA_SCALAR] = COL_RANGE_ROW(scalar),
+#ifdef MLC_SIMD_X86
+    [MLC_ISA_SSE2] = COL_RANGE_ROW(scalar),
+    [MLC_ISA_AVX2] = COL_RANGE_ROW(avx2),
+    [MLC_ISA_AVX512] = COL_RANGE_ROW(avx512)
+#endif
+};
+
+/* ranges */
+
+/* `v` rounded to the column's floating point type, saturating to infinity */
+static double col_float_round(const double v, const int single) {
+    if (!single)
+        return v;
+    if (v > FLT_MAX)
+        return INFINITY;
+    if (v < -FLT_MAX)
+        return -INFINITY;
+    return (float)v;
+}
+
+static double col_float_next(const double v, const double dir, const int single) {
+    return single ? nextafterf((float)v, (float)dir) : nextafter(v, dir);
+}
+
+static void col_int_limits(const col_dtype_t dtype, int64_t *min, int64_t *max) {
+    switch (dtype) {
+        case COL_DTYPE_INT64:
+            *min = INT64_MIN;
+            *max = INT64_MAX;
+            break;
+        case COL_DTYPE_INT32:
+            *min = INT32_MIN;
+            *max = INT32_MAX;
+            break;
+        default:
+            *min = 0;
+            *max = UINT8_MAX;
+            break;
+    }
+}
+
+/* Builds the range of values `x` of `dtype` with `lo < x < hi`, where each
+ * bound may instead be closed. Values compare exactly, so the bounds snap
+ * inwards to the nearest values the type can hold. */
+static void col_range_make(
+    const col_dtype_t dtype,
+    const double lo,
+    const int lo_open,
+    const double hi,
+    const int hi_open,
+    col_range_t *range
+) {
+    memset(range, 0, sizeof(*range));
+    if (isnan(lo) || isnan(hi)) {
+        range->empty = 1;
+        return;
+    }
+
+    if (dtype == COL_DTYPE_DOUBLE || dtype == COL_DTYPE_FLOAT) {
+        const int single = dtype == COL_DTYPE_FLOAT;
+        double a = col_float_round(lo, single);
+        double b = col_float_round(hi, single);
+        if (a < lo || (lo_open && a == lo))
+            a = col_float_next(a, INFINITY, single);
+        if (b > hi || (hi_open && b == hi))
+            b = col_float_next(b, -INFINITY, single);
+
+        /* nothing lies past an infinite bound, so stepping cannot meet it */
+        range->empty = a > b
+            || a < lo || (lo_open && a == lo)
+            || b > hi || (hi_open && b == hi);
+        if (single) {
+            range->lo.f32 = (float)a;
+            range->hi.f32 = (float)b;
+        } else {
+            range->lo.f64 = a;
+            range->hi.f64 = b;
+        }
+        return;
+    }
+
+    int64_t min, max;
+    col_int_limits(dtype, &min, &max);
+
+    /* `max + 1` is exact in `double` for every integer dtype */
+    const double above = (double)max + 1.0;
+    const double a = ceil(lo);
+    const double b = floor(hi);
+    if (a >= above || b < (double)min) {
+        range->empty = 1;
+        return;
+    }
+
+    int64_t ia = a < (double)min ? min : (int64_t)a;
+    int64_t ib = b >= above ? max : (int64_t)b;
+    if (lo_open && a == lo && a >= (double)min) {
+        if (ia == max) {
+            range->empty = 1;
+            return;
+        }
+        ia++;
+    }
+    if (hi_open && b == hi && b < above) {
+        if (ib == min) {
+            range->empty = 1;
+            return;
+        }
+        ib--;
+    }
+    range->empty = ia > ib;
+
+    switch (dtype) {
+        case COL_DTYPE_INT64:
+            range->lo.i64 = ia;
+            range->hi.i64 = ib;
+            break;
+        case COL_DTYPE_INT32:
+            range->lo.i32 = (int32_t)ia;
+            range->hi.i32 = (int32_t)ib;
+            break;
+        default:
+            range->lo.u8 = (uint8_t)ia;
+            range->hi.u8 = (uint8_t)ib;
+            break;
+    }
+}
+
+static void col_range_cmp(
+    const col_dtype_t dtype,
+    const col_cmp_t cmp,
+    const double v,
+    col_range_t *range
+) {
+    switch (cmp) {
+        case COL_CMP_LT:
+            col_range_make(dtype, -INFINITY, 0, v, 1, range);
+            break;
+        case COL_CMP_LE:
+            col_range_make(dtype, -INFINITY, 0, v, 0, range);
+            break;
+        case COL_CMP_GT:
+            col_range_make(dtype, v, 1, INFINITY, 0, range);
+            break;
+        case COL_CMP_GE:
+            col_range_make(dtype, v, 0, INFINITY, 0, range);
+            break;
+        default:
+            col_range_make(dtype, v, 0, v, 0, range);
+            range->negate = cmp == COL_CMP_NE;
+            break;
+    }
+}
+
+/* Tests one row against a range, ignoring validity */
+static int col_range_row(const col_t *col, const col_range_t *r, const size_t i) {
+    int in = 0;
+    switch (col->dtype) {
+        case COL_DTYPE_DOUBLE: {
+            const double x = ((const double *)col->data)[i];
+            in = x >= r->lo.f64 && x <= r->hi.f64;
+            break;
+        }
+        case COL_DTYPE_FLOAT: {
+            const float x = ((const float *)col->data)[i];
+            in = x >= r->lo.f32 && x <= r->hi.f32;
+            break;
+        }
+        case COL_DTYPE_INT64: {
+            const int64_t x = ((const int64_t *)col->data)[i];
+            in = x >= r->lo.i64 && x <= r->hi.i64;
+            break;
+        }
+        case COL_DTYPE_INT32: {
+            const int32_t x = ((const int32_t *)col->data)[i];
+            in = x >= r->lo.i32 && x <= r->hi.i32;
+            break;
+        }
+        default: {
+            const uint8_t x = ((const uint8_t *)col->data)[i];
+            in = x >= r->lo.u8 && x <= r->hi.u8;
+            break;
+        }
+    }
+    return (!r->empty && in) != r->negate;
+}
+
+/* predicates */
+
+typedef enum col_pred_kind {
+    COL_PRED_RANGE = 0,
+    COL_PRED_VALUES,
+    COL_PRED_STRINGS,
+    COL_PRED_CODES
+} col_pred_kind_t;
+
+/* A predicate bound to a column, with whatever lookup structure it needs */
+typedef struct col_pred {
+    const col_t *col;
+    col_pred_kind_t kind;
+    col_range_t range;      /* COL_PRED_RANGE */
+    col_scalar_t *values;   /* COL_PRED_VALUES: sorted `f64` or `i64` */
+    size_t n_values;
+    const char **slots;     /* COL_PRED_STRINGS: open addressing set */
+    size_t n_slots;
+    uint8_t *codes;         /* COL_PRED_CODES: 1 for each matching code */
+} col_pred_t;
+
+static int col_pred_validate(const col_t *col, const int numeric) {
+    if (!col)
+        return COL_ERR_NO_DATA;
+    if (numeric && !col_dtype_is_numeric(col->dtype))
+        return COL_ERR_INVALID_DTYPE;
+    if (!numeric && col->dtype != COL_DTYPE_STRING
+        && col->dtype != COL_DTYPE_CATEGORY)
+        return COL_ERR_INVALID_DTYPE;
+    return COL_ERR_OK;
+}
+
+static int col_pred_cmp(
+    col_pred_t *pred,
+    const col_t *col,
+    const col_cmp_t cmp,
+    const double value
+) {
+    memset(pred, 0, sizeof(*pred));
+    const int err_code = col_pred_validate(col, 1);
+    if (err_code)
+        return err_code;
+    if ((unsigned)cmp >= COL_CMPS)
+        return COL_ERR_INVALID_ARG;
+
+    pred->col = col;
+    pred->kind = COL_PRED_RANGE;
+    col_range_cmp(col->dtype, cmp, value, &pred->range);
+    return COL_ERR_OK;
+}
+
+static int col_pred_between(
+    col_pred_t *pred,
+    const col_t *col,
+    const double lo,
+    const double hi
+) {
+    memset(pred, 0, sizeof(*pred));
+    const int err_code = col_pred_validate(col, 1);
+    if (err_code)
+        return err_code;
+
+    pred->col = col;
+    pred->kind = COL_PRED_RANGE;
+    col_range_make(col->dtype, lo, 0, hi, 0, &pred->range);
+    return COL_ERR_OK;
+}
+
+static int col_value_cmp_f64(const void *a, const void *b) {
+    const double x = ((const col_scalar_t *)a)->f64;
+    const double y = ((const col_scalar_t *)b)->f64;
+    return (x > y) - (x < y);
+}
+
+static int col_value_cmp_i64(const void *a, const void *b) {
+    const int64_t x = ((const col_scalar_t *)a)->i64;
+    const int64_t y = ((const col_scalar_t *)b)->i64;
+    return (x > y) - (x < y);
+}
+
+/* Keeps the values a row of the column can equal, widened to `f64` for
+ * floating point columns and `i64` for integers, and sorts them */
+static int col_pred_isin(
+    col_pred_t *pred,
+    const col_t *col,
+    const double *values,
+    const size_t n_values
+) {
+    memset(pred, 0, sizeof(*pred));
+    const int err_code = col_pred_validate(col, 1);
+    if (err_code)
+        return err_code;
+    if (n_values && !values)
+        return COL_ERR_NO_DATA;
+
+    pred->col = col;
+    pred->kind = COL_PRED_VALUES;
+    pred->values = malloc((n_values ? n_values : 1) * sizeof(col_scalar_t));
+    if (!pred->values)
+        return COL_ERR_OOM;
+
+    const int is_float = col->dtype == COL_DTYPE_DOUBLE
+        || col->dtype == COL_DTYPE_FLOAT;
+    int64_t min, max;
+    col_int_limits(col->dtype, &min, &max);
+
+    size_t n = 0;
+    for (size_t i = 0; i < n_values; i++) {
+        const double v = values[i];
+        if (is_float) {
+            if (isnan(v) || col_float_round(v, col->dtype == COL_DTYPE_FLOAT) != v)
+                continue;
+            pred->values[n++].f64 = v;
+            continue;
+        }
+        /* also rejects NaN */
+        if (v != trunc(v) || v < (double)min || v >= (double)max + 1.0)
+            continue;
+        pred->values[n++].i64 = (int64_t)v;
+    }
+
+    qsort(
+        pred->values,
+        n,
+        sizeof(col_scalar_t),
+        is_float ? col_value_cmp_f64 : col_value_cmp_i64
+    );
+    pred->n_values = n;
+    return COL_ERR_OK;
+}
+
+/* Finds a string in the set: its slot, or the empty slot it would take */
+static size_t col_pred_probe(const col_pred_t *pred, const char *str) {
+    const size_t mask = pred->n_slots - 1;
+    size_t slot = (size_t)mlc_hash_str(str) & mask;
+    while (pred->slots[slot] && strcmp(pred->slots[slot], str))
+        slot = (slot + 1) & mask;
+    return slot;
+}
+
+/* Hashes the strings for a `string` column, or maps them to codes for a
+ * `category` column, where each row then costs one table lookup */
+static int col_pred_isin_str(
+    col_pred_t *pred,
+    const col_t *col,
+    const char *const *values,
+    const size_t n_values
+) {
+    memset(pred, 0, sizeof(*pred));
+    const int err_code = col_pred_validate(col, 0);
+    if (err_code)
+        return err_code;
+    if (n_values && !values)
+        return COL_ERR_NO_DATA;
+    for (size_t i = 0; i < n_values; i++)
+        if (!values[i])
+            return COL_ERR_NO_DATA;
+
+    pred->col = col;
+    if (col->dtype == COL_DTYPE_CATEGORY) {
+        const size_t n_categories = col->dict->values->n_rows;
+        pred->kind = COL_PRED_CODES;
+        pred->codes = calloc(n_categories ? n_categories : 1, 1);
+        if (!pred->codes)
+            return COL_ERR_OOM;
+
+        for (size_t i = 0; i < n_values; i++) {
+            const int32_t code = col_category_code_of(col, values[i], NULL);
+            if (code >= 0)
+                pred->codes[code] = 1;
+        }
+        return COL_ERR_OK;
+    }
+
+    size_t n_slots = 8;
+    while (n_slots < n_values * 2)
+        n_slots *= 2;
+
+    pred->kind = COL_PRED_STRINGS;
+    pred->n_slots = n_slots;
+    pred->slots = calloc(n_slots, sizeof(const char *));
+    if (!pred->slots)
+        return COL_ERR_OOM;
+
+    for (size_t i = 0; i < n_values; i++)
+        pred->slots[col_pred_probe(pred, values[i])] = values[i];
+    return COL_ERR_OK;
+}
+
+static void col_pred_free(col_pred_t *pred) {
+    free(pred->values);
+    free((void *)pred->slots);
+    free(pred->codes);
+}
+
+/* Binary search for the first value not below `x`, then an equality test */
+#define COL_VALUES_HAS(F, T)                                                \
+    static int col_values_has_##F(                                          \
+        const col_scalar_t *values,                                         \
+        const size_t n,                                                     \
+        const T x                                                           \
+    ) {                                                                     \
+        size_t lo = 0, hi = n;                                              \
+        while (lo < hi) {                                                   \
+            const size_t mid = lo + (hi - lo) / 2;                          \
+            if (values[mid].F < x)                                          \
+                lo = mid + 1;                                               \
+            else                                                            \
+                hi = mid;                                                   \
+        }                                                                   \
+        return lo < n && values[lo].F == x;                                 \
+    }
+
+COL_VALUES_HAS(f64, double)
+COL_VALUES_HAS(i64, int64_t)
+
+/* Tests one row against a predicate, ignoring validity */
+static int col_pred_value(const col_pred_t *pred, const size_t i) {
+    const col_t *col = pred->col;
+    switch (pred->kind) {
+        case COL_PRED_RANGE:
+            return col_range_row(col, &pred->range, i);
+        case COL_PRED_VALUES:
+            break;
+        case COL_PRED_STRINGS: {
+            const size_t *offsets = col->data;
+            const char *str = col->strbuf.bytes + offsets[i];
+            return pred->slots[col_pred_probe(pred, str)] != NULL;
+        }
+        default:
+            return pred->codes[col_code_read(col->data, col->stride, i)];
+    }
+
+    const col_scalar_t *values = pred->values;
+    const size_t n = pred->n_values;
+    switch (col->dtype) {
+        case COL_DTYPE_DOUBLE:
+            return col_values_has_f64(values, n, ((const double *)col->data)[i]);
+        case COL_DTYPE_FLOAT:
+            return col_values_has_f64(values, n, ((const float *)col->data)[i]);
+        case COL_DTYPE_INT64:
+            return col_values_has_i64(values, n, ((const int64_t *)col->data)[i]);
+        case COL_DTYPE_INT32:
+            return col_values_has_i64(values, n, ((const int32_t *)col->data)[i]);
+        default:
+            return col_values_has_i64(values, n, ((const uint8_t *)col->data)[i]);
+    }
+}
+
+static int col_pred_row(const col_pred_t *pred, const size_t i) {
+    const col_t *col = pred->col;
+    if (col->null_count && !col_bit_get(col->validity, i))
+        return 0;
+    return col_pred_value(pred, i);
+}
+
+/* Evaluates the predicate over every row. Bits of null rows and bits past
+ * the last row are cleared. */
+static void col_pred_mask(const col_pred_t *pred, uint8_t *mask) {
+    const col_t *col = pred->col;
+    const size_t n_rows = col->n_rows;
+    const size_t n_bytes = col_validity_bytes(n_rows);
+
+    if (pred->kind == COL_PRED_RANGE) {
+        const col_range_t *range = &pred->range;
+        if (range->empty)
+            memset(mask, 0, n_bytes);
+        else
+            col_range_kernels[mlc_cpu_isa()][col->dtype](
+                col->data, n_rows, range, mask
+            );
+
+        if (range->negate)
+            for (size_t b = 0; b < n_bytes; b++)
+                mask[b] = (uint8_t)~mask[b];
+    } else {
+        for (size_t i = 0; i < n_rows; i += 8) {
+            const size_t m = n_rows - i < 8 ? n_rows - i : 8;
+            unsigned bits = 0;
+            for (size_t k = 0; k < m; k++)
+                bits |= (unsigned)col_pred_value(pred, i + k) << k;
+            mask[i >> 3] = (uint8_t)bits;
+        }
+    }
+
+    if (col->null_count)
+        for (size_t b = 0; b < n_bytes; b++)
+            mask[b] &= col->validity[b];
+    if (n_rows % 8)
+        mask[n_bytes - 1] &= (uint8_t)((1u << (n_rows % 8)) - 1);
+}
+
+/* selection vectors */
+
+static int col_sel_reserve(col_sel_t *sel, const size_t capacity) {
+    if (capacity <= sel->capacity)
+        return COL_ERR_OK;
+    if (capacity > SIZE_MAX / sizeof(size_t))
+        return COL_ERR_OOM;
+
+    size_t *idx = realloc(sel->idx, capacity * sizeof(size_t));
+    if (!idx)
+        return COL_ERR_OOM;
+
+    sel->idx = idx;
+    sel->capacity = capacity;
+    return COL_ERR_OK;
+}
+
+/* Word `w` of a mask, with the bits past `n_rows` cleared */
+static uint64_t col_mask_word(
+    const uint8_t *mask,
+    const size_t n_rows,
+    const size_t w
+) {
+    const size_t rem = n_rows - w * 64;
+    const size_t n = rem < 64 ? rem : 64;
+
+    uint64_t bits = 0;
+    for (size_t k = 0; k * 8 < n; k++)
+        bits |= (uint64_t)mask[w * 8 + k] << (8 * k);
+    if (n < 64)
+        bits &= ((uint64_t)1 << n) - 1;
+    return bits;
+}
+
+col_sel_t *col_sel_create(const size_t capacity, int *err_out) {
+    /* alloc */
+    col_sel_t *sel = calloc(1, sizeof(col_sel_t));
+    if (!sel)
+        return mlc_fail_null(COL_ERR_OOM, err_out);
+
+    if (col_sel_reserve(sel, capacity)) {
+        free(sel);
+        return mlc_fail_null(COL_ERR_OOM, err_out);
+    }
+
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    return sel;
+}
+
+void col_sel_free(col_sel_t *sel) {
+    if (!sel)
+        return;
+
+    free(sel->idx);
+    free(sel);
+}
+
+int col_sel_from_mask(const uint8_t *mask, const size_t n_rows, col_sel_t *out) {
+    /* args */
+    if (!out || (n_rows && !mask))
+        return COL_ERR_NO_DATA;
+
+    const size_t n_words = n_rows / 64 + (n_rows % 64 != 0);
+
+    /* alloc */
+    size_t n = 0;
+    for (size_t w = 0; w < n_words; w++)
+        n += (size_t)__builtin_popcountll(col_mask_word(mask, n_rows, w));
+    if (col_sel_reserve(out, n))
+        return COL_ERR_OOM;
+
+    /* assign */
+    size_t *idx = out->idx;
+    for (size_t w = 0; w < n_words; w++) {
+        uint64_t bits = col_mask_word(mask, n_rows, w);
+        while (bits) {
+            *idx++ = w * 64 + (size_t)__builtin_ctzll(bits);
+            bits &= bits - 1;
+        }
+    }
+    out->n = n;
+
+    return COL_ERR_OK;
+}
+
+/* Refines `in`, or every row if NULL, into `out` */
+static int col_pred_sel(
+    const col_pred_t *pred,
+    const col_sel_t *in,
+    col_sel_t *out
+) {
+    const size_t n_rows = pred->col->n_rows;
+
+    /* args */
+    if (!out)
+        return COL_ERR_NO_DATA;
+    if (in) {
+        if (in->n && !in->idx)
+            return COL_ERR_NO_DATA;
+        for (size_t j = 0; j < in->n; j++)
+            if (in->idx[j] >= n_rows)
+                return COL_ERR_OUT_OF_BOUNDS;
+    }
+
+    /* sparse: test the selected rows one by one */
+    if (in && in->n * COL_SEL_DENSE < n_rows) {
+        if (col_sel_reserve(out, in->n))
+            return COL_ERR_OOM;
+
+        size_t n = 0;
+        for (size_t j = 0; j < in->n; j++)
+            if (col_pred_row(pred, in->idx[j]))
+                out->idx[n++] = in->idx[j];
+        out->n = n;
+        return COL_ERR_OK;
+    }
+
+    /* dense: evaluate every row with the vector kernels */
+    const size_t n_bytes = col_validity_bytes(n_rows);
+    uint8_t *mask = malloc(n_bytes ? n_bytes : 1);
+    if (!mask)
+        return COL_ERR_OOM;
+    col_pred_mask(pred, mask);
+
+    int err_code = COL_ERR_OK;
+    if (!in) {
+        err_code = col_sel_from_mask(mask, n_rows, out);
+    } else if (!(err_code = col_sel_reserve(out, in->n))) {
+        size_t n = 0;
+        for (size_t j = 0; j < in->n; j++)
+            if (col_bit_get(mask, in->idx[j]))
+                out->idx[n++] = in->idx[j];
+        out->n = n;
+    }
+
+    free(mask);
+    return err_code;
+}
+
+/* public predicates */
+
+int col_mask_cmp(
+    const col_t *col,
+    const col_cmp_t cmp,
+    const double value,
+    uint8_t *mask
+) {
+    col_pred_t pred;
+    const int err_code = col_pred_cmp(&pred, col, cmp, value);
+    if (err_code)
+        return err_code;
+    if (!mask && col->n_rows)
+        return COL_ERR_NO_DATA;
+
+    col_pred_mask(&pred, mask);
+    return COL_ERR_OK;
+}
+
+int col_mask_between(
+    const col_t *col,
+    const double lo,
+    const double hi,
+    uint8_t *mask
+) {
+    col_pred_t pred;
+    const int err_code = col_pred_between(&pred, col, lo, hi);
+    if (err_code)
+        return err_code;
+    if (!mask && col->n_rows)
+        return COL_ERR_NO_DATA;
+
+    col_pred_mask(&pred, mask);
+    return COL_ERR_OK;
+}
+
+int col_mask_isin(
+    const col_t *col,
+    const double *values,
+    const size_t n_values,
+    uint8_t *mask
+) {
+    col_pred_t pred;
+    int err_code = col_pred_isin(&pred, col, values, n_values);
+    if (!err_code && !mask && col->n_rows)
+        err_code = COL_ERR_NO_DATA;
+    if (!err_code)
+        col_pred_mask(&pred, mask);
+
+    col_pred_free(&pred);
+    return err_code;
+}
+
+int col_mask_isin_str(
+    const col_t *col,
+    const char *const *values,
+    const size_t n_values,
+    uint8_t *mask
+) {
+    col_pred_t pred;
+    int err_code = col_pred_isin_str(&pred, col, values, n_values);
+    if (!err_code && !mask && col->n_rows)
+        err_code = COL_ERR_NO_DATA;
+    if (!err_code)
+        col_pred_mask(&pred, mask);
+
+    col_pred_free(&pred);
+    return err_code;
+}
+
+int col_sel_cmp(
+    const col_t *col,
+    const col_cmp_t cmp,
+    const double value,
+    const col_sel_t *in,
+    col_sel_t *out
+) {
+    col_pred_t pred;
+    const int err_code = col_pred_cmp(&pred, col, cmp, value);
+    if (err_code)
+        return err_code;
+    return col_pred_sel(&pred, in, out);
+}
+
+int col_sel_between(
+    const col_t *col,
+    const double lo,
+    const double hi,
+    const col_sel_t *in,
+    col_sel_t *out
+) {
+    col_pred_t pred;
+    const int err_code = col_pred_between(&pred, col, lo, hi);
+    if (err_code)
+        return err_code;
+    return col_pred_sel(&pred, in, out);
+}
+
+int col_sel_isin(
+    const col_t *col,
+    const double *values,
+    const size_t n_values,
+    const col_sel_t *in,
+    col_sel_t *out
+) {
+    col_pred_t pred;
+    int err_code = col_pred_isin(&pred, col, values, n_values);
+    if (!err_code)
+        err_code = col_pred_sel(&pred, in, out);
+
+    col_pred_free(&pred);
+    return err_code;
+}
+
+int col_sel_isin_str(
+    const col_t *col,
+    const char *const *values,
+    const size_t n_values,
+    const col_sel_t *in,
+    col_sel_t *out
+) {
+    col_pred_t pred;
+    int err_code = col_pred_isin_str(&pred, col, values, n_values);
+    if (!err_code)
+        err_code = col_pred_sel(&pred, in, out);
+
+    col_pred_free(&pred);
+    return err_code;
+}
+
+col_t *col_filter(const col_t *col, const col_sel_t *sel, int *err_out) {
+    /* args */
+    if (!sel)
+        return mlc_fail_null(COL_ERR_NO_DATA, err_out);
+
+    return col_take(col, sel->idx, sel->n, err_out);
+}
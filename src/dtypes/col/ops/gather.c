@@ -0,0 +1,616 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/cpu.h"
+#include "core/error.h"
+#include "core/simd.h"
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/buffer.h"
+#include "dtypes/col/core/category.h"
+#include "dtypes/col/core/internal.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/col/core/strbuf.h"
+#include "dtypes/col/core/validity.h"
+#include "dtypes/col/ops/gather.h"
+
+/* Past this many bytes a source no longer fits the caches of most cores,
+ * and random rows are prefetched ahead of their use instead */
+#define COL_TAKE_PREFETCH_BYTES ((size_t)4 << 20)
+#define COL_TAKE_PREFETCH_AHEAD 16
+
+/* Integer types accepted as row indices */
+typedef enum col_index_type {
+    COL_INDEX_SIZE = 0,
+    COL_INDEX_INT32,
+    COL_INDEX_INT64,
+    COL_INDEX_TYPES
+} col_index_type_t;
+
+/* Copies `n` rows between `src` and `dst` through `idx` */
+typedef void (*col_move_fn)(
+    void *dst,
+    const void *src,
+    const void *idx,
+    const size_t n
+);
+
+/* THIS FUNCTION ASSUMES THE INDEX WAS BOUNDS CHECKED */
+static inline size_t col_index_at(
+    const void *idx,
+    const col_index_type_t type,
+    const size_t i
+) {
+    switch (type) {
+        case COL_INDEX_INT32:
+            return (size_t)((const int32_t *)idx)[i];
+        case COL_INDEX_INT64:
+            return (size_t)((const int64_t *)idx)[i];
+        default:
+            return ((const size_t *)idx)[i];
+    }
+}
+
+/* Negative indices wrap to huge unsigned values, so one compare per index
+ * covers both ends. Zero if every index lies in `[0, n_rows)`. */
+static int col_index_check(
+    const void *idx,
+    const col_index_type_t type,
+    const size_t n,
+    const size_t n_rows
+) {
+    const uint64_t bound = n_rows;
+    int bad = 0;
+    switch (type) {
+        case COL_INDEX_INT32: {
+            const int32_t *x = idx;
+            for (size_t i = 0; i < n; i++)
+                bad |= (uint64_t)(int64_t)x[i] >= bound;
+            break;
+        }
+        case COL_INDEX_INT64: {
+            const int64_t *x = idx;
+            for (size_t i = 0; i < n; i++)
+                bad |= (uint64_t)x[i] >= bound;
+            break;
+        }
+        default: {
+            const size_t *x = idx;
+            for (size_t i = 0; i < n; i++)
+                bad |= (uint64_t)x[i] >= bound;
+            break;
+        }
+    }
+    return bad;
+}
+
+/* scalar kernels */
+
+/* Rows are moved as unsigned integers of their width. The prefetching
+ * variants request the row `COL_TAKE_PREFETCH_AHEAD` iterations ahead, so
+ * that many cache misses are in flight at once. */
+#define COL_MOVE_SCALAR(IN, I, T)                                           \
+    static void col_take_scalar_##IN##_##T(                                 \
+        void *dst,                                                          \
+        const void *src,                                                    \
+        const void *idx,                                                    \
+        const size_t n                                                      \
+    ) {                                                                     \
+        T *d = dst;                                                         \
+        const T *s = src;                                                   \
+        const I *x = idx;                                                   \
+        for (size_t i = 0; i < n; i++)                                      \
+            d[i] = s[x[i]];                                                 \
+    }                                                                       \
+    static void col_take_prefetch_##IN##_##T(                               \
+        void *dst,                                                          \
+        const void *src,                                                    \
+        const void *idx,                                                    \
+        const size_t n                                                      \
+    ) {                                                                     \
+        T *d = dst;                                                         \
+        const T *s = src;                                                   \
+        const I *x = idx;                                                   \
+        size_t i = 0;                                                       \
+        for (; i + COL_TAKE_PREFETCH_AHEAD < n; i++) {                      \
+            __builtin_prefetch(s + x[i + COL_TAKE_PREFETCH_AHEAD]);         \
+            d[i] = s[x[i]];                                                 \
+        }                                                                   \
+        for (; i < n; i++)                                                  \
+            d[i] = s[x[i]];                                                 \
+    }                                                                       \
+    static void col_scatter_scalar_##IN##_##T(                              \
+        void *dst,                                                          \
+        const void *src,                                                    \
+        const void *idx,                                                    \
+        const size_t n                                                      \
+    ) {                                                                     \
+        T *d = dst;                                                         \
+        const T *s = src;                                                   \
+        const I *x = idx;                                                   \
+        for (size_t i = 0; i < n; i++)                                      \
+            d[x[i]] = s[i];                                                 \
+    }                                                                       \
+    static void col_scatter_prefetch_##IN##_##T(                            \
+        void *dst,                                                          \
+        const void *src,                                                    \
+        const void *idx,                                                    \
+        const size_t n                                                      \
+    ) {                                                                     \
+        T *d = dst;                                                         \
+        const T *s = src;                                                   \
+        const I *x = idx;                                                   \
+        size_t i = 0;                                                       \
+        for (; i + COL_TAKE_PREFETCH_AHEAD < n; i++) {                      \
+            __builtin_prefetch(d + x[i + COL_TAKE_PREFETCH_AHEAD], 1);      \
+            d[x[i]] = s[i];                                                 \
+        }                                                                   \
+        for (; i < n; i++)                                                  \
+            d[x[i]] = s[i];                                                 \
+    }
+
+#define COL_MOVE_SCALAR_WIDTHS(IN, I)                                       \
+    COL_MOVE_SCALAR(IN, I, uint8_t)                                         \
+    COL_MOVE_SCALAR(IN, I, uint16_t)                                        \
+    COL_MOVE_SCALAR(IN, I, uint32_t)                                        \
+    COL_MOVE_SCALAR(IN, I, uint64_t)
+
+COL_MOVE_SCALAR_WIDTHS(size, size_t)
+COL_MOVE_SCALAR_WIDTHS(i32, int32_t)
+COL_MOVE_SCALAR_WIDTHS(i64, int64_t)
+
+/* SIMD kernels */
+
+#ifdef MLC_SIMD_X86
+
+/* Hardware gathers only load 32 and 64-bit lanes. Narrower rows keep the
+ * scalar loops. */
+#define COL_TAKE_AVX2(IN, I, T, W, VIDX, LOAD, GATHER, STORE)               \
+    MLC_TARGET_AVX2 static void col_take_avx2_##IN##_##T(                   \
+        void *dst,                                                          \
+        const void *src,                                                    \
+        const void *idx,                                                    \
+        const size_t n                                                      \
+    ) {                                                                     \
+        T *d = dst;                                                         \
+        const T *s = src;                                                   \
+        const I *x = idx;                                                   \
+        size_t i = 0;                                                       \
+        for (; i + (W) <= n; i += (W)) {                                    \
+            const VIDX v = LOAD((const void *)(x + i));                     \
+            STORE((void *)(d + i), GATHER(s, v));                           \
+        }                                                                   \
+        for (; i < n; i++)                                                  \
+            d[i] = s[x[i]];                                                 \
+    }
+
+#define col_avx2_load128(p) _mm_loadu_si128((const __m128i *)(p))
+#define col_avx2_load256(p) _mm256_loadu_si256((const __m256i *)(p))
+#define col_avx2_store128(p, v) _mm_storeu_si128((__m128i *)(p), v)
+#define col_avx2_store256(p, v) _mm256_storeu_si256((__m256i *)(p), v)
+
+#define col_avx2_gather_i32_u32(s, v) \
+    _mm256_i32gather_epi32((const int *)(s), v, 4)
+#define col_avx2_gather_i32_u64(s, v) \
+    _mm256_i32gather_epi64((const long long *)(s), v, 8)
+#define col_avx2_gather_i64_u32(s, v) \
+    _mm256_i64gather_epi32((const int *)(s), v, 4)
+#define col_avx2_gather_i64_u64(s, v) \
+    _mm256_i64gather_epi64((const long long *)(s), v, 8)
+
+COL_TAKE_AVX2(i32, int32_t, uint32_t, 8, __m256i,
+    col_avx2_load256, col_avx2_gather_i32_u32, col_avx2_store256)
+COL_TAKE_AVX2(i32, int32_t, uint64_t, 4, __m128i,
+    col_avx2_load128, col_avx2_gather_i32_u64, col_avx2_store256)
+COL_TAKE_AVX2(i64, int64_t, uint32_t, 4, __m256i,
+    col_avx2_load256, col_avx2_gather_i64_u32, col_avx2_store128)
+COL_TAKE_AVX2(i64, int64_t, uint64_t, 4, __m256i,
+    col_avx2_load256, col_avx2_gather_i64_u64, col_avx2_store256)
+
+/* `size_t` indices gather as `int64_t` where they have its width. Bounds
+ * checked indices are below `SIZE_MAX / stride`, so never negative. */
+#if SIZE_MAX == UINT64_MAX
+COL_TAKE_AVX2(size, size_t, uint32_t, 4, __m256i,
+    col_avx2_load256, col_avx2_gather_i64_u32, col_avx2_store128)
+COL_TAKE_AVX2(size, size_t, uint64_t, 4, __m256i,
+    col_avx2_load256, col_avx2_gather_i64_u64, col_avx2_store256)
+#else
+#define col_take_avx2_size_uint32_t col_take_scalar_size_uint32_t
+#define col_take_avx2_size_uint64_t col_take_scalar_size_uint64_t
+#endif
+
+#endif
+
+/* dispatch tables, indexed by [isa][index type][log2 of the row width] */
+
+/* `narrow` kernels move 8 and 16-bit rows, `wide` ones 32 and 64-bit rows */
+#define COL_MOVE_WIDTHS(kind, narrow, wide, IN) {                           \
+    col_##kind##_##narrow##_##IN##_uint8_t,                                 \
+    col_##kind##_##narrow##_##IN##_uint16_t,                                \
+    col_##kind##_##wide##_##IN##_uint32_t,                                  \
+    col_##kind##_##wide##_##IN##_uint64_t                                   \
+}
+
+#define COL_MOVE_ROW(kind, narrow, wide) {                                  \
+    [COL_INDEX_SIZE] = COL_MOVE_WIDTHS(kind, narrow, wide, size),           \
+    [COL_INDEX_INT32] = COL_MOVE_WIDTHS(kind, narrow, wide, i32),           \
+    [COL_INDEX_INT64] = COL_MOVE_WIDTHS(kind, narrow, wide, i64)            \
+}
+
+/* AVX-512 gathers are no faster per row than AVX2 ones on most cores */
+static const col_move_fn
+col_take_kernels[MLC_ISA_COUNT][COL_INDEX_TYPES][4] = {
+    [MLC_ISA_SCALAR] = COL_MOVE_ROW(take, scalar, scalar),
+#ifdef MLC_SIMD_X86
+    [MLC_ISA_SSE2] = COL_MOVE_ROW(take, scalar, scalar),
+    [MLC_ISA_AVX2] = COL_MOVE_ROW(take, scalar, avx2),
+    [MLC_ISA_AVX512] = COL_MOVE_ROW(take, scalar, avx2)
+#endif
+};
+
+static const col_move_fn
+col_take_prefetch_kernels[COL_INDEX_TYPES][4] =
+    COL_MOVE_ROW(take, prefetch, prefetch);
+
+static const col_move_fn
+col_scatter_kernels[COL_INDEX_TYPES][4] =
+    COL_MOVE_ROW(scatter, scalar, scalar);
+
+static const col_move_fn
+col_scatter_prefetch_kernels[COL_INDEX_TYPES][4] =
+    COL_MOVE_ROW(scatter, prefetch, prefetch);
+
+/* THIS FUNCTION ASSUMES STRIDE IS 1, 2, 4 OR 8 */
+static inline size_t col_width_log2(const size_t stride) {
+    return stride == 1 ? 0 : stride == 2 ? 1 : stride == 4 ? 2 : 3;
+}
+
+/* Selects the gather kernel for the source's size and the CPU */
+static col_move_fn col_take_kernel(
+    const col_index_type_t type,
+    const size_t stride,
+    const size_t n_rows
+) {
+    const size_t width = col_width_log2(stride);
+    if (n_rows * stride > COL_TAKE_PREFETCH_BYTES)
+        return col_take_prefetch_kernels[type][width];
+    return col_take_kernels[mlc_cpu_isa()][type][width];
+}
+
+/* strings */
+
+/* Sizes the string buffer once, then copies each string without a search */
+static int col_take_strings(
+    col_t *dst,
+    const col_t *src,
+    const void *idx,
+    const col_index_type_t type,
+    const size_t n
+) {
+    const size_t *src_offsets = src->data;
+    const char *bytes = src->strbuf.bytes;
+
+    size_t n_bytes = 0;
+    for (size_t i = 0; i < n; i++)
+        n_bytes += strlen(bytes + src_offsets[col_index_at(idx, type, i)]) + 1;
+
+    if (col_strbuf_reserve(dst, n_bytes))
+        return COL_ERR_OOM;
+
+    size_t *offsets = dst->data;
+    char *out = dst->strbuf.bytes;
+    size_t len = 0;
+    for (size_t i = 0; i < n; i++) {
+        const char *str = bytes + src_offsets[col_index_at(idx, type, i)];
+        const size_t str_len = strlen(str) + 1;
+        memcpy(out + len, str, str_len);
+        offsets[i] = len;
+        len += str_len;
+    }
+    dst->strbuf.len = len;
+
+    return COL_ERR_OK;
+}
+
+/* A gather of distinct rows covering most of an owned column, such as a
+ * shuffle, copies the string bytes whole and gathers only the offsets.
+ * The strings of rows left out count as waste, reclaimed by compaction.
+ * `done_out` is cleared if the gather does not qualify, leaving `dst`
+ * untouched. */
+static int col_take_strbuf(
+    col_t *dst,
+    const col_t *src,
+    const void *idx,
+    const col_index_type_t type,
+    const size_t n,
+    int *done_out
+) {
+    *done_out = 0;
+
+    /* a borrowed buffer holds strings of rows outside the column */
+    if ((src->flags & COL_FLAG_BORROWED) || !n || n * 2 < src->n_rows)
+        return COL_ERR_OK;
+
+    uint8_t *seen = calloc(col_validity_bytes(src->n_rows) + 1, 1);
+    if (!seen)
+        return COL_ERR_OOM;
+
+    int distinct = 1;
+    for (size_t i = 0; i < n && distinct; i++) {
+        const size_t j = col_index_at(idx, type, i);
+        distinct = !col_bit_get(seen, j);
+        col_bit_set(seen, j, 1);
+    }
+
+    /* rows sharing bytes would break the waste accounting */
+    if (!distinct) {
+        free(seen);
+        return COL_ERR_OK;
+    }
+
+    const size_t *src_offsets = src->data;
+    size_t waste = src->strbuf.waste;
+    for (size_t j = 0; j < src->n_rows; j++)
+        if (!col_bit_get(seen, j))
+            waste += strlen(src->strbuf.bytes + src_offsets[j]) + 1;
+    free(seen);
+
+    const size_t len = src->strbuf.len;
+    if (col_strbuf_reserve(dst, len))
+        return COL_ERR_OOM;
+
+    if (len)
+        memcpy(dst->strbuf.bytes, src->strbuf.bytes, len);
+    dst->strbuf.len = len;
+    dst->strbuf.waste = waste;
+
+    col_take_kernel(type, sizeof(size_t), src->n_rows)(
+        dst->data, src->data, idx, n
+    );
+
+    *done_out = 1;
+    return COL_ERR_OK;
+}
+
+/* drivers */
+
+static col_t *col_take_any(
+    const col_t *col,
+    const void *idx,
+    const col_index_type_t type,
+    const size_t n,
+    int *err_out
+) {
+    /* args */
+    if (!col || (n && !idx))
+        return mlc_fail_null(COL_ERR_NO_DATA, err_out);
+    if (col_index_check(idx, type, n, col->n_rows))
+        return mlc_fail_null(COL_ERR_OUT_OF_BOUNDS, err_out);
+
+    /* init */
+    int err_code = COL_ERR_OK;
+    col_t *new_col = col_create_with_allocator(
+        col->name,
+        n,
+        col->dtype,
+        &col->allocator,
+        &err_code
+    );
+    if (!new_col)
+        return mlc_fail_null(err_code, err_out);
+
+    err_code = COL_ERR_OOM;
+    if (col->dtype == COL_DTYPE_CATEGORY && col_category_adopt(new_col, col))
+        goto fail;
+    if (col->null_count && col_validity_init(new_col))
+        goto fail;
+
+    /* assign */
+    if (col->dtype == COL_DTYPE_STRING) {
+        int done = 0;
+        err_code = col_take_strbuf(new_col, col, idx, type, n, &done);
+        if (!err_code && !done)
+            err_code = col_take_strings(new_col, col, idx, type, n);
+        if (err_code)
+            goto fail;
+    } else if (n) {
+        col_take_kernel(type, col->stride, col->n_rows)(
+            new_col->data, col->data, idx, n
+        );
+    }
+    new_col->n_rows = n;
+
+    if (col->null_count) {
+        for (size_t i = 0; i < n; i++) {
+            if (col_bit_get(col->validity, col_index_at(idx, type, i)))
+                continue;
+            col_bit_set(new_col->validity, i, 0);
+            new_col->null_count++;
+        }
+    }
+
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    return new_col;
+
+fail:
+    col_free(new_col);
+    return mlc_fail_null(err_code, err_out);
+}
+
+/* Appends every string of `src` once, then points the target rows at them,
+ * releasing the strings they held */
+static int col_scatter_strings(
+    col_t *dst,
+    const col_t *src,
+    const void *idx,
+    const col_index_type_t type
+) {
+    const size_t *src_offsets = src->data;
+
+    size_t n_bytes = 0;
+    for (size_t i = 0; i < src->n_rows; i++)
+        n_bytes += strlen(src->strbuf.bytes + src_offsets[i]) + 1;
+
+    if (col_strbuf_reserve(dst, n_bytes))
+        return COL_ERR_OOM;
+
+    size_t *offsets = dst->data;
+    col_strbuf_t *buf = &dst->strbuf;
+    for (size_t i = 0; i < src->n_rows; i++) {
+        const size_t j = col_index_at(idx, type, i);
+        const char *str = src->strbuf.bytes + src_offsets[i];
+        const size_t str_len = strlen(str) + 1;
+
+        col_strbuf_release(dst, j, 1);
+        memcpy(buf->bytes + buf->len, str, str_len);
+        offsets[j] = buf->len;
+        buf->len += str_len;
+    }
+
+    return COL_ERR_OK;
+}
+
+/* Re-encodes the codes of `src` in the dictionary of `dst`, looking each
+ * category up once. Null rows keep code 0. */
+static int col_scatter_codes(
+    col_t *dst,
+    const col_t *src,
+    const void *idx,
+    const col_index_type_t type
+) {
+    const col_t *values = src->dict->values;
+    const size_t *value_offsets = values->data;
+
+    int32_t *map = malloc((values->n_rows + 1) * sizeof(int32_t));
+    if (!map)
+        return COL_ERR_OOM;
+    for (size_t c = 0; c < values->n_rows; c++)
+        map[c] = -1;
+
+    int err_code = COL_ERR_OK;
+    for (size_t i = 0; i < src->n_rows && !err_code; i++) {
+        int32_t code = 0;
+        if (!src->null_count || col_bit_get(src->validity, i)) {
+            const int32_t src_code = col_code_read(src->data, src->stride, i);
+            if (map[src_code] < 0)
+                err_code = col_category_encode(
+                    dst,
+                    values->strbuf.bytes + value_offsets[src_code],
+                    &map[src_code]
+                );
+            code = map[src_code];
+        }
+
+        /* encoding may have widened the codes of `dst` */
+        if (!err_code)
+            col_code_write(dst->data, dst->stride, col_index_at(idx, type, i), code);
+    }
+
+    free(map);
+    return err_code;
+}
+
+static int col_scatter_any(
+    col_t *dst,
+    const col_t *src,
+    const void *idx,
+    const col_index_type_t type
+) {
+    /* args */
+    if (!dst || !src || (src->n_rows && !idx))
+        return COL_ERR_NO_DATA;
+    if (dst == src)
+        return COL_ERR_INVALID_ARG;
+    if (dst->dtype != src->dtype)
+        return COL_ERR_INVALID_DTYPE;
+    if (col_index_check(idx, type, src->n_rows, dst->n_rows))
+        return COL_ERR_OUT_OF_BOUNDS;
+
+    /* malloc */
+    if (col_data_detach(dst))
+        return COL_ERR_OOM;
+    if (src->null_count && col_validity_init(dst))
+        return COL_ERR_OOM;
+
+    /* a source viewing the target's rows is copied before they change */
+    col_t *tmp = NULL;
+    if (col_rows_overlap(dst, src)) {
+        int err_code = COL_ERR_OK;
+        tmp = col_clone(src, &err_code);
+        if (!tmp)
+            return err_code;
+        src = tmp;
+    }
+
+    /* assign */
+    const size_t n = src->n_rows;
+    int err_code = COL_ERR_OK;
+    if (dst->dtype == COL_DTYPE_STRING) {
+        err_code = col_scatter_strings(dst, src, idx, type);
+    } else if (dst->dtype == COL_DTYPE_CATEGORY) {
+        err_code = col_scatter_codes(dst, src, idx, type);
+    } else if (n) {
+        const size_t width = col_width_log2(dst->stride);
+        const col_move_fn kernel = dst->n_rows * dst->stride > COL_TAKE_PREFETCH_BYTES
+            ? col_scatter_prefetch_kernels[type][width]
+            : col_scatter_kernels[type][width];
+        kernel(dst->data, src->data, idx, n);
+    }
+
+    if (!err_code && dst->validity) {
+        for (size_t i = 0; i < n; i++) {
+            const size_t j = col_index_at(idx, type, i);
+            const int valid = !src->null_count || col_bit_get(src->validity, i);
+            if (valid == col_bit_get(dst->validity, j))
+                continue;
+            col_bit_set(dst->validity, j, valid);
+            if (valid)
+                dst->null_count--;
+            else
+                dst->null_count++;
+        }
+    }
+
+    col_free(tmp);
+    return err_code;
+}
+
+col_t *col_take(
+    const col_t *col,
+    const size_t *idx,
+    const size_t n,
+    int *err_out
+) {
+    return col_take_any(col, idx, COL_INDEX_SIZE, n, err_out);
+}
+
+col_t *col_take_int32(
+    const col_t *col,
+    const int32_t *idx,
+    const size_t n,
+    int *err_out
+) {
+    return col_take_any(col, idx, COL_INDEX_INT32, n, err_out);
+}
+
+col_t *col_take_int64(
+    const col_t *col,
+    const int64_t *idx,
+    const size_t n,
+    int *err_out
+) {
+    return col_take_any(col, idx, COL_INDEX_INT64, n, err_out);
+}
+
+int col_scatter(col_t *dst, const col_t *src, const size_t *idx) {
+    return col_scatter_any(dst, src, idx, COL_INDEX_SIZE);
+}
+
+int col_scatter_int32(col_t *dst, const col_t *src, const int32_t *idx) {
+    return col_scatter_any(dst, src, idx, COL_INDEX_INT32);
+}
+
+int col_scatter_int64(col_t *dst, const col_t *src, const int64_t *idx) {
+    return col_scatter_any(dst, src, idx, COL_INDEX_INT64);
+}
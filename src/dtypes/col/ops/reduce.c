@@ -0,0 +1,759 @@
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "core/cpu.h"
+#include "core/error.h"
+#include "core/simd.h"
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/internal.h"
+#include "dtypes/col/core/validity.h"
+#include "dtypes/col/ops/reduce.h"
+
+/* Rows per kernel call. Block sums are combined with compensation, so the
+ * rounding error grows with the block size rather than the column length.
+ * A multiple of 8 keeps blocks aligned to validity bytes. */
+#define COL_REDUCE_BLOCK 2048
+
+typedef enum col_reduce_mode {
+    COL_REDUCE_SUM = 0, /* sum(x) */
+    COL_REDUCE_ABS,     /* sum(|x|) */
+    COL_REDUCE_SQ,      /* sum((x - center)^2) */
+    COL_REDUCE_MODES
+} col_reduce_mode_t;
+
+typedef double (*col_reduce_fn)(
+    const void *data,
+    const size_t n,
+    const double center
+);
+
+typedef void (*col_minmax_fn)(
+    const void *data,
+    const size_t n,
+    double *min_out,
+    double *max_out
+);
+
+/* scalar kernels */
+
+static inline double col_scalar_acc_sum(
+    const double acc,
+    const double v,
+    const double c
+) {
+    (void)c;
+    return acc + v;
+}
+
+static inline double col_scalar_acc_abs(
+    const double acc,
+    const double v,
+    const double c
+) {
+    (void)c;
+    return acc + fabs(v);
+}
+
+static inline double col_scalar_acc_sq(
+    const double acc,
+    const double v,
+    const double c
+) {
+    const double d = v - c;
+    return acc + d * d;
+}
+
+static inline double col_scalar_acc(
+    const col_reduce_mode_t mode,
+    const double acc,
+    const double v,
+    const double c
+) {
+    switch (mode) {
+        case COL_REDUCE_ABS:
+            return col_scalar_acc_abs(acc, v, c);
+        case COL_REDUCE_SQ:
+            return col_scalar_acc_sq(acc, v, c);
+        default:
+            return col_scalar_acc_sum(acc, v, c);
+    }
+}
+
+/* Four independent accumulators, summed pairwise at the end */
+#define COL_REDUCE_SCALAR(T, mode)                                          \
+    static double col_reduce_scalar_##T##_##mode(                           \
+        const void *data,                                                   \
+        const size_t n,                                                     \
+        const double center                                                 \
+    ) {                                                                     \
+        const T *x = data;                                                  \
+        double a0 = 0.0, a1 = 0.0, a2 = 0.0, a3 = 0.0;                      \
+        size_t i = 0;                                                       \
+        for (; i + 4 <= n; i += 4) {                                        \
+            a0 = col_scalar_acc_##mode(a0, (double)x[i], center);           \
+            a1 = col_scalar_acc_##mode(a1, (double)x[i + 1], center);       \
+            a2 = col_scalar_acc_##mode(a2, (double)x[i + 2], center);       \
+            a3 = col_scalar_acc_##mode(a3, (double)x[i + 3], center);       \
+        }                                                                   \
+        for (; i < n; i++)                                                  \
+            a0 = col_scalar_acc_##mode(a0, (double)x[i], center);           \
+        return (a0 + a1) + (a2 + a3);                                       \
+    }
+
+#define COL_MINMAX_SCALAR(T)                                                \
+    static void col_minmax_scalar_##T(                                      \
+        const void *data,                                                   \
+        const size_t n,                                                     \
+        double *min_out,                                                    \
+        double *max_out                                                     \
+    ) {                                                                     \
+        const T *x = data;                                                  \
+        double mn = INFINITY, mx = -INFINITY;                               \
+        for (size_t i = 0; i < n; i++) {                                    \
+            const double v = (double)x[i];                                  \
+            mn = v < mn ? v : mn;                                           \
+            mx = v > mx ? v : mx;                                           \
+        }                                                                   \
+        *min_out = mn;                                                      \
+        *max_out = mx;                                                      \
+    }
+
+#define COL_REDUCE_SCALAR_ALL(T)                                            \
+    COL_REDUCE_SCALAR(T, sum)                                               \
+    COL_REDUCE_SCALAR(T, abs)                                               \
+    COL_REDUCE_SCALAR(T, sq)                                                \
+    COL_MINMAX_SCALAR(T)
+
+COL_REDUCE_SCALAR_ALL(double)
+COL_REDUCE_SCALAR_ALL(float)
+COL_REDUCE_SCALAR_ALL(int64_t)
+COL_REDUCE_SCALAR_ALL(int32_t)
+COL_REDUCE_SCALAR_ALL(uint8_t)
+
+/* SIMD kernels
+ *
+ * Every numeric dtype except `int64` (which lacks a cheap conversion before
+ * AVX-512DQ and gains nothing over scalar) is widened to double lanes on
+ * load, so one set of accumulate/min/max helpers serves all of them. Each
+ * ISA provides: VEC type, lane count, zero/set1, load_<T>, acc_<mode>,
+ * min/max and horizontal sum/min/max. */
+
+#ifdef MLC_SIMD_X86
+
+/* SSE2: 2 lanes */
+
+MLC_TARGET_SSE2 static inline __m128d col_sse2_load_double(const double *p) {
+    return _mm_loadu_pd(p);
+}
+
+MLC_TARGET_SSE2 static inline __m128d col_sse2_load_float(const float *p) {
+    return _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64((const __m128i *)p)));
+}
+
+MLC_TARGET_SSE2 static inline __m128d col_sse2_load_int32_t(const int32_t *p) {
+    return _mm_cvtepi32_pd(_mm_loadl_epi64((const __m128i *)p));
+}
+
+MLC_TARGET_SSE2 static inline __m128d col_sse2_load_uint8_t(const uint8_t *p) {
+    return _mm_set_pd(p[1], p[0]);
+}
+
+MLC_TARGET_SSE2 static inline __m128d col_sse2_acc_sum(
+    const __m128d acc,
+    const __m128d v,
+    const __m128d c
+) {
+    (void)c;
+    return _mm_add_pd(acc, v);
+}
+
+MLC_TARGET_SSE2 static inline __m128d col_sse2_acc_abs(
+    const __m128d acc,
+    const __m128d v,
+    const __m128d c
+) {
+    (void)c;
+    return _mm_add_pd(acc, _mm_andnot_pd(_mm_set1_pd(-0.0), v));
+}
+
+MLC_TARGET_SSE2 static inline __m128d col_sse2_acc_sq(
+    const __m128d acc,
+    const __m128d v,
+    const __m128d c
+) {
+    const __m128d d = _mm_sub_pd(v, c);
+    return _mm_add_pd(acc, _mm_mul_pd(d, d));
+}
+
+MLC_TARGET_SSE2 static inline double col_sse2_hsum(const __m128d v) {
+    return _mm_cvtsd_f64(_mm_add_sd(v, _mm_unpackhi_pd(v, v)));
+}
+
+MLC_TARGET_SSE2 static inline double col_sse2_hmin(const __m128d v) {
+    return _mm_cvtsd_f64(_mm_min_sd(v, _mm_unpackhi_pd(v, v)));
+}
+
+MLC_TARGET_SSE2 static inline double col_sse2_hmax(const __m128d v) {
+    return _mm_cvtsd_f64(_mm_max_sd(v, _mm_unpackhi_pd(v, v)));
+}
+
+#define col_sse2_set1 _mm_set1_pd
+#define col_sse2_add _mm_add_pd
+#define col_sse2_min _mm_min_pd
+#define col_sse2_max _mm_max_pd
+
+/* AVX2: 4 lanes */
+
+MLC_TARGET_AVX2 static inline __m256d col_avx2_load_double(const double *p) {
+    return _mm256_loadu_pd(p);
+}
+
+MLC_TARGET_AVX2 static inline __m256d col_avx2_load_float(const float *p) {
+    return _mm256_cvtps_pd(_mm_loadu_ps(p));
+}
+
+MLC_TARGET_AVX2 static inline __m256d col_avx2_load_int32_t(const int32_t *p) {
+    return _mm256_cvtepi32_pd(_mm_loadu_si128((const __m128i *)p));
+}
+
+MLC_TARGET_AVX2 static inline __m256d col_avx2_load_uint8_t(const uint8_t *p) {
+    int32_t bytes;
+    memcpy(&bytes, p, sizeof(bytes));
+    return _mm256_cvtepi32_pd(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(bytes)));
+}
+
+MLC_TARGET_AVX2 static inline __m256d col_avx2_acc_sum(
+    const __m256d acc,
+    const __m256d v,
+    const __m256d c
+) {
+    (void)c;
+    return _mm256_add_pd(acc, v);
+}
+
+MLC_TARGET_AVX2 static inline __m256d col_avx2_acc_abs(
+    const __m256d acc,
+    const __m256d v,
+    const __m256d c
+) {
+    (void)c;
+    return _mm256_add_pd(acc, _mm256_andnot_pd(_mm256_set1_pd(-0.0), v));
+}
+
+MLC_TARGET_AVX2 static inline __m256d col_avx2_acc_sq(
+    const __m256d acc,
+    const __m256d v,
+    const __m256d c
+) {
+    const __m256d d = _mm256_sub_pd(v, c);
+    return _mm256_fmadd_pd(d, d, acc);
+}
+
+MLC_TARGET_AVX2 static inline double col_avx2_hsum(const __m256d v) {
+    return col_sse2_hsum(
+        _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1))
+    );
+}
+
+MLC_TARGET_AVX2 static inline double col_avx2_hmin(const __m256d v) {
+    return col_sse2_hmin(
+        _mm_min_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1))
+    );
+}
+
+MLC_TARGET_AVX2 static inline double col_avx2_hmax(const __m256d v) {
+    return col_sse2_hmax(
+        _mm_max_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1))
+    );
+}
+
+#define col_avx2_set1 _mm256_set1_pd
+#define col_avx2_add _mm256_add_pd
+#define col_avx2_min _mm256_min_pd
+#define col_avx2_max _mm256_max_pd
+
+/* AVX-512: 8 lanes */
+
+MLC_TARGET_AVX512 static inline __m512d col_avx512_load_double(
+    const double *p
+) {
+    return _mm512_loadu_pd(p);
+}
+
+MLC_TARGET_AVX512 static inline __m512d col_avx512_load_float(const float *p) {
+    return _mm512_cvtps_pd(_mm256_loadu_ps(p));
+}
+
+MLC_TARGET_AVX512 static inline __m512d col_avx512_load_int32_t(
+    const int32_t *p
+) {
+    return _mm512_cvtepi32_pd(_mm256_loadu_si256((const __m256i *)p));
+}
+
+MLC_TARGET_AVX512 static inline __m512d col_avx512_load_uint8_t(
+    const uint8_t *p
+) {
+    return _mm512_cvtepi32_pd(
+        _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)p))
+    );
+}
+
+MLC_TARGET_AVX512 static inline __m512d col_avx512_acc_sum(
+    const __m512d acc,
+    const __m512d v,
+    const __m512d c
+) {
+    (void)c;
+    return _mm512_add_pd(acc, v);
+}
+
+MLC_TARGET_AVX512 static inline __m512d col_avx512_acc_abs(
+    const __m512d acc,
+    const __m512d v,
+    const __m512d c
+) {
+    (void)c;
+    return _mm512_add_pd(acc, _mm512_abs_pd(v));
+}
+
+MLC_TARGET_AVX512 static inline __m512d col_avx512_acc_sq(
+    const __m512d acc,
+    const __m512d v,
+    const __m512d c
+) {
+    const __m512d d = _mm512_sub_pd(v, c);
+    return _mm512_fmadd_pd(d, d, acc);
+}
+
+MLC_TARGET_AVX512 static inline double col_avx512_hsum(const __m512d v) {
+    return col_avx2_hsum(
+        _mm256_add_pd(_mm512_castpd512_pd256(v), _mm512_extractf64x4_pd(v, 1))
+    );
+}
+
+MLC_TARGET_AVX512 static inline double col_avx512_hmin(const __m512d v) {
+    return col_avx2_hmin(
+        _mm256_min_pd(_mm512_castpd512_pd256(v), _mm512_extractf64x4_pd(v, 1))
+    );
+}
+
+MLC_TARGET_AVX512 static inline double col_avx512_hmax(const __m512d v) {
+    return col_avx2_hmax(
+        _mm256_max_pd(_mm512_castpd512_pd256(v), _mm512_extractf64x4_pd(v, 1))
+    );
+}
+
+#define col_avx512_set1 _mm512_set1_pd
+#define col_avx512_add _mm512_add_pd
+#define col_avx512_min _mm512_min_pd
+#define col_avx512_max _mm512_max_pd
+
+/* Four vector accumulators hide the add latency; the scalar tail reuses the
+ * scalar accumulate helper. */
+#define COL_REDUCE_SIMD(isa, TARGET, VEC, W, T, mode)                       \
+    TARGET static double col_reduce_##isa##_##T##_##mode(                   \
+        const void *data,                                                   \
+        const size_t n,                                                     \
+        const double center                                                 \
+    ) {                                                                     \
+        const T *x = data;                                                  \
+        const VEC c = col_##isa##_set1(center);                             \
+        VEC a0 = col_##isa##_set1(0.0), a1 = a0, a2 = a0, a3 = a0;          \
+        size_t i = 0;                                                       \
+        for (; i + 4 * (W) <= n; i += 4 * (W)) {                            \
+            a0 = col_##isa##_acc_##mode(a0, col_##isa##_load_##T(x + i), c);\
+            a1 = col_##isa##_acc_##mode(                                    \
+                a1, col_##isa##_load_##T(x + i + (W)), c);                  \
+            a2 = col_##isa##_acc_##mode(                                    \
+                a2, col_##isa##_load_##T(x + i + 2 * (W)), c);              \
+            a3 = col_##isa##_acc_##mode(                                    \
+                a3, col_##isa##_load_##T(x + i + 3 * (W)), c);              \
+        }                                                                   \
+        for (; i + (W) <= n; i += (W))                                      \
+            a0 = col_##isa##_acc_##mode(a0, col_##isa##_load_##T(x + i), c);\
+        double acc = col_##isa##_hsum(                                      \
+            col_##isa##_add(col_##isa##_add(a0, a1), col_##isa##_add(a2, a3))\
+        );                                                                  \
+        for (; i < n; i++)                                                  \
+            acc = col_scalar_acc_##mode(acc, (double)x[i], center);         \
+        return acc;                                                         \
+    }
+
+/* `min(v, acc)` returns `acc` when `v` is NaN, so NaNs are skipped the same
+ * way as in the scalar kernel. */
+#define COL_MINMAX_SIMD(isa, TARGET, VEC, W, T)                             \
+    TARGET static void col_minmax_##isa##_##T(                              \
+        const void *data,                                                   \
+        const size_t n,                                                     \
+        double *min_out,                                                    \
+        double *max_out                                                     \
+    ) {                                                                     \
+        const T *x = data;                                                  \
+        VEC mn0 = col_##isa##_set1(INFINITY), mn1 = mn0;                    \
+        VEC mx0 = col_##isa##_set1(-INFINITY), mx1 = mx0;                   \
+        size_t i = 0;                                                       \
+        for (; i + 2 * (W) <= n; i += 2 * (W)) {                            \
+            const VEC v0 = col_##isa##_load_##T(x + i);                     \
+            const VEC v1 = col_##isa##_load_##T(x + i + (W));               \
+            mn0 = col_##isa##_min(v0, mn0);                                 \
+            mn1 = col_##isa##_min(v1, mn1);                                 \
+            mx0 = col_##isa##_max(v0, mx0);                                 \
+            mx1 = col_##isa##_max(v1, mx1);                                 \
+        }                                                                   \
+        for (; i + (W) <= n; i += (W)) {                                    \
+            const VEC v = col_##isa##_load_##T(x + i);                      \
+            mn0 = col_##isa##_min(v, mn0);                                  \
+            mx0 = col_##isa##_max(v, mx0);                                  \
+        }                                                                   \
+        double mn = col_##isa##_hmin(col_##isa##_min(mn0, mn1));            \
+        double mx = col_##isa##_hmax(col_##isa##_max(mx0, mx1));            \
+        for (; i < n; i++) {                                                \
+            const double v = (double)x[i];                                  \
+            mn = v < mn ? v : mn;                                           \
+            mx = v > mx ? v : mx;                                           \
+        }                                                                   \
+        *min_out = mn;                                                      \
+        *max_out = mx;                                                      \
+    }
+
+#define COL_REDUCE_SIMD_ALL(isa, TARGET, VEC, W, T)                         \
+    COL_REDUCE_SIMD(isa, TARGET, VEC, W, T, sum)                            \
+    COL_REDUCE_SIMD(isa, TARGET, VEC, W, T, abs)                            \
+    COL_REDUCE_SIMD(isa, TARGET, VEC, W, T, sq)                             \
+    COL_MINMAX_SIMD(isa, TARGET, VEC, W, T)
+
+#define COL_REDUCE_SIMD_TYPES(isa, TARGET, VEC, W)                          \
+    COL_REDUCE_SIMD_ALL(isa, TARGET, VEC, W, double)                        \
+    COL_REDUCE_SIMD_ALL(isa, TARGET, VEC, W, float)                         \
+    COL_REDUCE_SIMD_ALL(isa, TARGET, VEC, W, int32_t)                       \
+    COL_REDUCE_SIMD_ALL(isa, TARGET, VEC, W, uint8_t)
+
+COL_REDUCE_SIMD_TYPES(sse2, MLC_TARGET_SSE2, __m128d, 2)
+COL_REDUCE_SIMD_TYPES(avx2, MLC_TARGET_AVX2, __m256d, 4)
+COL_REDUCE_SIMD_TYPES(avx512, MLC_TARGET_AVX512, __m512d, 8)
+
+#endif
+
+/* dispatch tables, indexed by [isa][dtype][mode] and [isa][dtype] */
+
+#define COL_REDUCE_MODES_OF(isa, T) {                                       \
+    [COL_REDUCE_SUM] = col_reduce_##isa##_##T##_sum,                        \
+    [COL_REDUCE_ABS] = col_reduce_##isa##_##T##_abs,                        \
+    [COL_REDUCE_SQ] = col_reduce_##isa##_##T##_sq                           \
+}
+
+#define COL_REDUCE_ROW(isa) {                                               \
+    [COL_DTYPE_DOUBLE] = COL_REDUCE_MODES_OF(isa, double),                  \
+    [COL_DTYPE_FLOAT] = COL_REDUCE_MODES_OF(isa, float),                    \
+    [COL_DTYPE_INT64] = COL_REDUCE_MODES_OF(scalar, int64_t),               \
+    [COL_DTYPE_INT32] = COL_REDUCE_MODES_OF(isa, int32_t),                  \
+    [COL_DTYPE_UINT8] = COL_REDUCE_MODES_OF(isa, uint8_t)                   \
+}
+
+#define COL_MINMAX_ROW(isa) {                                               \
+    [COL_DTYPE_DOUBLE] = col_minmax_##isa##_double,                         \
+    [COL_DTYPE_FLOAT] = col_minmax_##isa##_float,                           \
+    [COL_DTYPE_INT64] = col_minmax_scalar_int64_t,                          \
+    [COL_DTYPE_INT32] = col_minmax_##isa##_int32_t,                         \
+    [COL_DTYPE_UINT8] = col_minmax_##isa##_uint8_t                          \
+}
+
+static const col_reduce_fn
+col_reduce_kernels[MLC_ISA_COUNT][COL_DTYPE_UINT8 + 1][COL_REDUCE_MODES] = {
+    [MLC_ISA_SCALAR] = COL_REDUCE_ROW(scalar),
+#ifdef MLC_SIMD_X86
+    [MLC_ISA_SSE2] = COL_REDUCE_ROW(sse2),
+    [MLC_ISA_AVX2] = COL_REDUCE_ROW(avx2),
+    [MLC_ISA_AVX512] = COL_REDUCE_ROW(avx512)
+#endif
+};
+
+static const col_minmax_fn
+col_minmax_kernels[MLC_ISA_COUNT][COL_DTYPE_UINT8 + 1] = {
+    [MLC_ISA_SCALAR] = COL_MINMAX_ROW(scalar),
+#ifdef MLC_SIMD_X86
+    [MLC_ISA_SSE2] = COL_MINMAX_ROW(sse2),
+    [MLC_ISA_AVX2] = COL_MINMAX_ROW(avx2),
+    [MLC_ISA_AVX512] = COL_MINMAX_ROW(avx512)
+#endif
+};
+
+/* drivers */
+
+static inline double col_value_double(const col_t *col, const size_t idx) {
+    switch (col->dtype) {
+        case COL_DTYPE_DOUBLE:
+            return ((const double *)col->data)[idx];
+        case COL_DTYPE_FLOAT:
+            return ((const float *)col->data)[idx];
+        case COL_DTYPE_INT64:
+            return (double)((const int64_t *)col->data)[idx];
+        case COL_DTYPE_INT32:
+            return ((const int32_t *)col->data)[idx];
+        default:
+            return ((const uint8_t *)col->data)[idx];
+    }
+}
+
+/* Neumaier's variant of Kahan summation, also exact when |x| > |sum| */
+static inline void col_kahan_add(double *sum, double *comp, const double x) {
+    const double t = *sum + x;
+    if (fabs(*sum) >= fabs(x))
+        *comp += (*sum - t) + x;
+    else
+        *comp += (x - t) + *sum;
+    *sum = t;
+}
+
+static int col_reduce_validate(const col_t *col) {
+    if (!col)
+        return COL_ERR_NO_DATA;
+    if (!col_dtype_is_numeric(col->dtype))
+        return COL_ERR_INVALID_DTYPE;
+    return COL_ERR_OK;
+}
+
+/* Blocks without nulls go to the SIMD kernel, the rest to a masked loop */
+static double col_reduce_run(
+    const col_t *col,
+    const col_reduce_mode_t mode,
+    const double center,
+    size_t *count_out
+) {
+    const col_reduce_fn kernel = col_reduce_kernels[mlc_cpu_isa()][col->dtype][mode];
+    const char *data = col->data;
+    double sum = 0.0, comp = 0.0;
+    size_t count = 0;
+
+    for (size_t b = 0; b < col->n_rows; b += COL_REDUCE_BLOCK) {
+        const size_t len = col->n_rows - b < COL_REDUCE_BLOCK
+            ? col->n_rows - b
+            : COL_REDUCE_BLOCK;
+
+        double partial = 0.0;
+        if (!col_validity_count(col, b, len)) {
+            partial = kernel(data + b * col->stride, len, center);
+            count += len;
+        } else {
+            for (size_t i = b; i < b + len; i++) {
+                if (!col_bit_get(col->validity, i))
+                    continue;
+                partial = col_scalar_acc(
+                    mode, partial, col_value_double(col, i), center
+                );
+                count++;
+            }
+        }
+        col_kahan_add(&sum, &comp, partial);
+    }
+
+    if (count_out)
+        *count_out = count;
+    return sum + comp;
+}
+
+static size_t col_minmax_run(const col_t *col, double *min_out, double *max_out) {
+    const col_minmax_fn kernel = col_minmax_kernels[mlc_cpu_isa()][col->dtype];
+    const char *data = col->data;
+    double mn = INFINITY, mx = -INFINITY;
+    size_t count = 0;
+
+    for (size_t b = 0; b < col->n_rows; b += COL_REDUCE_BLOCK) {
+        const size_t len = col->n_rows - b < COL_REDUCE_BLOCK
+            ? col->n_rows - b
+            : COL_REDUCE_BLOCK;
+
+        double block_min = INFINITY, block_max = -INFINITY;
+        if (!col_validity_count(col, b, len)) {
+            kernel(data + b * col->stride, len, &block_min, &block_max);
+            count += len;
+        } else {
+            for (size_t i = b; i < b + len; i++) {
+                if (!col_bit_get(col->validity, i))
+                    continue;
+                const double v = col_value_double(col, i);
+                block_min = v < block_min ? v : block_min;
+                block_max = v > block_max ? v : block_max;
+                count++;
+            }
+        }
+        mn = block_min < mn ? block_min : mn;
+        mx = block_max > mx ? block_max : mx;
+    }
+
+    /* min > max only when every value was NaN */
+    if (count && mn > mx)
+        mn = mx = NAN;
+
+    *min_out = mn;
+    *max_out = mx;
+    return count;
+}
+
+/* First non-null index holding `target`, or the first non-null index */
+static size_t col_find_first(const col_t *col, const double target) {
+    size_t first_valid = SIZE_MAX;
+    for (size_t i = 0; i < col->n_rows; i++) {
+        if (col->null_count && !col_bit_get(col->validity, i))
+            continue;
+        if (first_valid == SIZE_MAX)
+            first_valid = i;
+        if (col_value_double(col, i) == target)
+            return i;
+    }
+    return first_valid;
+}
+
+/* First non-null index of the smallest or largest `int64` value. Values
+ * compare exactly, as doubles round those beyond 2^53 together. */
+static size_t col_find_extreme_int64(const col_t *col, const int largest) {
+    const int64_t *vals = col->data;
+    size_t best = SIZE_MAX;
+    for (size_t i = 0; i < col->n_rows; i++) {
+        if (col->null_count && !col_bit_get(col->validity, i))
+            continue;
+        if (best == SIZE_MAX
+            || (largest ? vals[i] > vals[best] : vals[i] < vals[best]))
+            best = i;
+    }
+    return best;
+}
+
+double col_sum(const col_t *col, int *err_out) {
+    /* args */
+    const int err = col_reduce_validate(col);
+    if (err)
+        return mlc_fail_nan(err, err_out);
+
+    const double sum = col_reduce_run(col, COL_REDUCE_SUM, 0.0, NULL);
+
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    return sum;
+}
+
+double col_mean(const col_t *col, int *err_out) {
+    /* args */
+    const int err = col_reduce_validate(col);
+    if (err)
+        return mlc_fail_nan(err, err_out);
+
+    size_t count;
+    const double sum = col_reduce_run(col, COL_REDUCE_SUM, 0.0, &count);
+    if (!count)
+        return mlc_fail_nan(COL_ERR_NO_DATA, err_out);
+
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    return sum / (double)count;
+}
+
+double col_var(const col_t *col, const size_t ddof, int *err_out) {
+    /* args */
+    const int err = col_reduce_validate(col);
+    if (err)
+        return mlc_fail_nan(err, err_out);
+
+    size_t count;
+    const double sum = col_reduce_run(col, COL_REDUCE_SUM, 0.0, &count);
+    if (count <= ddof)
+        return mlc_fail_nan(COL_ERR_NO_DATA, err_out);
+
+    const double mean = sum / (double)count;
+    const double sq = col_reduce_run(col, COL_REDUCE_SQ, mean, NULL);
+
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    return sq / (double)(count - ddof);
+}
+
+double col_min(const col_t *col, int *err_out) {
+    /* args */
+    const int err = col_reduce_validate(col);
+    if (err)
+        return mlc_fail_nan(err, err_out);
+
+    double mn, mx;
+    if (!col_minmax_run(col, &mn, &mx))
+        return mlc_fail_nan(COL_ERR_NO_DATA, err_out);
+
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    return mn;
+}
+
+double col_max(const col_t *col, int *err_out) {
+    /* args */
+    const int err = col_reduce_validate(col);
+    if (err)
+        return mlc_fail_nan(err, err_out);
+
+    double mn, mx;
+    if (!col_minmax_run(col, &mn, &mx))
+        return mlc_fail_nan(COL_ERR_NO_DATA, err_out);
+
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    return mx;
+}
+
+size_t col_argmin(const col_t *col, int *err_out) {
+    /* args */
+    const int err = col_reduce_validate(col);
+    if (err)
+        return mlc_fail_npos(err, err_out);
+
+    double mn, mx;
+    if (!col_minmax_run(col, &mn, &mx))
+        return mlc_fail_npos(COL_ERR_NO_DATA, err_out);
+
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    if (col->dtype == COL_DTYPE_INT64)
+        return col_find_extreme_int64(col, 0);
+    return col_find_first(col, mn);
+}
+
+size_t col_argmax(const col_t *col, int *err_out) {
+    /* args */
+    const int err = col_reduce_validate(col);
+    if (err)
+        return mlc_fail_npos(err, err_out);
+
+    double mn, mx;
+    if (!col_minmax_run(col, &mn, &mx))
+        return mlc_fail_npos(COL_ERR_NO_DATA, err_out);
+
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    if (col->dtype == COL_DTYPE_INT64)
+        return col_find_extreme_int64(col, 1);
+    return col_find_first(col, mx);
+}
+
+double col_norm_l1(const col_t *col, int *err_out) {
+    /* args */
+    const int err = col_reduce_validate(col);
+    if (err)
+        return mlc_fail_nan(err, err_out);
+
+    const double sum = col_reduce_run(col, COL_REDUCE_ABS, 0.0, NULL);
+
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    return sum;
+}
+
+double col_norm_l2(const col_t *col, int *err_out) {
+    /* args */
+    const int err = col_reduce_validate(col);
+    if (err)
+        return mlc_fail_nan(err, err_out);
+
+    const double sq = col_reduce_run(col, COL_REDUCE_SQ, 0.0, NULL);
+
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    return sqrt(sq);
+}
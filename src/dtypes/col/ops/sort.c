@@ -0,0 +1,913 @@
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/error.h"
+#include "core/thread.h"
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/buffer.h"
+#include "dtypes/col/core/internal.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/col/core/validity.h"
+#include "dtypes/col/ops/sort.h"
+
+/* Fewest rows a chunk of a parallel sort holds. Smaller columns are sorted
+ * on the calling thread alone. */
+#define COL_SORT_CHUNK_ROWS ((size_t)1 << 16)
+
+/* Keys of a run this long, with their scratch, fit in the L2 cache */
+#define COL_SORT_CACHE_ROWS ((size_t)1 << 15)
+
+/* Runs of tied string prefixes this short, or tied this deep into their
+ * strings, are merge sorted by comparison instead of radix sorted */
+#define COL_SORT_COMPARE_ROWS 16
+#define COL_SORT_MAX_DEPTH 64
+
+/* NaN sorts after every number in either direction */
+#define COL_SORT_NAN_KEY UINT64_MAX
+
+/* State shared by the tasks of one sort */
+typedef struct col_sort_ctx {
+    const col_t *col;           /* column to key */
+    const uint32_t *ranks;      /* rank of every category code, or NULL */
+    const int64_t *rows;        /* rows to sort, or NULL for every row */
+    int descending;
+    size_t n;                   /* number of rows to sort */
+    uint64_t *keys;
+    uint64_t *keys_tmp;
+    int64_t *idx;               /* row of every key, or NULL */
+    int64_t *idx_tmp;
+    int keys_owned;             /* whether `keys` was allocated here */
+    size_t *bounds;             /* `n_chunks + 1` chunk boundaries */
+    size_t n_chunks;
+    size_t n_threads;
+    /* merge rounds */
+    size_t step;                /* chunks per merged run */
+    const uint64_t *src_keys;
+    uint64_t *dst_keys;
+    const int64_t *src_idx;
+    int64_t *dst_idx;
+} col_sort_ctx_t;
+
+/* keys */
+
+/* Keys are unsigned integers ordering as the values do. Floats flip every
+ * bit of negative values and the sign bit of positive ones. Descending
+ * sorts complement the keys, which keeps equal rows in input order. */
+
+static inline uint64_t col_sort_key_double(const double x, const int desc) {
+    if (isnan(x))
+        return COL_SORT_NAN_KEY;
+    uint64_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+    bits ^= (bits >> 63) ? UINT64_MAX : (uint64_t)1 << 63;
+    return desc ? ~bits : bits;
+}
+
+static inline uint64_t col_sort_key_float(const float x, const int desc) {
+    if (isnan(x))
+        return COL_SORT_NAN_KEY;
+    uint32_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+    bits ^= (bits >> 31) ? UINT32_MAX : (uint32_t)1 << 31;
+    return desc ? ~(uint64_t)bits : bits;
+}
+
+static inline uint64_t col_sort_key_int64(const int64_t x, const int desc) {
+    const uint64_t bits = (uint64_t)x ^ (uint64_t)1 << 63;
+    return desc ? ~bits : bits;
+}
+
+static inline uint64_t col_sort_key_int32(const int32_t x, const int desc) {
+    const uint64_t bits = (uint32_t)x ^ (uint32_t)1 << 31;
+    return desc ? ~bits : bits;
+}
+
+/* Also keys the ranks of categories */
+static inline uint64_t col_sort_key_unsigned(const uint64_t x, const int desc) {
+    return desc ? ~x : x;
+}
+
+/* The first 8 bytes of `str`, big-endian and zero padded, so keys order as
+ * the strings do */
+static inline uint64_t col_sort_key_prefix(const char *str, const int desc) {
+    uint64_t key = 0;
+    for (size_t b = 0; b < 8 && str[b]; b++)
+        key |= (uint64_t)(unsigned char)str[b] << (56 - 8 * b);
+    return desc ? ~key : key;
+}
+
+static inline double col_sort_value_double(uint64_t key, const int desc) {
+    if (key == COL_SORT_NAN_KEY)
+        return NAN;
+    if (desc)
+        key = ~key;
+    key ^= (key >> 63) ? (uint64_t)1 << 63 : UINT64_MAX;
+    double x;
+    memcpy(&x, &key, sizeof(x));
+    return x;
+}
+
+static inline float col_sort_value_float(const uint64_t key, const int desc) {
+    if (key == COL_SORT_NAN_KEY)
+        return NAN;
+    uint32_t bits = (uint32_t)(desc ? ~key : key);
+    bits ^= (bits >> 31) ? (uint32_t)1 << 31 : UINT32_MAX;
+    float x;
+    memcpy(&x, &bits, sizeof(x));
+    return x;
+}
+
+/* Keys rows `[start, end)` of the rows to sort */
+static void col_sort_extract(
+    const col_sort_ctx_t *ctx,
+    const size_t start,
+    const size_t end
+) {
+    const col_t *col = ctx->col;
+    const int64_t *rows = ctx->rows;
+    const int desc = ctx->descending;
+    uint64_t *keys = ctx->keys;
+
+    #define COL_SORT_EXTRACT(KEY_OF)                                        \
+        for (size_t i = start; i < end; i++) {                              \
+            const size_t row = rows ? (size_t)rows[i] : i;                  \
+            keys[i] = KEY_OF;                                               \
+        }
+
+    switch (col->dtype) {
+        case COL_DTYPE_DOUBLE: {
+            const double *data = col->data;
+            COL_SORT_EXTRACT(col_sort_key_double(data[row], desc))
+            break;
+        }
+        case COL_DTYPE_FLOAT: {
+            const float *data = col->data;
+            COL_SORT_EXTRACT(col_sort_key_float(data[row], desc))
+            break;
+        }
+        case COL_DTYPE_INT64: {
+            const int64_t *data = col->data;
+            COL_SORT_EXTRACT(col_sort_key_int64(data[row], desc))
+            break;
+        }
+        case COL_DTYPE_INT32: {
+            const int32_t *data = col->data;
+            COL_SORT_EXTRACT(col_sort_key_int32(data[row], desc))
+            break;
+        }
+        case COL_DTYPE_UINT8: {
+            const uint8_t *data = col->data;
+            COL_SORT_EXTRACT(col_sort_key_unsigned(data[row], desc))
+            break;
+        }
+        case COL_DTYPE_STRING: {
+            const size_t *offsets = col->data;
+            const char *bytes = col->strbuf.bytes;
+            COL_SORT_EXTRACT(col_sort_key_prefix(bytes + offsets[row], desc))
+            break;
+        }
+        default: {
+            const uint32_t *ranks = ctx->ranks;
+            COL_SORT_EXTRACT(col_sort_key_unsigned(
+                ranks[col_code_read(col->data, col->stride, row)],
+                desc
+            ))
+            break;
+        }
+    }
+
+    #undef COL_SORT_EXTRACT
+
+    if (ctx->idx)
+        for (size_t i = start; i < end; i++)
+            ctx->idx[i] = rows ? rows[i] : (int64_t)i;
+}
+
+/* Writes keys `[start, end)` back as values of a numeric column */
+static void col_sort_decode(
+    const col_sort_ctx_t *ctx,
+    const size_t start,
+    const size_t end
+) {
+    const uint64_t *keys = ctx->keys;
+    const int desc = ctx->descending;
+    void *data = ctx->col->data;
+
+    switch (ctx->col->dtype) {
+        case COL_DTYPE_DOUBLE:
+            for (size_t i = start; i < end; i++)
+                ((double *)data)[i] = col_sort_value_double(keys[i], desc);
+            break;
+        case COL_DTYPE_FLOAT:
+            for (size_t i = start; i < end; i++)
+                ((float *)data)[i] = col_sort_value_float(keys[i], desc);
+            break;
+        case COL_DTYPE_INT64:
+            for (size_t i = start; i < end; i++)
+                ((int64_t *)data)[i] = (int64_t)((desc ? ~keys[i] : keys[i])
+                    ^ (uint64_t)1 << 63);
+            break;
+        case COL_DTYPE_INT32:
+            for (size_t i = start; i < end; i++)
+                ((int32_t *)data)[i] = (int32_t)(uint32_t)((desc ? ~keys[i] : keys[i])
+                    ^ (uint32_t)1 << 31);
+            break;
+        default:
+            for (size_t i = start; i < end; i++)
+                ((uint8_t *)data)[i] = (uint8_t)(desc ? ~keys[i] : keys[i]);
+            break;
+    }
+}
+
+/* radix sort */
+
+/* Sorts `keys[0, n)`, and `idx` along if not NULL, on their lowest
+ * `digits` 8-bit digits, leaving the result in `keys_tmp` if `to_tmp` is
+ * set and in `keys` otherwise. Digits every key shares are skipped, so
+ * narrow or clustered keys take few passes.
+ *
+ * Runs too large for the caches are first split on their most significant
+ * differing digit, and every bucket sorted on the digits below it. Each
+ * LSD pass then scatters into a bucket that stays in cache. */
+static void col_sort_radix_digits(
+    uint64_t *keys,
+    uint64_t *keys_tmp,
+    int64_t *idx,
+    int64_t *idx_tmp,
+    const size_t n,
+    const size_t digits,
+    const int to_tmp
+) {
+    uint64_t *src = keys, *dst = keys_tmp;
+    int64_t *src_idx = idx, *dst_idx = idx_tmp;
+    size_t top = n < 2 ? 0 : digits;
+
+    size_t counts[8][256] = {{0}};
+    for (size_t i = 0; i < n && top; i++) {
+        const uint64_t key = keys[i];
+        for (size_t d = 0; d < top; d++)
+            counts[d][(key >> (8 * d)) & 0xFF]++;
+    }
+    while (top > 0 && counts[top - 1][(keys[0] >> (8 * (top - 1))) & 0xFF] == n)
+        top--;
+
+    if (n > COL_SORT_CACHE_ROWS && top > 1) {
+        const unsigned shift = (unsigned)(8 * (top - 1));
+        size_t starts[257];
+        size_t pos[256];
+        size_t sum = 0;
+        for (size_t b = 0; b < 256; b++) {
+            starts[b] = pos[b] = sum;
+            sum += counts[top - 1][b];
+        }
+        starts[256] = n;
+
+        for (size_t i = 0; i < n; i++) {
+            const size_t p = pos[(keys[i] >> shift) & 0xFF]++;
+            keys_tmp[p] = keys[i];
+            if (idx)
+                idx_tmp[p] = idx[i];
+        }
+
+        /* the buckets now sit in `keys_tmp`, which they sort away from */
+        for (size_t b = 0; b < 256; b++)
+            col_sort_radix_digits(
+                keys_tmp + starts[b],
+                keys + starts[b],
+                idx ? idx_tmp + starts[b] : NULL,
+                idx ? idx + starts[b] : NULL,
+                starts[b + 1] - starts[b],
+                top - 1,
+                !to_tmp
+            );
+        return;
+    }
+
+    for (size_t d = 0; d < top; d++) {
+        const unsigned shift = (unsigned)(8 * d);
+        size_t *count = counts[d];
+        if (count[(src[0] >> shift) & 0xFF] == n)
+            continue;
+
+        size_t sum = 0;
+        for (size_t b = 0; b < 256; b++) {
+            const size_t c = count[b];
+            count[b] = sum;
+            sum += c;
+        }
+
+        if (src_idx) {
+            for (size_t i = 0; i < n; i++) {
+                const size_t pos = count[(src[i] >> shift) & 0xFF]++;
+                dst[pos] = src[i];
+                dst_idx[pos] = src_idx[i];
+            }
+            int64_t *tmp_idx = src_idx;
+            src_idx = dst_idx;
+            dst_idx = tmp_idx;
+        } else {
+            for (size_t i = 0; i < n; i++)
+                dst[count[(src[i] >> shift) & 0xFF]++] = src[i];
+        }
+
+        uint64_t *tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+
+    uint64_t *out = to_tmp ? keys_tmp : keys;
+    if (src != out && n) {
+        memcpy(out, src, n * sizeof(uint64_t));
+        if (idx)
+            memcpy(to_tmp ? idx_tmp : idx, src_idx, n * sizeof(int64_t));
+    }
+}
+
+/* Sorts `keys[0, n)`, and `idx` along if not NULL, in place */
+static void col_sort_radix(
+    uint64_t *keys,
+    uint64_t *keys_tmp,
+    int64_t *idx,
+    int64_t *idx_tmp,
+    const size_t n
+) {
+    col_sort_radix_digits(keys, keys_tmp, idx, idx_tmp, n, 8, 0);
+}
+
+/* merge */
+
+/* Number of rows of `a` among the first `d` rows of the stable merge of
+ * `a` and `b`, ties going to `a` */
+static size_t col_sort_corank(
+    const uint64_t *a,
+    const size_t n_a,
+    const uint64_t *b,
+    const size_t n_b,
+    const size_t d
+) {
+    size_t lo = d > n_b ? d - n_b : 0;
+    size_t hi = d < n_a ? d : n_a;
+    while (lo < hi) {
+        const size_t mid = lo + (hi - lo) / 2;
+        if (a[mid] <= b[d - mid - 1])
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+/* Each task writes the rows of its own chunk of the output, merging the
+ * slices of the two runs that land there */
+static void col_sort_merge_run(void *arg, size_t task) {
+    const col_sort_ctx_t *ctx = arg;
+    const size_t *bounds = ctx->bounds;
+    const size_t half = ctx->step / 2;
+    const size_t first = task / ctx->step * ctx->step;
+    const size_t mid = first + half < ctx->n_chunks ? first + half : ctx->n_chunks;
+    const size_t last = first + ctx->step < ctx->n_chunks
+        ? first + ctx->step
+        : ctx->n_chunks;
+
+    const size_t base = bounds[first];
+    const uint64_t *a = ctx->src_keys + base;
+    const uint64_t *b = ctx->src_keys + bounds[mid];
+    const size_t n_a = bounds[mid] - base;
+    const size_t n_b = bounds[last] - bounds[mid];
+
+    const size_t d_start = bounds[task] - base;
+    const size_t d_end = bounds[task + 1] - base;
+    size_t i = col_sort_corank(a, n_a, b, n_b, d_start);
+    const size_t i_end = col_sort_corank(a, n_a, b, n_b, d_end);
+    size_t j = d_start - i;
+    const size_t j_end = d_end - i_end;
+
+    const int64_t *a_idx = ctx->src_idx ? ctx->src_idx + base : NULL;
+    const int64_t *b_idx = ctx->src_idx ? ctx->src_idx + bounds[mid] : NULL;
+    uint64_t *out = ctx->dst_keys + bounds[task];
+    int64_t *out_idx = ctx->dst_idx ? ctx->dst_idx + bounds[task] : NULL;
+
+    size_t k = 0;
+    while (i < i_end && j < j_end) {
+        if (b[j] < a[i]) {
+            if (out_idx)
+                out_idx[k] = b_idx[j];
+            out[k++] = b[j++];
+        } else {
+            if (out_idx)
+                out_idx[k] = a_idx[i];
+            out[k++] = a[i++];
+        }
+    }
+    for (; i < i_end; i++) {
+        if (out_idx)
+            out_idx[k] = a_idx[i];
+        out[k++] = a[i];
+    }
+    for (; j < j_end; j++) {
+        if (out_idx)
+            out_idx[k] = b_idx[j];
+        out[k++] = b[j];
+    }
+}
+
+/* strings */
+
+static inline int col_sort_strcmp(
+    const col_sort_ctx_t *ctx,
+    const int64_t a,
+    const int64_t b,
+    const size_t depth
+) {
+    const size_t *offsets = ctx->col->data;
+    const char *bytes = ctx->col->strbuf.bytes;
+    const int cmp = strcmp(
+        bytes + offsets[a] + depth,
+        bytes + offsets[b] + depth
+    );
+    return ctx->descending ? -cmp : cmp;
+}
+
+/* Bottom-up merge sort of the rows `idx[0, n)` by their strings past
+ * `depth` bytes */
+static void col_sort_strings_merge(
+    const col_sort_ctx_t *ctx,
+    int64_t *idx,
+    int64_t *idx_tmp,
+    const size_t n,
+    const size_t depth
+) {
+    int64_t *src = idx, *dst = idx_tmp;
+    for (size_t width = 1; width < n; width *= 2) {
+        for (size_t lo = 0; lo < n; lo += 2 * width) {
+            const size_t mid = lo + width < n ? lo + width : n;
+            const size_t hi = lo + 2 * width < n ? lo + 2 * width : n;
+            size_t i = lo, j = mid, k = lo;
+            while (i < mid && j < hi)
+                dst[k++] = col_sort_strcmp(ctx, src[j], src[i], depth) < 0
+                    ? src[j++]
+                    : src[i++];
+            while (i < mid)
+                dst[k++] = src[i++];
+            while (j < hi)
+                dst[k++] = src[j++];
+        }
+        int64_t *tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+    if (src != idx)
+        memcpy(idx, src, n * sizeof(int64_t));
+}
+
+static void col_sort_strings(
+    const col_sort_ctx_t *ctx,
+    uint64_t *keys,
+    uint64_t *keys_tmp,
+    int64_t *idx,
+    int64_t *idx_tmp,
+    const size_t n,
+    const size_t depth
+);
+
+/* Sorts the runs of `idx[0, n)` whose keys, the prefixes at `depth`, tie
+ * while their strings go on past them */
+static void col_sort_refine(
+    const col_sort_ctx_t *ctx,
+    uint64_t *keys,
+    uint64_t *keys_tmp,
+    int64_t *idx,
+    int64_t *idx_tmp,
+    const size_t n,
+    const size_t depth
+) {
+    size_t start = 0;
+    while (start < n) {
+        size_t end = start + 1;
+        while (end < n && keys[end] == keys[start])
+            end++;
+
+        /* a zero last byte means the strings ended within the prefix */
+        const uint64_t prefix = ctx->descending ? ~keys[start] : keys[start];
+        if (end - start > 1 && (prefix & 0xFF))
+            col_sort_strings(
+                ctx,
+                keys + start,
+                keys_tmp + start,
+                idx + start,
+                idx_tmp + start,
+                end - start,
+                depth + 8
+            );
+        start = end;
+    }
+}
+
+/* Sorts the rows `idx[0, n)`, whose strings tie on their first `depth`
+ * bytes, by the 8 bytes after, then refines the ties again */
+static void col_sort_strings(
+    const col_sort_ctx_t *ctx,
+    uint64_t *keys,
+    uint64_t *keys_tmp,
+    int64_t *idx,
+    int64_t *idx_tmp,
+    const size_t n,
+    const size_t depth
+) {
+    if (n <= COL_SORT_COMPARE_ROWS || depth >= COL_SORT_MAX_DEPTH) {
+        col_sort_strings_merge(ctx, idx, idx_tmp, n, depth);
+        return;
+    }
+
+    const size_t *offsets = ctx->col->data;
+    const char *bytes = ctx->col->strbuf.bytes;
+    for (size_t i = 0; i < n; i++)
+        keys[i] = col_sort_key_prefix(
+            bytes + offsets[idx[i]] + depth,
+            ctx->descending
+        );
+
+    col_sort_radix(keys, keys_tmp, idx, idx_tmp, n);
+    col_sort_refine(ctx, keys, keys_tmp, idx, idx_tmp, n, depth);
+}
+
+/* tasks */
+
+static void col_sort_chunk_run(void *arg, size_t task) {
+    const col_sort_ctx_t *ctx = arg;
+    const size_t start = ctx->bounds[task];
+    const size_t end = ctx->bounds[task + 1];
+
+    col_sort_extract(ctx, start, end);
+    col_sort_radix(
+        ctx->keys + start,
+        ctx->keys_tmp + start,
+        ctx->idx ? ctx->idx + start : NULL,
+        ctx->idx ? ctx->idx_tmp + start : NULL,
+        end - start
+    );
+}
+
+static void col_sort_copy_run(void *arg, size_t task) {
+    const col_sort_ctx_t *ctx = arg;
+    const size_t start = ctx->bounds[task];
+    const size_t n = ctx->bounds[task + 1] - start;
+
+    memcpy(ctx->keys + start, ctx->src_keys + start, n * sizeof(uint64_t));
+    if (ctx->idx)
+        memcpy(ctx->idx + start, ctx->src_idx + start, n * sizeof(int64_t));
+}
+
+static void col_sort_refine_run(void *arg, size_t task) {
+    const col_sort_ctx_t *ctx = arg;
+    const size_t start = ctx->bounds[task];
+
+    col_sort_refine(
+        ctx,
+        ctx->keys + start,
+        ctx->keys_tmp + start,
+        ctx->idx + start,
+        ctx->idx_tmp + start,
+        ctx->bounds[task + 1] - start,
+        0
+    );
+}
+
+static void col_sort_decode_run(void *arg, size_t task) {
+    const col_sort_ctx_t *ctx = arg;
+    col_sort_decode(ctx, ctx->bounds[task], ctx->bounds[task + 1]);
+}
+
+/* drivers */
+
+static void col_sort_release(col_sort_ctx_t *ctx) {
+    if (ctx->keys_owned)
+        free(ctx->keys);
+    free(ctx->keys_tmp);
+    free(ctx->idx_tmp);
+    free(ctx->bounds);
+}
+
+/* Sizes the chunks and allocates the scratch arrays of a sort of `n` rows.
+ * `keys` may hold the rows themselves, or be NULL to allocate them. */
+static int col_sort_prepare(
+    col_sort_ctx_t *ctx,
+    const col_t *col,
+    const uint32_t *ranks,
+    const int64_t *rows,
+    const size_t n,
+    const col_sort_options_t *options,
+    uint64_t *keys,
+    int64_t *idx
+) {
+    const size_t n_threads = options->n_threads
+        ? options->n_threads
+        : mlc_thread_count();
+    size_t n_chunks = n / COL_SORT_CHUNK_ROWS;
+    if (n_chunks > n_threads)
+        n_chunks = n_threads;
+    if (!n_chunks)
+        n_chunks = 1;
+
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->col = col;
+    ctx->ranks = ranks;
+    ctx->rows = rows;
+    ctx->descending = options->descending;
+    ctx->n = n;
+    ctx->idx = idx;
+    ctx->n_chunks = n_chunks;
+    ctx->n_threads = n_threads;
+
+    /* malloc */
+    ctx->keys_owned = !keys;
+    ctx->keys = keys ? keys : malloc((n + 1) * sizeof(uint64_t));
+    ctx->keys_tmp = malloc((n + 1) * sizeof(uint64_t));
+    ctx->idx_tmp = idx ? malloc((n + 1) * sizeof(int64_t)) : NULL;
+    ctx->bounds = malloc((n_chunks + 1) * sizeof(size_t));
+    if (!ctx->keys || !ctx->keys_tmp || (idx && !ctx->idx_tmp) || !ctx->bounds) {
+        col_sort_release(ctx);
+        return COL_ERR_OOM;
+    }
+
+    /* assign */
+    const size_t rows_per_chunk = n / n_chunks;
+    const size_t extra = n % n_chunks;
+    for (size_t t = 0; t <= n_chunks; t++)
+        ctx->bounds[t] = t * rows_per_chunk + (t < extra ? t : extra);
+
+    return COL_ERR_OK;
+}
+
+/* Sorts every chunk, merges the chunks pairwise until one run is left,
+ * then refines the ties of string prefixes */
+static void col_sort_execute(col_sort_ctx_t *ctx) {
+    const size_t n_chunks = ctx->n_chunks;
+    mlc_parallel_for(n_chunks, ctx->n_threads, col_sort_chunk_run, ctx);
+
+    ctx->src_keys = ctx->keys;
+    ctx->dst_keys = ctx->keys_tmp;
+    ctx->src_idx = ctx->idx;
+    ctx->dst_idx = ctx->idx_tmp;
+    for (ctx->step = 2; ctx->step / 2 < n_chunks; ctx->step *= 2) {
+        mlc_parallel_for(n_chunks, ctx->n_threads, col_sort_merge_run, ctx);
+
+        uint64_t *keys = (uint64_t *)ctx->src_keys;
+        ctx->src_keys = ctx->dst_keys;
+        ctx->dst_keys = keys;
+        int64_t *idx = (int64_t *)ctx->src_idx;
+        ctx->src_idx = ctx->dst_idx;
+        ctx->dst_idx = idx;
+    }
+    if (ctx->src_keys != ctx->keys)
+        mlc_parallel_for(n_chunks, ctx->n_threads, col_sort_copy_run, ctx);
+
+    if (ctx->col->dtype != COL_DTYPE_STRING)
+        return;
+
+    /* move the chunk boundaries past the ties, so no run spans two tasks */
+    for (size_t t = 1; t < n_chunks; t++) {
+        size_t b = ctx->bounds[t] > ctx->bounds[t - 1]
+            ? ctx->bounds[t]
+            : ctx->bounds[t - 1];
+        while (b > 0 && b < ctx->n && ctx->keys[b] == ctx->keys[b - 1])
+            b++;
+        ctx->bounds[t] = b;
+    }
+    mlc_parallel_for(n_chunks, ctx->n_threads, col_sort_refine_run, ctx);
+}
+
+/* Ranks the categories of a `category` column by their strings */
+static uint32_t *col_sort_ranks(const col_t *col, int *err_out) {
+    const col_t *values = col->dict->values;
+    const size_t n = values->n_rows;
+    col_sort_options_t options = col_sort_options_default();
+    options.n_threads = 1;
+
+    /* malloc */
+    int64_t *order = malloc((n + 1) * sizeof(int64_t));
+    uint32_t *ranks = malloc((n + 1) * sizeof(uint32_t));
+    col_sort_ctx_t ctx;
+    if (!order || !ranks
+        || col_sort_prepare(&ctx, values, NULL, NULL, n, &options, NULL, order)) {
+        free(order);
+        free(ranks);
+        return mlc_fail_null(COL_ERR_OOM, err_out);
+    }
+
+    /* assign */
+    col_sort_execute(&ctx);
+    col_sort_release(&ctx);
+    for (size_t r = 0; r < n; r++)
+        ranks[order[r]] = (uint32_t)r;
+
+    free(order);
+    return ranks;
+}
+
+/* Writes the rows of `col` in sorted order to `out`, null rows in input
+ * order at the end or the start */
+static int col_sort_index(
+    const col_t *col,
+    const col_sort_options_t *options,
+    int64_t *out
+) {
+    const size_t n = col->n_rows;
+    const size_t n_null = col->null_count;
+    const size_t n_valid = n - n_null;
+    int64_t *sorted = out + (options->nulls_first ? n_null : 0);
+    int64_t *nulls = out + (options->nulls_first ? 0 : n_valid);
+
+    /* malloc */
+    int err_code = COL_ERR_OK;
+    int64_t *rows = NULL;
+    uint32_t *ranks = NULL;
+    col_sort_ctx_t ctx;
+
+    if (n_null) {
+        rows = malloc((n_valid + 1) * sizeof(int64_t));
+        if (!rows)
+            return COL_ERR_OOM;
+    }
+    if (col->dtype == COL_DTYPE_CATEGORY) {
+        ranks = col_sort_ranks(col, &err_code);
+        if (!ranks)
+            goto cleanup;
+    }
+    err_code = col_sort_prepare(
+        &ctx,
+        col,
+        ranks,
+        rows,
+        n_valid,
+        options,
+        NULL,
+        sorted
+    );
+    if (err_code)
+        goto cleanup;
+
+    /* assign */
+    if (n_null) {
+        size_t n_rows = 0, n_nulls = 0;
+        for (size_t i = 0; i < n; i++) {
+            if (col_bit_get(col->validity, i))
+                rows[n_rows++] = (int64_t)i;
+            else
+                nulls[n_nulls++] = (int64_t)i;
+        }
+    }
+
+    col_sort_execute(&ctx);
+    col_sort_release(&ctx);
+
+cleanup:
+    free(ranks);
+    free(rows);
+    return err_code;
+}
+
+/* Sorts a numeric column without nulls through its keys alone, keying
+ * 8-byte values in place */
+static int col_sort_values(col_t *col, const col_sort_options_t *options) {
+    col_sort_ctx_t ctx;
+    uint64_t *keys = col->stride == sizeof(uint64_t) ? col->data : NULL;
+    if (col_sort_prepare(&ctx, col, NULL, NULL, col->n_rows, options, keys, NULL))
+        return COL_ERR_OOM;
+
+    col_sort_execute(&ctx);
+    mlc_parallel_for(ctx.n_chunks, ctx.n_threads, col_sort_decode_run, &ctx);
+    col_sort_release(&ctx);
+
+    return COL_ERR_OK;
+}
+
+/* Writes row `order[i]` of `src` to row `i` of `dst` */
+static void col_sort_permute(
+    void *dst,
+    const void *src,
+    const int64_t *order,
+    const size_t n,
+    const size_t stride
+) {
+    #define COL_SORT_PERMUTE(T)                                             \
+        for (size_t i = 0; i < n; i++)                                      \
+            ((T *)dst)[i] = ((const T *)src)[order[i]];
+
+    switch (stride) {
+        case sizeof(uint8_t):
+            COL_SORT_PERMUTE(uint8_t)
+            break;
+        case sizeof(uint16_t):
+            COL_SORT_PERMUTE(uint16_t)
+            break;
+        case sizeof(uint32_t):
+            COL_SORT_PERMUTE(uint32_t)
+            break;
+        default:
+            COL_SORT_PERMUTE(uint64_t)
+            break;
+    }
+
+    #undef COL_SORT_PERMUTE
+}
+
+col_sort_options_t col_sort_options_default(void) {
+    col_sort_options_t options = {
+        .descending = 0,
+        .nulls_first = 0,
+        .n_threads = 0
+    };
+    return options;
+}
+
+int col_sort(col_t *col, const col_sort_options_t *options) {
+    /* args */
+    if (!col)
+        return COL_ERR_NO_DATA;
+
+    const col_sort_options_t opts = options
+        ? *options
+        : col_sort_options_default();
+    const size_t n = col->n_rows;
+    if (n < 2)
+        return COL_ERR_OK;
+
+    if (col_data_detach(col))
+        return COL_ERR_OOM;
+
+    if (col_dtype_is_numeric(col->dtype) && !col->null_count)
+        return col_sort_values(col, &opts);
+
+    /* malloc */
+    int64_t *order = malloc(n * sizeof(int64_t));
+    void *tmp = malloc(n * col->stride);
+    int err_code = COL_ERR_OOM;
+    if (!order || !tmp)
+        goto cleanup;
+
+    err_code = col_sort_index(col, &opts, order);
+    if (err_code)
+        goto cleanup;
+
+    /* assign: rows move whole, strings by their offsets */
+    memcpy(tmp, col->data, n * col->stride);
+    col_sort_permute(col->data, tmp, order, n, col->stride);
+
+    if (col->null_count) {
+        const size_t n_null = col->null_count;
+        const size_t n_valid = n - n_null;
+        if (opts.nulls_first) {
+            col_validity_fill(col, 0, n_null, 0);
+            col_validity_fill(col, n_null, n_valid, 1);
+        } else {
+            col_validity_fill(col, 0, n_valid, 1);
+            col_validity_fill(col, n_valid, n_null, 0);
+        }
+    }
+
+cleanup:
+    free(tmp);
+    free(order);
+    return err_code;
+}
+
+col_t *col_argsort(
+    const col_t *col,
+    const col_sort_options_t *options,
+    int *err_out
+) {
+    /* args */
+    if (!col)
+        return mlc_fail_null(COL_ERR_NO_DATA, err_out);
+
+    const col_sort_options_t opts = options
+        ? *options
+        : col_sort_options_default();
+
+    /* init */
+    int err_code = COL_ERR_OK;
+    col_t *new_col = col_create_with_allocator(
+        col->name,
+        col->n_rows,
+        COL_DTYPE_INT64,
+        &col->allocator,
+        &err_code
+    );
+    if (!new_col)
+        return mlc_fail_null(err_code, err_out);
+
+    /* assign */
+    err_code = col_sort_index(col, &opts, new_col->data);
+    if (err_code) {
+        col_free(new_col);
+        return mlc_fail_null(err_code, err_out);
+    }
+    new_col->n_rows = col->n_rows;
+
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    return new_col;
+}
@@ -0,0 +1,27 @@
+#include <stdint.h>
+
+#include "core/error.h"
+#include "dtypes/df/core/type.h"
+#include "dtypes/df/core/accessors.h"
+#include "dtypes/df/core/index.h"
+
+size_t df_col_index(const df_t *df, const char *name, int *err_out) {
+    /* args */
+    if (!df || !name)
+        return mlc_fail_npos(COL_ERR_NO_DATA, err_out);
+
+    const uint32_t slot = df->slots[df_index_probe(df, name)];
+    if (!slot)
+        return mlc_fail_npos(COL_ERR_NOT_FOUND, err_out);
+
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    return slot - 1;
+}
+
+col_t *df_col(const df_t *df, const char *name, int *err_out) {
+    const size_t idx = df_col_index(df, name, err_out);
+    if (idx == SIZE_MAX)
+        return NULL;
+    return df->cols[idx];
+}
@@ -0,0 +1,47 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/hash.h"
+#include "dtypes/df/core/type.h"
+#include "dtypes/df/core/index.h"
+
+#define DF_INDEX_MIN_SLOTS 16
+
+size_t df_index_probe(const df_t *df, const char *name) {
+    const size_t mask = df->n_slots - 1;
+    size_t i = mlc_hash_str(name) & mask;
+
+    while (df->slots[i]) {
+        if (strcmp(df->cols[df->slots[i] - 1]->name, name) == 0)
+            break;
+        i = (i + 1) & mask;
+    }
+
+    return i;
+}
+
+int df_index_rebuild(df_t *df) {
+    size_t n_slots = DF_INDEX_MIN_SLOTS;
+    while (n_slots < 2 * df->n_cols)
+        n_slots *= 2;
+
+    /* alloc, unless the current slots are large enough */
+    if (df->n_slots < n_slots) {
+        uint32_t *slots = calloc(n_slots, sizeof(uint32_t));
+        if (!slots)
+            return COL_ERR_OOM;
+
+        free(df->slots);
+        df->slots = slots;
+        df->n_slots = n_slots;
+    } else {
+        memset(df->slots, 0, df->n_slots * sizeof(uint32_t));
+    }
+
+    /* assign */
+    for (size_t j = 0; j < df->n_cols; j++)
+        df->slots[df_index_probe(df, df->cols[j]->name)] = (uint32_t)(j + 1);
+
+    return COL_ERR_OK;
+}
@@ -0,0 +1,181 @@
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "core/error.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/df/core/type.h"
+#include "dtypes/df/core/accessors.h"
+#include "dtypes/df/core/index.h"
+#include "dtypes/df/core/lifecycle.h"
+#include "dtypes/df/core/modifiers.h"
+
+df_t *df_create(int *err_out) {
+    /* alloc */
+    df_t *df = calloc(1, sizeof(df_t));
+    if (!df)
+        return mlc_fail_null(COL_ERR_OOM, err_out);
+
+    /* init */
+    if (df_index_rebuild(df)) {
+        free(df);
+        return mlc_fail_null(COL_ERR_OOM, err_out);
+    }
+
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    return df;
+}
+
+/* Frees the frame, leaving its columns to the caller */
+static void df_release(df_t *df) {
+    free(df->cols);
+    free(df->slots);
+    free(df);
+}
+
+df_t *df_from_cols(col_t *const *cols, const size_t n_cols, int *err_out) {
+    /* args */
+    if (!cols && n_cols)
+        return mlc_fail_null(COL_ERR_NO_DATA, err_out);
+
+    /* alloc */
+    int err_code;
+    df_t *df = df_create(&err_code);
+    if (!df)
+        return mlc_fail_null(err_code, err_out);
+
+    /* assign */
+    for (size_t j = 0; j < n_cols; j++) {
+        err_code = df_add_col(df, cols[j]);
+        if (err_code) {
+            df_release(df);
+            return mlc_fail_null(err_code, err_out);
+        }
+    }
+
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    return df;
+}
+
+void df_free(df_t *df) {
+    if (!df)
+        return;
+
+    for (size_t j = 0; j < df->n_cols; j++)
+        col_free(df->cols[j]);
+    df_release(df);
+}
+
+/* Creates a frame from `n` new columns, freeing them on error */
+static df_t *df_from_new_cols(col_t **cols, const size_t n, int *err_out) {
+    df_t *df = df_from_cols(cols, n, err_out);
+    if (!df) {
+        for (size_t j = 0; j < n; j++)
+            col_free(cols[j]);
+    }
+    free(cols);
+    return df;
+}
+
+df_t *df_clone(const df_t *df, int *err_out) {
+    /* args */
+    if (!df)
+        return mlc_fail_null(COL_ERR_NO_DATA, err_out);
+
+    /* alloc */
+    col_t **cols = calloc(df->n_cols + 1, sizeof(col_t *));
+    if (!cols)
+        return mlc_fail_null(COL_ERR_OOM, err_out);
+
+    /* assign */
+    int err_code = COL_ERR_OK;
+    size_t n = 0;
+    for (; n < df->n_cols; n++) {
+        cols[n] = col_clone(df->cols[n], &err_code);
+        if (!cols[n])
+            break;
+    }
+
+    if (n < df->n_cols) {
+        for (size_t j = 0; j < n; j++)
+            col_free(cols[j]);
+        free(cols);
+        return mlc_fail_null(err_code, err_out);
+    }
+
+    return df_from_new_cols(cols, n, err_out);
+}
+
+df_t *df_select(
+    const df_t *df,
+    const char *const *names,
+    const size_t n_names,
+    int *err_out
+) {
+    /* args */
+    if (!df || (!names && n_names))
+        return mlc_fail_null(COL_ERR_NO_DATA, err_out);
+
+    /* alloc */
+    col_t **cols = calloc(n_names + 1, sizeof(col_t *));
+    if (!cols)
+        return mlc_fail_null(COL_ERR_OOM, err_out);
+
+    /* assign */
+    int err_code = COL_ERR_OK;
+    size_t n = 0;
+    for (; n < n_names; n++) {
+        const col_t *col = df_col(df, names[n], &err_code);
+        if (!col)
+            break;
+        cols[n] = col_clone(col, &err_code);
+        if (!cols[n])
+            break;
+    }
+
+    if (err_code) {
+        for (size_t j = 0; j < n; j++)
+            col_free(cols[j]);
+        free(cols);
+        return mlc_fail_null(err_code, err_out);
+    }
+
+    return df_from_new_cols(cols, n, err_out);
+}
+
+df_t *df_slice(
+    const df_t *df,
+    const size_t start,
+    const size_t len,
+    int *err_out
+) {
+    /* args */
+    if (!df)
+        return mlc_fail_null(COL_ERR_NO_DATA, err_out);
+    if (start > df->n_rows || len > df->n_rows - start)
+        return mlc_fail_null(COL_ERR_OUT_OF_BOUNDS, err_out);
+
+    /* alloc */
+    col_t **cols = calloc(df->n_cols + 1, sizeof(col_t *));
+    if (!cols)
+        return mlc_fail_null(COL_ERR_OOM, err_out);
+
+    /* assign */
+    int err_code = COL_ERR_OK;
+    size_t n = 0;
+    for (; n < df->n_cols; n++) {
+        cols[n] = col_slice(df->cols[n], start, len, &err_code);
+        if (!cols[n])
+            break;
+    }
+
+    if (n < df->n_cols) {
+        for (size_t j = 0; j < n; j++)
+            col_free(cols[j]);
+        free(cols);
+        return mlc_fail_null(err_code, err_out);
+    }
+
+    return df_from_new_cols(cols, n, err_out);
+}
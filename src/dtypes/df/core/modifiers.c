@@ -0,0 +1,100 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/error.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/col/core/modifiers.h"
+#include "dtypes/df/core/type.h"
+#include "dtypes/df/core/accessors.h"
+#include "dtypes/df/core/index.h"
+#include "dtypes/df/core/modifiers.h"
+
+int df_add_col(df_t *df, col_t *col) {
+    /* args */
+    if (!df || !col)
+        return COL_ERR_NO_DATA;
+    if (df->n_cols && col->n_rows != df->n_rows)
+        return COL_ERR_INVALID_ARG;
+    if (df->slots[df_index_probe(df, col->name)])
+        return COL_ERR_INVALID_ARG;
+    if (df->n_cols >= UINT32_MAX)
+        return COL_ERR_OUT_OF_BOUNDS;
+
+    /* alloc */
+    if (df->n_cols == df->capacity) {
+        const size_t capacity = df->capacity ? df->capacity * 2 : 8;
+        col_t **cols = realloc(df->cols, capacity * sizeof(col_t *));
+        if (!cols)
+            return COL_ERR_OOM;
+        df->cols = cols;
+        df->capacity = capacity;
+    }
+
+    /* assign */
+    df->cols[df->n_cols++] = col;
+    if (2 * df->n_cols > df->n_slots) {
+        if (df_index_rebuild(df)) {
+            df->n_cols--;
+            return COL_ERR_OOM;
+        }
+    } else {
+        df->slots[df_index_probe(df, col->name)] = (uint32_t)df->n_cols;
+    }
+    df->n_rows = col->n_rows;
+
+    return COL_ERR_OK;
+}
+
+col_t *df_take_col(df_t *df, const char *name, int *err_out) {
+    /* args */
+    const size_t idx = df_col_index(df, name, err_out);
+    if (idx == SIZE_MAX)
+        return NULL;
+
+    /* assign */
+    col_t *col = df->cols[idx];
+    memmove(
+        df->cols + idx,
+        df->cols + idx + 1,
+        (df->n_cols - idx - 1) * sizeof(col_t *)
+    );
+    df->n_cols--;
+    if (!df->n_cols)
+        df->n_rows = 0;
+
+    /* never grows, so never fails */
+    df_index_rebuild(df);
+
+    return col;
+}
+
+int df_drop_col(df_t *df, const char *name) {
+    int err_code;
+    col_t *col = df_take_col(df, name, &err_code);
+    if (!col)
+        return err_code;
+
+    col_free(col);
+    return COL_ERR_OK;
+}
+
+int df_rename_col(df_t *df, const char *name, const char *new_name) {
+    /* args */
+    int err_code;
+    const size_t idx = df_col_index(df, name, &err_code);
+    if (idx == SIZE_MAX)
+        return err_code;
+    if (!new_name || !strlen(new_name))
+        return COL_ERR_EMPTY_NAME;
+    if (df->slots[df_index_probe(df, new_name)])
+        return strcmp(name, new_name) ? COL_ERR_INVALID_ARG : COL_ERR_OK;
+
+    /* assign */
+    err_code = col_rename(df->cols[idx], new_name);
+    if (err_code)
+        return err_code;
+
+    df_index_rebuild(df);
+    return COL_ERR_OK;
+}
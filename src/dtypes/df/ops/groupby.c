@@ -0,0 +1,704 @@
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/error.h"
+#include "core/thread.h"
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/internal.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/col/core/validity.h"
+#include "dtypes/col/ops/gather.h"
+#include "dtypes/col/ops/sort.h"
+#include "dtypes/df/core/type.h"
+#include "dtypes/df/core/accessors.h"
+#include "dtypes/df/core/lifecycle.h"
+#include "dtypes/df/ops/groupby.h"
+#include "dtypes/df/ops/keys.h"
+
+/* Fewest rows a chunk of a parallel group-by holds. Smaller frames are
+ * grouped on the calling thread alone. */
+#define DF_GROUPBY_CHUNK_ROWS ((size_t)1 << 16)
+
+/* Partitions per thread, so uneven partitions still balance */
+#define DF_GROUPBY_PARTS_PER_THREAD 4
+#define DF_GROUPBY_MAX_PART_BITS 8
+
+/* Slots of a new partition table, kept at most half full */
+#define DF_GROUPBY_MIN_SLOTS 64
+
+#define DF_GROUPBY_TAG_MASK 0xFFFFFFFF00000000ULL
+
+/* Running aggregate of one group */
+typedef struct df_groupby_state {
+    double acc;                 /* sum, min or max */
+    int64_t count;              /* number of values folded */
+} df_groupby_state_t;
+
+/* Groups of one partition */
+typedef struct df_groupby_part {
+    size_t start;               /* first entry of `rows` in the partition */
+    size_t end;
+    uint64_t *slots;            /* hash tag | (group + 1), 0 if empty */
+    size_t n_slots;             /* number of slots, a power of two */
+    int64_t *first;             /* first row of every group */
+    df_groupby_state_t *states; /* `n_aggs` states per group */
+    size_t n_groups;
+    size_t capacity;            /* groups allocated in `first` and `states` */
+    size_t offset;              /* index of the first group in the result */
+    int err;
+} df_groupby_part_t;
+
+/* State shared by the tasks of one group-by */
+typedef struct df_groupby_ctx {
+    const col_t **keys;
+    size_t n_keys;
+    const col_t **values;       /* value column of every aggregation */
+    const df_agg_t *aggs;
+    size_t n_aggs;
+    size_t n;                   /* number of rows */
+    uint64_t *hashes;           /* hash of every row */
+    size_t *rows;               /* rows by partition, NULL for one partition */
+    uint32_t *groups;           /* group of every entry, within its partition */
+    size_t *bounds;             /* `n_chunks + 1` chunk boundaries */
+    size_t n_chunks;
+    size_t *counts;             /* rows of every chunk in every partition */
+    df_groupby_part_t *parts;
+    size_t n_parts;
+    unsigned part_shift;        /* shift of a hash to its partition */
+    size_t n_threads;
+    /* merge */
+    int64_t *first;             /* first row of every group */
+    df_groupby_state_t *states; /* `n_aggs` states per group */
+} df_groupby_ctx_t;
+
+/* partition tables */
+
+/* Doubles the slots of a partition, reinserting every group by the hash of
+ * its first row */
+static int df_groupby_rehash(
+    const df_groupby_ctx_t *ctx,
+    df_groupby_part_t *part
+) {
+    const size_t n_slots = part->n_slots ? part->n_slots * 2 : DF_GROUPBY_MIN_SLOTS;
+    uint64_t *slots = calloc(n_slots, sizeof(uint64_t));
+    if (!slots)
+        return COL_ERR_OOM;
+
+    const size_t mask = n_slots - 1;
+    for (size_t g = 0; g < part->n_groups; g++) {
+        const uint64_t h = ctx->hashes[part->first[g]];
+        size_t s = (size_t)h & mask;
+        while (slots[s])
+            s = (s + 1) & mask;
+        slots[s] = (h & DF_GROUPBY_TAG_MASK) | (g + 1);
+    }
+
+    free(part->slots);
+    part->slots = slots;
+    part->n_slots = n_slots;
+    return COL_ERR_OK;
+}
+
+/* Makes room for one more group */
+static int df_groupby_reserve(
+    const df_groupby_ctx_t *ctx,
+    df_groupby_part_t *part
+) {
+    if (part->n_groups >= UINT32_MAX - 1)
+        return COL_ERR_OUT_OF_BOUNDS;
+    if (2 * (part->n_groups + 1) > part->n_slots && df_groupby_rehash(ctx, part))
+        return COL_ERR_OOM;
+    if (part->n_groups < part->capacity)
+        return COL_ERR_OK;
+
+    const size_t capacity = part->capacity ? part->capacity * 2 : DF_GROUPBY_MIN_SLOTS / 2;
+    int64_t *first = realloc(part->first, capacity * sizeof(int64_t));
+    if (!first)
+        return COL_ERR_OOM;
+    part->first = first;
+
+    df_groupby_state_t *states = realloc(
+        part->states,
+        (capacity * ctx->n_aggs + 1) * sizeof(df_groupby_state_t)
+    );
+    if (!states)
+        return COL_ERR_OOM;
+    part->states = states;
+    part->capacity = capacity;
+
+    return COL_ERR_OK;
+}
+
+/* Assigns every row of a partition its group, creating groups in the order
+ * their first rows appear */
+static int df_groupby_build(
+    const df_groupby_ctx_t *ctx,
+    df_groupby_part_t *part
+) {
+    for (size_t i = part->start; i < part->end; i++) {
+        const size_t row = ctx->rows ? ctx->rows[i] : i;
+        const uint64_t h = ctx->hashes[row];
+        const uint64_t tag = h & DF_GROUPBY_TAG_MASK;
+
+        if (2 * (part->n_groups + 1) > part->n_slots) {
+            const int err_code = df_groupby_reserve(ctx, part);
+            if (err_code)
+                return err_code;
+        }
+
+        const size_t mask = part->n_slots - 1;
+        size_t s = (size_t)h & mask;
+        for (;;) {
+            const uint64_t slot = part->slots[s];
+            if (!slot)
+                break;
+            if ((slot & DF_GROUPBY_TAG_MASK) == tag) {
+                const size_t g = (size_t)(uint32_t)slot - 1;
+                if (df_keys_equal(ctx->keys, (size_t)part->first[g], ctx->keys, row, ctx->n_keys)) {
+                    ctx->groups[i] = (uint32_t)g;
+                    goto next;
+                }
+            }
+            s = (s + 1) & mask;
+        }
+
+        /* new group */
+        {
+            const int err_code = df_groupby_reserve(ctx, part);
+            if (err_code)
+                return err_code;
+
+            const size_t g = part->n_groups++;
+            part->slots[s] = tag | (g + 1);
+            part->first[g] = (int64_t)row;
+            df_groupby_state_t *states = part->states + g * ctx->n_aggs;
+            for (size_t a = 0; a < ctx->n_aggs; a++) {
+                const df_agg_op_t op = ctx->aggs[a].op;
+                states[a].acc = op == DF_AGG_MIN || op == DF_AGG_MAX ? NAN : 0;
+                states[a].count = 0;
+            }
+            ctx->groups[i] = (uint32_t)g;
+        }
+next:;
+    }
+
+    return COL_ERR_OK;
+}
+
+/* Folds the values of aggregation `a` into the groups of a partition */
+static void df_groupby_fold(
+    const df_groupby_ctx_t *ctx,
+    df_groupby_part_t *part,
+    const size_t a
+) {
+    const col_t *col = ctx->values[a];
+    const size_t *rows = ctx->rows;
+    const uint32_t *groups = ctx->groups;
+    const size_t n_aggs = ctx->n_aggs;
+    df_groupby_state_t *states = part->states + a;
+
+    if (!col) {
+        for (size_t i = part->start; i < part->end; i++)
+            states[(size_t)groups[i] * n_aggs].count++;
+        return;
+    }
+
+    const uint8_t *validity = col->null_count ? col->validity : NULL;
+    if (ctx->aggs[a].op == DF_AGG_COUNT) {
+        for (size_t i = part->start; i < part->end; i++) {
+            const size_t row = rows ? rows[i] : i;
+            if (!validity || col_bit_get(validity, row))
+                states[(size_t)groups[i] * n_aggs].count++;
+        }
+        return;
+    }
+
+    #define DF_GROUPBY_FOLD(T, UPDATE)                                      \
+        {                                                                   \
+            const T *vals = col->data;                                      \
+            for (size_t i = part->start; i < part->end; i++) {              \
+                const size_t row = rows ? rows[i] : i;                      \
+                if (validity && !col_bit_get(validity, row))                \
+                    continue;                                               \
+                df_groupby_state_t *s = &states[(size_t)groups[i] * n_aggs];\
+                const double v = (double)vals[row];                         \
+                s->count++;                                                 \
+                UPDATE;                                                     \
+            }                                                               \
+        }                                                                   \
+        break;
+
+    #define DF_GROUPBY_FOLD_DTYPES(UPDATE)                                  \
+        switch (col->dtype) {                                               \
+            case COL_DTYPE_DOUBLE:                                          \
+                DF_GROUPBY_FOLD(double, UPDATE)                             \
+            case COL_DTYPE_FLOAT:                                           \
+                DF_GROUPBY_FOLD(float, UPDATE)                              \
+            case COL_DTYPE_INT64:                                           \
+                DF_GROUPBY_FOLD(int64_t, UPDATE)                            \
+            case COL_DTYPE_INT32:                                           \
+                DF_GROUPBY_FOLD(int32_t, UPDATE)                            \
+            case COL_DTYPE_UINT8:                                           \
+                DF_GROUPBY_FOLD(uint8_t, UPDATE)                            \
+            default:                                                        \
+                break;                                                      \
+        }
+
+    /* `acc` starts as NaN for min and max, and NaN values never replace
+     * a number */
+    switch (ctx->aggs[a].op) {
+        case DF_AGG_MIN:
+            DF_GROUPBY_FOLD_DTYPES(if (v < s->acc || isnan(s->acc)) s->acc = v)
+            break;
+        case DF_AGG_MAX:
+            DF_GROUPBY_FOLD_DTYPES(if (v > s->acc || isnan(s->acc)) s->acc = v)
+            break;
+        default:
+            DF_GROUPBY_FOLD_DTYPES(s->acc += v)
+            break;
+    }
+
+    #undef DF_GROUPBY_FOLD_DTYPES
+    #undef DF_GROUPBY_FOLD
+}
+
+/* tasks */
+
+/* Hashes the keys of a chunk, then counts its rows in every partition */
+static void df_groupby_hash_run(void *arg, size_t task) {
+    df_groupby_ctx_t *ctx = arg;
+    const size_t start = ctx->bounds[task];
+    const size_t end = ctx->bounds[task + 1];
+    df_keys_hash(ctx->keys, ctx->n_keys, start, end - start, ctx->hashes + start);
+
+    if (ctx->n_parts == 1)
+        return;
+
+    size_t *counts = ctx->counts + task * ctx->n_parts;
+    for (size_t i = start; i < end; i++)
+        counts[ctx->hashes[i] >> ctx->part_shift]++;
+}
+
+/* Writes the rows of a chunk to their partitions, in row order */
+static void df_groupby_scatter_run(void *arg, size_t task) {
+    df_groupby_ctx_t *ctx = arg;
+    size_t *pos = ctx->counts + task * ctx->n_parts;
+    for (size_t i = ctx->bounds[task]; i < ctx->bounds[task + 1]; i++)
+        ctx->rows[pos[ctx->hashes[i] >> ctx->part_shift]++] = i;
+}
+
+static void df_groupby_part_run(void *arg, size_t task) {
+    df_groupby_ctx_t *ctx = arg;
+    df_groupby_part_t *part = &ctx->parts[task];
+
+    part->err = df_groupby_build(ctx, part);
+    if (part->err)
+        return;
+    for (size_t a = 0; a < ctx->n_aggs; a++)
+        df_groupby_fold(ctx, part, a);
+}
+
+/* Copies the groups of a partition to their place in the result */
+static void df_groupby_merge_run(void *arg, size_t task) {
+    df_groupby_ctx_t *ctx = arg;
+    const df_groupby_part_t *part = &ctx->parts[task];
+    if (!part->n_groups)
+        return;
+
+    memcpy(
+        ctx->first + part->offset,
+        part->first,
+        part->n_groups * sizeof(int64_t)
+    );
+    memcpy(
+        ctx->states + part->offset * ctx->n_aggs,
+        part->states,
+        part->n_groups * ctx->n_aggs * sizeof(df_groupby_state_t)
+    );
+}
+
+/* drivers */
+
+static void df_groupby_release(df_groupby_ctx_t *ctx) {
+    if (ctx->parts) {
+        for (size_t p = 0; p < ctx->n_parts; p++) {
+            free(ctx->parts[p].slots);
+            free(ctx->parts[p].first);
+            free(ctx->parts[p].states);
+        }
+    }
+    free(ctx->parts);
+    free(ctx->keys);
+    free(ctx->values);
+    free(ctx->hashes);
+    free(ctx->rows);
+    free(ctx->groups);
+    free(ctx->bounds);
+    free(ctx->counts);
+    free(ctx->first);
+    free(ctx->states);
+}
+
+/* Looks up the key and value columns and sizes the chunks and partitions */
+static int df_groupby_prepare(
+    df_groupby_ctx_t *ctx,
+    const df_t *df,
+    const char *const *keys,
+    const size_t n_keys,
+    const df_agg_t *aggs,
+    const size_t n_aggs,
+    const df_groupby_options_t *options
+) {
+    const size_t n = df->n_rows;
+    const size_t n_threads = options->n_threads
+        ? options->n_threads
+        : mlc_thread_count();
+    size_t n_chunks = n / DF_GROUPBY_CHUNK_ROWS;
+    if (n_chunks > n_threads)
+        n_chunks = n_threads;
+    if (!n_chunks)
+        n_chunks = 1;
+
+    size_t part_bits = 0;
+    if (n_chunks > 1) {
+        while (part_bits < DF_GROUPBY_MAX_PART_BITS
+            && ((size_t)1 << part_bits) < n_threads * DF_GROUPBY_PARTS_PER_THREAD)
+            part_bits++;
+    }
+
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->n_keys = n_keys;
+    ctx->aggs = aggs;
+    ctx->n_aggs = n_aggs;
+    ctx->n = n;
+    ctx->n_chunks = n_chunks;
+    ctx->n_parts = (size_t)1 << part_bits;
+    ctx->part_shift = 64 - part_bits;
+    ctx->n_threads = n_threads;
+
+    /* malloc */
+    ctx->keys = malloc(n_keys * sizeof(col_t *));
+    ctx->values = malloc((n_aggs + 1) * sizeof(col_t *));
+    ctx->hashes = malloc((n + 1) * sizeof(uint64_t));
+    ctx->groups = malloc((n + 1) * sizeof(uint32_t));
+    ctx->bounds = malloc((n_chunks + 1) * sizeof(size_t));
+    ctx->parts = calloc(ctx->n_parts, sizeof(df_groupby_part_t));
+    if (ctx->n_parts > 1) {
+        ctx->rows = malloc(n * sizeof(size_t));
+        ctx->counts = calloc(n_chunks * ctx->n_parts, sizeof(size_t));
+    }
+    if (!ctx->keys || !ctx->values || !ctx->hashes || !ctx->groups
+        || !ctx->bounds || !ctx->parts
+        || (ctx->n_parts > 1 && (!ctx->rows || !ctx->counts)))
+        return COL_ERR_OOM;
+
+    /* assign */
+    int err_code = COL_ERR_OK;
+    for (size_t k = 0; k < n_keys; k++) {
+        ctx->keys[k] = df_col(df, keys[k], &err_code);
+        if (!ctx->keys[k])
+            return err_code;
+    }
+
+    for (size_t a = 0; a < n_aggs; a++) {
+        if ((unsigned)aggs[a].op > DF_AGG_MAX)
+            return COL_ERR_INVALID_ARG;
+        ctx->values[a] = NULL;
+        if (!aggs[a].col) {
+            if (aggs[a].op != DF_AGG_COUNT)
+                return COL_ERR_INVALID_ARG;
+            continue;
+        }
+
+        ctx->values[a] = df_col(df, aggs[a].col, &err_code);
+        if (!ctx->values[a])
+            return err_code;
+        if (aggs[a].op != DF_AGG_COUNT && !col_dtype_is_numeric(ctx->values[a]->dtype))
+            return COL_ERR_INVALID_DTYPE;
+    }
+
+    const size_t rows_per_chunk = n / n_chunks;
+    const size_t extra = n % n_chunks;
+    for (size_t t = 0; t <= n_chunks; t++)
+        ctx->bounds[t] = t * rows_per_chunk + (t < extra ? t : extra);
+
+    return COL_ERR_OK;
+}
+
+/* Hashes, partitions and aggregates every row, then merges the groups of
+ * every partition into `first` and `states` */
+static int df_groupby_execute(df_groupby_ctx_t *ctx, size_t *n_groups_out) {
+    const size_t n_parts = ctx->n_parts;
+    mlc_parallel_for(ctx->n_chunks, ctx->n_threads, df_groupby_hash_run, ctx);
+
+    if (n_parts == 1) {
+        ctx->parts[0].end = ctx->n;
+    } else {
+        /* partition-major prefix sums keep every partition in row order */
+        size_t pos = 0;
+        for (size_t p = 0; p < n_parts; p++) {
+            ctx->parts[p].start = pos;
+            for (size_t c = 0; c < ctx->n_chunks; c++) {
+                const size_t count = ctx->counts[c * n_parts + p];
+                ctx->counts[c * n_parts + p] = pos;
+                pos += count;
+            }
+            ctx->parts[p].end = pos;
+        }
+        mlc_parallel_for(ctx->n_chunks, ctx->n_threads, df_groupby_scatter_run, ctx);
+    }
+
+    mlc_parallel_for(n_parts, ctx->n_threads, df_groupby_part_run, ctx);
+
+    size_t n_groups = 0;
+    for (size_t p = 0; p < n_parts; p++) {
+        if (ctx->parts[p].err)
+            return ctx->parts[p].err;
+        ctx->parts[p].offset = n_groups;
+        n_groups += ctx->parts[p].n_groups;
+    }
+
+    /* malloc */
+    ctx->first = malloc((n_groups + 1) * sizeof(int64_t));
+    ctx->states = malloc((n_groups * ctx->n_aggs + 1) * sizeof(df_groupby_state_t));
+    if (!ctx->first || !ctx->states)
+        return COL_ERR_OOM;
+
+    /* assign */
+    mlc_parallel_for(n_parts, ctx->n_threads, df_groupby_merge_run, ctx);
+    *n_groups_out = n_groups;
+    return COL_ERR_OK;
+}
+
+/* Orders the groups by the keys of their first rows, last key first, so the
+ * stable sorts leave the first key column in order */
+static int df_groupby_sort_keys(
+    const df_groupby_ctx_t *ctx,
+    const size_t n_groups,
+    int64_t *order
+) {
+    col_sort_options_t options = col_sort_options_default();
+    options.n_threads = ctx->n_threads;
+
+    /* malloc */
+    int64_t *rows = malloc((n_groups + 1) * sizeof(int64_t));
+    if (!rows)
+        return COL_ERR_OOM;
+
+    /* assign */
+    int err_code = COL_ERR_OK;
+    for (size_t g = 0; g < n_groups; g++)
+        order[g] = (int64_t)g;
+    for (size_t k = ctx->n_keys; k-- > 0 && !err_code;) {
+        for (size_t g = 0; g < n_groups; g++)
+            rows[g] = ctx->first[order[g]];
+
+        col_t *keys = col_take_int64(ctx->keys[k], rows, n_groups, &err_code);
+        col_t *sorted = keys ? col_argsort(keys, &options, &err_code) : NULL;
+        if (sorted) {
+            const int64_t *idx = sorted->data;
+            for (size_t g = 0; g < n_groups; g++)
+                rows[g] = order[idx[g]];
+            memcpy(order, rows, n_groups * sizeof(int64_t));
+        }
+        col_free(sorted);
+        col_free(keys);
+    }
+
+    free(rows);
+    return err_code;
+}
+
+/* Orders the groups by their first rows. Partitions list their groups in
+ * that order, so only several partitions need sorting. */
+static int df_groupby_sort_first(
+    const df_groupby_ctx_t *ctx,
+    const size_t n_groups,
+    int64_t *order
+) {
+    col_sort_options_t options = col_sort_options_default();
+    options.n_threads = ctx->n_threads;
+
+    int err_code = COL_ERR_OK;
+    col_t *first = col_wrap("first", ctx->first, n_groups, COL_DTYPE_INT64, &err_code);
+    col_t *sorted = first ? col_argsort(first, &options, &err_code) : NULL;
+    if (sorted)
+        memcpy(order, sorted->data, n_groups * sizeof(int64_t));
+
+    col_free(sorted);
+    col_free(first);
+    return err_code;
+}
+
+/* Creates the result column of aggregation `a`, group `i` taken from
+ * `order[i]` */
+static col_t *df_groupby_emit(
+    const df_groupby_ctx_t *ctx,
+    const size_t a,
+    const int64_t *order,
+    const size_t n_groups,
+    int *err_out
+) {
+    const df_agg_t *agg = &ctx->aggs[a];
+    static const char *const op_names[] = {
+        [DF_AGG_COUNT] = "count",
+        [DF_AGG_SUM] = "sum",
+        [DF_AGG_MEAN] = "mean",
+        [DF_AGG_MIN] = "min",
+        [DF_AGG_MAX] = "max"
+    };
+
+    /* init */
+    char *name = NULL;
+    if (!agg->name && agg->col) {
+        const size_t len = strlen(agg->col) + strlen(op_names[agg->op]) + 2;
+        name = malloc(len);
+        if (!name)
+            return mlc_fail_null(COL_ERR_OOM, err_out);
+        snprintf(name, len, "%s_%s", agg->col, op_names[agg->op]);
+    }
+
+    int err_code = COL_ERR_OK;
+    col_t *col = col_create_with_capacity(
+        agg->name ? agg->name : name ? name : op_names[agg->op],
+        n_groups,
+        agg->op == DF_AGG_COUNT ? COL_DTYPE_INT64 : COL_DTYPE_DOUBLE,
+        &err_code
+    );
+    free(name);
+    if (!col)
+        return mlc_fail_null(err_code, err_out);
+
+    /* assign */
+    const int nullable = agg->op != DF_AGG_COUNT && agg->op != DF_AGG_SUM;
+    size_t null_count = 0;
+    for (size_t i = 0; i < n_groups; i++) {
+        const size_t g = order ? (size_t)order[i] : i;
+        const df_groupby_state_t *s = &ctx->states[g * ctx->n_aggs + a];
+        if (agg->op == DF_AGG_COUNT) {
+            ((int64_t *)col->data)[i] = s->count;
+            continue;
+        }
+
+        double val = s->acc;
+        if (agg->op == DF_AGG_MEAN)
+            val = s->count ? s->acc / (double)s->count : NAN;
+        ((double *)col->data)[i] = val;
+        null_count += nullable && !s->count;
+    }
+    col->n_rows = n_groups;
+
+    if (null_count) {
+        if (col_validity_init(col)) {
+            col_free(col);
+            return mlc_fail_null(COL_ERR_OOM, err_out);
+        }
+        for (size_t i = 0; i < n_groups; i++) {
+            const size_t g = order ? (size_t)order[i] : i;
+            if (!ctx->states[g * ctx->n_aggs + a].count)
+                col_bit_set(col->validity, i, 0);
+        }
+        col->null_count = null_count;
+    }
+
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    return col;
+}
+
+df_groupby_options_t df_groupby_options_default(void) {
+    df_groupby_options_t options = {
+        .sort = 0,
+        .n_threads = 0
+    };
+    return options;
+}
+
+df_t *df_groupby(
+    const df_t *df,
+    const char *const *keys,
+    const size_t n_keys,
+    const df_agg_t *aggs,
+    const size_t n_aggs,
+    const df_groupby_options_t *options,
+    int *err_out
+) {
+    /* args */
+    if (!df || !keys || (!aggs && n_aggs))
+        return mlc_fail_null(COL_ERR_NO_DATA, err_out);
+    if (!n_keys)
+        return mlc_fail_null(COL_ERR_INVALID_ARG, err_out);
+
+    const df_groupby_options_t opts = options
+        ? *options
+        : df_groupby_options_default();
+
+    /* init */
+    df_groupby_ctx_t ctx;
+    size_t n_groups = 0;
+    int64_t *order = NULL;
+    int64_t *rows = NULL;
+    col_t **cols = NULL;
+    size_t n_cols = 0;
+    df_t *result = NULL;
+    int err_code = df_groupby_prepare(&ctx, df, keys, n_keys, aggs, n_aggs, &opts);
+    if (!err_code)
+        err_code = df_groupby_execute(&ctx, &n_groups);
+    if (err_code)
+        goto cleanup;
+
+    /* malloc */
+    err_code = COL_ERR_OOM;
+    rows = malloc((n_groups + 1) * sizeof(int64_t));
+    cols = calloc(n_keys + n_aggs, sizeof(col_t *));
+    if (!rows || !cols)
+        goto cleanup;
+    if (opts.sort || ctx.n_parts > 1) {
+        order = malloc((n_groups + 1) * sizeof(int64_t));
+        if (!order)
+            goto cleanup;
+        err_code = opts.sort
+            ? df_groupby_sort_keys(&ctx, n_groups, order)
+            : df_groupby_sort_first(&ctx, n_groups, order);
+        if (err_code)
+            goto cleanup;
+    }
+
+    /* assign: keys are copied from the first row of every group */
+    for (size_t g = 0; g < n_groups; g++)
+        rows[g] = ctx.first[order ? order[g] : (int64_t)g];
+
+    for (; n_cols < n_keys; n_cols++) {
+        cols[n_cols] = col_take_int64(ctx.keys[n_cols], rows, n_groups, &err_code);
+        if (!cols[n_cols])
+            goto cleanup;
+    }
+    for (size_t a = 0; a < n_aggs; a++, n_cols++) {
+        cols[n_cols] = df_groupby_emit(&ctx, a, order, n_groups, &err_code);
+        if (!cols[n_cols])
+            goto cleanup;
+    }
+
+    result = df_from_cols(cols, n_cols, &err_code);
+    if (result)
+        n_cols = 0;
+
+cleanup:
+    if (cols) {
+        for (size_t j = 0; j < n_cols; j++)
+            col_free(cols[j]);
+    }
+    free(cols);
+    free(rows);
+    free(order);
+    df_groupby_release(&ctx);
+
+    if (!result)
+        return mlc_fail_null(err_code, err_out);
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    return result;
+}
@@ -0,0 +1,689 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/error.h"
+#include "core/thread.h"
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/col/core/modifiers.h"
+#include "dtypes/col/ops/gather.h"
+#include "dtypes/df/core/type.h"
+#include "dtypes/df/core/accessors.h"
+#include "dtypes/df/core/lifecycle.h"
+#include "dtypes/df/ops/join.h"
+#include "dtypes/df/ops/keys.h"
+
+/* Fewest rows a chunk of a parallel join holds. Smaller frames are hashed
+ * and probed on the calling thread alone. */
+#define DF_JOIN_CHUNK_ROWS ((size_t)1 << 16)
+
+/* Probe chunks per thread, so chunks with many matches still balance */
+#define DF_JOIN_CHUNKS_PER_THREAD 4
+
+/* Right rows per partition, whose table, hashes and chains then fit the
+ * L2 cache */
+#define DF_JOIN_CACHE_ROWS ((size_t)1 << 14)
+#define DF_JOIN_MAX_PART_BITS 12
+
+/* Left rows probed at once: hashed, their slots prefetched, then matched */
+#define DF_JOIN_BLOCK_ROWS 256
+
+#define DF_JOIN_TAG_MASK 0xFFFFFFFF00000000ULL
+
+/* End of a chain of right rows with equal keys */
+#define DF_JOIN_NONE UINT32_MAX
+
+/* Matches of one chunk of left rows */
+typedef struct df_join_chunk {
+    int64_t *left;
+    int64_t *right;
+    size_t n;
+    size_t capacity;
+    size_t offset;              /* index of the first match in the result */
+    size_t n_missing;           /* left rows of a left join without a match */
+    int err;
+} df_join_chunk_t;
+
+/* State shared by the tasks of one join */
+typedef struct df_join_ctx {
+    const col_t **lkeys;
+    const col_t **rkeys;
+    size_t n_keys;
+    int left_join;
+    int lnullable;              /* whether any left key holds a null */
+    int rnullable;
+    size_t n_threads;
+    /* build */
+    size_t n_right;
+    uint64_t *hashes;           /* hash of every right row */
+    size_t *bounds;             /* `n_chunks + 1` right chunk boundaries */
+    size_t n_chunks;
+    size_t *counts;             /* right rows of every chunk in every partition */
+    size_t n_parts;
+    unsigned part_shift;        /* one less than the shift to a partition */
+    size_t *part_bounds;        /* `n_parts + 1` partition boundaries */
+    size_t *rows;               /* right rows by partition, null keys dropped */
+    uint64_t *row_hashes;       /* hash of every entry of `rows` */
+    uint32_t *next;             /* next entry with equal keys in the partition */
+    uint32_t *tail;             /* last entry of the chain of every first one */
+    uint64_t *slots;            /* hash tag | (entry + 1), 0 if empty */
+    size_t *slot_bounds;        /* `n_parts + 1` partition slot boundaries */
+    int *part_err;
+    /* probe */
+    size_t n_left;
+    size_t *probe_bounds;       /* `n_probe + 1` left chunk boundaries */
+    size_t n_probe;
+    df_join_chunk_t *chunks;
+    int64_t *left_out;
+    int64_t *right_out;
+} df_join_ctx_t;
+
+/* Partition of a hash. Shifting twice allows a single partition. */
+static inline size_t df_join_part(const df_join_ctx_t *ctx, const uint64_t h) {
+    return (size_t)((h >> ctx->part_shift) >> 1);
+}
+
+/* Sizes `n_chunks` chunks of `n` rows into `bounds` */
+static void df_join_bounds(size_t *bounds, const size_t n, const size_t n_chunks) {
+    const size_t rows_per_chunk = n / n_chunks;
+    const size_t extra = n % n_chunks;
+    for (size_t t = 0; t <= n_chunks; t++)
+        bounds[t] = t * rows_per_chunk + (t < extra ? t : extra);
+}
+
+/* build */
+
+/* Hashes the keys of a chunk of right rows, then counts its rows with no
+ * null key in every partition */
+static void df_join_hash_run(void *arg, size_t task) {
+    df_join_ctx_t *ctx = arg;
+    const size_t start = ctx->bounds[task];
+    const size_t end = ctx->bounds[task + 1];
+    df_keys_hash(ctx->rkeys, ctx->n_keys, start, end - start, ctx->hashes + start);
+
+    size_t *counts = ctx->counts + task * ctx->n_parts;
+    for (size_t i = start; i < end; i++) {
+        if (ctx->rnullable && df_keys_null(ctx->rkeys, ctx->n_keys, i))
+            continue;
+        counts[df_join_part(ctx, ctx->hashes[i])]++;
+    }
+}
+
+/* Writes the rows of a chunk to their partitions, in row order */
+static void df_join_scatter_run(void *arg, size_t task) {
+    df_join_ctx_t *ctx = arg;
+    size_t *pos = ctx->counts + task * ctx->n_parts;
+    for (size_t i = ctx->bounds[task]; i < ctx->bounds[task + 1]; i++) {
+        if (ctx->rnullable && df_keys_null(ctx->rkeys, ctx->n_keys, i))
+            continue;
+        const uint64_t h = ctx->hashes[i];
+        const size_t e = pos[df_join_part(ctx, h)]++;
+        ctx->rows[e] = i;
+        ctx->row_hashes[e] = h;
+    }
+}
+
+/* Inserts the entries of a partition into its table. Entries with keys
+ * already present are chained after them instead, in row order. */
+static void df_join_build_run(void *arg, size_t task) {
+    df_join_ctx_t *ctx = arg;
+    const size_t start = ctx->part_bounds[task];
+    const size_t n = ctx->part_bounds[task + 1] - start;
+    if (n >= DF_JOIN_NONE) {
+        ctx->part_err[task] = COL_ERR_OUT_OF_BOUNDS;
+        return;
+    }
+
+    uint64_t *slots = ctx->slots + ctx->slot_bounds[task];
+    const size_t mask = ctx->slot_bounds[task + 1] - ctx->slot_bounds[task] - 1;
+    const size_t *rows = ctx->rows + start;
+    uint32_t *next = ctx->next + start;
+    uint32_t *tail = ctx->tail + start;
+
+    for (size_t e = 0; e < n; e++) {
+        const uint64_t h = ctx->row_hashes[start + e];
+        const uint64_t tag = h & DF_JOIN_TAG_MASK;
+        next[e] = DF_JOIN_NONE;
+
+        size_t s = (size_t)h & mask;
+        for (;;) {
+            const uint64_t slot = slots[s];
+            if (!slot) {
+                slots[s] = tag | (e + 1);
+                tail[e] = (uint32_t)e;
+                break;
+            }
+            const size_t head = (size_t)(uint32_t)slot - 1;
+            if ((slot & DF_JOIN_TAG_MASK) == tag
+                && df_keys_equal(ctx->rkeys, rows[head], ctx->rkeys, rows[e], ctx->n_keys)) {
+                next[tail[head]] = (uint32_t)e;
+                tail[head] = (uint32_t)e;
+                break;
+            }
+            s = (s + 1) & mask;
+        }
+    }
+}
+
+/* probe */
+
+/* Appends a match, growing the buffers of the chunk */
+static int df_join_emit(
+    df_join_chunk_t *chunk,
+    const size_t left,
+    const int64_t right
+) {
+    if (chunk->n == chunk->capacity) {
+        const size_t capacity = chunk->capacity * 2;
+        int64_t *l = realloc(chunk->left, capacity * sizeof(int64_t));
+        if (!l)
+            return COL_ERR_OOM;
+        chunk->left = l;
+        int64_t *r = realloc(chunk->right, capacity * sizeof(int64_t));
+        if (!r)
+            return COL_ERR_OOM;
+        chunk->right = r;
+        chunk->capacity = capacity;
+    }
+
+    chunk->left[chunk->n] = (int64_t)left;
+    chunk->right[chunk->n] = right;
+    chunk->n++;
+    return COL_ERR_OK;
+}
+
+/* Finds the first entry of the chain of right rows matching left row `i`.
+ * Returns `DF_JOIN_NONE` if there is none. */
+static inline size_t df_join_find(
+    const df_join_ctx_t *ctx,
+    const size_t i,
+    const uint64_t h,
+    const size_t p
+) {
+    const uint64_t *slots = ctx->slots + ctx->slot_bounds[p];
+    const size_t mask = ctx->slot_bounds[p + 1] - ctx->slot_bounds[p] - 1;
+    const size_t *rows = ctx->rows + ctx->part_bounds[p];
+    const uint64_t tag = h & DF_JOIN_TAG_MASK;
+
+    size_t s = (size_t)h & mask;
+    for (;;) {
+        const uint64_t slot = slots[s];
+        if (!slot)
+            return DF_JOIN_NONE;
+        const size_t head = (size_t)(uint32_t)slot - 1;
+        if ((slot & DF_JOIN_TAG_MASK) == tag
+            && df_keys_equal(ctx->lkeys, i, ctx->rkeys, rows[head], ctx->n_keys))
+            return head;
+        s = (s + 1) & mask;
+    }
+}
+
+/* Probes a chunk of left rows a block at a time, prefetching the slot of
+ * every row of the block before matching any */
+static void df_join_probe_run(void *arg, size_t task) {
+    df_join_ctx_t *ctx = arg;
+    df_join_chunk_t *chunk = &ctx->chunks[task];
+    const size_t start = ctx->probe_bounds[task];
+    const size_t end = ctx->probe_bounds[task + 1];
+
+    /* malloc: most joins match about one row per left row */
+    chunk->capacity = end - start + 16;
+    chunk->left = malloc(chunk->capacity * sizeof(int64_t));
+    chunk->right = malloc(chunk->capacity * sizeof(int64_t));
+    if (!chunk->left || !chunk->right) {
+        chunk->err = COL_ERR_OOM;
+        return;
+    }
+
+    uint64_t hashes[DF_JOIN_BLOCK_ROWS];
+    for (size_t b = start; b < end; b += DF_JOIN_BLOCK_ROWS) {
+        const size_t len = end - b < DF_JOIN_BLOCK_ROWS ? end - b : DF_JOIN_BLOCK_ROWS;
+        df_keys_hash(ctx->lkeys, ctx->n_keys, b, len, hashes);
+        for (size_t j = 0; j < len; j++) {
+            const size_t p = df_join_part(ctx, hashes[j]);
+            const size_t mask = ctx->slot_bounds[p + 1] - ctx->slot_bounds[p] - 1;
+            __builtin_prefetch(ctx->slots + ctx->slot_bounds[p] + (hashes[j] & mask));
+        }
+
+        for (size_t j = 0; j < len; j++) {
+            const size_t i = b + j;
+            size_t e = DF_JOIN_NONE;
+            size_t p = 0;
+            if (!ctx->lnullable || !df_keys_null(ctx->lkeys, ctx->n_keys, i)) {
+                p = df_join_part(ctx, hashes[j]);
+                e = df_join_find(ctx, i, hashes[j], p);
+            }
+
+            if (e == DF_JOIN_NONE) {
+                if (!ctx->left_join)
+                    continue;
+                chunk->n_missing++;
+                if (df_join_emit(chunk, i, -1)) {
+                    chunk->err = COL_ERR_OOM;
+                    return;
+                }
+                continue;
+            }
+
+            const size_t *rows = ctx->rows + ctx->part_bounds[p];
+            const uint32_t *next = ctx->next + ctx->part_bounds[p];
+            for (; e != DF_JOIN_NONE; e = next[e]) {
+                if (df_join_emit(chunk, i, (int64_t)rows[e])) {
+                    chunk->err = COL_ERR_OOM;
+                    return;
+                }
+            }
+        }
+    }
+}
+
+/* Copies the matches of a chunk to their place in the result */
+static void df_join_merge_run(void *arg, size_t task) {
+    df_join_ctx_t *ctx = arg;
+    const df_join_chunk_t *chunk = &ctx->chunks[task];
+    if (!chunk->n)
+        return;
+
+    memcpy(ctx->left_out + chunk->offset, chunk->left, chunk->n * sizeof(int64_t));
+    memcpy(ctx->right_out + chunk->offset, chunk->right, chunk->n * sizeof(int64_t));
+}
+
+/* drivers */
+
+static void df_join_release(df_join_ctx_t *ctx) {
+    if (ctx->chunks) {
+        for (size_t t = 0; t < ctx->n_probe; t++) {
+            free(ctx->chunks[t].left);
+            free(ctx->chunks[t].right);
+        }
+    }
+    free(ctx->chunks);
+    free(ctx->probe_bounds);
+    free(ctx->part_err);
+    free(ctx->slot_bounds);
+    free(ctx->slots);
+    free(ctx->tail);
+    free(ctx->next);
+    free(ctx->row_hashes);
+    free(ctx->rows);
+    free(ctx->part_bounds);
+    free(ctx->counts);
+    free(ctx->bounds);
+    free(ctx->hashes);
+    free(ctx->rkeys);
+    free(ctx->lkeys);
+}
+
+/* Looks up and checks the key columns, then sizes the chunks and the
+ * partitions */
+static int df_join_prepare(
+    df_join_ctx_t *ctx,
+    const df_t *left,
+    const df_t *right,
+    const char *const *left_on,
+    const char *const *right_on,
+    const size_t n_keys,
+    const df_join_options_t *options
+) {
+    const size_t n_threads = options->n_threads
+        ? options->n_threads
+        : mlc_thread_count();
+    const size_t n_right = right->n_rows;
+    const size_t n_left = left->n_rows;
+
+    size_t n_chunks = n_right / DF_JOIN_CHUNK_ROWS;
+    if (n_chunks > n_threads)
+        n_chunks = n_threads;
+    if (!n_chunks)
+        n_chunks = 1;
+
+    size_t n_probe = n_left / DF_JOIN_CHUNK_ROWS;
+    if (n_probe > n_threads * DF_JOIN_CHUNKS_PER_THREAD)
+        n_probe = n_threads * DF_JOIN_CHUNKS_PER_THREAD;
+    if (!n_probe)
+        n_probe = 1;
+
+    size_t part_bits = 0;
+    while (part_bits < DF_JOIN_MAX_PART_BITS
+        && (DF_JOIN_CACHE_ROWS << part_bits) < n_right)
+        part_bits++;
+
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->n_keys = n_keys;
+    ctx->left_join = options->type == DF_JOIN_LEFT;
+    ctx->n_threads = n_threads;
+    ctx->n_right = n_right;
+    ctx->n_chunks = n_chunks;
+    ctx->n_parts = (size_t)1 << part_bits;
+    ctx->part_shift = 63 - (unsigned)part_bits;
+    ctx->n_left = n_left;
+    ctx->n_probe = n_probe;
+
+    /* malloc */
+    ctx->lkeys = malloc(n_keys * sizeof(col_t *));
+    ctx->rkeys = malloc(n_keys * sizeof(col_t *));
+    ctx->hashes = malloc((n_right + 1) * sizeof(uint64_t));
+    ctx->bounds = malloc((n_chunks + 1) * sizeof(size_t));
+    ctx->counts = calloc(n_chunks * ctx->n_parts, sizeof(size_t));
+    ctx->part_bounds = malloc((ctx->n_parts + 1) * sizeof(size_t));
+    ctx->slot_bounds = malloc((ctx->n_parts + 1) * sizeof(size_t));
+    ctx->part_err = calloc(ctx->n_parts, sizeof(int));
+    ctx->probe_bounds = malloc((n_probe + 1) * sizeof(size_t));
+    ctx->chunks = calloc(n_probe, sizeof(df_join_chunk_t));
+    if (!ctx->lkeys || !ctx->rkeys || !ctx->hashes || !ctx->bounds
+        || !ctx->counts || !ctx->part_bounds || !ctx->slot_bounds
+        || !ctx->part_err || !ctx->probe_bounds || !ctx->chunks)
+        return COL_ERR_OOM;
+
+    /* assign */
+    int err_code = COL_ERR_OK;
+    for (size_t k = 0; k < n_keys; k++) {
+        ctx->lkeys[k] = df_col(left, left_on[k], &err_code);
+        if (!ctx->lkeys[k])
+            return err_code;
+        ctx->rkeys[k] = df_col(right, right_on[k], &err_code);
+        if (!ctx->rkeys[k])
+            return err_code;
+
+        const col_dtype_t dtype = ctx->lkeys[k]->dtype;
+        if (dtype != ctx->rkeys[k]->dtype)
+            return COL_ERR_INVALID_DTYPE;
+        if (dtype != COL_DTYPE_INT32 && dtype != COL_DTYPE_INT64 && dtype != COL_DTYPE_STRING)
+            return COL_ERR_INVALID_DTYPE;
+
+        ctx->lnullable |= ctx->lkeys[k]->null_count > 0;
+        ctx->rnullable |= ctx->rkeys[k]->null_count > 0;
+    }
+
+    df_join_bounds(ctx->bounds, n_right, n_chunks);
+    df_join_bounds(ctx->probe_bounds, n_left, n_probe);
+    return COL_ERR_OK;
+}
+
+/* Partitions the right rows and builds a table over every partition */
+static int df_join_build(df_join_ctx_t *ctx) {
+    const size_t n_parts = ctx->n_parts;
+    mlc_parallel_for(ctx->n_chunks, ctx->n_threads, df_join_hash_run, ctx);
+
+    /* partition-major prefix sums keep every partition in row order */
+    size_t pos = 0;
+    size_t n_slots = 0;
+    for (size_t p = 0; p < n_parts; p++) {
+        ctx->part_bounds[p] = pos;
+        for (size_t c = 0; c < ctx->n_chunks; c++) {
+            const size_t count = ctx->counts[c * n_parts + p];
+            ctx->counts[c * n_parts + p] = pos;
+            pos += count;
+        }
+
+        /* tables are kept at most half full */
+        size_t size = 16;
+        while (size < 2 * (pos - ctx->part_bounds[p]))
+            size *= 2;
+        ctx->slot_bounds[p] = n_slots;
+        n_slots += size;
+    }
+    ctx->part_bounds[n_parts] = pos;
+    ctx->slot_bounds[n_parts] = n_slots;
+
+    /* malloc */
+    ctx->rows = malloc((pos + 1) * sizeof(size_t));
+    ctx->row_hashes = malloc((pos + 1) * sizeof(uint64_t));
+    ctx->next = malloc((pos + 1) * sizeof(uint32_t));
+    ctx->tail = malloc((pos + 1) * sizeof(uint32_t));
+    ctx->slots = calloc(n_slots, sizeof(uint64_t));
+    if (!ctx->rows || !ctx->row_hashes || !ctx->next || !ctx->tail || !ctx->slots)
+        return COL_ERR_OOM;
+
+    /* assign */
+    mlc_parallel_for(ctx->n_chunks, ctx->n_threads, df_join_scatter_run, ctx);
+    mlc_parallel_for(n_parts, ctx->n_threads, df_join_build_run, ctx);
+    for (size_t p = 0; p < n_parts; p++) {
+        if (ctx->part_err[p])
+            return ctx->part_err[p];
+    }
+
+    return COL_ERR_OK;
+}
+
+/* Probes every left row, then merges the matches of every chunk into two
+ * new index columns */
+static int df_join_probe(
+    df_join_ctx_t *ctx,
+    col_t **left_out,
+    col_t **right_out
+) {
+    mlc_parallel_for(ctx->n_probe, ctx->n_threads, df_join_probe_run, ctx);
+
+    size_t n = 0;
+    for (size_t t = 0; t < ctx->n_probe; t++) {
+        if (ctx->chunks[t].err)
+            return ctx->chunks[t].err;
+        ctx->chunks[t].offset = n;
+        n += ctx->chunks[t].n;
+    }
+
+    /* init */
+    int err_code = COL_ERR_OK;
+    col_t *left = col_create_with_capacity("left", n, COL_DTYPE_INT64, &err_code);
+    if (!left)
+        return err_code;
+    col_t *right = col_create_with_capacity("right", n, COL_DTYPE_INT64, &err_code);
+    if (!right) {
+        col_free(left);
+        return err_code;
+    }
+
+    /* assign */
+    ctx->left_out = left->data;
+    ctx->right_out = right->data;
+    mlc_parallel_for(ctx->n_probe, ctx->n_threads, df_join_merge_run, ctx);
+    left->n_rows = n;
+    right->n_rows = n;
+
+    *left_out = left;
+    *right_out = right;
+    return COL_ERR_OK;
+}
+
+/* Runs a join into index columns, reporting whether any left row of a left
+ * join went without a match */
+static int df_join_run(
+    const df_t *left,
+    const df_t *right,
+    const char *const *left_on,
+    const char *const *right_on,
+    const size_t n_keys,
+    const df_join_options_t *options,
+    col_t **left_out,
+    col_t **right_out,
+    size_t *n_missing_out
+) {
+    /* args */
+    if (!left || !right || !left_on || !right_on || !left_out || !right_out)
+        return COL_ERR_NO_DATA;
+    *left_out = NULL;
+    *right_out = NULL;
+    if (!n_keys)
+        return COL_ERR_INVALID_ARG;
+
+    const df_join_options_t opts = options
+        ? *options
+        : df_join_options_default();
+    if ((unsigned)opts.type > DF_JOIN_LEFT)
+        return COL_ERR_INVALID_ARG;
+
+    /* assign */
+    df_join_ctx_t ctx;
+    int err_code = df_join_prepare(&ctx, left, right, left_on, right_on, n_keys, &opts);
+    if (!err_code)
+        err_code = df_join_build(&ctx);
+    if (!err_code)
+        err_code = df_join_probe(&ctx, left_out, right_out);
+
+    if (n_missing_out) {
+        *n_missing_out = 0;
+        for (size_t t = 0; !err_code && t < ctx.n_probe; t++)
+            *n_missing_out += ctx.chunks[t].n_missing;
+    }
+
+    df_join_release(&ctx);
+    return err_code;
+}
+
+/* Gathers a right column to the join, null where `idx` is -1 */
+static col_t *df_join_take(
+    const col_t *col,
+    const int64_t *idx,
+    const size_t n,
+    const size_t n_missing,
+    int *err_out
+) {
+    if (!n_missing)
+        return col_take_int64(col, idx, n, err_out);
+
+    /* malloc */
+    int64_t *safe = malloc((n + 1) * sizeof(int64_t));
+    if (!safe)
+        return mlc_fail_null(COL_ERR_OOM, err_out);
+
+    /* assign: missing rows read row 0, then are nulled */
+    int err_code = COL_ERR_OK;
+    col_t *new_col = NULL;
+    if (col->n_rows) {
+        for (size_t i = 0; i < n; i++)
+            safe[i] = idx[i] < 0 ? 0 : idx[i];
+        new_col = col_take_int64(col, safe, n, &err_code);
+        for (size_t i = 0; new_col && !err_code && i < n; i++) {
+            if (idx[i] < 0)
+                err_code = col_set_null(new_col, i);
+        }
+    } else {
+        new_col = col_create_with_capacity(col->name, n, col->dtype, &err_code);
+        for (size_t i = 0; new_col && !err_code && i < n; i++)
+            err_code = col_append_null(new_col);
+    }
+    free(safe);
+
+    if (err_code) {
+        col_free(new_col);
+        return mlc_fail_null(err_code, err_out);
+    }
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    return new_col;
+}
+
+df_join_options_t df_join_options_default(void) {
+    df_join_options_t options = {
+        .type = DF_JOIN_INNER,
+        .suffix = "_right",
+        .n_threads = 0
+    };
+    return options;
+}
+
+int df_join_index(
+    const df_t *left,
+    const df_t *right,
+    const char *const *left_on,
+    const char *const *right_on,
+    const size_t n_keys,
+    const df_join_options_t *options,
+    col_t **left_out,
+    col_t **right_out
+) {
+    return df_join_run(
+        left, right, left_on, right_on, n_keys, options, left_out, right_out, NULL
+    );
+}
+
+df_t *df_join(
+    const df_t *left,
+    const df_t *right,
+    const char *const *left_on,
+    const char *const *right_on,
+    const size_t n_keys,
+    const df_join_options_t *options,
+    int *err_out
+) {
+    const df_join_options_t opts = options
+        ? *options
+        : df_join_options_default();
+
+    /* init */
+    col_t *lidx = NULL;
+    col_t *ridx = NULL;
+    size_t n_missing = 0;
+    int err_code = df_join_run(
+        left, right, left_on, right_on, n_keys, &opts, &lidx, &ridx, &n_missing
+    );
+    if (err_code)
+        return mlc_fail_null(err_code, err_out);
+
+    /* malloc */
+    const size_t n = lidx->n_rows;
+    col_t **cols = calloc(left->n_cols + right->n_cols + 1, sizeof(col_t *));
+    size_t n_cols = 0;
+    df_t *result = NULL;
+    err_code = COL_ERR_OOM;
+    if (!cols)
+        goto cleanup;
+
+    /* assign: left columns, then right ones but their keys */
+    for (size_t j = 0; j < left->n_cols; j++, n_cols++) {
+        cols[n_cols] = col_take_int64(left->cols[j], lidx->data, n, &err_code);
+        if (!cols[n_cols])
+            goto cleanup;
+    }
+
+    for (size_t j = 0; j < right->n_cols; j++) {
+        const col_t *col = right->cols[j];
+        int is_key = 0;
+        for (size_t k = 0; k < n_keys && !is_key; k++)
+            is_key = !strcmp(col->name, right_on[k]);
+        if (is_key)
+            continue;
+
+        cols[n_cols] = df_join_take(col, ridx->data, n, n_missing, &err_code);
+        if (!cols[n_cols])
+            goto cleanup;
+        n_cols++;
+
+        /* names taken on the left get the suffix */
+        if (df_col_index(left, col->name, NULL) == SIZE_MAX)
+            continue;
+        const char *suffix = opts.suffix ? opts.suffix : "";
+        const size_t len = strlen(col->name) + strlen(suffix) + 1;
+        char *name = malloc(len);
+        err_code = COL_ERR_OOM;
+        if (!name)
+            goto cleanup;
+        snprintf(name, len, "%s%s", col->name, suffix);
+        err_code = col_rename(cols[n_cols - 1], name);
+        free(name);
+        if (err_code)
+            goto cleanup;
+    }
+
+    result = df_from_cols(cols, n_cols, &err_code);
+    if (result)
+        n_cols = 0;
+
+cleanup:
+    if (cols) {
+        for (size_t j = 0; j < n_cols; j++)
+            col_free(cols[j]);
+    }
+    free(cols);
+    col_free(ridx);
+    col_free(lidx);
+
+    if (!result)
+        return mlc_fail_null(err_code, err_out);
+    if (err_out)
+        *err_out = COL_ERR_OK;
+    return result;
+}
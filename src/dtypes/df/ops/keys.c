@@ -0,0 +1,218 @@
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "core/cpu.h"
+#include "core/hash.h"
+#include "core/simd.h"
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/internal.h"
+#include "dtypes/df/ops/keys.h"
+
+/* Rows hashed at once, so their hashes stay in L1 across key columns */
+#define DF_KEYS_BLOCK_ROWS 512
+
+/* Value hashed for null keys */
+#define DF_KEYS_NULL_BITS 0x9e3779b97f4a7c15ULL
+
+/* Hashes `n` canonical key values into `hashes`, or combines them with the
+ * hashes of the previous key columns unless `first` is set */
+typedef void (*df_keys_mix_fn)(
+    uint64_t *hashes,
+    const uint64_t *bits,
+    const size_t n,
+    const int first
+);
+
+/* Keys equal under `df_keys_equal` map to equal bits: every NaN to one
+ * NaN, and `-0.0` to `0.0` */
+static inline uint64_t df_keys_bits_double(double x) {
+    if (isnan(x))
+        x = NAN;
+    else if (x == 0)
+        x = 0.0;
+    uint64_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+    return bits;
+}
+
+/* Writes the canonical bits of rows `[start, start + n)` of a key column.
+ * Strings contribute their hash. */
+static void df_keys_bits(
+    const col_t *col,
+    const size_t start,
+    const size_t n,
+    uint64_t *bits
+) {
+    #define DF_KEYS_BITS(T, EXPR)                                           \
+        {                                                                   \
+            const T *vals = (const T *)col->data + start;                   \
+            for (size_t i = 0; i < n; i++)                                  \
+                bits[i] = EXPR(vals[i]);                                    \
+        }                                                                   \
+        break;
+    #define DF_KEYS_BITS_INT(x) ((uint64_t)(int64_t)(x))
+
+    switch (col->dtype) {
+        case COL_DTYPE_DOUBLE:
+            DF_KEYS_BITS(double, df_keys_bits_double)
+        case COL_DTYPE_FLOAT:
+            DF_KEYS_BITS(float, df_keys_bits_double)
+        case COL_DTYPE_INT64:
+            DF_KEYS_BITS(int64_t, DF_KEYS_BITS_INT)
+        case COL_DTYPE_INT32:
+            DF_KEYS_BITS(int32_t, DF_KEYS_BITS_INT)
+        case COL_DTYPE_UINT8:
+            DF_KEYS_BITS(uint8_t, DF_KEYS_BITS_INT)
+        case COL_DTYPE_STRING: {
+            const size_t *offsets = (const size_t *)col->data + start;
+            for (size_t i = 0; i < n; i++)
+                bits[i] = mlc_hash_str(col->strbuf.bytes + offsets[i]);
+            break;
+        }
+        case COL_DTYPE_CATEGORY:
+            for (size_t i = 0; i < n; i++)
+                bits[i] = (uint64_t)col_code_read(col->data, col->stride, start + i);
+            break;
+    }
+
+    #undef DF_KEYS_BITS_INT
+    #undef DF_KEYS_BITS
+
+    /* null rows hold defined values, overwritten here */
+    if (col->null_count) {
+        for (size_t i = 0; i < n; i++) {
+            if (!col_bit_get(col->validity, start + i))
+                bits[i] = DF_KEYS_NULL_BITS;
+        }
+    }
+}
+
+static void df_keys_mix_scalar(
+    uint64_t *hashes,
+    const uint64_t *bits,
+    const size_t n,
+    const int first
+) {
+    if (first) {
+        for (size_t i = 0; i < n; i++)
+            hashes[i] = mlc_hash_u64(bits[i]);
+        return;
+    }
+    for (size_t i = 0; i < n; i++)
+        hashes[i] = mlc_hash_combine(hashes[i], mlc_hash_u64(bits[i]));
+}
+
+#ifdef MLC_SIMD_X86
+
+/* `mlc_hash_u64` and `mlc_hash_combine` four and eight lanes at a time.
+ * AVX2 has no 64-bit multiply, so it is built from three 32-bit ones. */
+
+MLC_TARGET_AVX2 static inline __m256i df_keys_mul_avx2(
+    const __m256i a,
+    const uint64_t c
+) {
+    const __m256i lo = _mm256_set1_epi64x((long long)c);
+    const __m256i hi = _mm256_set1_epi64x((long long)(c >> 32));
+    const __m256i cross = _mm256_add_epi64(
+        _mm256_mul_epu32(_mm256_srli_epi64(a, 32), lo),
+        _mm256_mul_epu32(a, hi)
+    );
+    return _mm256_add_epi64(
+        _mm256_mul_epu32(a, lo),
+        _mm256_slli_epi64(cross, 32)
+    );
+}
+
+MLC_TARGET_AVX2 static inline __m256i df_keys_hash_avx2(__m256i x) {
+    x = _mm256_xor_si256(x, _mm256_srli_epi64(x, 30));
+    x = df_keys_mul_avx2(x, 0xbf58476d1ce4e5b9ULL);
+    x = _mm256_xor_si256(x, _mm256_srli_epi64(x, 27));
+    x = df_keys_mul_avx2(x, 0x94d049bb133111ebULL);
+    return _mm256_xor_si256(x, _mm256_srli_epi64(x, 31));
+}
+
+MLC_TARGET_AVX2 static void df_keys_mix_avx2(
+    uint64_t *hashes,
+    const uint64_t *bits,
+    const size_t n,
+    const int first
+) {
+    const __m256i golden = _mm256_set1_epi64x((long long)0x9e3779b97f4a7c15ULL);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i h = df_keys_hash_avx2(
+            _mm256_loadu_si256((const __m256i *)(bits + i))
+        );
+        if (!first) {
+            const __m256i a = _mm256_loadu_si256((const __m256i *)(hashes + i));
+            h = _mm256_add_epi64(
+                _mm256_add_epi64(h, golden),
+                _mm256_add_epi64(_mm256_slli_epi64(a, 6), _mm256_srli_epi64(a, 2))
+            );
+            h = df_keys_hash_avx2(_mm256_xor_si256(a, h));
+        }
+        _mm256_storeu_si256((__m256i *)(hashes + i), h);
+    }
+    df_keys_mix_scalar(hashes + i, bits + i, n - i, first);
+}
+
+MLC_TARGET_AVX512 static inline __m512i df_keys_hash_avx512(__m512i x) {
+    x = _mm512_xor_si512(x, _mm512_srli_epi64(x, 30));
+    x = _mm512_mullo_epi64(x, _mm512_set1_epi64((long long)0xbf58476d1ce4e5b9ULL));
+    x = _mm512_xor_si512(x, _mm512_srli_epi64(x, 27));
+    x = _mm512_mullo_epi64(x, _mm512_set1_epi64((long long)0x94d049bb133111ebULL));
+    return _mm512_xor_si512(x, _mm512_srli_epi64(x, 31));
+}
+
+MLC_TARGET_AVX512 static void df_keys_mix_avx512(
+    uint64_t *hashes,
+    const uint64_t *bits,
+    const size_t n,
+    const int first
+) {
+    const __m512i golden = _mm512_set1_epi64((long long)0x9e3779b97f4a7c15ULL);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512i h = df_keys_hash_avx512(_mm512_loadu_si512(bits + i));
+        if (!first) {
+            const __m512i a = _mm512_loadu_si512(hashes + i);
+            h = _mm512_add_epi64(
+                _mm512_add_epi64(h, golden),
+                _mm512_add_epi64(_mm512_slli_epi64(a, 6), _mm512_srli_epi64(a, 2))
+            );
+            h = df_keys_hash_avx512(_mm512_xor_si512(a, h));
+        }
+        _mm512_storeu_si512(hashes + i, h);
+    }
+    df_keys_mix_scalar(hashes + i, bits + i, n - i, first);
+}
+
+#endif
+
+static const df_keys_mix_fn df_keys_mix_kernels[MLC_ISA_COUNT] = {
+    [MLC_ISA_SCALAR] = df_keys_mix_scalar,
+#ifdef MLC_SIMD_X86
+    [MLC_ISA_SSE2] = df_keys_mix_scalar,
+    [MLC_ISA_AVX2] = df_keys_mix_avx2,
+    [MLC_ISA_AVX512] = df_keys_mix_avx512
+#endif
+};
+
+void df_keys_hash(
+    const col_t *const *keys,
+    const size_t n_keys,
+    const size_t start,
+    const size_t n,
+    uint64_t *hashes
+) {
+    const df_keys_mix_fn mix = df_keys_mix_kernels[mlc_cpu_isa()];
+    uint64_t bits[DF_KEYS_BLOCK_ROWS];
+    for (size_t b = 0; b < n; b += DF_KEYS_BLOCK_ROWS) {
+        const size_t len = n - b < DF_KEYS_BLOCK_ROWS ? n - b : DF_KEYS_BLOCK_ROWS;
+        for (size_t k = 0; k < n_keys; k++) {
+            df_keys_bits(keys[k], start + b, len, bits);
+            mix(hashes + b, bits, len, k == 0);
+        }
+    }
+}
@@ -0,0 +1,73 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "core/thread.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/col/ops/distinct.h"
+#include "test_utils/random.h"
+
+/*
+ * Times exact and approximate distinct counts of random `int64` values.
+ * Pass the number of rows, of distinct values and of threads to override
+ * the defaults.
+ */
+
+static const size_t SIZE = 10000000;
+static const size_t CARDINALITY = 1000000;
+
+/* Wall time, as the counts run on several threads */
+static double seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void report(const char *name, const double elapsed, const size_t n) {
+    printf("%-24s %8.3f s %8.1f ns/row\n", name, elapsed, elapsed * 1e9 / (double)n);
+}
+
+int main(int argc, char **argv) {
+    const size_t n = argc > 1 ? strtoull(argv[1], NULL, 10) : SIZE;
+    const size_t n_distinct = argc > 2 ? strtoull(argv[2], NULL, 10) : CARDINALITY;
+    if (argc > 3)
+        mlc_thread_set_count(strtoull(argv[3], NULL, 10));
+
+    int64_t *vals = malloc(n * sizeof(int64_t));
+    if (!vals || !n_distinct) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    for (size_t i = 0; i < n; i++)
+        vals[i] = (int64_t)(next_random() % n_distinct);
+    col_t *col = col_create_array("value", vals, n, COL_DTYPE_INT64, NULL);
+    free(vals);
+    if (!col) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    printf("%zu rows, %zu values, %zu threads\n", n, n_distinct, mlc_thread_count());
+
+    double start = seconds();
+    const size_t exact = col_ndistinct(col, NULL);
+    report("col_ndistinct", seconds() - start, n);
+
+    start = seconds();
+    col_t *values = NULL;
+    col_t *counts = NULL;
+    const int counts_err = col_value_counts(col, 1, &values, &counts);
+    report("col_value_counts sorted", seconds() - start, n);
+
+    start = seconds();
+    const double estimate = col_ndistinct_hll(col, 0, NULL);
+    report("col_ndistinct_hll", seconds() - start, n);
+    printf("exact %zu, estimate %.0f (%+.2f%%)\n",
+        exact, estimate, 100.0 * (estimate - (double)exact) / (double)exact);
+
+    const int failed = exact == SIZE_MAX || counts_err || estimate != estimate;
+    col_free(counts);
+    col_free(values);
+    col_free(col);
+    return failed;
+}
@@ -0,0 +1,86 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "core/thread.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/df/core/lifecycle.h"
+#include "dtypes/df/ops/groupby.h"
+#include "test_utils/random.h"
+
+/*
+ * Times `df_groupby` of random doubles by a random `int64` key. Pass the
+ * number of rows, of distinct keys and of threads to override the
+ * defaults.
+ */
+
+static const size_t SIZE = 10000000;
+static const size_t CARDINALITY = 100000;
+
+/* Wall time, as the group-by runs on several threads */
+static double seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void report(const char *name, const double elapsed, const size_t n) {
+    printf("%-24s %8.3f s %8.1f ns/row\n", name, elapsed, elapsed * 1e9 / (double)n);
+}
+
+int main(int argc, char **argv) {
+    const size_t n = argc > 1 ? strtoull(argv[1], NULL, 10) : SIZE;
+    const size_t n_keys = argc > 2 ? strtoull(argv[2], NULL, 10) : CARDINALITY;
+    if (argc > 3)
+        mlc_thread_set_count(strtoull(argv[3], NULL, 10));
+
+    int64_t *keys = malloc(n * sizeof(int64_t));
+    double *vals = malloc(n * sizeof(double));
+    if (!keys || !vals || !n_keys) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    for (size_t i = 0; i < n; i++) {
+        keys[i] = (int64_t)(next_random() % n_keys);
+        vals[i] = (double)(int64_t)next_random() / 4294967296.0;
+    }
+
+    col_t *cols[2] = {
+        col_create_array("key", keys, n, COL_DTYPE_INT64, NULL),
+        col_create_array("value", vals, n, COL_DTYPE_DOUBLE, NULL)
+    };
+    free(keys);
+    free(vals);
+    df_t *df = cols[0] && cols[1] ? df_from_cols(cols, 2, NULL) : NULL;
+    if (!df) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    printf("%zu rows, %zu keys, %zu threads\n", n, n_keys, mlc_thread_count());
+
+    const char *by[] = {"key"};
+    const df_agg_t aggs[] = {
+        {NULL, DF_AGG_COUNT, NULL},
+        {"value", DF_AGG_SUM, NULL},
+        {"value", DF_AGG_MEAN, NULL},
+        {"value", DF_AGG_MIN, NULL},
+        {"value", DF_AGG_MAX, NULL}
+    };
+
+    double start = seconds();
+    df_t *res = df_groupby(df, by, 1, aggs, 5, NULL, NULL);
+    report("df_groupby", seconds() - start, n);
+
+    df_groupby_options_t options = df_groupby_options_default();
+    options.sort = 1;
+    start = seconds();
+    df_t *sorted = df_groupby(df, by, 1, aggs, 5, &options, NULL);
+    report("df_groupby sorted", seconds() - start, n);
+
+    const int failed = !res || !sorted;
+    df_free(sorted);
+    df_free(res);
+    df_free(df);
+    return failed;
+}
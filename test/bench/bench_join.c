@@ -0,0 +1,112 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "core/thread.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/df/core/lifecycle.h"
+#include "dtypes/df/ops/join.h"
+#include "test_utils/random.h"
+
+/*
+ * Times `df_join` of a large frame of random `int64` keys against a
+ * smaller one of unique keys, half of which match. Pass the number of
+ * left rows, of right rows and of threads to override the defaults.
+ */
+
+static const size_t LEFT_SIZE = 10000000;
+static const size_t RIGHT_SIZE = 1000000;
+
+/* Wall time, as the join runs on several threads */
+static double seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void report(const char *name, const double elapsed, const size_t n) {
+    printf("%-24s %8.3f s %8.1f ns/row\n", name, elapsed, elapsed * 1e9 / (double)n);
+}
+
+/* Frame of a key column and a `double` payload named `value` */
+static df_t *frame_create(const char *key, int64_t *keys, const size_t n) {
+    double *vals = malloc(n * sizeof(double));
+    if (!vals)
+        return NULL;
+    for (size_t i = 0; i < n; i++)
+        vals[i] = (double)(int64_t)next_random() / 4294967296.0;
+
+    col_t *cols[2] = {
+        col_create_array(key, keys, n, COL_DTYPE_INT64, NULL),
+        col_create_array("value", vals, n, COL_DTYPE_DOUBLE, NULL)
+    };
+    free(vals);
+    df_t *df = cols[0] && cols[1] ? df_from_cols(cols, 2, NULL) : NULL;
+    if (!df) {
+        col_free(cols[0]);
+        col_free(cols[1]);
+    }
+    return df;
+}
+
+int main(int argc, char **argv) {
+    const size_t n_left = argc > 1 ? strtoull(argv[1], NULL, 10) : LEFT_SIZE;
+    const size_t n_right = argc > 2 ? strtoull(argv[2], NULL, 10) : RIGHT_SIZE;
+    if (argc > 3)
+        mlc_thread_set_count(strtoull(argv[3], NULL, 10));
+
+    int64_t *lkeys = malloc(n_left * sizeof(int64_t));
+    int64_t *rkeys = malloc(n_right * sizeof(int64_t));
+    if (!lkeys || !rkeys || !n_right) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    /* unique right keys 0, 2, 4, ..., left keys over twice their range */
+    for (size_t i = 0; i < n_right; i++)
+        rkeys[i] = (int64_t)(2 * i);
+    for (size_t i = 0; i < n_right; i++) {
+        const size_t j = i + next_random() % (n_right - i);
+        const int64_t tmp = rkeys[i];
+        rkeys[i] = rkeys[j];
+        rkeys[j] = tmp;
+    }
+    for (size_t i = 0; i < n_left; i++)
+        lkeys[i] = (int64_t)(next_random() % (2 * n_right));
+
+    df_t *left = frame_create("key", lkeys, n_left);
+    df_t *right = frame_create("key", rkeys, n_right);
+    free(lkeys);
+    free(rkeys);
+    if (!left || !right) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    printf("%zu x %zu rows, %zu threads\n", n_left, n_right, mlc_thread_count());
+
+    const char *on[] = {"key"};
+    col_t *lidx = NULL;
+    col_t *ridx = NULL;
+    double start = seconds();
+    const int index_err = df_join_index(left, right, on, on, 1, NULL, &lidx, &ridx);
+    report("df_join_index", seconds() - start, n_left);
+
+    start = seconds();
+    df_t *inner = df_join(left, right, on, on, 1, NULL, NULL);
+    report("df_join inner", seconds() - start, n_left);
+
+    df_join_options_t options = df_join_options_default();
+    options.type = DF_JOIN_LEFT;
+    start = seconds();
+    df_t *outer = df_join(left, right, on, on, 1, &options, NULL);
+    report("df_join left", seconds() - start, n_left);
+
+    const int failed = index_err || !inner || !outer;
+    df_free(outer);
+    df_free(inner);
+    col_free(ridx);
+    col_free(lidx);
+    df_free(right);
+    df_free(left);
+    return failed;
+}
@@ -0,0 +1,99 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "core/number.h"
+#include "test_utils/random.h"
+
+/*
+ * Times the kernels of `core/number.h` against the C library on random
+ * values. Pass the number of values to override the default.
+ */
+
+static const size_t SIZE = 1000000;
+
+static double seconds(void) {
+    return (double)clock() / CLOCKS_PER_SEC;
+}
+
+static void report(const char *name, const double elapsed, const size_t n) {
+    printf("%-24s %8.1f ns/value\n", name, elapsed * 1e9 / (double)n);
+}
+
+int main(int argc, char **argv) {
+    const size_t n = argc > 1 ? strtoull(argv[1], NULL, 10) : SIZE;
+
+    char *text = malloc(n * MLC_NUMBER_MAX);
+    size_t *lens = malloc(n * sizeof(size_t));
+    double *vals = malloc(n * sizeof(double));
+    if (!text || !lens || !vals) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    /* doubles: uniformly random mantissas, spread over exponents */
+    for (size_t i = 0; i < n; i++) {
+        const double mantissa = (double)(next_random() >> 11) / 9007199254740992.0;
+        vals[i] = mantissa * (double)(1 << (next_random() % 30));
+    }
+
+    double sink = 0;
+    double start = seconds();
+    for (size_t i = 0; i < n; i++)
+        lens[i] = (size_t)snprintf(text + i * MLC_NUMBER_MAX, MLC_NUMBER_MAX, "%.17g", vals[i]);
+    report("snprintf %.17g", seconds() - start, n);
+
+    start = seconds();
+    for (size_t i = 0; i < n; i++)
+        lens[i] = mlc_format_double(vals[i], text + i * MLC_NUMBER_MAX);
+    report("mlc_format_double", seconds() - start, n);
+
+    start = seconds();
+    for (size_t i = 0; i < n; i++)
+        sink += strtod(text + i * MLC_NUMBER_MAX, NULL);
+    report("strtod", seconds() - start, n);
+
+    start = seconds();
+    for (size_t i = 0; i < n; i++) {
+        double val;
+        const char *str = text + i * MLC_NUMBER_MAX;
+        mlc_parse_double(str, str + lens[i], &val);
+        sink += val;
+    }
+    report("mlc_parse_double", seconds() - start, n);
+
+    /* integers of every length */
+    start = seconds();
+    for (size_t i = 0; i < n; i++) {
+        const int64_t val = (int64_t)(next_random() >> (i % 64));
+        lens[i] = (size_t)snprintf(text + i * MLC_NUMBER_MAX, MLC_NUMBER_MAX, "%lld", (long long)val);
+    }
+    report("snprintf %lld", seconds() - start, n);
+
+    start = seconds();
+    for (size_t i = 0; i < n; i++)
+        sink += (double)strtoll(text + i * MLC_NUMBER_MAX, NULL, 10);
+    report("strtoll", seconds() - start, n);
+
+    start = seconds();
+    for (size_t i = 0; i < n; i++) {
+        int64_t val;
+        const char *str = text + i * MLC_NUMBER_MAX;
+        mlc_parse_int64(str, str + lens[i], &val);
+        sink += (double)val;
+    }
+    report("mlc_parse_int64", seconds() - start, n);
+
+    start = seconds();
+    for (size_t i = 0; i < n; i++)
+        lens[i] = mlc_format_int64((int64_t)(next_random() >> (i % 64)), text + i * MLC_NUMBER_MAX);
+    report("mlc_format_int64", seconds() - start, n);
+
+    printf("checksum %g\n", sink);
+    free(text);
+    free(lens);
+    free(vals);
+    return 0;
+}
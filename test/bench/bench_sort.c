@@ -0,0 +1,61 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "core/thread.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/col/ops/sort.h"
+#include "test_utils/random.h"
+
+/*
+ * Times `col_sort` and `col_argsort` on random doubles. Pass the number of
+ * values and of threads to override the defaults.
+ */
+
+static const size_t SIZE = 10000000;
+
+/* Wall time, as the sorts run on several threads */
+static double seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void report(const char *name, const double elapsed, const size_t n) {
+    printf("%-24s %8.3f s %8.1f ns/value\n", name, elapsed, elapsed * 1e9 / (double)n);
+}
+
+int main(int argc, char **argv) {
+    const size_t n = argc > 1 ? strtoull(argv[1], NULL, 10) : SIZE;
+    if (argc > 2)
+        mlc_thread_set_count(strtoull(argv[2], NULL, 10));
+
+    double *vals = malloc(n * sizeof(double));
+    if (!vals) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    for (size_t i = 0; i < n; i++)
+        vals[i] = (double)(int64_t)next_random() / 4294967296.0;
+
+    col_t *col = col_create_array("double", vals, n, COL_DTYPE_DOUBLE, NULL);
+    free(vals);
+    if (!col) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    printf("%zu doubles, %zu threads\n", n, mlc_thread_count());
+
+    double start = seconds();
+    col_t *order = col_argsort(col, NULL, NULL);
+    report("col_argsort", seconds() - start, n);
+
+    start = seconds();
+    const int err = col_sort(col, NULL);
+    report("col_sort", seconds() - start, n);
+
+    col_free(order);
+    col_free(col);
+    return err || !order;
+}
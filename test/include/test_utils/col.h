@@ -12,6 +12,7 @@ int64_t *col_int64_data_create(const size_t n);
 int32_t *col_int32_data_create(const size_t n);
 uint8_t *col_uint8_data_create(const size_t n);
 char **col_string_data_create(const size_t n);
+char **col_category_data_create(const size_t n, const size_t n_categories);
 
 col_t *col_double_dummy_create(const char *name, const size_t n_rows);
 col_t *col_float_dummy_create(const char *name, const size_t n_rows);
@@ -19,6 +20,11 @@ col_t *col_int64_dummy_create(const char *name, const size_t n_rows);
 col_t *col_int32_dummy_create(const char *name, const size_t n_rows);
 col_t *col_uint8_dummy_create(const char *name, const size_t n_rows);
 col_t *col_string_dummy_create(const char *name, const size_t n_rows);
+col_t *col_category_dummy_create(
+    const char *name,
+    const size_t n_rows,
+    const size_t n_categories
+);
 
 #endif
 
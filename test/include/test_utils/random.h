@@ -0,0 +1,9 @@
+#ifndef RANDOM_TEST_UTILS_H
+#define RANDOM_TEST_UTILS_H
+
+#include <stdint.h>
+
+/* xorshift64 from a fixed seed, so runs are reproducible */
+uint64_t next_random(void);
+
+#endif
@@ -82,6 +82,26 @@ char **col_string_data_create(const size_t n) {
     return data;
 }
 
+char **col_category_data_create(const size_t n, const size_t n_categories) {
+    char **data = malloc(n * sizeof(char *));
+    if (!data)
+        return NULL;
+
+    for (size_t i = 0; i < n; i++) {
+        char buf[32];
+        sprintf(buf, "Category %zu", (i * 7) % n_categories);
+        data[i] = strdup(buf);
+        if (!data[i]) {
+            for (size_t j = 0; j < i; j++)
+                free(data[j]);
+            free(data);
+            return NULL;
+        }
+    }
+
+    return data;
+}
+
 col_t *col_double_dummy_create(const char *name, const size_t n_rows) {
     double *data = col_double_data_create(n_rows);
     struct col *col = col_create_array(
@@ -172,3 +192,28 @@ col_t *col_string_dummy_create(const char *name, const size_t n_rows) {
 
     return col;
 }
+
+col_t *col_category_dummy_create(
+    const char *name,
+    const size_t n_rows,
+    const size_t n_categories
+) {
+    char **data = col_category_data_create(n_rows, n_categories);
+    struct col *col = col_create_array(
+        name, 
+        data, 
+        n_rows, 
+        COL_DTYPE_CATEGORY, 
+        NULL
+    );
+
+    if (data) {
+        for (size_t i = 0; i < n_rows; i++) {
+            if (data[i])
+                free(data[i]);
+        }
+        free(data);
+    }
+
+    return col;
+}
@@ -0,0 +1,11 @@
+#include <stdint.h>
+
+#include "test_utils/random.h"
+
+uint64_t next_random(void) {
+    static uint64_t state = 0x9E3779B97F4A7C15ULL;
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
@@ -0,0 +1,127 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/alloc.h"
+
+void test_mlc_allocator_default();
+void test_mlc_allocator_global();
+void test_mlc_realloc_fallback();
+
+/* Counts live allocations and refuses to exceed a byte budget */
+typedef struct counter {
+    size_t n_live;
+    size_t n_bytes;
+    size_t max_bytes;
+} counter_t;
+
+static void *counter_alloc(void *ctx, size_t size, size_t align);
+static void counter_free(void *ctx, void *ptr);
+
+int main() {
+    test_mlc_allocator_default();
+    test_mlc_allocator_global();
+    test_mlc_realloc_fallback();
+}
+
+void test_mlc_allocator_default() {
+    const mlc_allocator_t *libc = mlc_allocator_default();
+    assert(libc->alloc && libc->realloc && libc->free);
+
+    /* alignment */
+    for (size_t align = 1; align <= 256; align *= 2) {
+        void *ptr = mlc_alloc(libc, 3, align);
+        assert(ptr != NULL);
+        assert((uintptr_t)ptr % align == 0);
+        mlc_free(libc, ptr);
+    }
+    assert(mlc_alloc(libc, 0, 1) == NULL);
+
+    /* realloc keeps contents and alignment */
+    char *ptr = mlc_alloc(libc, 100, 64);
+    memset(ptr, 'x', 100);
+    ptr = mlc_realloc(libc, ptr, 100, 5000, 64);
+    assert(ptr != NULL);
+    assert((uintptr_t)ptr % 64 == 0);
+    for (size_t i = 0; i < 100; i++)
+        assert(ptr[i] == 'x');
+    assert(mlc_realloc(libc, ptr, 5000, 0, 64) == NULL);
+
+    /* calloc */
+    uint32_t *zeroed = mlc_calloc(libc, 10, sizeof(uint32_t));
+    for (size_t i = 0; i < 10; i++)
+        assert(zeroed[i] == 0);
+    mlc_free(libc, zeroed);
+    assert(mlc_calloc(libc, SIZE_MAX, 2) == NULL);
+
+    /* strdup */
+    char *str = mlc_strdup(libc, "hello");
+    assert(strcmp(str, "hello") == 0);
+    mlc_free(libc, str);
+    mlc_free(libc, NULL);
+}
+
+void test_mlc_allocator_global() {
+    assert(mlc_allocator_global()->alloc == mlc_allocator_default()->alloc);
+
+    counter_t counter = { 0, 0, 0 };
+    const mlc_allocator_t custom = { counter_alloc, NULL, counter_free, &counter };
+    mlc_allocator_set_global(&custom);
+    assert(mlc_allocator_global()->ctx == &counter);
+
+    void *ptr = mlc_alloc(mlc_allocator_global(), 16, 8);
+    assert(counter.n_live == 1);
+    mlc_free(mlc_allocator_global(), ptr);
+    assert(counter.n_live == 0);
+
+    /* an allocator without `alloc` is rejected */
+    const mlc_allocator_t broken = { NULL, NULL, NULL, NULL };
+    mlc_allocator_set_global(&broken);
+    assert(mlc_allocator_global()->ctx == &counter);
+
+    mlc_allocator_set_global(NULL);
+    assert(mlc_allocator_global()->alloc == mlc_allocator_default()->alloc);
+}
+
+void test_mlc_realloc_fallback() {
+    counter_t counter = { 0, 0, 64 };
+    const mlc_allocator_t custom = { counter_alloc, NULL, counter_free, &counter };
+
+    char *ptr = mlc_realloc(&custom, NULL, 0, 8, 8);
+    assert(ptr != NULL);
+    memcpy(ptr, "abcdefg", 8);
+
+    /* alloc, copy and free */
+    ptr = mlc_realloc(&custom, ptr, 8, 32, 8);
+    assert(ptr != NULL);
+    assert(strcmp(ptr, "abcdefg") == 0);
+    assert(counter.n_live == 1);
+
+    /* over budget, the old memory survives */
+    assert(mlc_realloc(&custom, ptr, 32, 128, 8) == NULL);
+    assert(strcmp(ptr, "abcdefg") == 0);
+
+    mlc_free(&custom, ptr);
+    assert(counter.n_live == 0);
+}
+
+static void *counter_alloc(void *ctx, size_t size, size_t align) {
+    counter_t *counter = ctx;
+    (void)align;
+    if (counter->max_bytes && size > counter->max_bytes)
+        return NULL;
+
+    void *ptr = malloc(size);
+    if (ptr) {
+        counter->n_live++;
+        counter->n_bytes += size;
+    }
+    return ptr;
+}
+
+static void counter_free(void *ctx, void *ptr) {
+    counter_t *counter = ctx;
+    counter->n_live--;
+    free(ptr);
+}
@@ -0,0 +1,115 @@
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "core/alloc.h"
+#include "core/arena.h"
+
+void test_mlc_arena_alloc();
+void test_mlc_arena_realloc();
+void test_mlc_arena_reset();
+void test_mlc_arena_limit();
+
+int main() {
+    test_mlc_arena_alloc();
+    test_mlc_arena_realloc();
+    test_mlc_arena_reset();
+    test_mlc_arena_limit();
+}
+
+void test_mlc_arena_alloc() {
+    mlc_arena_t *arena = mlc_arena_create(1024, 0);
+    const mlc_allocator_t allocator = mlc_arena_allocator(arena);
+    assert(allocator.free == NULL);
+    assert(mlc_arena_bytes(arena) == 0);
+
+    /* alignment, and allocations never overlap */
+    char *prev = NULL;
+    for (size_t i = 0; i < 100; i++) {
+        const size_t align = (size_t)1 << (i % 7);
+        char *ptr = mlc_alloc(&allocator, 1 + i % 13, align);
+        assert(ptr != NULL);
+        assert((uintptr_t)ptr % align == 0);
+        memset(ptr, (int)i, 1 + i % 13);
+        if (prev)
+            assert(prev[0] == (char)(i - 1));
+        prev = ptr;
+    }
+    assert(mlc_arena_bytes(arena) > 0);
+
+    /* oversized allocations get a block of their own */
+    char *big = mlc_alloc(&allocator, 10000, 64);
+    assert(big != NULL);
+    assert((uintptr_t)big % 64 == 0);
+    memset(big, 1, 10000);
+    char *small = mlc_alloc(&allocator, 8, 8);
+    assert(small != NULL);
+    assert(small < big || small >= big + 10000);
+
+    mlc_free(&allocator, small);
+    mlc_arena_free(arena);
+    mlc_arena_free(NULL);
+}
+
+void test_mlc_arena_realloc() {
+    mlc_arena_t *arena = mlc_arena_create(1024, 0);
+    const mlc_allocator_t allocator = mlc_arena_allocator(arena);
+
+    /* the latest allocation grows in place */
+    char *ptr = mlc_alloc(&allocator, 16, 8);
+    memcpy(ptr, "arena", 6);
+    char *grown = mlc_realloc(&allocator, ptr, 16, 64, 8);
+    assert(grown == ptr);
+
+    /* anything else moves */
+    char *other = mlc_alloc(&allocator, 16, 8);
+    assert(other != NULL);
+    char *moved = mlc_realloc(&allocator, grown, 64, 128, 8);
+    assert(moved != grown);
+    assert(strcmp(moved, "arena") == 0);
+
+    /* growing past the block moves too */
+    char *huge = mlc_realloc(&allocator, moved, 128, 4096, 64);
+    assert(huge != NULL);
+    assert((uintptr_t)huge % 64 == 0);
+    assert(strcmp(huge, "arena") == 0);
+
+    mlc_arena_free(arena);
+}
+
+void test_mlc_arena_reset() {
+    mlc_arena_t *arena = mlc_arena_create(1024, 0);
+    const mlc_allocator_t allocator = mlc_arena_allocator(arena);
+
+    void *first = mlc_alloc(&allocator, 8, 8);
+    for (size_t i = 0; i < 1000; i++)
+        assert(mlc_alloc(&allocator, 100, 8) != NULL);
+    const size_t n_bytes = mlc_arena_bytes(arena);
+    assert(n_bytes > 100 * 1000);
+
+    /* everything is released, the first block is reused */
+    mlc_arena_reset(arena);
+    assert(mlc_arena_bytes(arena) < n_bytes);
+    assert(mlc_arena_bytes(arena) > 0);
+    assert(mlc_alloc(&allocator, 8, 8) == first);
+
+    mlc_arena_free(arena);
+}
+
+void test_mlc_arena_limit() {
+    mlc_arena_t *arena = mlc_arena_create(1024, 4096);
+    const mlc_allocator_t allocator = mlc_arena_allocator(arena);
+
+    size_t n = 0;
+    while (mlc_alloc(&allocator, 100, 8))
+        n++;
+    assert(n > 0);
+    assert(mlc_arena_bytes(arena) <= 4096);
+    assert(mlc_alloc(&allocator, 5000, 8) == NULL);
+
+    /* a reset makes room again */
+    mlc_arena_reset(arena);
+    assert(mlc_alloc(&allocator, 100, 8) != NULL);
+
+    mlc_arena_free(arena);
+}
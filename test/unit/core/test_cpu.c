@@ -0,0 +1,33 @@
+#include <assert.h>
+
+#include "core/cpu.h"
+
+void test_mlc_cpu_isa();
+void test_mlc_cpu_isa_limit();
+
+int main() {
+    test_mlc_cpu_isa();
+    test_mlc_cpu_isa_limit();
+}
+
+void test_mlc_cpu_isa() {
+    /* valid */
+    const mlc_isa_t host = mlc_cpu_isa_detect();
+    assert(host < MLC_ISA_COUNT);
+    assert(mlc_cpu_isa_detect() == host);
+    assert(mlc_cpu_isa() == host);
+}
+
+void test_mlc_cpu_isa_limit() {
+    /* valid */
+    const mlc_isa_t host = mlc_cpu_isa_detect();
+    mlc_cpu_isa_limit(MLC_ISA_SCALAR);
+    assert(mlc_cpu_isa() == MLC_ISA_SCALAR);
+
+    /* a cap above the host never enables unsupported code paths */
+    mlc_cpu_isa_limit(MLC_ISA_AVX512);
+    assert(mlc_cpu_isa() == host);
+
+    mlc_cpu_isa_limit(MLC_ISA_COUNT);
+    assert(mlc_cpu_isa() == host);
+}
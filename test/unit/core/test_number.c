@@ -0,0 +1,276 @@
+#include <assert.h>
+#include <float.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/number.h"
+#include "test_utils/random.h"
+
+void test_mlc_parse_double();
+void test_mlc_parse_float();
+void test_mlc_parse_int64();
+void test_mlc_format_double();
+void test_mlc_format_float();
+void test_mlc_format_int64();
+
+static const size_t SIZE = 99999;
+
+static int same_double(const double a, const double b) {
+    return memcmp(&a, &b, sizeof(a)) == 0;
+}
+
+static int same_float(const float a, const float b) {
+    return memcmp(&a, &b, sizeof(a)) == 0;
+}
+
+/* Parses a whole NUL-terminated string, comparing with the C library */
+static void check_double(const char *str) {
+    double val = 0;
+    const char *end = str + strlen(str);
+    assert(mlc_parse_double(str, end, &val) == end);
+    assert(same_double(val, strtod(str, NULL)));
+}
+
+static void check_float(const char *str) {
+    float val = 0;
+    const char *end = str + strlen(str);
+    assert(mlc_parse_float(str, end, &val) == end);
+    assert(same_float(val, strtof(str, NULL)));
+}
+
+/* Digits needed by `%.*g` to round trip, the shortest libc can do */
+static size_t shortest_digits(const double val, const int max_digits) {
+    char buf[512];
+    for (int n = 1; n < max_digits; n++) {
+        snprintf(buf, sizeof(buf), "%.*g", n, val);
+        if (strtod(buf, NULL) == val)
+            return (size_t)n;
+    }
+    return (size_t)max_digits;
+}
+
+/* Significant digits of a formatted number */
+static size_t count_digits(const char *str) {
+    size_t n = 0;
+    size_t zeros = 0;
+    while (*str == '-' || *str == '0' || *str == '.')
+        str++;
+    for (; *str && *str != 'e'; str++) {
+        if (*str == '.')
+            continue;
+        zeros = *str == '0' ? zeros + 1 : 0;
+        n++;
+    }
+    return n - zeros;
+}
+
+int main() {
+    test_mlc_parse_double();
+    test_mlc_parse_float();
+    test_mlc_parse_int64();
+    test_mlc_format_double();
+    test_mlc_format_float();
+    test_mlc_format_int64();
+}
+
+void test_mlc_parse_double() {
+    static const char *cases[] = {
+        "0", "-0", "1", "+1", "0.1", ".5", "5.", "3.14159", "1e10", "1E-10",
+        "123456789012345678", "9007199254740993", "1.7976931348623157e308",
+        "1.7976931348623159e308", "2.2250738585072014e-308",
+        "2.2250738585072011e-308", "4.9406564584124654e-324", "2e-324",
+        "3e-324", "1e-400", "1e400", "0.000000000000000000000000000001",
+        "7.038531e-26", "9007199254740992.000000000000000000000001",
+        "2.4703282292062327208828439643411068618252990130716238221279284"
+        "125033775363510437593264991818081799618989828234772285886546332"
+        "8355e-324",
+        "1448997445238699", "8.98846567431158e307",
+        "00000000000000000000000000000000000000001.5",
+        "0.0000000000000000000000000000000000000000012345678901234567890123"
+    };
+
+    /* valid: matches strtod bit for bit */
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+        check_double(cases[i]);
+
+    for (size_t i = 0; i < SIZE; i++) {
+        char buf[64];
+        double val;
+        const uint64_t bits = next_random();
+        memcpy(&val, &bits, sizeof(val));
+        if (!isfinite(val))
+            continue;
+        snprintf(buf, sizeof(buf), "%.*g", (int)(i % 20) + 1, val);
+        check_double(buf);
+    }
+
+    /* valid: special values */
+    double val = 0;
+    const char *str = "-Infinity";
+    assert(mlc_parse_double(str, str + 9, &val) == str + 9);
+    assert(val == -HUGE_VAL);
+    str = "nan";
+    assert(mlc_parse_double(str, str + 3, &val) == str + 3);
+    assert(isnan(val));
+
+    /* valid: stops at the first character that is not part of the number */
+    str = "12.5e3,7";
+    assert(mlc_parse_double(str, str + 8, &val) == str + 6);
+    assert(val == 12500.0);
+    str = "2e";
+    assert(mlc_parse_double(str, str + 2, &val) == str + 1);
+    assert(val == 2.0);
+
+    /* valid: never reads past `end` */
+    str = "1234";
+    assert(mlc_parse_double(str, str + 2, &val) == str + 2);
+    assert(val == 12.0);
+
+    /* invalid: no number */
+    val = 7;
+    str = "-.e1";
+    assert(mlc_parse_double(str, str + 4, &val) == NULL);
+    assert(mlc_parse_double(str, str, &val) == NULL);
+    assert(val == 7);
+}
+
+void test_mlc_parse_float() {
+    static const char *cases[] = {
+        "0", "0.1", "3.4028235e38", "3.4028236e38", "1e39", "1.17549435e-38",
+        "1.4e-45", "7e-46", "1e-50", "16777217", "0.30000001192092896",
+        "1.00000005960464477539062499999"
+    };
+
+    /* valid: matches strtof bit for bit */
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+        check_float(cases[i]);
+
+    for (size_t i = 0; i < SIZE; i++) {
+        char buf[64];
+        float val;
+        const uint32_t bits = (uint32_t)next_random();
+        memcpy(&val, &bits, sizeof(val));
+        if (!isfinite(val))
+            continue;
+        snprintf(buf, sizeof(buf), "%.*g", (int)(i % 12) + 1, val);
+        check_float(buf);
+    }
+}
+
+void test_mlc_parse_int64() {
+    int64_t val = 0;
+
+    /* valid */
+    const char *str = "-9223372036854775808";
+    assert(mlc_parse_int64(str, str + 20, &val) == str + 20);
+    assert(val == INT64_MIN);
+    str = "9223372036854775807";
+    assert(mlc_parse_int64(str, str + 19, &val) == str + 19);
+    assert(val == INT64_MAX);
+    str = "+000000000000000000000042x";
+    assert(mlc_parse_int64(str, str + 26, &val) == str + 25);
+    assert(val == 42);
+
+    for (size_t i = 0; i < SIZE; i++) {
+        char buf[32];
+        const int64_t expected = (int64_t)(next_random() >> (i % 64));
+        const int len = snprintf(buf, sizeof(buf), "%lld", (long long)expected);
+        assert(mlc_parse_int64(buf, buf + len, &val) == buf + len);
+        assert(val == expected);
+    }
+
+    /* invalid: overflow or no digits, leaving `out` untouched */
+    val = 7;
+    str = "9223372036854775808";
+    assert(mlc_parse_int64(str, str + 19, &val) == NULL);
+    str = "-9223372036854775809";
+    assert(mlc_parse_int64(str, str + 20, &val) == NULL);
+    str = "99999999999999999999";
+    assert(mlc_parse_int64(str, str + 20, &val) == NULL);
+    str = "-x";
+    assert(mlc_parse_int64(str, str + 2, &val) == NULL);
+    assert(val == 7);
+}
+
+void test_mlc_format_double() {
+    char buf[MLC_NUMBER_MAX];
+    static const struct {
+        double val;
+        const char *str;
+    } cases[] = {
+        {0.0, "0"}, {-0.0, "-0"}, {1.0, "1"}, {-42.0, "-42"}, {0.1, "0.1"},
+        {0.1 + 0.2, "0.30000000000000004"}, {1.5e-5, "0.000015"}, {1e-6, "1e-6"},
+        {1e-4, "0.0001"}, {123456.75, "123456.75"},
+        {1e16, "10000000000000000"}, {1e17, "1e+17"}, {1e21, "1e+21"},
+        {DBL_MAX, "1.7976931348623157e+308"}, {DBL_MIN, "2.2250738585072014e-308"},
+        {5e-324, "5e-324"}, {HUGE_VAL, "inf"}, {-HUGE_VAL, "-inf"}
+    };
+
+    /* valid: known outputs */
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        const size_t len = mlc_format_double(cases[i].val, buf);
+        assert(strcmp(buf, cases[i].str) == 0);
+        assert(len == strlen(buf));
+    }
+    mlc_format_double(NAN, buf);
+    assert(strcmp(buf, "nan") == 0);
+
+    /* valid: round trips with no more digits than `%.17g` needs */
+    for (size_t i = 0; i < SIZE; i++) {
+        double val;
+        const uint64_t bits = next_random();
+        memcpy(&val, &bits, sizeof(val));
+        if (!isfinite(val))
+            continue;
+
+        const size_t len = mlc_format_double(val, buf);
+        assert(len < MLC_NUMBER_MAX);
+        assert(same_double(strtod(buf, NULL), val));
+        assert(count_digits(buf) <= shortest_digits(val, 17));
+    }
+}
+
+void test_mlc_format_float() {
+    char buf[MLC_NUMBER_MAX];
+
+    /* valid */
+    mlc_format_float(0.1f, buf);
+    assert(strcmp(buf, "0.1") == 0);
+    mlc_format_float(FLT_MAX, buf);
+    assert(strcmp(buf, "3.4028235e+38") == 0);
+    mlc_format_float(1.4e-45f, buf);
+    assert(strcmp(buf, "1e-45") == 0);
+
+    for (size_t i = 0; i < SIZE; i++) {
+        float val;
+        const uint32_t bits = (uint32_t)next_random();
+        memcpy(&val, &bits, sizeof(val));
+        if (!isfinite(val))
+            continue;
+
+        mlc_format_float(val, buf);
+        assert(same_float(strtof(buf, NULL), val));
+        assert(count_digits(buf) <= 9);
+    }
+}
+
+void test_mlc_format_int64() {
+    char buf[MLC_NUMBER_MAX];
+    char expected[MLC_NUMBER_MAX];
+
+    /* valid */
+    assert(mlc_format_int64(0, buf) == 1);
+    assert(strcmp(buf, "0") == 0);
+    mlc_format_int64(INT64_MIN, buf);
+    assert(strcmp(buf, "-9223372036854775808") == 0);
+
+    for (size_t i = 0; i < SIZE; i++) {
+        const int64_t val = (int64_t)(next_random() >> (i % 64));
+        snprintf(expected, sizeof(expected), "%lld", (long long)val);
+        assert(mlc_format_int64(val, buf) == strlen(expected));
+        assert(strcmp(buf, expected) == 0);
+    }
+}
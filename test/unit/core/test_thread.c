@@ -0,0 +1,53 @@
+#include <assert.h>
+#include <stddef.h>
+
+#include "core/thread.h"
+
+void test_mlc_thread_count();
+void test_mlc_parallel_for();
+
+static const size_t SIZE = 999;
+
+int main() {
+    test_mlc_thread_count();
+    test_mlc_parallel_for();
+}
+
+void test_mlc_thread_count() {
+    /* valid */
+    const size_t host = mlc_thread_count();
+    assert(host >= 1);
+
+    mlc_thread_set_count(3);
+    assert(mlc_thread_count() == 3);
+
+    mlc_thread_set_count(0);
+    assert(mlc_thread_count() == host);
+}
+
+static void square(void *ctx, size_t task) {
+    size_t *out = ctx;
+    out[task] = task * task;
+}
+
+void test_mlc_parallel_for() {
+    size_t out[999];
+
+    /* valid: every task runs exactly once, whatever the thread count */
+    for (size_t n_threads = 0; n_threads <= 8; n_threads++) {
+        for (size_t i = 0; i < SIZE; i++)
+            out[i] = 0;
+
+        mlc_parallel_for(SIZE, n_threads, square, out);
+        for (size_t i = 0; i < SIZE; i++)
+            assert(out[i] == i * i);
+    }
+
+    /* valid: more threads than tasks */
+    out[0] = 1;
+    mlc_parallel_for(1, 64, square, out);
+    assert(out[0] == 0);
+
+    /* valid: no tasks */
+    mlc_parallel_for(0, 4, square, out);
+}
@@ -10,6 +10,7 @@
 
 void test_col_at();
 void test_col_get();
+void test_col_at_unchecked();
 
 static const size_t SIZE = 999;
 static const size_t S_IDX = 0;
@@ -19,6 +20,7 @@ static const size_t E_IDX = SIZE - 1;
 int main() {
     test_col_at();
     test_col_get();
+    test_col_at_unchecked();
 }
 
 void test_col_at() {
@@ -174,10 +176,12 @@ void test_col_get() {
 
     char **string_data = col_string_data_create(SIZE);
     struct col *col_string = col_string_dummy_create("string", SIZE);
-    const char **col_string_data = col_string_get(col_string, &err);
+    const size_t *col_string_offsets = col_string_offsets_get(col_string, &err);
+    assert(err == COL_ERR_OK);
+    const char *col_string_bytes = col_string_bytes_get(col_string, &err);
     assert(err == COL_ERR_OK);
     for (size_t i = 0; i < SIZE; i++)
-        assert(strcmp(col_string_data[i], string_data[i]) == 0);
+        assert(strcmp(col_string_bytes + col_string_offsets[i], string_data[i]) == 0);
     col_free(col_string);
     for (size_t i = 0; i < SIZE; i++)
         free(string_data[i]);
@@ -189,5 +193,35 @@ void test_col_get() {
     assert(col_float_get(col_valid, &err) == NULL);
     assert(err == COL_ERR_INVALID_DTYPE);
 
+    assert(col_string_offsets_get(col_valid, &err) == NULL);
+    assert(err == COL_ERR_INVALID_DTYPE);
+
+    assert(col_string_bytes_get(col_valid, &err) == NULL);
+    assert(err == COL_ERR_INVALID_DTYPE);
+
     col_free(col_valid);
 }
+
+void test_col_at_unchecked() {
+    /* valid: agrees with the checked accessors */
+    struct col *col_double = col_double_dummy_create("double", SIZE);
+    struct col *col_float = col_float_dummy_create("float", SIZE);
+    struct col *col_int64 = col_int64_dummy_create("int64", SIZE);
+    struct col *col_int32 = col_int32_dummy_create("int32", SIZE);
+    struct col *col_uint8 = col_uint8_dummy_create("uint8", SIZE);
+    struct col *col_string = col_string_dummy_create("string", SIZE);
+    for (size_t i = 0; i < SIZE; i++) {
+        assert(col_double_at_unchecked(col_double, i) == *col_double_at(col_double, i, NULL));
+        assert(col_float_at_unchecked(col_float, i) == *col_float_at(col_float, i, NULL));
+        assert(col_int64_at_unchecked(col_int64, i) == *col_int64_at(col_int64, i, NULL));
+        assert(col_int32_at_unchecked(col_int32, i) == *col_int32_at(col_int32, i, NULL));
+        assert(col_uint8_at_unchecked(col_uint8, i) == *col_uint8_at(col_uint8, i, NULL));
+        assert(col_string_at_unchecked(col_string, i) == col_string_at(col_string, i, NULL));
+    }
+    col_free(col_double);
+    col_free(col_float);
+    col_free(col_int64);
+    col_free(col_int32);
+    col_free(col_uint8);
+    col_free(col_string);
+}
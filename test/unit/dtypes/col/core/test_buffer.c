@@ -0,0 +1,160 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "core/alloc.h"
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/buffer.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/col/core/modifiers.h"
+#include "dtypes/col/ops/cast.h"
+#include "test_utils/col.h"
+
+void test_col_data_bytes();
+void test_col_data_alloc();
+void test_col_data_realloc();
+void test_col_data_lifecycle();
+
+static int col_aligned(const col_t *col);
+
+static const size_t SIZE = 999;
+
+int main() {
+    test_col_data_bytes();
+    test_col_data_alloc();
+    test_col_data_realloc();
+    test_col_data_lifecycle();
+}
+
+void test_col_data_bytes() {
+    assert(col_data_bytes(0, sizeof(double)) == 0);
+    assert(col_data_bytes(1, sizeof(uint8_t)) == COL_DATA_ALIGN);
+    assert(col_data_bytes(8, sizeof(double)) == COL_DATA_ALIGN);
+    assert(col_data_bytes(9, sizeof(double)) == 2 * COL_DATA_ALIGN);
+    assert(col_data_bytes(SIZE, sizeof(float)) % COL_DATA_ALIGN == 0);
+    assert(col_data_bytes(SIZE, sizeof(float)) >= SIZE * sizeof(float));
+
+    /* overflow */
+    assert(col_data_bytes(SIZE_MAX, sizeof(double)) == 0);
+    assert(col_data_bytes(SIZE_MAX, sizeof(uint8_t)) == 0);
+}
+
+void test_col_data_alloc() {
+    const mlc_allocator_t *libc = mlc_allocator_default();
+
+    assert(col_data_alloc(libc, 0, sizeof(double)) == NULL);
+    assert(col_data_alloc(libc, SIZE_MAX, sizeof(double)) == NULL);
+
+    for (size_t n = 1; n < 3 * COL_DATA_ALIGN; n++) {
+        uint8_t *data = col_data_alloc(libc, n, sizeof(uint8_t));
+        assert(data != NULL);
+        assert((uintptr_t)data % COL_DATA_ALIGN == 0);
+
+        /* rows and padding are addressable, the padding is zeroed */
+        memset(data, 0xAB, n);
+        for (size_t i = n; i < col_data_bytes(n, sizeof(uint8_t)); i++)
+            assert(data[i] == 0);
+        col_data_free(libc, data);
+    }
+
+    col_data_free(libc, NULL);
+}
+
+void test_col_data_realloc() {
+    const mlc_allocator_t *libc = mlc_allocator_default();
+
+    double *data = col_data_alloc(libc, SIZE, sizeof(double));
+    for (size_t i = 0; i < SIZE; i++)
+        data[i] = (double)i;
+
+    /* grow */
+    double *grown = col_data_realloc(
+        libc,
+        data,
+        SIZE * sizeof(double),
+        SIZE * 2,
+        sizeof(double)
+    );
+    assert(grown != NULL);
+    assert((uintptr_t)grown % COL_DATA_ALIGN == 0);
+    for (size_t i = 0; i < SIZE; i++)
+        assert(grown[i] == (double)i);
+
+    /* shrink */
+    double *shrunk = col_data_realloc(
+        libc,
+        grown,
+        3 * sizeof(double),
+        3,
+        sizeof(double)
+    );
+    assert(shrunk != NULL);
+    assert((uintptr_t)shrunk % COL_DATA_ALIGN == 0);
+    assert(shrunk[0] == 0.0 && shrunk[1] == 1.0 && shrunk[2] == 2.0);
+
+    /* a failure leaves the old buffer in place */
+    assert(col_data_realloc(libc, shrunk, 0, SIZE_MAX, sizeof(double)) == NULL);
+    assert(shrunk[2] == 2.0);
+    col_data_free(libc, shrunk);
+
+    /* from NULL */
+    double *fresh = col_data_realloc(libc, NULL, 0, SIZE, sizeof(double));
+    assert(fresh != NULL);
+    assert((uintptr_t)fresh % COL_DATA_ALIGN == 0);
+    col_data_free(libc, fresh);
+}
+
+void test_col_data_lifecycle() {
+    /* create */
+    struct col *col = col_create_with_capacity("col", 3, COL_DTYPE_DOUBLE, NULL);
+    assert(col_aligned(col));
+    struct col *col_array = col_double_dummy_create("array", SIZE);
+    assert(col_aligned(col_array));
+
+    /* append growth */
+    for (size_t i = 0; i < SIZE; i++) {
+        assert(col_append(col, &(double){ (double)i }) == COL_ERR_OK);
+        assert(col_aligned(col));
+    }
+
+    /* remove */
+    for (size_t i = 0; i < SIZE / 2; i++)
+        assert(col_remove(col, 0) == COL_ERR_OK);
+    assert(col_aligned(col));
+    assert(((double *)col->data)[0] == (double)(SIZE / 2));
+
+    /* reserve and shrink */
+    assert(col_reserve(col, SIZE * 4) == COL_ERR_OK);
+    assert(col_aligned(col));
+    assert(col_shrink_to_fit(col) == COL_ERR_OK);
+    assert(col_aligned(col));
+    assert(((double *)col->data)[col->n_rows - 1] == (double)(SIZE - 1));
+
+    /* clone */
+    struct col *clone = col_clone(col, NULL);
+    assert(col_aligned(clone));
+    col_free(clone);
+
+    /* in place cast */
+    assert(col_cast_inplace(col_array, COL_DTYPE_FLOAT) == COL_ERR_OK);
+    assert(col_aligned(col_array));
+
+    /* category code widening */
+    struct col *col_category = col_create("category", COL_DTYPE_CATEGORY, NULL);
+    char buf[32];
+    for (size_t i = 0; i < 300; i++) {
+        snprintf(buf, sizeof(buf), "c%zu", i);
+        assert(col_category_append(col_category, buf) == COL_ERR_OK);
+        assert(col_aligned(col_category));
+    }
+    assert(col_category->stride == sizeof(uint16_t));
+
+    col_free(col_category);
+    col_free(col_array);
+    col_free(col);
+}
+
+static int col_aligned(const col_t *col) {
+    return (uintptr_t)col->data % COL_DATA_ALIGN == 0;
+}
@@ -0,0 +1,209 @@
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/accessors.h"
+#include "dtypes/col/core/category.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/col/core/modifiers.h"
+#include "test_utils/col.h"
+
+void test_col_category_from_string();
+void test_col_category_to_string();
+void test_col_category_code_of();
+void test_col_category_widen();
+void test_col_category_modifiers();
+
+static const size_t SIZE = 999;
+
+int main() {
+    test_col_category_from_string();
+    test_col_category_to_string();
+    test_col_category_code_of();
+    test_col_category_widen();
+    test_col_category_modifiers();
+}
+
+void test_col_category_from_string() {
+    int err;
+
+    /* valid */
+    char **category_data = col_category_data_create(SIZE, 10);
+    struct col *col_string = col_create_array(
+        "string",
+        category_data,
+        SIZE,
+        COL_DTYPE_STRING,
+        NULL
+    );
+    struct col *col_category = col_category_from_string(col_string, &err);
+    assert(err == COL_ERR_OK);
+    assert(strcmp(col_category->name, "string") == 0);
+    assert(col_category->dtype == COL_DTYPE_CATEGORY);
+    assert(col_category->n_rows == SIZE);
+    assert(col_category->stride == sizeof(uint8_t));
+
+    const col_t *dict = col_category_dict_get(col_category, &err);
+    assert(err == COL_ERR_OK);
+    assert(dict->n_rows == 10);
+
+    const uint8_t *codes = col_category_codes_get(col_category, &err);
+    assert(err == COL_ERR_OK);
+    for (size_t i = 0; i < SIZE; i++) {
+        assert(strcmp(col_category_at(col_category, i, NULL), category_data[i]) == 0);
+        assert(strcmp(col_string_at(dict, codes[i], NULL), category_data[i]) == 0);
+    }
+
+    /* first appearance order */
+    assert(col_category_code_at(col_category, 0, NULL) == 0);
+    assert(col_category_code_at(col_category, 1, NULL) == 1);
+
+    col_free(col_category);
+    col_free(col_string);
+    for (size_t i = 0; i < SIZE; i++)
+        free(category_data[i]);
+    free(category_data);
+
+    /* err */
+    struct col *col_valid = col_double_dummy_create("valid", SIZE);
+    assert(col_category_from_string(col_valid, &err) == NULL);
+    assert(err == COL_ERR_INVALID_DTYPE);
+    assert(col_category_from_string(NULL, &err) == NULL);
+    assert(err == COL_ERR_NO_DATA);
+    col_free(col_valid);
+}
+
+void test_col_category_to_string() {
+    int err;
+
+    /* valid */
+    char **category_data = col_category_data_create(SIZE, 10);
+    struct col *col_category = col_category_dummy_create("category", SIZE, 10);
+    struct col *col_string = col_category_to_string(col_category, &err);
+    assert(err == COL_ERR_OK);
+    assert(strcmp(col_string->name, "category") == 0);
+    assert(col_string->dtype == COL_DTYPE_STRING);
+    assert(col_string->n_rows == SIZE);
+    for (size_t i = 0; i < SIZE; i++)
+        assert(strcmp(col_string_at(col_string, i, NULL), category_data[i]) == 0);
+    col_free(col_string);
+    col_free(col_category);
+    for (size_t i = 0; i < SIZE; i++)
+        free(category_data[i]);
+    free(category_data);
+
+    struct col *col_empty = col_create("empty", COL_DTYPE_CATEGORY, NULL);
+    struct col *col_empty_string = col_category_to_string(col_empty, &err);
+    assert(err == COL_ERR_OK);
+    assert(col_empty_string->n_rows == 0);
+    col_free(col_empty_string);
+    col_free(col_empty);
+
+    /* err */
+    struct col *col_valid = col_string_dummy_create("valid", SIZE);
+    assert(col_category_to_string(col_valid, &err) == NULL);
+    assert(err == COL_ERR_INVALID_DTYPE);
+    assert(col_category_at(col_valid, 0, &err) == NULL);
+    assert(err == COL_ERR_INVALID_DTYPE);
+    col_free(col_valid);
+}
+
+void test_col_category_code_of() {
+    int err;
+    struct col *col = col_category_dummy_create("category", SIZE, 10);
+
+    /* valid */
+    const int32_t code = col_category_code_of(col, "Category 7", &err);
+    assert(err == COL_ERR_OK);
+    assert(code == col_category_code_at(col, 1, NULL));
+
+    /* err */
+    assert(col_category_code_of(col, "missing", &err) == -1);
+    assert(err == COL_ERR_NOT_FOUND);
+    assert(col_category_dict_get(col, NULL)->n_rows == 10);
+    assert(col_category_code_at(col, SIZE, &err) == -1);
+    assert(err == COL_ERR_OUT_OF_BOUNDS);
+    col_free(col);
+}
+
+void test_col_category_widen() {
+    struct col *col = col_create("category", COL_DTYPE_CATEGORY, NULL);
+    char buf[32];
+
+    for (size_t i = 0; i < 70000; i++) {
+        sprintf(buf, "%zu", i);
+        assert(col_category_append(col, buf) == COL_ERR_OK);
+        if (i == 255)
+            assert(col->stride == sizeof(uint8_t));
+        if (i == 256)
+            assert(col->stride == sizeof(uint16_t));
+    }
+    assert(col->stride == sizeof(int32_t));
+
+    for (size_t i = 0; i < 70000; i++) {
+        sprintf(buf, "%zu", i);
+        assert(col_category_code_at(col, i, NULL) == (int32_t)i);
+        assert(strcmp(col_category_at(col, i, NULL), buf) == 0);
+    }
+    col_free(col);
+}
+
+void test_col_category_modifiers() {
+    /* valid */
+    struct col *col = col_category_dummy_create("category", SIZE, 10);
+    assert(col_category_set(col, "foo", 0) == COL_ERR_OK);
+    assert(strcmp(col_category_at(col, 0, NULL), "foo") == 0);
+    assert(col_category_dict_get(col, NULL)->n_rows == 11);
+
+    const char *block[] = { "bar", "foo", "Category 0" };
+    assert(col_insert_range(col, 1, block, 3) == COL_ERR_OK);
+    assert(col->n_rows == SIZE + 3);
+    assert(strcmp(col_category_at(col, 1, NULL), "bar") == 0);
+    assert(strcmp(col_category_at(col, 2, NULL), "foo") == 0);
+    assert(strcmp(col_category_at(col, 3, NULL), "Category 0") == 0);
+    assert(col_category_code_at(col, 0, NULL) == col_category_code_at(col, 2, NULL));
+
+    struct col *other = col_create("other", COL_DTYPE_CATEGORY, NULL);
+    assert(col_category_append(other, "baz") == COL_ERR_OK);
+    assert(col_category_append(other, "foo") == COL_ERR_OK);
+    assert(col_concat(col, other) == COL_ERR_OK);
+    assert(col->n_rows == SIZE + 5);
+    assert(strcmp(col_category_at(col, SIZE + 3, NULL), "baz") == 0);
+    assert(strcmp(col_category_at(col, SIZE + 4, NULL), "foo") == 0);
+    assert(col_category_code_at(col, SIZE + 4, NULL) == col_category_code_at(col, 0, NULL));
+    col_free(other);
+
+    assert(col_concat(col, col) == COL_ERR_OK);
+    assert(col->n_rows == (SIZE + 5) * 2);
+    for (size_t i = 0; i < SIZE + 5; i++)
+        assert(col_category_code_at(col, i, NULL) == col_category_code_at(col, i + SIZE + 5, NULL));
+
+    assert(col_remove(col, 0) == COL_ERR_OK);
+    assert(strcmp(col_category_at(col, 0, NULL), "bar") == 0);
+
+    /* its own labels behind a new one, which grows the dictionary */
+    char label[256];
+    memset(label, 'x', sizeof(label) - 1);
+    label[sizeof(label) - 1] = '\0';
+    const char *own[] = {
+        label,
+        col_category_at(col, 0, NULL),
+        col_category_at(col, 1, NULL),
+        col_category_at(col, SIZE + 2, NULL)
+    };
+    const size_t n_rows = col->n_rows;
+    assert(col_insert_range(col, 0, own, 4) == COL_ERR_OK);
+    assert(col->n_rows == n_rows + 4);
+    assert(strcmp(col_category_at(col, 0, NULL), label) == 0);
+    assert(strcmp(col_category_at(col, 1, NULL), "bar") == 0);
+    assert(strcmp(col_category_at(col, 2, NULL), "foo") == 0);
+    assert(strcmp(col_category_at(col, 3, NULL), "baz") == 0);
+    assert(col_category_dict_get(col, NULL)->n_rows == 14);
+
+    /* err */
+    assert(col_category_append(col, NULL) == COL_ERR_NO_DATA);
+    assert(col_string_append(col, "foo") == COL_ERR_INVALID_DTYPE);
+    assert(col_category_set(col, "foo", col->n_rows) == COL_ERR_OUT_OF_BOUNDS);
+    col_free(col);
+}
@@ -1,17 +1,35 @@
 #include <assert.h>
 #include <math.h>
+#include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
+#include "core/alloc.h"
+#include "core/arena.h"
 #include "dtypes/col/core/type.h"
+#include "dtypes/col/core/accessors.h"
+#include "dtypes/col/core/buffer.h"
 #include "dtypes/col/core/lifecycle.h"
+#include "dtypes/col/core/modifiers.h"
+#include "dtypes/col/ops/arith.h"
+#include "dtypes/col/ops/cast.h"
+#include "dtypes/col/ops/reduce.h"
 #include "dtypes/col/core/internal.h"
 #include "test_utils/col.h"
 
 void test_col_create();
+void test_col_create_with_capacity();
 void test_col_create_array();
+void test_col_wrap();
+void test_col_slice();
 void test_col_clone();
+void test_col_clone_cow();
+void test_col_reserve();
+void test_col_shrink_to_fit();
 void test_col_free();
+void test_col_allocator();
+void test_col_allocator_arena();
 
 static void col_assert(
     const col_t *col, 
@@ -26,9 +44,17 @@ static const size_t SIZE = 999;
 
 int main() {
     test_col_create();
+    test_col_create_with_capacity();
     test_col_create_array();
+    test_col_wrap();
+    test_col_slice();
     test_col_clone();
+    test_col_clone_cow();
+    test_col_reserve();
+    test_col_shrink_to_fit();
     test_col_free();
+    test_col_allocator();
+    test_col_allocator_arena();
 }
 
 void test_col_create() {
@@ -59,6 +85,10 @@ void test_col_create() {
     col_assert(col_string, "string", NULL, 0, COL_DTYPE_STRING, err);
     col_free(col_string);
 
+    struct col *col_category = col_create("category", COL_DTYPE_CATEGORY, &err);
+    col_assert(col_category, "category", NULL, 0, COL_DTYPE_CATEGORY, err);
+    col_free(col_category);
+
     /* err */
     struct col *col_bad_dtype = col_create("bad_dtype", 999, &err);
     assert(col_bad_dtype == NULL);
@@ -73,6 +103,51 @@ void test_col_create() {
     assert(err == COL_ERR_EMPTY_NAME);
 }
 
+void test_col_create_with_capacity() {
+    int err = 0;
+
+    /* valid */
+    struct col *col_double = col_create_with_capacity(
+        "double",
+        SIZE,
+        COL_DTYPE_DOUBLE,
+        &err
+    );
+    assert(err == COL_ERR_OK);
+    assert(col_double->n_rows == 0);
+    assert(col_double->capacity == SIZE);
+    assert(col_double->data != NULL);
+    void *data = col_double->data;
+    for (size_t i = 0; i < SIZE; i++)
+        assert(col_append(col_double, &(double){ i }) == COL_ERR_OK);
+    assert(col_double->data == data);
+    assert(col_double->n_rows == SIZE);
+    col_free(col_double);
+
+    struct col *col_empty = col_create_with_capacity(
+        "empty",
+        0,
+        COL_DTYPE_STRING,
+        &err
+    );
+    col_assert(col_empty, "empty", NULL, 0, COL_DTYPE_STRING, err);
+    assert(col_empty->capacity == 0);
+    col_free(col_empty);
+
+    /* err */
+    struct col *col_bad_dtype = col_create_with_capacity("bad_dtype", SIZE, 999, &err);
+    assert(col_bad_dtype == NULL);
+    assert(err == COL_ERR_INVALID_DTYPE);
+
+    struct col *col_null_name = col_create_with_capacity(NULL, SIZE, COL_DTYPE_DOUBLE, &err);
+    assert(col_null_name == NULL);
+    assert(err == COL_ERR_EMPTY_NAME);
+
+    struct col *col_too_big = col_create_with_capacity("too_big", SIZE_MAX, COL_DTYPE_DOUBLE, &err);
+    assert(col_too_big == NULL);
+    assert(err == COL_ERR_OOM);
+}
+
 void test_col_create_array() {
     int err = 0;
 
@@ -115,6 +190,14 @@ void test_col_create_array() {
     free(string_data);
     col_free(col_string);
 
+    char **category_data = col_category_data_create(SIZE, 10);
+    struct col *col_category = col_category_dummy_create("category", SIZE, 10);
+    col_assert(col_category, "category", category_data, SIZE, COL_DTYPE_CATEGORY, err);
+    for (size_t i = 0; i < SIZE; i++)
+        free(category_data[i]);
+    free(category_data);
+    col_free(col_category);
+
     /* err */
     double *data = col_double_data_create(SIZE);
 
@@ -141,6 +224,169 @@ void test_col_create_array() {
     free(data);
 }
 
+void test_col_wrap() {
+    int err = 0;
+
+    /* valid: reads in place, a stack buffer shows nothing is freed */
+    double buf[SIZE];
+    for (size_t i = 0; i < SIZE; i++)
+        buf[i] = (double)i;
+
+    struct col *col = col_wrap("wrapped", buf, SIZE, COL_DTYPE_DOUBLE, &err);
+    assert(err == COL_ERR_OK);
+    assert(col->data == buf);
+    assert(col->flags & COL_FLAG_BORROWED);
+    assert(col->n_rows == SIZE);
+    assert(col_sum(col, NULL) == (double)(SIZE * (SIZE - 1) / 2));
+    assert(col_free(col) == COL_ERR_OK);
+
+    /* mutating copies first and never writes the buffer */
+    col = col_wrap("wrapped", buf, SIZE, COL_DTYPE_DOUBLE, NULL);
+    assert(col_double_set(col, -1.0, 0) == COL_ERR_OK);
+    assert(col->data != buf);
+    assert(!(col->flags & COL_FLAG_BORROWED));
+    assert(buf[0] == 0.0);
+    assert(((double *)col->data)[0] == -1.0);
+    assert(((double *)col->data)[SIZE - 1] == (double)(SIZE - 1));
+    assert(col_double_append(col, 1.0) == COL_ERR_OK);
+    col_free(col);
+
+    col = col_wrap("wrapped", buf, SIZE, COL_DTYPE_DOUBLE, NULL);
+    assert(col_binary_scalar_inplace(col, 2.0, COL_OP_MUL) == COL_ERR_OK);
+    assert(buf[1] == 1.0);
+    assert(((double *)col->data)[1] == 2.0);
+    col_free(col);
+
+    col = col_wrap("wrapped", buf, SIZE, COL_DTYPE_DOUBLE, NULL);
+    assert(col_remove(col, 0) == COL_ERR_OK);
+    assert(buf[0] == 0.0);
+    assert(((double *)col->data)[0] == 1.0);
+    col_free(col);
+
+    /* clones own their copy */
+    col = col_wrap("wrapped", buf, SIZE, COL_DTYPE_DOUBLE, NULL);
+    struct col *clone = col_clone(col, &err);
+    assert(err == COL_ERR_OK);
+    assert(clone->data != buf);
+    assert(!(clone->flags & COL_FLAG_BORROWED));
+    assert(memcmp(clone->data, buf, sizeof(buf)) == 0);
+    col_free(clone);
+    col_free(col);
+
+    /* err */
+    assert(col_wrap("wrapped", NULL, SIZE, COL_DTYPE_DOUBLE, &err) == NULL);
+    assert(err == COL_ERR_NO_DATA);
+    assert(col_wrap("wrapped", buf, 0, COL_DTYPE_DOUBLE, &err) == NULL);
+    assert(err == COL_ERR_NO_DATA);
+    assert(col_wrap(NULL, buf, SIZE, COL_DTYPE_DOUBLE, &err) == NULL);
+    assert(err == COL_ERR_EMPTY_NAME);
+    assert(col_wrap("wrapped", buf, SIZE, COL_DTYPE_STRING, &err) == NULL);
+    assert(err == COL_ERR_INVALID_DTYPE);
+    assert(col_wrap("wrapped", buf, SIZE, 999, &err) == NULL);
+    assert(err == COL_ERR_INVALID_DTYPE);
+}
+
+void test_col_slice() {
+    int err = 0;
+
+    /* valid: numeric rows are shared */
+    int32_t *int32_data = col_int32_data_create(SIZE);
+    struct col *col_int32 = col_int32_dummy_create("int32", SIZE);
+    assert(col_set_null(col_int32, 12) == COL_ERR_OK);
+
+    struct col *view = col_slice(col_int32, 10, 100, &err);
+    assert(err == COL_ERR_OK);
+    assert(view->data == (int32_t *)col_int32->data + 10);
+    assert(view->n_rows == 100);
+    assert(view->flags & COL_FLAG_BORROWED);
+    assert(strcmp(view->name, "int32") == 0);
+    assert(view->null_count == 1);
+    assert(col_is_null(view, 2, NULL));
+    assert(!col_is_null(view, 3, NULL));
+
+    /* slices of slices */
+    struct col *inner = col_slice(view, 5, 10, &err);
+    assert(inner->data == (int32_t *)col_int32->data + 15);
+    assert(inner->null_count == 0);
+    assert(inner->validity == NULL);
+    col_free(inner);
+
+    /* mutating the view leaves the parent untouched */
+    assert(col_int32_set(view, -1, 0) == COL_ERR_OK);
+    assert(view->data != (int32_t *)col_int32->data + 10);
+    assert(((int32_t *)col_int32->data)[10] == int32_data[10]);
+    assert(((int32_t *)view->data)[0] == -1);
+    assert(((int32_t *)view->data)[99] == int32_data[109]);
+    assert(view->null_count == 1);
+    col_free(view);
+
+    /* empty */
+    view = col_slice(col_int32, SIZE, 0, &err);
+    assert(err == COL_ERR_OK);
+    assert(view->n_rows == 0);
+    assert(col_int32_append(view, 7) == COL_ERR_OK);
+    assert(((int32_t *)view->data)[0] == 7);
+    col_free(view);
+
+    col_free(col_int32);
+    free(int32_data);
+
+    /* strings share the parent's bytes, clones copy only their own */
+    char **string_data = col_string_data_create(SIZE);
+    struct col *col_string = col_string_dummy_create("string", SIZE);
+    view = col_slice(col_string, SIZE - 3, 3, &err);
+    assert(view->strbuf.bytes == col_string->strbuf.bytes);
+    for (size_t i = 0; i < 3; i++)
+        assert(strcmp(col_string_at(view, i, NULL), string_data[SIZE - 3 + i]) == 0);
+
+    struct col *clone = col_clone(view, &err);
+    assert(err == COL_ERR_OK);
+    size_t n_bytes = 0;
+    for (size_t i = 0; i < 3; i++) {
+        assert(strcmp(col_string_at(clone, i, NULL), string_data[SIZE - 3 + i]) == 0);
+        n_bytes += strlen(string_data[SIZE - 3 + i]) + 1;
+    }
+    assert(clone->strbuf.len == n_bytes);
+    col_free(clone);
+
+    assert(col_string_append(view, "appended") == COL_ERR_OK);
+    assert(view->strbuf.bytes != col_string->strbuf.bytes);
+    assert(strcmp(col_string_at(view, 3, NULL), "appended") == 0);
+    assert(col_string->n_rows == SIZE);
+    col_free(view);
+    col_free(col_string);
+    for (size_t i = 0; i < SIZE; i++)
+        free(string_data[i]);
+    free(string_data);
+
+    /* categories share the dictionary */
+    struct col *col_category = col_category_dummy_create("category", SIZE, 5);
+    view = col_slice(col_category, 1, 10, &err);
+    assert(view->dict == col_category->dict);
+    assert(view->stride == col_category->stride);
+    assert(strcmp(
+        col_category_at(view, 0, NULL),
+        col_category_at(col_category, 1, NULL)
+    ) == 0);
+    assert(col_category_append(view, "new") == COL_ERR_OK);
+    assert(view->dict != col_category->dict);
+    assert(col_category->dict->values->n_rows == 5);
+    col_free(view);
+    col_free(col_category);
+
+    /* err */
+    struct col *col_valid = col_double_dummy_create("valid", SIZE);
+    assert(col_slice(NULL, 0, 1, &err) == NULL);
+    assert(err == COL_ERR_NO_DATA);
+    assert(col_slice(col_valid, SIZE + 1, 0, &err) == NULL);
+    assert(err == COL_ERR_OUT_OF_BOUNDS);
+    assert(col_slice(col_valid, 1, SIZE, &err) == NULL);
+    assert(err == COL_ERR_OUT_OF_BOUNDS);
+    assert(col_slice(col_valid, 0, SIZE_MAX, &err) == NULL);
+    assert(err == COL_ERR_OUT_OF_BOUNDS);
+    col_free(col_valid);
+}
+
 void test_col_clone() {
     int err = 0;
 
@@ -237,18 +483,53 @@ void test_col_clone() {
         free(string_data[i]);
     free(string_data);
 
+    char **category_data = col_category_data_create(SIZE, 300);
+    struct col *col_category = col_category_dummy_create("category", SIZE, 300);
+    struct col *col_category_clone = col_clone(col_category, &err);
+    col_free(col_category);
+    col_assert(
+        col_category_clone,
+        "category",
+        category_data,
+        SIZE,
+        COL_DTYPE_CATEGORY,
+	    err
+    );
+    assert(col_category_clone->stride == sizeof(uint16_t));
+    col_free(col_category_clone);
+    for (size_t i = 0; i < SIZE; i++)
+        free(category_data[i]);
+    free(category_data);
+
+    /* valid: empty columns, sharing nothing with their clone once written */
+    struct col *col_empty = col_create("empty", COL_DTYPE_STRING, NULL);
+    struct col *col_empty_clone = col_clone(col_empty, &err);
+    assert(col_empty_clone != NULL);
+    assert(col_empty_clone->n_rows == 0);
+    assert(col_empty_clone->dtype == COL_DTYPE_STRING);
+    assert(!strcmp(col_empty_clone->name, "empty"));
+    assert(col_string_append(col_empty_clone, "a") == COL_ERR_OK);
+    assert(col_empty->n_rows == 0);
+    col_free(col_empty_clone);
+
+    mlc_arena_t *arena = mlc_arena_create(0, 0);
+    const mlc_allocator_t allocator = mlc_arena_allocator(arena);
+    col_empty_clone = col_clone_with_allocator(col_empty, &allocator, &err);
+    assert(col_empty_clone != NULL);
+    assert(col_empty_clone->n_rows == 0);
+    col_free(col_empty_clone);
+    mlc_arena_free(arena);
+    col_free(col_empty);
+
     /* err */
     struct col *col_valid1 = col_double_dummy_create("valid1", SIZE);
-    struct col *col_valid2 = col_clone(col_valid1, &err);
-    assert(err == COL_ERR_OK);
-    struct col *col_valid3 = col_clone(col_valid1, &err);
-    assert(err == COL_ERR_OK);
+    struct col *col_valid2 = col_double_dummy_create("valid2", SIZE);
 
     struct col *col_null = col_clone(NULL, &err);
     assert(col_null == NULL);
     assert(err == COL_ERR_NO_DATA);
 
-    free(col_valid1->data);
+    col_data_free(&col_valid1->allocator, col_valid1->data);
     col_valid1->data = NULL;
     struct col *col_null_data = col_clone(col_valid1, &err);
     assert(col_null_data == NULL);
@@ -262,11 +543,153 @@ void test_col_clone() {
     assert(err == COL_ERR_EMPTY_NAME);
     col_free(col_valid2);
 
-    col_valid3->n_rows = 0;
-    struct col *col_bad_rows = col_clone(col_valid3, &err);
-    assert(col_bad_rows == NULL);
-    assert(err == COL_ERR_NO_DATA);
-    col_free(col_valid3);
+}
+
+void test_col_clone_cow() {
+    int err = 0;
+    double *double_data = col_double_data_create(SIZE);
+
+    /* clones share storage until written */
+    struct col *col = col_double_dummy_create("double", SIZE);
+    struct col *clone = col_clone(col, &err);
+    assert(err == COL_ERR_OK);
+    assert(clone->data == col->data);
+    assert(clone->share == col->share);
+    assert(col->share->refs == 2);
+
+    /* nulls live in the clone's own bitmap */
+    assert(col_set_null(clone, 0) == COL_ERR_OK);
+    assert(clone->data == col->data);
+    assert(!col_is_null(col, 0, NULL));
+
+    /* the first write copies */
+    assert(col_double_set(clone, -1.0, 1) == COL_ERR_OK);
+    assert(clone->data != col->data);
+    assert(clone->share == NULL);
+    assert(((double *)clone->data)[1] == -1.0);
+    assert(((double *)col->data)[1] == double_data[1]);
+    assert(clone->null_count == 1);
+
+    /* the last holder takes the storage over without copying */
+    void *data = col->data;
+    assert(col->share->refs == 1);
+    assert(col_double_set(col, -2.0, 2) == COL_ERR_OK);
+    assert(col->data == data);
+    assert(col->share == NULL);
+    col_free(clone);
+
+    /* append and remove on the source leave clones intact */
+    struct col *clone1 = col_clone(col, NULL);
+    struct col *clone2 = col_clone(clone1, NULL);
+    assert(col->share->refs == 3);
+    assert(col_double_append(col, 1.0) == COL_ERR_OK);
+    assert(col_remove(col, 0) == COL_ERR_OK);
+    assert(col->n_rows == SIZE);
+    assert(((double *)col->data)[0] == double_data[1]);
+    assert(clone1->share->refs == 2);
+
+    /* freeing the other holders keeps the storage alive */
+    col_free(col);
+    col_free(clone1);
+    assert(clone2->share->refs == 1);
+    assert(((double *)clone2->data)[0] == double_data[0]);
+    assert(((double *)clone2->data)[2] == -2.0);
+    assert(col_shrink_to_fit(clone2) == COL_ERR_OK);
+    assert(clone2->share == NULL);
+    col_free(clone2);
+
+    /* shared storage is not shrunk, and in place ops copy first */
+    col = col_double_dummy_create("double", SIZE);
+    clone = col_clone(col, NULL);
+    assert(col_shrink_to_fit(col) == COL_ERR_OK);
+    assert(clone->data == col->data);
+    assert(col_cast_inplace(clone, COL_DTYPE_FLOAT) == COL_ERR_OK);
+    assert(col->dtype == COL_DTYPE_DOUBLE);
+    assert(((double *)col->data)[3] == double_data[3]);
+    assert(col_binary_scalar_inplace(col, 2.0, COL_OP_MUL) == COL_ERR_OK);
+    col_free(clone);
+    col_free(col);
+
+    /* categories share the dictionary */
+    struct col *col_category = col_category_dummy_create("category", SIZE, 5);
+    clone = col_clone(col_category, NULL);
+    assert(clone->dict == col_category->dict);
+    assert(col_category_append(clone, "new") == COL_ERR_OK);
+    assert(clone->dict != col_category->dict);
+    assert(col_category->dict->values->n_rows == 5);
+    assert(col_category->n_rows == SIZE);
+    col_free(col_category);
+    assert(strcmp(col_category_at(clone, SIZE, NULL), "new") == 0);
+    col_free(clone);
+
+    /* another allocator always gets a full copy */
+    col = col_double_dummy_create("double", SIZE);
+    mlc_arena_t *arena = mlc_arena_create(0, 0);
+    const mlc_allocator_t allocator = mlc_arena_allocator(arena);
+    clone = col_clone_with_allocator(col, &allocator, NULL);
+    assert(clone->data != col->data);
+    assert(clone->share == NULL);
+    assert(col->share == NULL);
+    col_free(col);
+    assert(((double *)clone->data)[4] == double_data[4]);
+    mlc_arena_free(arena);
+
+    free(double_data);
+}
+
+void test_col_reserve() {
+    /* valid */
+    double *double_data = col_double_data_create(SIZE);
+    struct col *col_double = col_double_dummy_create("double", SIZE);
+    assert(col_double->capacity == SIZE);
+    assert(col_reserve(col_double, SIZE * 2) == COL_ERR_OK);
+    assert(col_double->capacity == SIZE * 2);
+    col_assert(col_double, "double", double_data, SIZE, COL_DTYPE_DOUBLE, 0);
+
+    assert(col_reserve(col_double, 1) == COL_ERR_OK);
+    assert(col_double->capacity == SIZE * 2);
+    col_free(col_double);
+    free(double_data);
+
+    struct col *col_string = col_create("string", COL_DTYPE_STRING, NULL);
+    assert(col_reserve(col_string, SIZE) == COL_ERR_OK);
+    assert(col_string->capacity == SIZE);
+    assert(col_string->n_rows == 0);
+    col_free(col_string);
+
+    /* err */
+    assert(col_reserve(NULL, SIZE) == COL_ERR_NO_DATA);
+
+    struct col *col_valid = col_double_dummy_create("valid", SIZE);
+    assert(col_reserve(col_valid, SIZE_MAX) == COL_ERR_OOM);
+    assert(col_valid->capacity == SIZE);
+    col_free(col_valid);
+}
+
+void test_col_shrink_to_fit() {
+    /* valid */
+    int64_t *int64_data = col_int64_data_create(SIZE);
+    struct col *col_int64 = col_create("int64", COL_DTYPE_INT64, NULL);
+    for (size_t i = 0; i < SIZE; i++)
+        assert(col_append(col_int64, &int64_data[i]) == COL_ERR_OK);
+    assert(col_int64->capacity >= SIZE);
+    assert(col_shrink_to_fit(col_int64) == COL_ERR_OK);
+    assert(col_int64->capacity == SIZE);
+    col_assert(col_int64, "int64", int64_data, SIZE, COL_DTYPE_INT64, 0);
+    col_free(col_int64);
+    free(int64_data);
+
+    struct col *col_uint8 = col_uint8_dummy_create("uint8", SIZE);
+    for (size_t i = 0; i < SIZE; i++)
+        assert(col_remove(col_uint8, 0) == COL_ERR_OK);
+    assert(col_uint8->capacity == SIZE);
+    assert(col_shrink_to_fit(col_uint8) == COL_ERR_OK);
+    col_assert(col_uint8, "uint8", NULL, 0, COL_DTYPE_UINT8, 0);
+    assert(col_uint8->capacity == 0);
+    col_free(col_uint8);
+
+    /* err */
+    assert(col_shrink_to_fit(NULL) == COL_ERR_NO_DATA);
 }
 
 void test_col_free() {
@@ -274,6 +697,161 @@ void test_col_free() {
     assert(col_free(col) == COL_ERR_OK);
 }
 
+/* Counts live allocations so leaks and foreign frees are caught */
+static void *counting_alloc(void *ctx, size_t size, size_t align) {
+    void *ptr = mlc_alloc(mlc_allocator_default(), size, align);
+    if (ptr)
+        *(size_t *)ctx += 1;
+    return ptr;
+}
+
+static void *counting_realloc(
+    void *ctx,
+    void *ptr,
+    size_t old_size,
+    size_t size,
+    size_t align
+) {
+    (void)ctx;
+    return mlc_realloc(mlc_allocator_default(), ptr, old_size, size, align);
+}
+
+static void counting_free(void *ctx, void *ptr) {
+    *(size_t *)ctx -= 1;
+    mlc_free(mlc_allocator_default(), ptr);
+}
+
+void test_col_allocator() {
+    int err = 0;
+    size_t n_live = 0;
+    const mlc_allocator_t counting = {
+        counting_alloc,
+        counting_realloc,
+        counting_free,
+        &n_live
+    };
+
+    /* every buffer of every dtype goes through the column's allocator */
+    double *double_data = col_double_data_create(SIZE);
+    struct col *col_double = col_create_array_with_allocator(
+        "double",
+        double_data,
+        SIZE,
+        COL_DTYPE_DOUBLE,
+        &counting,
+        &err
+    );
+    assert(err == COL_ERR_OK);
+    assert(n_live > 0);
+    assert(col_double->allocator.ctx == &n_live);
+    for (size_t i = 0; i < SIZE; i++)
+        assert(col_double_append(col_double, (double)i) == COL_ERR_OK);
+    assert(col_set_null(col_double, 3) == COL_ERR_OK);
+    for (size_t i = 0; i < SIZE; i++)
+        assert(col_remove(col_double, 0) == COL_ERR_OK);
+    assert(col_rename(col_double, "renamed") == COL_ERR_OK);
+    assert(col_shrink_to_fit(col_double) == COL_ERR_OK);
+
+    struct col *col_string = col_create_with_allocator(
+        "string",
+        0,
+        COL_DTYPE_STRING,
+        &counting,
+        &err
+    );
+    struct col *col_category = col_create_with_allocator(
+        "category",
+        0,
+        COL_DTYPE_CATEGORY,
+        &counting,
+        &err
+    );
+    char buf[32];
+    for (size_t i = 0; i < SIZE; i++) {
+        snprintf(buf, sizeof(buf), "value %zu", i);
+        assert(col_string_append(col_string, buf) == COL_ERR_OK);
+        assert(col_category_append(col_category, buf) == COL_ERR_OK);
+    }
+
+    /* clones inherit the allocator */
+    const size_t n_before = n_live;
+    struct col *clone = col_clone(col_category, &err);
+    assert(clone->allocator.ctx == &n_live);
+    assert(n_live > n_before);
+
+    /* or take another one */
+    struct col *clone_libc = col_clone_with_allocator(
+        col_string,
+        mlc_allocator_default(),
+        &err
+    );
+    assert(clone_libc->allocator.ctx == NULL);
+    assert(n_live > n_before);
+
+    col_free(clone_libc);
+    col_free(clone);
+    col_free(col_category);
+    col_free(col_string);
+    col_free(col_double);
+    assert(n_live == 0);
+    free(double_data);
+
+    /* the global allocator applies to columns created afterwards */
+    mlc_allocator_set_global(&counting);
+    struct col *col_global = col_create("global", COL_DTYPE_INT32, &err);
+    mlc_allocator_set_global(NULL);
+    assert(col_global->allocator.ctx == &n_live);
+    assert(n_live > 0);
+    col_free(col_global);
+    assert(n_live == 0);
+}
+
+void test_col_allocator_arena() {
+    mlc_arena_t *arena = mlc_arena_create(0, 0);
+    const mlc_allocator_t allocator = mlc_arena_allocator(arena);
+
+    /* many short-lived columns, released at once without `col_free` */
+    for (size_t round = 0; round < 3; round++) {
+        for (size_t i = 0; i < 1000; i++) {
+            struct col *col = col_create_with_allocator(
+                "short_lived",
+                0,
+                i % 2 ? COL_DTYPE_STRING : COL_DTYPE_INT64,
+                &allocator,
+                NULL
+            );
+            assert(col != NULL);
+            for (size_t j = 0; j < 20; j++) {
+                if (i % 2)
+                    assert(col_string_append(col, "arena") == COL_ERR_OK);
+                else
+                    assert(col_int64_append(col, (int64_t)j) == COL_ERR_OK);
+            }
+            assert(col_remove(col, 0) == COL_ERR_OK);
+            assert(col->n_rows == 19);
+            assert((uintptr_t)col->data % COL_DATA_ALIGN == 0);
+
+            struct col *clone = col_clone(col, NULL);
+            assert(clone->n_rows == 19);
+            if (i % 2 == 0)
+                assert(((int64_t *)clone->data)[0] == 1);
+        }
+        mlc_arena_reset(arena);
+    }
+
+    /* `col_free` is still safe, it releases nothing */
+    struct col *col = col_create_with_allocator(
+        "freed",
+        8,
+        COL_DTYPE_DOUBLE,
+        &allocator,
+        NULL
+    );
+    assert(col_free(col) == COL_ERR_OK);
+
+    mlc_arena_free(arena);
+}
+
 static void col_assert(
     const col_t *col, 
     const char *name,
@@ -288,7 +866,8 @@ static void col_assert(
     assert(strcmp(col->name, name) == 0);
     assert(col->n_rows == n_rows);
     assert(col->dtype == dtype);
-    assert(col->stride == stride);
+    if (dtype != COL_DTYPE_CATEGORY)
+        assert(col->stride == stride);
 
     if (!n_rows) {
         assert(col->data == NULL);
@@ -333,9 +912,14 @@ static void col_assert(
         }
         case COL_DTYPE_STRING: {
             const char **exp = (const char **)data;
-            char **act = col->data;
             for (size_t i = 0; i < col->n_rows; i++)
-                assert(strcmp(act[i], exp[i]) == 0);
+                assert(strcmp(col_string_at(col, i, NULL), exp[i]) == 0);
+            break;
+        }
+        case COL_DTYPE_CATEGORY: {
+            const char **exp = (const char **)data;
+            for (size_t i = 0; i < col->n_rows; i++)
+                assert(strcmp(col_category_at(col, i, NULL), exp[i]) == 0);
             break;
         }
     }
@@ -1,6 +1,8 @@
 #include <assert.h>
 #include <math.h>
 #include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "dtypes/col/core/accessors.h"
@@ -11,7 +13,13 @@
 
 void test_col_set();
 void test_col_append();
+void test_col_insert_range();
+void test_col_extend();
+void test_col_concat();
 void test_col_remove();
+void test_col_remove_range();
+void test_col_remove_indices();
+void test_col_retain_mask();
 void test_col_rename();
 
 static const size_t SIZE = 999;
@@ -22,7 +30,13 @@ static const size_t E_IDX = SIZE - 1;
 int main() {
     test_col_set();
     test_col_append();
+    test_col_insert_range();
+    test_col_extend();
+    test_col_concat();
     test_col_remove();
+    test_col_remove_range();
+    test_col_remove_indices();
+    test_col_retain_mask();
     test_col_rename();
 }
 
@@ -82,6 +96,18 @@ void test_col_set() {
 	assert(strcmp(col_string_at(col_string, E_IDX, NULL), "baz") == 0);
     col_free(col_string);
 
+    /* valid: setting a shared or null row goes through `col_set` */
+    struct col *col_shared = col_double_dummy_create("shared", SIZE);
+    struct col *col_copy = col_clone(col_shared, NULL);
+    assert(col_set_null(col_shared, M_IDX) == COL_ERR_OK);
+    assert(col_double_set(col_shared, 2.5, M_IDX) == COL_ERR_OK);
+    assert(col_double_set(col_shared, 2.5, S_IDX) == COL_ERR_OK);
+    assert(col_shared->null_count == 0);
+    assert(*col_double_at(col_shared, M_IDX, NULL) == 2.5);
+    assert(*col_double_at(col_copy, S_IDX, NULL) != 2.5);
+    col_free(col_copy);
+    col_free(col_shared);
+
     /* err */
     struct col *col_valid1 = col_double_dummy_create("valid1", SIZE);
     assert(col_double_set(col_valid1, 3.141592653589, SIZE * 2) == COL_ERR_OUT_OF_BOUNDS);
@@ -150,6 +176,177 @@ void test_col_append() {
     col_free(col_valid);
 }
 
+void test_col_insert_range() {
+    /* valid */
+    int32_t *int32_data = col_int32_data_create(SIZE);
+    const int32_t int32_block[] = { -1, -2, -3 };
+    struct col *col_int32 = col_int32_dummy_create("int32", SIZE);
+    assert(col_insert_range(col_int32, M_IDX, int32_block, 3) == COL_ERR_OK);
+    assert(col_int32->n_rows == SIZE + 3);
+    for (size_t i = 0; i < M_IDX; i++)
+        assert(*col_int32_at(col_int32, i, NULL) == int32_data[i]);
+    for (size_t i = 0; i < 3; i++)
+        assert(*col_int32_at(col_int32, M_IDX + i, NULL) == int32_block[i]);
+    for (size_t i = M_IDX; i < SIZE; i++)
+        assert(*col_int32_at(col_int32, i + 3, NULL) == int32_data[i]);
+
+    assert(col_insert_range(col_int32, S_IDX, int32_block, 3) == COL_ERR_OK);
+    assert(*col_int32_at(col_int32, S_IDX, NULL) == -1);
+    assert(*col_int32_at(col_int32, 3, NULL) == int32_data[0]);
+    assert(col_insert_range(col_int32, S_IDX, int32_block, 0) == COL_ERR_OK);
+    assert(col_int32->n_rows == SIZE + 6);
+    col_free(col_int32);
+    free(int32_data);
+
+    char **string_data = col_string_data_create(SIZE);
+    const char *string_block[] = { "foo", "bar" };
+    struct col *col_string = col_string_dummy_create("string", SIZE);
+    assert(col_insert_range(col_string, M_IDX, string_block, 2) == COL_ERR_OK);
+    assert(col_string->n_rows == SIZE + 2);
+    assert(strcmp(col_string_at(col_string, M_IDX, NULL), "foo") == 0);
+    assert(strcmp(col_string_at(col_string, M_IDX + 1, NULL), "bar") == 0);
+    for (size_t i = M_IDX; i < SIZE; i++)
+        assert(strcmp(col_string_at(col_string, i + 2, NULL), string_data[i]) == 0);
+    col_free(col_string);
+    for (size_t i = 0; i < SIZE; i++)
+        free(string_data[i]);
+    free(string_data);
+
+    /* err */
+    struct col *col_valid = col_int32_dummy_create("valid", SIZE);
+    assert(col_insert_range(col_valid, SIZE + 1, int32_block, 3) == COL_ERR_OUT_OF_BOUNDS);
+    assert(col_insert_range(col_valid, S_IDX, NULL, 3) == COL_ERR_NO_DATA);
+    assert(col_valid->n_rows == SIZE);
+    col_free(col_valid);
+}
+
+void test_col_extend() {
+    /* valid */
+    double *double_data = col_double_data_create(SIZE);
+    struct col *col_double = col_create("double", COL_DTYPE_DOUBLE, NULL);
+    assert(col_extend(col_double, double_data, SIZE) == COL_ERR_OK);
+    assert(col_extend(col_double, double_data, SIZE) == COL_ERR_OK);
+    assert(col_double->n_rows == SIZE * 2);
+    for (size_t i = 0; i < col_double->n_rows; i++)
+        assert(fabs(*col_double_at(col_double, i, NULL) - double_data[i % SIZE]) < 1e-12f);
+    col_free(col_double);
+    free(double_data);
+
+    char **string_data = col_string_data_create(SIZE);
+    struct col *col_string = col_create("string", COL_DTYPE_STRING, NULL);
+    assert(col_extend(col_string, string_data, SIZE) == COL_ERR_OK);
+    assert(col_string->n_rows == SIZE);
+    for (size_t i = 0; i < SIZE; i++)
+        assert(strcmp(col_string_at(col_string, i, NULL), string_data[i]) == 0);
+    col_free(col_string);
+
+    /* its own strings, which growing the buffer moves */
+    col_string = col_string_dummy_create("string", SIZE);
+    const char **own_data = malloc(SIZE * sizeof(char *));
+    for (size_t i = 0; i < SIZE; i++)
+        own_data[i] = col_string_at(col_string, i, NULL);
+    assert(col_extend(col_string, own_data, SIZE) == COL_ERR_OK);
+    assert(col_string->n_rows == SIZE * 2);
+    for (size_t i = 0; i < col_string->n_rows; i++)
+        assert(strcmp(col_string_at(col_string, i, NULL), string_data[i % SIZE]) == 0);
+
+    for (size_t i = 0; i < SIZE; i++)
+        own_data[i] = col_string_at(col_string, i, NULL);
+    assert(col_insert_range(col_string, S_IDX, own_data, SIZE) == COL_ERR_OK);
+    assert(col_string->n_rows == SIZE * 3);
+    for (size_t i = 0; i < col_string->n_rows; i++)
+        assert(strcmp(col_string_at(col_string, i, NULL), string_data[i % SIZE]) == 0);
+    col_free(col_string);
+    free(own_data);
+    for (size_t i = 0; i < SIZE; i++)
+        free(string_data[i]);
+    free(string_data);
+
+    /* err */
+    struct col *col_valid = col_create("valid", COL_DTYPE_DOUBLE, NULL);
+    assert(col_extend(col_valid, NULL, SIZE) == COL_ERR_NO_DATA);
+    col_free(col_valid);
+}
+
+void test_col_concat() {
+    /* valid */
+    uint8_t *uint8_data = col_uint8_data_create(SIZE);
+    struct col *col_uint8_dst = col_uint8_dummy_create("dst", SIZE);
+    struct col *col_uint8_src = col_uint8_dummy_create("src", SIZE);
+    assert(col_concat(col_uint8_dst, col_uint8_src) == COL_ERR_OK);
+    assert(col_uint8_dst->n_rows == SIZE * 2);
+    assert(col_uint8_src->n_rows == SIZE);
+    for (size_t i = 0; i < col_uint8_dst->n_rows; i++)
+        assert(*col_uint8_at(col_uint8_dst, i, NULL) == uint8_data[i % SIZE]);
+
+    assert(col_concat(col_uint8_dst, col_uint8_dst) == COL_ERR_OK);
+    assert(col_uint8_dst->n_rows == SIZE * 4);
+    for (size_t i = 0; i < col_uint8_dst->n_rows; i++)
+        assert(*col_uint8_at(col_uint8_dst, i, NULL) == uint8_data[i % SIZE]);
+    col_free(col_uint8_dst);
+    col_free(col_uint8_src);
+    free(uint8_data);
+
+    char **string_data = col_string_data_create(SIZE);
+    struct col *col_string = col_string_dummy_create("string", SIZE);
+    assert(col_concat(col_string, col_string) == COL_ERR_OK);
+    assert(col_string->n_rows == SIZE * 2);
+    for (size_t i = 0; i < col_string->n_rows; i++)
+        assert(strcmp(col_string_at(col_string, i, NULL), string_data[i % SIZE]) == 0);
+    col_free(col_string);
+    for (size_t i = 0; i < SIZE; i++)
+        free(string_data[i]);
+    free(string_data);
+
+    /* valid: views of the target's own rows */
+    int64_t *int64_data = col_int64_data_create(SIZE);
+    struct col *col_int64 = col_int64_dummy_create("int64", SIZE);
+    col_set_null(col_int64, 2);
+    struct col *int64_slice = col_slice(col_int64, 1, SIZE - 1, NULL);
+    assert(col_concat(col_int64, int64_slice) == COL_ERR_OK);
+    assert(col_int64->n_rows == 2 * SIZE - 1);
+    assert(col_int64->null_count == 2);
+    assert(col_is_null(col_int64, SIZE + 1, NULL) == 1);
+    for (size_t i = 0; i < col_int64->n_rows; i++) {
+        const size_t j = i < SIZE ? i : i - SIZE + 1;
+        if (j != 2)
+            assert(*col_int64_at(col_int64, i, NULL) == int64_data[j]);
+    }
+    col_free(int64_slice);
+
+    struct col *int64_wrap = col_wrap("wrap", col_int64->data, SIZE, COL_DTYPE_INT64, NULL);
+    assert(col_concat(col_int64, int64_wrap) == COL_ERR_OK);
+    assert(col_int64->n_rows == 3 * SIZE - 1);
+    assert(*col_int64_at(col_int64, 3 * SIZE - 2, NULL) == int64_data[SIZE - 1]);
+    col_free(int64_wrap);
+    col_free(col_int64);
+    free(int64_data);
+
+    string_data = col_string_data_create(SIZE);
+    col_string = col_string_dummy_create("string", SIZE);
+    struct col *string_slice = col_slice(col_string, SIZE / 2, SIZE - SIZE / 2, NULL);
+    assert(col_concat(col_string, string_slice) == COL_ERR_OK);
+    assert(col_string->n_rows == 2 * SIZE - SIZE / 2);
+    for (size_t i = 0; i < col_string->n_rows; i++) {
+        const size_t j = i < SIZE ? i : i - SIZE + SIZE / 2;
+        assert(strcmp(col_string_at(col_string, i, NULL), string_data[j]) == 0);
+    }
+    col_free(string_slice);
+    col_free(col_string);
+    for (size_t i = 0; i < SIZE; i++)
+        free(string_data[i]);
+    free(string_data);
+
+    /* err */
+    struct col *col_valid1 = col_double_dummy_create("valid1", SIZE);
+    struct col *col_valid2 = col_float_dummy_create("valid2", SIZE);
+    assert(col_concat(col_valid1, col_valid2) == COL_ERR_INVALID_DTYPE);
+    assert(col_concat(col_valid1, NULL) == COL_ERR_NO_DATA);
+    assert(col_valid1->n_rows == SIZE);
+    col_free(col_valid1);
+    col_free(col_valid2);
+}
+
 void test_col_remove() {
     /* valid */   
     double *double_data = col_double_data_create(SIZE);
@@ -214,6 +411,133 @@ void test_col_remove() {
     col_free(col_valid);
 }
 
+void test_col_remove_range() {
+    /* valid */
+    int64_t *int64_data = col_int64_data_create(SIZE);
+    struct col *col_int64 = col_int64_dummy_create("int64", SIZE);
+    assert(col_remove_range(col_int64, M_IDX, 10) == COL_ERR_OK);
+    assert(col_int64->n_rows == SIZE - 10);
+    for (size_t i = 0; i < M_IDX; i++)
+        assert(*col_int64_at(col_int64, i, NULL) == int64_data[i]);
+    for (size_t i = M_IDX; i < col_int64->n_rows; i++)
+        assert(*col_int64_at(col_int64, i, NULL) == int64_data[i + 10]);
+    assert(col_remove_range(col_int64, S_IDX, 0) == COL_ERR_OK);
+    assert(col_remove_range(col_int64, S_IDX, col_int64->n_rows) == COL_ERR_OK);
+    assert(col_int64->n_rows == 0);
+    col_free(col_int64);
+    free(int64_data);
+
+    char **string_data = col_string_data_create(SIZE);
+    struct col *col_string = col_string_dummy_create("string", SIZE);
+    assert(col_remove_range(col_string, S_IDX, 10) == COL_ERR_OK);
+    assert(col_string->n_rows == SIZE - 10);
+    for (size_t i = 0; i < col_string->n_rows; i++)
+        assert(strcmp(col_string_at(col_string, i, NULL), string_data[i + 10]) == 0);
+    col_free(col_string);
+    for (size_t i = 0; i < SIZE; i++)
+        free(string_data[i]);
+    free(string_data);
+
+    /* err */
+    struct col *col_valid = col_double_dummy_create("valid", SIZE);
+    assert(col_remove_range(col_valid, E_IDX, 2) == COL_ERR_OUT_OF_BOUNDS);
+    assert(col_remove_range(col_valid, SIZE + 1, 0) == COL_ERR_OUT_OF_BOUNDS);
+    assert(col_valid->n_rows == SIZE);
+    col_free(col_valid);
+}
+
+void test_col_remove_indices() {
+    const size_t idx[] = { S_IDX, 1, 7, M_IDX, E_IDX };
+    const size_t k = sizeof(idx) / sizeof(idx[0]);
+
+    /* valid */
+    int32_t *int32_data = col_int32_data_create(SIZE);
+    struct col *col_int32 = col_int32_dummy_create("int32", SIZE);
+    assert(col_remove_indices(col_int32, idx, k) == COL_ERR_OK);
+    assert(col_int32->n_rows == SIZE - k);
+    for (size_t i = 0, j = 0, r = 0; i < SIZE; i++) {
+        if (j < k && idx[j] == i) {
+            j++;
+            continue;
+        }
+        assert(*col_int32_at(col_int32, r++, NULL) == int32_data[i]);
+    }
+    col_free(col_int32);
+    free(int32_data);
+
+    char **string_data = col_string_data_create(SIZE);
+    struct col *col_string = col_string_dummy_create("string", SIZE);
+    assert(col_remove_indices(col_string, idx, k) == COL_ERR_OK);
+    assert(col_string->n_rows == SIZE - k);
+    for (size_t i = 0, j = 0, r = 0; i < SIZE; i++) {
+        if (j < k && idx[j] == i) {
+            j++;
+            continue;
+        }
+        assert(strcmp(col_string_at(col_string, r++, NULL), string_data[i]) == 0);
+    }
+    col_free(col_string);
+    for (size_t i = 0; i < SIZE; i++)
+        free(string_data[i]);
+    free(string_data);
+
+    /* err */
+    const size_t unsorted[] = { M_IDX, S_IDX };
+    const size_t duplicate[] = { M_IDX, M_IDX };
+    const size_t bad_bounds[] = { S_IDX, SIZE };
+    struct col *col_valid = col_double_dummy_create("valid", SIZE);
+    assert(col_remove_indices(col_valid, unsorted, 2) == COL_ERR_INVALID_ARG);
+    assert(col_remove_indices(col_valid, duplicate, 2) == COL_ERR_INVALID_ARG);
+    assert(col_remove_indices(col_valid, bad_bounds, 2) == COL_ERR_OUT_OF_BOUNDS);
+    assert(col_remove_indices(col_valid, NULL, 2) == COL_ERR_NO_DATA);
+    assert(col_valid->n_rows == SIZE);
+    col_free(col_valid);
+}
+
+void test_col_retain_mask() {
+    uint8_t mask[SIZE];
+    size_t n_kept = 0;
+    for (size_t i = 0; i < SIZE; i++) {
+        mask[i] = (i % 3 == 0) || (i > M_IDX && i < M_IDX + 20);
+        n_kept += mask[i];
+    }
+
+    /* valid */
+    float *float_data = col_float_data_create(SIZE);
+    struct col *col_float = col_float_dummy_create("float", SIZE);
+    assert(col_retain_mask(col_float, mask) == COL_ERR_OK);
+    assert(col_float->n_rows == n_kept);
+    for (size_t i = 0, r = 0; i < SIZE; i++)
+        if (mask[i])
+            assert(*col_float_at(col_float, r++, NULL) == float_data[i]);
+    col_free(col_float);
+    free(float_data);
+
+    char **string_data = col_string_data_create(SIZE);
+    struct col *col_string = col_string_dummy_create("string", SIZE);
+    assert(col_retain_mask(col_string, mask) == COL_ERR_OK);
+    assert(col_string->n_rows == n_kept);
+    for (size_t i = 0, r = 0; i < SIZE; i++)
+        if (mask[i])
+            assert(strcmp(col_string_at(col_string, r++, NULL), string_data[i]) == 0);
+    col_free(col_string);
+    for (size_t i = 0; i < SIZE; i++)
+        free(string_data[i]);
+    free(string_data);
+
+    memset(mask, 0, sizeof(mask));
+    struct col *col_none = col_string_dummy_create("none", SIZE);
+    assert(col_retain_mask(col_none, mask) == COL_ERR_OK);
+    assert(col_none->n_rows == 0);
+    col_free(col_none);
+
+    /* err */
+    struct col *col_valid = col_double_dummy_create("valid", SIZE);
+    assert(col_retain_mask(col_valid, NULL) == COL_ERR_NO_DATA);
+    assert(col_valid->n_rows == SIZE);
+    col_free(col_valid);
+}
+
 void test_col_rename() {
     /* valid */
     struct col *col_valid = col_double_dummy_create("valid", SIZE);
@@ -0,0 +1,169 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/accessors.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/col/core/modifiers.h"
+#include "dtypes/col/core/span.h"
+#include "test_utils/col.h"
+
+void test_col_cspan();
+void test_col_span();
+void test_col_span_shared();
+void test_col_span_invalid();
+
+static const size_t SIZE = 999;
+
+int main() {
+    test_col_cspan();
+    test_col_span();
+    test_col_span_shared();
+    test_col_span_invalid();
+}
+
+void test_col_cspan() {
+    int err;
+
+    /* valid */
+    double *double_data = col_double_data_create(SIZE);
+    struct col *col_double = col_double_dummy_create("double", SIZE);
+    const col_double_cspan_t double_span = col_double_cspan(col_double, &err);
+    assert(err == COL_ERR_OK && double_span.len == SIZE);
+    assert(memcmp(double_span.ptr, double_data, SIZE * sizeof(double)) == 0);
+    col_free(col_double);
+    free(double_data);
+
+    float *float_data = col_float_data_create(SIZE);
+    struct col *col_float = col_float_dummy_create("float", SIZE);
+    const col_float_cspan_t float_span = col_float_cspan(col_float, &err);
+    assert(err == COL_ERR_OK && float_span.len == SIZE);
+    assert(memcmp(float_span.ptr, float_data, SIZE * sizeof(float)) == 0);
+    col_free(col_float);
+    free(float_data);
+
+    int64_t *int64_data = col_int64_data_create(SIZE);
+    struct col *col_int64 = col_int64_dummy_create("int64", SIZE);
+    const col_int64_cspan_t int64_span = col_int64_cspan(col_int64, &err);
+    assert(err == COL_ERR_OK && int64_span.len == SIZE);
+    assert(memcmp(int64_span.ptr, int64_data, SIZE * sizeof(int64_t)) == 0);
+    col_free(col_int64);
+    free(int64_data);
+
+    int32_t *int32_data = col_int32_data_create(SIZE);
+    struct col *col_int32 = col_int32_dummy_create("int32", SIZE);
+    const col_int32_cspan_t int32_span = col_int32_cspan(col_int32, &err);
+    assert(err == COL_ERR_OK && int32_span.len == SIZE);
+    assert(memcmp(int32_span.ptr, int32_data, SIZE * sizeof(int32_t)) == 0);
+    col_free(col_int32);
+    free(int32_data);
+
+    uint8_t *uint8_data = col_uint8_data_create(SIZE);
+    struct col *col_uint8 = col_uint8_dummy_create("uint8", SIZE);
+    const col_uint8_cspan_t uint8_span = col_uint8_cspan(col_uint8, &err);
+    assert(err == COL_ERR_OK && uint8_span.len == SIZE);
+    assert(memcmp(uint8_span.ptr, uint8_data, SIZE * sizeof(uint8_t)) == 0);
+    col_free(col_uint8);
+    free(uint8_data);
+
+    /* valid: empty column */
+    struct col *col_empty = col_create("empty", COL_DTYPE_DOUBLE, NULL);
+    const col_double_cspan_t empty_span = col_double_cspan(col_empty, &err);
+    assert(err == COL_ERR_OK && empty_span.len == 0);
+    col_free(col_empty);
+}
+
+void test_col_span() {
+    int err;
+
+    /* valid: writes land in the column */
+    struct col *col_double = col_double_dummy_create("double", SIZE);
+    const col_double_span_t double_span = col_double_span(col_double, &err);
+    assert(err == COL_ERR_OK && double_span.len == SIZE);
+    for (size_t i = 0; i < double_span.len; i++)
+        double_span.ptr[i] *= 2;
+    for (size_t i = 0; i < SIZE; i++)
+        assert(*col_double_at(col_double, i, NULL) == i * 3.141592653589793 * 2);
+    col_free(col_double);
+
+    struct col *col_float = col_float_dummy_create("float", SIZE);
+    const col_float_span_t float_span = col_float_span(col_float, &err);
+    assert(err == COL_ERR_OK && float_span.len == SIZE);
+    float_span.ptr[SIZE - 1] = 0.5f;
+    assert(*col_float_at(col_float, SIZE - 1, NULL) == 0.5f);
+    col_free(col_float);
+
+    struct col *col_int64 = col_int64_dummy_create("int64", SIZE);
+    const col_int64_span_t int64_span = col_int64_span(col_int64, &err);
+    assert(err == COL_ERR_OK && int64_span.len == SIZE);
+    int64_span.ptr[SIZE - 1] = INT64_MIN;
+    assert(*col_int64_at(col_int64, SIZE - 1, NULL) == INT64_MIN);
+    col_free(col_int64);
+
+    struct col *col_int32 = col_int32_dummy_create("int32", SIZE);
+    const col_int32_span_t int32_span = col_int32_span(col_int32, &err);
+    assert(err == COL_ERR_OK && int32_span.len == SIZE);
+    int32_span.ptr[SIZE - 1] = INT32_MIN;
+    assert(*col_int32_at(col_int32, SIZE - 1, NULL) == INT32_MIN);
+    col_free(col_int32);
+
+    struct col *col_uint8 = col_uint8_dummy_create("uint8", SIZE);
+    const col_uint8_span_t uint8_span = col_uint8_span(col_uint8, &err);
+    assert(err == COL_ERR_OK && uint8_span.len == SIZE);
+    uint8_span.ptr[SIZE - 1] = UINT8_MAX;
+    assert(*col_uint8_at(col_uint8, SIZE - 1, NULL) == UINT8_MAX);
+    col_free(col_uint8);
+
+    /* valid: validity bits are left as they are */
+    struct col *col_null = col_double_dummy_create("null", SIZE);
+    assert(col_set_null(col_null, 0) == COL_ERR_OK);
+    const col_double_span_t null_span = col_double_span(col_null, &err);
+    assert(err == COL_ERR_OK);
+    null_span.ptr[0] = 1.0;
+    assert(col_is_null(col_null, 0, NULL) == 1);
+    assert(col_null->null_count == 1);
+    col_free(col_null);
+}
+
+void test_col_span_shared() {
+    int err;
+
+    /* valid: a clone keeps its rows when the source is written */
+    struct col *col = col_int32_dummy_create("int32", SIZE);
+    struct col *clone = col_clone(col, NULL);
+    assert(clone);
+    const col_int32_span_t span = col_int32_span(col, &err);
+    assert(err == COL_ERR_OK && span.len == SIZE);
+    for (size_t i = 0; i < span.len; i++)
+        span.ptr[i] = -1;
+    assert(*col_int32_at(clone, SIZE - 1, NULL) != -1);
+    assert(col_int32_cspan(clone, NULL).ptr != span.ptr);
+    col_free(clone);
+
+    /* valid: a slice copies its rows, leaving the source unchanged */
+    struct col *slice = col_slice(col, 1, 2, NULL);
+    assert(slice);
+    const col_int32_span_t slice_span = col_int32_span(slice, &err);
+    assert(err == COL_ERR_OK && slice_span.len == 2);
+    slice_span.ptr[0] = 7;
+    assert(*col_int32_at(col, 1, NULL) == -1);
+    assert(*col_int32_at(slice, 0, NULL) == 7);
+    col_free(slice);
+
+    col_free(col);
+}
+
+void test_col_span_invalid() {
+    int err;
+    struct col *col = col_double_dummy_create("double", SIZE);
+
+    /* invalid */
+    const col_float_cspan_t cspan = col_float_cspan(col, &err);
+    assert(err == COL_ERR_INVALID_DTYPE && !cspan.ptr && cspan.len == 0);
+    const col_int64_span_t span = col_int64_span(col, &err);
+    assert(err == COL_ERR_INVALID_DTYPE && !span.ptr && span.len == 0);
+
+    col_free(col);
+}
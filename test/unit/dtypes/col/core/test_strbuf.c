@@ -0,0 +1,139 @@
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/accessors.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/col/core/modifiers.h"
+#include "dtypes/col/core/strbuf.h"
+#include "test_utils/col.h"
+
+void test_col_strbuf_layout();
+void test_col_strbuf_reserve();
+void test_col_strbuf_push();
+void test_col_strbuf_release();
+void test_col_strbuf_compact();
+
+static const size_t SIZE = 999;
+
+int main() {
+    test_col_strbuf_layout();
+    test_col_strbuf_reserve();
+    test_col_strbuf_push();
+    test_col_strbuf_release();
+    test_col_strbuf_compact();
+}
+
+void test_col_strbuf_layout() {
+    char **string_data = col_string_data_create(SIZE);
+    struct col *col = col_string_dummy_create("string", SIZE);
+
+    /* strings are packed back to back in row order */
+    size_t n_bytes = 0;
+    const size_t *offsets = col->data;
+    for (size_t i = 0; i < SIZE; i++) {
+        assert(offsets[i] == n_bytes);
+        n_bytes += strlen(string_data[i]) + 1;
+    }
+    assert(col->strbuf.len == n_bytes);
+    assert(col->strbuf.capacity >= n_bytes);
+    assert(col->strbuf.waste == 0);
+
+    /* clones share both buffers until written, then copy them */
+    struct col *clone = col_clone(col, NULL);
+    assert(clone->strbuf.bytes == col->strbuf.bytes);
+    assert(col_string_set(clone, "x", 0) == COL_ERR_OK);
+    assert(clone->strbuf.bytes != col->strbuf.bytes);
+    assert(memcmp(clone->strbuf.bytes, col->strbuf.bytes, n_bytes) == 0);
+    assert(strcmp(col_string_at(clone, 0, NULL), "x") == 0);
+    assert(strcmp(col_string_at(col, 0, NULL), string_data[0]) == 0);
+    col_free(clone);
+
+    col_free(col);
+    for (size_t i = 0; i < SIZE; i++)
+        free(string_data[i]);
+    free(string_data);
+}
+
+void test_col_strbuf_reserve() {
+    struct col *col = col_create("string", COL_DTYPE_STRING, NULL);
+    assert(col_strbuf_reserve(col, 100) == COL_ERR_OK);
+    assert(col->strbuf.capacity >= 100);
+    assert(col->strbuf.len == 0);
+
+    char *bytes = col->strbuf.bytes;
+    for (size_t i = 0; i < 10; i++)
+        assert(col_string_append(col, "123456789") == COL_ERR_OK);
+    assert(col->strbuf.bytes == bytes);
+    assert(col->strbuf.len == 100);
+
+    assert(col_strbuf_reserve(col, SIZE_MAX) == COL_ERR_OOM);
+    col_free(col);
+}
+
+void test_col_strbuf_push() {
+    struct col *col = col_string_dummy_create("string", SIZE);
+
+    /* values pointing into the column's own storage */
+    for (size_t i = 0; i < SIZE; i++)
+        assert(col_string_append(col, col_string_at(col, i, NULL)) == COL_ERR_OK);
+    assert(col->n_rows == SIZE * 2);
+    for (size_t i = 0; i < SIZE; i++)
+        assert(strcmp(
+            col_string_at(col, i, NULL),
+            col_string_at(col, i + SIZE, NULL)
+        ) == 0);
+
+    assert(col_string_set(col, col_string_at(col, 1, NULL), 0) == COL_ERR_OK);
+    assert(strcmp(col_string_at(col, 0, NULL), "Entry 1") == 0);
+    col_free(col);
+}
+
+void test_col_strbuf_release() {
+    struct col *col = col_string_dummy_create("string", SIZE);
+    const size_t len = col->strbuf.len;
+
+    assert(col_string_set(col, "foo", 0) == COL_ERR_OK);
+    assert(col->strbuf.waste == strlen("Entry 0") + 1);
+
+    assert(col_remove(col, 0) == COL_ERR_OK);
+    assert(col->strbuf.waste == strlen("Entry 0") + strlen("foo") + 2);
+    assert(col->strbuf.len == len + strlen("foo") + 1);
+    col_free(col);
+}
+
+void test_col_strbuf_compact() {
+    char **string_data = col_string_data_create(SIZE);
+    struct col *col = col_string_dummy_create("string", SIZE);
+
+    /* overwriting every row repeatedly must not grow without bound */
+    for (size_t round = 0; round < 8; round++)
+        for (size_t i = 0; i < SIZE; i++)
+            assert(col_string_set(col, string_data[SIZE - i - 1], i) == COL_ERR_OK);
+    assert(col->strbuf.capacity <= 8 * (col->strbuf.len - col->strbuf.waste));
+    for (size_t i = 0; i < SIZE; i++)
+        assert(strcmp(col_string_at(col, i, NULL), string_data[SIZE - i - 1]) == 0);
+
+    assert(col_remove_range(col, 0, SIZE / 2) == COL_ERR_OK);
+    assert(col_strbuf_compact(col, 0) == COL_ERR_OK);
+    assert(col->strbuf.waste == 0);
+
+    assert(col_shrink_to_fit(col) == COL_ERR_OK);
+    assert(col->strbuf.capacity == col->strbuf.len);
+    for (size_t i = 0; i < col->n_rows; i++)
+        assert(strcmp(
+            col_string_at(col, i, NULL),
+            string_data[SIZE - (i + SIZE / 2) - 1]
+        ) == 0);
+
+    assert(col_remove_range(col, 0, col->n_rows) == COL_ERR_OK);
+    assert(col_shrink_to_fit(col) == COL_ERR_OK);
+    assert(col->strbuf.bytes == NULL);
+    assert(col->strbuf.capacity == 0);
+    col_free(col);
+
+    for (size_t i = 0; i < SIZE; i++)
+        free(string_data[i]);
+    free(string_data);
+}
@@ -0,0 +1,249 @@
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/accessors.h"
+#include "dtypes/col/core/category.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/col/core/modifiers.h"
+#include "test_utils/col.h"
+
+void test_col_set_null();
+void test_col_append_null();
+void test_col_validity_insert();
+void test_col_validity_remove();
+void test_col_validity_concat();
+void test_col_validity_lifecycle();
+void test_col_validity_category();
+
+static const size_t SIZE = 999;
+
+static void validity_assert(const col_t *col, const uint8_t *nulls);
+
+int main() {
+    test_col_set_null();
+    test_col_append_null();
+    test_col_validity_insert();
+    test_col_validity_remove();
+    test_col_validity_concat();
+    test_col_validity_lifecycle();
+    test_col_validity_category();
+}
+
+void test_col_set_null() {
+    int err;
+
+    /* valid */
+    struct col *col = col_int32_dummy_create("int32", SIZE);
+    assert(col_validity_get(col) == NULL);
+    assert(col_is_null(col, 0, &err) == 0);
+    assert(err == COL_ERR_OK);
+
+    assert(col_set_null(col, 3) == COL_ERR_OK);
+    assert(col_set_null(col, 3) == COL_ERR_OK);
+    assert(col_set_null(col, SIZE - 1) == COL_ERR_OK);
+    assert(col_validity_get(col) != NULL);
+    assert(col_null_count(col) == 2);
+    assert(col_is_null(col, 3, NULL) == 1);
+    assert(col_is_null(col, 4, NULL) == 0);
+    assert(col_is_null(col, SIZE - 1, NULL) == 1);
+
+    assert(col_int32_set(col, 42, 3) == COL_ERR_OK);
+    assert(col_is_null(col, 3, NULL) == 0);
+    assert(col_null_count(col) == 1);
+
+    /* err */
+    assert(col_set_null(col, SIZE) == COL_ERR_OUT_OF_BOUNDS);
+    assert(col_is_null(col, SIZE, &err) == -1);
+    assert(err == COL_ERR_OUT_OF_BOUNDS);
+    col_free(col);
+}
+
+void test_col_append_null() {
+    struct col *col_double = col_create("double", COL_DTYPE_DOUBLE, NULL);
+    for (size_t i = 0; i < SIZE; i++) {
+        if (i % 3)
+            assert(col_double_append(col_double, (double)i) == COL_ERR_OK);
+        else
+            assert(col_append_null(col_double) == COL_ERR_OK);
+    }
+    assert(col_double->n_rows == SIZE);
+    assert(col_null_count(col_double) == SIZE / 3);
+    for (size_t i = 0; i < SIZE; i++) {
+        assert(col_is_null(col_double, i, NULL) == !(i % 3));
+        if (i % 3)
+            assert(*col_double_at(col_double, i, NULL) == (double)i);
+        else
+            assert(*col_double_at(col_double, i, NULL) == 0.0);
+    }
+    col_free(col_double);
+
+    struct col *col_string = col_create("string", COL_DTYPE_STRING, NULL);
+    assert(col_append_null(col_string) == COL_ERR_OK);
+    assert(col_string_append(col_string, "foo") == COL_ERR_OK);
+    assert(col_is_null(col_string, 0, NULL) == 1);
+    assert(col_is_null(col_string, 1, NULL) == 0);
+    assert(strcmp(col_string_at(col_string, 0, NULL), "") == 0);
+    col_free(col_string);
+}
+
+void test_col_validity_insert() {
+    uint8_t nulls[SIZE + 3];
+    memset(nulls, 0, sizeof(nulls));
+
+    struct col *col = col_int64_dummy_create("int64", SIZE);
+    for (size_t i = 0; i < SIZE; i += 5)
+        assert(col_set_null(col, i) == COL_ERR_OK);
+
+    const int64_t block[] = { 1, 2, 3 };
+    assert(col_insert_range(col, 7, block, 3) == COL_ERR_OK);
+    for (size_t i = 0, r = 0; r < SIZE + 3; r++) {
+        if (r >= 7 && r < 10)
+            continue;
+        nulls[r] = !(i % 5);
+        i++;
+    }
+    validity_assert(col, nulls);
+    col_free(col);
+}
+
+void test_col_validity_remove() {
+    uint8_t nulls[SIZE];
+    uint8_t mask[SIZE];
+
+    /* remove_range */
+    struct col *col = col_float_dummy_create("float", SIZE);
+    for (size_t i = 0; i < SIZE; i += 3)
+        assert(col_set_null(col, i) == COL_ERR_OK);
+    assert(col_remove_range(col, 5, 11) == COL_ERR_OK);
+    for (size_t i = 0, r = 0; i < SIZE; i++)
+        if (i < 5 || i >= 16)
+            nulls[r++] = !(i % 3);
+    validity_assert(col, nulls);
+    col_free(col);
+
+    /* remove_indices */
+    const size_t idx[] = { 0, 1, 2, 64, 65, SIZE - 1 };
+    col = col_float_dummy_create("float", SIZE);
+    for (size_t i = 0; i < SIZE; i += 3)
+        assert(col_set_null(col, i) == COL_ERR_OK);
+    assert(col_remove_indices(col, idx, 6) == COL_ERR_OK);
+    for (size_t i = 0, j = 0, r = 0; i < SIZE; i++) {
+        if (j < 6 && idx[j] == i) {
+            j++;
+            continue;
+        }
+        nulls[r++] = !(i % 3);
+    }
+    validity_assert(col, nulls);
+    col_free(col);
+
+    /* retain_mask */
+    col = col_string_dummy_create("string", SIZE);
+    for (size_t i = 0; i < SIZE; i += 3)
+        assert(col_set_null(col, i) == COL_ERR_OK);
+    for (size_t i = 0; i < SIZE; i++)
+        mask[i] = i % 2;
+    assert(col_retain_mask(col, mask) == COL_ERR_OK);
+    for (size_t i = 0, r = 0; i < SIZE; i++)
+        if (mask[i])
+            nulls[r++] = !(i % 3);
+    validity_assert(col, nulls);
+    col_free(col);
+}
+
+void test_col_validity_concat() {
+    uint8_t nulls[SIZE * 4];
+
+    struct col *col_a = col_uint8_dummy_create("a", SIZE);
+    struct col *col_b = col_uint8_dummy_create("b", SIZE);
+    assert(col_set_null(col_b, 1) == COL_ERR_OK);
+
+    /* valid dst, nullable src */
+    assert(col_concat(col_a, col_b) == COL_ERR_OK);
+    memset(nulls, 0, sizeof(nulls));
+    nulls[SIZE + 1] = 1;
+    validity_assert(col_a, nulls);
+
+    /* self */
+    assert(col_concat(col_a, col_a) == COL_ERR_OK);
+    nulls[SIZE * 3 + 1] = 1;
+    validity_assert(col_a, nulls);
+
+    /* nullable dst, valid src */
+    struct col *col_c = col_uint8_dummy_create("c", SIZE);
+    assert(col_concat(col_b, col_c) == COL_ERR_OK);
+    memset(nulls, 0, sizeof(nulls));
+    nulls[1] = 1;
+    validity_assert(col_b, nulls);
+
+    col_free(col_a);
+    col_free(col_b);
+    col_free(col_c);
+}
+
+void test_col_validity_lifecycle() {
+    uint8_t nulls[SIZE];
+    memset(nulls, 0, sizeof(nulls));
+
+    struct col *col = col_create("double", COL_DTYPE_DOUBLE, NULL);
+    for (size_t i = 0; i < SIZE; i++) {
+        nulls[i] = i % 7 == 0;
+        if (nulls[i])
+            assert(col_append_null(col) == COL_ERR_OK);
+        else
+            assert(col_double_append(col, 1.0) == COL_ERR_OK);
+    }
+
+    struct col *clone = col_clone(col, NULL);
+    validity_assert(clone, nulls);
+    col_free(clone);
+
+    assert(col_shrink_to_fit(col) == COL_ERR_OK);
+    validity_assert(col, nulls);
+    col_free(col);
+}
+
+void test_col_validity_category() {
+    struct col *col_string = col_string_dummy_create("string", SIZE);
+    assert(col_set_null(col_string, 0) == COL_ERR_OK);
+    assert(col_set_null(col_string, 10) == COL_ERR_OK);
+
+    struct col *col_category = col_category_from_string(col_string, NULL);
+    assert(col_null_count(col_category) == 2);
+    assert(col_is_null(col_category, 0, NULL) == 1);
+    assert(col_is_null(col_category, 10, NULL) == 1);
+    assert(col_category_dict_get(col_category, NULL)->n_rows == SIZE - 2);
+
+    struct col *col_back = col_category_to_string(col_category, NULL);
+    assert(col_null_count(col_back) == 2);
+    assert(col_is_null(col_back, 10, NULL) == 1);
+    for (size_t i = 1; i < SIZE; i++)
+        if (i != 10)
+            assert(strcmp(
+                col_string_at(col_back, i, NULL),
+                col_string_at(col_string, i, NULL)
+            ) == 0);
+
+    /* concatenating only nulls must not look up the empty dictionary */
+    struct col *col_nulls = col_create("nulls", COL_DTYPE_CATEGORY, NULL);
+    assert(col_append_null(col_nulls) == COL_ERR_OK);
+    assert(col_concat(col_category, col_nulls) == COL_ERR_OK);
+    assert(col_is_null(col_category, SIZE, NULL) == 1);
+    assert(col_null_count(col_category) == 3);
+
+    col_free(col_nulls);
+    col_free(col_back);
+    col_free(col_category);
+    col_free(col_string);
+}
+
+static void validity_assert(const col_t *col, const uint8_t *nulls) {
+    size_t null_count = 0;
+    for (size_t i = 0; i < col->n_rows; i++) {
+        assert(col_is_null(col, i, NULL) == nulls[i]);
+        null_count += nulls[i];
+    }
+    assert(col_null_count(col) == null_count);
+}
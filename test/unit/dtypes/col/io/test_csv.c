@@ -0,0 +1,445 @@
+#include <assert.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/accessors.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/col/core/modifiers.h"
+#include "dtypes/col/io/csv.h"
+
+void test_col_read_csv();
+void test_col_read_csv_quoted();
+void test_col_read_csv_dtypes();
+void test_col_csv_next();
+void test_col_read_csv_parallel();
+void test_col_read_csv_invalid();
+void test_col_write_csv();
+void test_col_write_csv_parallel();
+void test_col_write_csv_invalid();
+
+static const size_t SIZE = 999;
+static const char *PATH = "test_col_csv.csv";
+
+static void read_file(char *buf, const size_t size) {
+    FILE *file = fopen(PATH, "rb");
+    assert(file);
+    const size_t n = fread(buf, 1, size - 1, file);
+    buf[n] = '\0';
+    fclose(file);
+}
+
+static void write_file(const char *text) {
+    FILE *file = fopen(PATH, "wb");
+    assert(file);
+    fputs(text, file);
+    fclose(file);
+}
+
+int main() {
+    test_col_read_csv();
+    test_col_read_csv_quoted();
+    test_col_read_csv_dtypes();
+    test_col_csv_next();
+    test_col_read_csv_parallel();
+    test_col_read_csv_invalid();
+    test_col_write_csv();
+    test_col_write_csv_parallel();
+    test_col_write_csv_invalid();
+    remove(PATH);
+}
+
+void test_col_read_csv() {
+    int err = 0;
+    size_t n_cols = 0;
+
+    /* valid: dtypes are inferred, empty fields are null */
+    write_file(
+        "id,score,label,empty\n"
+        "1,0.5,a,\n"
+        "2,,b,\n"
+        "\n"
+        "3,1e3,,\n"
+        "4,2,d\n"
+    );
+    col_t **cols = col_read_csv(PATH, NULL, &n_cols, &err);
+    assert(err == COL_ERR_OK);
+    assert(n_cols == 4);
+
+    assert(strcmp(cols[0]->name, "id") == 0);
+    assert(cols[0]->dtype == COL_DTYPE_INT64);
+    assert(cols[0]->n_rows == 4);
+    assert(*col_int64_at(cols[0], 3, NULL) == 4);
+
+    assert(cols[1]->dtype == COL_DTYPE_DOUBLE);
+    assert(*col_double_at(cols[1], 0, NULL) == 0.5);
+    assert(*col_double_at(cols[1], 2, NULL) == 1000.0);
+    assert(col_is_null(cols[1], 1, NULL));
+    assert(cols[1]->null_count == 1);
+
+    assert(cols[2]->dtype == COL_DTYPE_STRING);
+    assert(strcmp(col_string_at(cols[2], 1, NULL), "b") == 0);
+    assert(col_is_null(cols[2], 2, NULL));
+
+    assert(cols[3]->dtype == COL_DTYPE_DOUBLE);
+    assert(cols[3]->null_count == 4);
+    col_csv_cols_free(cols, n_cols);
+
+    /* valid: no header, CRLF line endings and a missing final newline */
+    col_csv_options_t options = col_csv_options_default();
+    options.header = 0;
+    write_file("1;x\r\n2;y\r\n3;z");
+    options.delim = ';';
+    cols = col_read_csv(PATH, &options, &n_cols, &err);
+    assert(err == COL_ERR_OK);
+    assert(n_cols == 2);
+    assert(strcmp(cols[1]->name, "column_1") == 0);
+    assert(cols[0]->n_rows == 3);
+    assert(strcmp(col_string_at(cols[1], 1, NULL), "y") == 0);
+    assert(strcmp(col_string_at(cols[1], 2, NULL), "z") == 0);
+    col_csv_cols_free(cols, n_cols);
+
+    /* valid: a header alone gives empty columns */
+    write_file("\xEF\xBB\xBF" "a,b\n");
+    cols = col_read_csv(PATH, NULL, &n_cols, &err);
+    assert(err == COL_ERR_OK);
+    assert(n_cols == 2);
+    assert(strcmp(cols[0]->name, "a") == 0);
+    assert(cols[0]->n_rows == 0);
+    col_csv_cols_free(cols, n_cols);
+}
+
+void test_col_read_csv_quoted() {
+    int err = 0;
+    size_t n_cols = 0;
+
+    /* valid: delimiters, newlines and escaped quotes inside quotes */
+    write_file(
+        "\"name, full\",quote\n"
+        "\"Doe, Jane\",\"she said \"\"hi\"\"\"\n"
+        "\"multi\nline\",\"\"\n"
+    );
+    col_t **cols = col_read_csv(PATH, NULL, &n_cols, &err);
+    assert(err == COL_ERR_OK);
+    assert(n_cols == 2);
+    assert(strcmp(cols[0]->name, "name, full") == 0);
+    assert(cols[0]->n_rows == 2);
+    assert(strcmp(col_string_at(cols[0], 0, NULL), "Doe, Jane") == 0);
+    assert(strcmp(col_string_at(cols[1], 0, NULL), "she said \"hi\"") == 0);
+    assert(strcmp(col_string_at(cols[0], 1, NULL), "multi\nline") == 0);
+
+    /* quoted empty fields are empty strings, not nulls */
+    assert(strcmp(col_string_at(cols[1], 1, NULL), "") == 0);
+    assert(!col_is_null(cols[1], 1, NULL));
+    col_csv_cols_free(cols, n_cols);
+}
+
+void test_col_read_csv_dtypes() {
+    int err = 0;
+    size_t n_cols = 0;
+
+    /* valid: given dtypes, including category */
+    write_file("a,b,c\n1,x,2.5\n2,y,\n3,x,4\n");
+    const col_dtype_t dtypes[] = {
+        COL_DTYPE_INT32,
+        COL_DTYPE_CATEGORY,
+        COL_DTYPE_FLOAT
+    };
+    col_csv_options_t options = col_csv_options_default();
+    options.dtypes = dtypes;
+    options.n_dtypes = 3;
+
+    col_t **cols = col_read_csv(PATH, &options, &n_cols, &err);
+    assert(err == COL_ERR_OK);
+    assert(cols[0]->dtype == COL_DTYPE_INT32);
+    assert(*col_int32_at(cols[0], 2, NULL) == 3);
+    assert(cols[1]->dtype == COL_DTYPE_CATEGORY);
+    assert(cols[1]->dict->values->n_rows == 2);
+    assert(strcmp(col_category_at(cols[1], 2, NULL), "x") == 0);
+    assert(*col_float_at(cols[2], 0, NULL) == 2.5f);
+    assert(col_is_null(cols[2], 1, NULL));
+    col_csv_cols_free(cols, n_cols);
+
+    /* invalid: values that do not fit */
+    write_file("a,b,c\n1,x,2.5\nfoo,y,1\n");
+    assert(col_read_csv(PATH, &options, &n_cols, &err) == NULL);
+    assert(err == COL_ERR_PARSE);
+
+    /* invalid: wrong number of dtypes */
+    options.n_dtypes = 2;
+    assert(col_read_csv(PATH, &options, &n_cols, &err) == NULL);
+    assert(err == COL_ERR_INVALID_ARG);
+}
+
+void test_col_csv_next() {
+    int err = 0;
+
+    /* valid: small chunks stream every row exactly once */
+    FILE *file = fopen(PATH, "wb");
+    fputs("idx,text\n", file);
+    for (size_t i = 0; i < SIZE; i++)
+        fprintf(file, "%zu,\"row\n%zu\"\n", i, i);
+    fclose(file);
+
+    col_csv_options_t options = col_csv_options_default();
+    options.chunk_bytes = 64;
+    col_csv_reader_t *reader = col_csv_open(PATH, &options, &err);
+    assert(err == COL_ERR_OK);
+    assert(col_csv_n_cols(reader) == 2);
+
+    size_t n_rows = 0;
+    size_t n_chunks = 0;
+    col_t **chunk;
+    while ((chunk = col_csv_next(reader, &err))) {
+        for (size_t i = 0; i < chunk[0]->n_rows; i++) {
+            char expected[32];
+            snprintf(expected, sizeof(expected), "row\n%zu", n_rows + i);
+            assert(*col_int64_at(chunk[0], i, NULL) == (int64_t)(n_rows + i));
+            assert(strcmp(col_string_at(chunk[1], i, NULL), expected) == 0);
+        }
+        n_rows += chunk[0]->n_rows;
+        n_chunks++;
+        col_csv_cols_free(chunk, 2);
+    }
+    assert(err == COL_ERR_OK);
+    assert(n_rows == SIZE);
+    assert(n_chunks > 1);
+
+    /* the end stays the end */
+    assert(col_csv_next(reader, &err) == NULL);
+    assert(err == COL_ERR_OK);
+    col_csv_close(reader);
+
+    /* valid: a row longer than a chunk */
+    write_file("a\nxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\n");
+    options.chunk_bytes = 4;
+    size_t n_cols = 0;
+    col_t **cols = col_read_csv(PATH, &options, &n_cols, &err);
+    assert(err == COL_ERR_OK);
+    assert(strlen(col_string_at(cols[0], 0, NULL)) == 36);
+    col_csv_cols_free(cols, n_cols);
+}
+
+void test_col_read_csv_parallel() {
+    int err = 0;
+    size_t n_cols = 0;
+    const size_t n = 100000;
+
+    /* valid: chunks split across threads keep row order */
+    FILE *file = fopen(PATH, "wb");
+    fputs("i,x,s\n", file);
+    for (size_t i = 0; i < n; i++)
+        fprintf(file, "%zu,%zu.25,\"s,%zu\"\n", i, i, i % 7);
+    fclose(file);
+
+    for (size_t n_threads = 1; n_threads <= 4; n_threads += 3) {
+        col_csv_options_t options = col_csv_options_default();
+        options.n_threads = n_threads;
+        col_t **cols = col_read_csv(PATH, &options, &n_cols, &err);
+        assert(err == COL_ERR_OK);
+        assert(cols[0]->n_rows == n);
+        for (size_t i = 0; i < n; i += 997) {
+            char expected[32];
+            snprintf(expected, sizeof(expected), "s,%zu", i % 7);
+            assert(*col_int64_at(cols[0], i, NULL) == (int64_t)i);
+            assert(*col_double_at(cols[1], i, NULL) == (double)i + 0.25);
+            assert(strcmp(col_string_at(cols[2], i, NULL), expected) == 0);
+        }
+        col_csv_cols_free(cols, n_cols);
+    }
+}
+
+void test_col_read_csv_invalid() {
+    int err = 0;
+    size_t n_cols = 0;
+
+    /* invalid: missing file */
+    assert(col_read_csv("missing.csv", NULL, &n_cols, &err) == NULL);
+    assert(err == COL_ERR_IO);
+
+    /* invalid: empty file */
+    write_file("");
+    assert(col_read_csv(PATH, NULL, &n_cols, &err) == NULL);
+    assert(err == COL_ERR_NO_DATA);
+
+    /* invalid: more fields than the header */
+    write_file("a,b\n1,2\n3,4,5\n");
+    assert(col_read_csv(PATH, NULL, &n_cols, &err) == NULL);
+    assert(err == COL_ERR_PARSE);
+
+    /* invalid: options */
+    col_csv_options_t options = col_csv_options_default();
+    options.delim = '"';
+    assert(col_csv_open(PATH, &options, &err) == NULL);
+    assert(err == COL_ERR_INVALID_ARG);
+
+    assert(col_read_csv(NULL, NULL, &n_cols, &err) == NULL);
+    assert(err == COL_ERR_NO_DATA);
+}
+
+void test_col_write_csv() {
+    int err = 0;
+    char text[256];
+
+    /* valid: every dtype, nulls and quoting */
+    const double doubles[] = {0.1, -2.5, 1e300};
+    const float floats[] = {0.1f, 3.0f, -4.0f};
+    const int64_t int64s[] = {-9, 0, 9000000000};
+    const int32_t int32s[] = {1, -2, 3};
+    const uint8_t uint8s[] = {255, 0, 7};
+    col_t *cols[7] = {
+        col_create_array("d", doubles, 3, COL_DTYPE_DOUBLE, &err),
+        col_create_array("f", floats, 3, COL_DTYPE_FLOAT, &err),
+        col_create_array("i64", int64s, 3, COL_DTYPE_INT64, &err),
+        col_create_array("i32", int32s, 3, COL_DTYPE_INT32, &err),
+        col_create_array("u8", uint8s, 3, COL_DTYPE_UINT8, &err),
+        col_create("s, t", COL_DTYPE_STRING, &err),
+        col_create("c", COL_DTYPE_CATEGORY, &err)
+    };
+    col_string_append(cols[5], "plain");
+    col_string_append(cols[5], "say \"hi\"\n");
+    col_string_append(cols[5], "");
+    col_category_append(cols[6], "x");
+    col_category_append(cols[6], "y,z");
+    col_category_append(cols[6], "x");
+    col_set_null(cols[1], 1);
+    col_set_null(cols[6], 2);
+
+    assert(col_write_csv(cols, 7, PATH, NULL) == COL_ERR_OK);
+    read_file(text, sizeof(text));
+    assert(strcmp(
+        text,
+        "d,f,i64,i32,u8,\"s, t\",c\n"
+        "0.1,0.1,-9,1,255,plain,x\n"
+        "-2.5,,0,-2,0,\"say \"\"hi\"\"\n\",\"y,z\"\n"
+        "1e+300,-4.0,9000000000,3,7,\"\",\n"
+    ) == 0);
+
+    /* valid: reads back to the same values */
+    size_t n_cols = 0;
+    col_t **read = col_read_csv(PATH, NULL, &n_cols, &err);
+    assert(err == COL_ERR_OK);
+    assert(n_cols == 7);
+    assert(strcmp(read[5]->name, "s, t") == 0);
+    assert(*col_double_at(read[0], 0, NULL) == 0.1);
+    assert(*col_double_at(read[0], 2, NULL) == 1e300);
+    assert(col_is_null(read[1], 1, NULL));
+    assert(strcmp(col_string_at(read[5], 1, NULL), "say \"hi\"\n") == 0);
+    assert(strcmp(col_string_at(read[5], 2, NULL), "") == 0);
+    assert(col_is_null(read[6], 2, NULL));
+    col_csv_cols_free(read, n_cols);
+
+    /* valid: integral doubles stay doubles, numeric strings need dtypes */
+    const double integral[] = {1.0, -2.0};
+    col_t *round[2] = {
+        col_create_array("d", integral, 2, COL_DTYPE_DOUBLE, &err),
+        col_create("s", COL_DTYPE_STRING, &err)
+    };
+    col_string_append(round[1], "1");
+    col_string_append(round[1], "2");
+    assert(col_write_csv(round, 2, PATH, NULL) == COL_ERR_OK);
+    read_file(text, sizeof(text));
+    assert(strcmp(text, "d,s\n1.0,1\n-2.0,2\n") == 0);
+
+    read = col_read_csv(PATH, NULL, &n_cols, &err);
+    assert(err == COL_ERR_OK);
+    assert(read[0]->dtype == COL_DTYPE_DOUBLE);
+    assert(*col_double_at(read[0], 1, NULL) == -2.0);
+    assert(read[1]->dtype == COL_DTYPE_INT64);
+    col_csv_cols_free(read, n_cols);
+
+    const col_dtype_t dtypes[] = {COL_DTYPE_DOUBLE, COL_DTYPE_STRING};
+    col_csv_options_t options = col_csv_options_default();
+    options.dtypes = dtypes;
+    options.n_dtypes = 2;
+    read = col_read_csv(PATH, &options, &n_cols, &err);
+    assert(err == COL_ERR_OK);
+    assert(read[1]->dtype == COL_DTYPE_STRING);
+    assert(strcmp(col_string_at(read[1], 1, NULL), "2") == 0);
+    col_csv_cols_free(read, n_cols);
+    col_free(round[0]);
+    col_free(round[1]);
+
+    /* valid: no header and another delimiter */
+    options = col_csv_options_default();
+    options.header = 0;
+    options.delim = ';';
+    assert(col_write_csv(cols + 5, 2, PATH, &options) == COL_ERR_OK);
+    read_file(text, sizeof(text));
+    assert(strcmp(text, "plain;x\n\"say \"\"hi\"\"\n\";y,z\n\"\";\n") == 0);
+
+    /* valid: a file descriptor */
+    FILE *file = fopen(PATH, "wb");
+    assert(col_write_csv_fd(cols + 2, 1, fileno(file), NULL) == COL_ERR_OK);
+    fclose(file);
+    read_file(text, sizeof(text));
+    assert(strcmp(text, "i64\n-9\n0\n9000000000\n") == 0);
+
+    for (size_t j = 0; j < 7; j++)
+        col_free(cols[j]);
+}
+
+void test_col_write_csv_parallel() {
+    int err = 0;
+    const size_t n = 100000;
+
+    /* valid: small chunks on several threads keep row order */
+    col_t *cols[2] = {
+        col_create("i", COL_DTYPE_INT64, &err),
+        col_create("x", COL_DTYPE_DOUBLE, &err)
+    };
+    for (size_t i = 0; i < n; i++) {
+        col_int64_append(cols[0], (int64_t)i);
+        col_double_append(cols[1], (double)i / 3);
+    }
+
+    col_csv_options_t options = col_csv_options_default();
+    options.n_threads = 4;
+    options.chunk_bytes = 4096;
+    assert(col_write_csv(cols, 2, PATH, &options) == COL_ERR_OK);
+
+    size_t n_cols = 0;
+    col_t **read = col_read_csv(PATH, NULL, &n_cols, &err);
+    assert(err == COL_ERR_OK);
+    assert(read[0]->n_rows == n);
+    for (size_t i = 0; i < n; i++) {
+        assert(*col_int64_at(read[0], i, NULL) == (int64_t)i);
+        assert(*col_double_at(read[1], i, NULL) == (double)i / 3);
+    }
+    col_csv_cols_free(read, n_cols);
+
+    col_free(cols[0]);
+    col_free(cols[1]);
+}
+
+void test_col_write_csv_invalid() {
+    int err = 0;
+    const double data[] = {1, 2};
+    col_t *cols[2] = {
+        col_create_array("a", data, 2, COL_DTYPE_DOUBLE, &err),
+        col_create_array("b", data, 1, COL_DTYPE_DOUBLE, &err)
+    };
+
+    /* invalid: unequal row counts */
+    assert(col_write_csv(cols, 2, PATH, NULL) == COL_ERR_INVALID_ARG);
+
+    /* invalid: options */
+    col_csv_options_t options = col_csv_options_default();
+    options.quote = ',';
+    assert(col_write_csv(cols, 1, PATH, &options) == COL_ERR_INVALID_ARG);
+
+    /* invalid: destinations */
+    assert(col_write_csv(cols, 1, "missing/dir/out.csv", NULL) == COL_ERR_IO);
+    assert(col_write_csv_fd(cols, 1, -1, NULL) == COL_ERR_IO);
+
+    /* invalid: no columns */
+    assert(col_write_csv(NULL, 1, PATH, NULL) == COL_ERR_NO_DATA);
+    assert(col_write_csv(cols, 0, PATH, NULL) == COL_ERR_NO_DATA);
+    assert(col_write_csv(cols, 1, NULL, NULL) == COL_ERR_NO_DATA);
+
+    col_free(cols[0]);
+    col_free(cols[1]);
+}
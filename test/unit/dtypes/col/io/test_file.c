@@ -0,0 +1,233 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/accessors.h"
+#include "dtypes/col/core/category.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/col/core/modifiers.h"
+#include "dtypes/col/io/file.h"
+#include "test_utils/col.h"
+
+void test_col_save_numeric();
+void test_col_save_string();
+void test_col_save_category();
+void test_col_open_mmap_lifetime();
+void test_col_open_mmap_invalid();
+
+static const size_t SIZE = 999;
+static const char *PATH = "test_col_file.col";
+
+int main() {
+    test_col_save_numeric();
+    test_col_save_string();
+    test_col_save_category();
+    test_col_open_mmap_lifetime();
+    test_col_open_mmap_invalid();
+    remove(PATH);
+}
+
+void test_col_save_numeric() {
+    int err = 0;
+
+    /* valid: values and null rows round trip */
+    struct col *col_double = col_double_dummy_create("double", SIZE);
+    assert(col_set_null(col_double, 7) == COL_ERR_OK);
+    assert(col_save(col_double, PATH) == COL_ERR_OK);
+
+    struct col *mapped = col_open_mmap(PATH, &err);
+    assert(err == COL_ERR_OK);
+    assert(strcmp(mapped->name, "double") == 0);
+    assert(mapped->dtype == COL_DTYPE_DOUBLE);
+    assert(mapped->n_rows == SIZE);
+    assert(mapped->flags & COL_FLAG_BORROWED);
+    assert((uintptr_t)mapped->data % COL_DATA_ALIGN == 0);
+    assert(memcmp(mapped->data, col_double->data, SIZE * sizeof(double)) == 0);
+    assert(mapped->null_count == 1);
+    assert(col_is_null(mapped, 7, NULL));
+    assert(!col_is_null(mapped, 8, NULL));
+    col_free(mapped);
+
+    /* valid: mutation copies and leaves the file untouched */
+    mapped = col_open_mmap(PATH, &err);
+    const double val = -1.0;
+    assert(col_set(mapped, &val, 0) == COL_ERR_OK);
+    assert(!(mapped->flags & COL_FLAG_BORROWED));
+    assert(*col_double_at(mapped, 0, NULL) == val);
+    col_free(mapped);
+
+    mapped = col_open_mmap(PATH, &err);
+    assert(*col_double_at(mapped, 0, NULL) == *col_double_at(col_double, 0, NULL));
+    col_free(mapped);
+    col_free(col_double);
+
+    /* valid: empty column */
+    struct col *col_uint8 = col_create("uint8", COL_DTYPE_UINT8, &err);
+    assert(col_save(col_uint8, PATH) == COL_ERR_OK);
+    mapped = col_open_mmap(PATH, &err);
+    assert(err == COL_ERR_OK);
+    assert(mapped->n_rows == 0);
+    assert(col_append(mapped, &(uint8_t){ 3 }) == COL_ERR_OK);
+    assert(*col_uint8_at(mapped, 0, NULL) == 3);
+    col_free(mapped);
+    col_free(col_uint8);
+
+    /* invalid */
+    assert(col_save(NULL, PATH) == COL_ERR_NO_DATA);
+}
+
+void test_col_save_string() {
+    int err = 0;
+
+    /* valid: overwritten rows are not written */
+    struct col *col_string = col_string_dummy_create("string", SIZE);
+    assert(col_set(col_string, "overwritten", 3) == COL_ERR_OK);
+    assert(col_set_null(col_string, 4) == COL_ERR_OK);
+    assert(col_save(col_string, PATH) == COL_ERR_OK);
+
+    struct col *mapped = col_open_mmap(PATH, &err);
+    assert(err == COL_ERR_OK);
+    assert(mapped->strbuf.len < col_string->strbuf.len);
+    for (size_t i = 0; i < SIZE; i++) {
+        const char *a = col_string_at(mapped, i, NULL);
+        const char *b = col_string_at(col_string, i, NULL);
+        assert(strcmp(a, b) == 0);
+    }
+    assert(col_is_null(mapped, 4, NULL));
+
+    /* valid: appending detaches */
+    assert(col_append(mapped, "appended") == COL_ERR_OK);
+    assert(strcmp(col_string_at(mapped, SIZE, NULL), "appended") == 0);
+    assert(strcmp(col_string_at(mapped, 3, NULL), "overwritten") == 0);
+    col_free(mapped);
+    col_free(col_string);
+}
+
+void test_col_save_category() {
+    int err = 0;
+
+    /* valid: codes map, the dictionary is indexed */
+    struct col *col_category = col_category_dummy_create("category", SIZE, 300);
+    assert(col_save(col_category, PATH) == COL_ERR_OK);
+
+    struct col *mapped = col_open_mmap(PATH, &err);
+    assert(err == COL_ERR_OK);
+    assert(mapped->stride == col_category->stride);
+    for (size_t i = 0; i < SIZE; i++) {
+        const char *a = col_category_at(mapped, i, NULL);
+        const char *b = col_category_at(col_category, i, NULL);
+        assert(strcmp(a, b) == 0);
+    }
+
+    const char *first = col_category_at(col_category, 0, NULL);
+    assert(
+        col_category_code_of(mapped, first, NULL)
+            == col_category_code_of(col_category, first, NULL)
+    );
+
+    /* valid: new categories extend a private dictionary */
+    assert(col_set(mapped, "new category", 0) == COL_ERR_OK);
+    assert(strcmp(col_category_at(mapped, 0, NULL), "new category") == 0);
+    assert(strcmp(col_category_at(mapped, 1, NULL),
+        col_category_at(col_category, 1, NULL)) == 0);
+    col_free(mapped);
+    col_free(col_category);
+}
+
+void test_col_open_mmap_lifetime() {
+    int err = 0;
+
+    struct col *col_int32 = col_int32_dummy_create("int32", SIZE);
+    assert(col_save(col_int32, PATH) == COL_ERR_OK);
+
+    /* valid: clones share the mapping, slices keep it alive */
+    struct col *mapped = col_open_mmap(PATH, &err);
+    struct col *clone = col_clone(mapped, &err);
+    assert(err == COL_ERR_OK);
+    assert(clone->data == mapped->data);
+    assert(clone->flags & COL_FLAG_BORROWED);
+
+    struct col *view = col_slice(mapped, 10, 100, &err);
+    assert(err == COL_ERR_OK);
+    col_free(mapped);
+    col_free(clone);
+
+    assert(*col_int32_at(view, 0, NULL) == *col_int32_at(col_int32, 10, NULL));
+    assert(*col_int32_at(view, 99, NULL) == *col_int32_at(col_int32, 109, NULL));
+
+    /* valid: the last holder detaches and releases the mapping */
+    assert(col_set(view, &(int32_t){ 5 }, 0) == COL_ERR_OK);
+    assert(view->share == NULL);
+    assert(*col_int32_at(view, 1, NULL) == *col_int32_at(col_int32, 11, NULL));
+    col_free(view);
+    col_free(col_int32);
+}
+
+void test_col_open_mmap_invalid() {
+    int err = 0;
+
+    /* invalid: missing file */
+    assert(col_open_mmap("missing.col", &err) == NULL);
+    assert(err == COL_ERR_IO);
+
+    assert(col_open_mmap(NULL, &err) == NULL);
+    assert(err == COL_ERR_NO_DATA);
+
+    /* invalid: not a column file */
+    FILE *file = fopen(PATH, "wb");
+    fputs("name,value\na,1\n", file);
+    fclose(file);
+    assert(col_open_mmap(PATH, &err) == NULL);
+    assert(err == COL_ERR_PARSE);
+
+    /* invalid: unsupported version and truncated sections */
+    struct col *col_double = col_double_dummy_create("double", SIZE);
+    assert(col_save(col_double, PATH) == COL_ERR_OK);
+
+    file = fopen(PATH, "r+b");
+    fseek(file, 8, SEEK_SET);
+    const uint32_t version = COL_FILE_VERSION + 1;
+    fwrite(&version, sizeof(version), 1, file);
+    fclose(file);
+    assert(col_open_mmap(PATH, &err) == NULL);
+    assert(err == COL_ERR_PARSE);
+
+    assert(col_save(col_double, PATH) == COL_ERR_OK);
+    file = fopen(PATH, "r+b");
+    fseek(file, 0, SEEK_END);
+    const long len = ftell(file);
+    fclose(file);
+
+    char *buf = malloc((size_t)len);
+    file = fopen(PATH, "rb");
+    assert(fread(buf, 1, (size_t)len, file) == (size_t)len);
+    fclose(file);
+    file = fopen(PATH, "wb");
+    fwrite(buf, 1, (size_t)len / 2, file);
+    fclose(file);
+    free(buf);
+    assert(col_open_mmap(PATH, &err) == NULL);
+    assert(err == COL_ERR_PARSE);
+
+    col_free(col_double);
+
+    /* invalid: a dictionary string outside the dictionary bytes */
+    struct col *col_category = col_category_dummy_create("category", SIZE, 10);
+    assert(col_save(col_category, PATH) == COL_ERR_OK);
+
+    uint64_t dict_offset;
+    file = fopen(PATH, "r+b");
+    fseek(file, 88, SEEK_SET);
+    assert(fread(&dict_offset, sizeof(dict_offset), 1, file) == 1);
+    fseek(file, (long)dict_offset, SEEK_SET);
+    const uint64_t str_offset = UINT64_MAX / 2;
+    fwrite(&str_offset, sizeof(str_offset), 1, file);
+    fclose(file);
+    assert(col_open_mmap(PATH, &err) == NULL);
+    assert(err == COL_ERR_PARSE);
+
+    col_free(col_category);
+}
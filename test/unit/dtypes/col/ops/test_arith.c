@@ -0,0 +1,430 @@
+#include <assert.h>
+#include <math.h>
+#include <stdint.h>
+
+#include "core/cpu.h"
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/accessors.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/col/core/modifiers.h"
+#include "dtypes/col/ops/arith.h"
+#include "test_utils/col.h"
+
+void test_col_binary();
+void test_col_binary_scalar();
+void test_col_binary_int();
+void test_col_fma();
+void test_col_unary();
+void test_col_clip();
+void test_col_arith_into();
+void test_col_arith_nulls();
+void test_col_arith_isa();
+
+static const size_t SIZE = 999;
+
+int main() {
+    test_col_binary();
+    test_col_binary_scalar();
+    test_col_binary_int();
+    test_col_fma();
+    test_col_unary();
+    test_col_clip();
+    test_col_arith_into();
+    test_col_arith_nulls();
+    test_col_arith_isa();
+}
+
+void test_col_binary() {
+    int err;
+
+    /* valid */
+    col_t *a = col_double_dummy_create("a", SIZE);
+    col_t *b = col_double_dummy_create("b", SIZE);
+    const double *x = col_double_get(a, NULL);
+
+    col_t *sum = col_binary(a, b, COL_OP_ADD, &err);
+    assert(err == COL_ERR_OK);
+    assert(sum->n_rows == SIZE && sum->dtype == COL_DTYPE_DOUBLE);
+    col_t *diff = col_binary(a, b, COL_OP_SUB, &err);
+    col_t *prod = col_binary(a, b, COL_OP_MUL, &err);
+    col_t *quot = col_binary(a, b, COL_OP_DIV, &err);
+    for (size_t i = 0; i < SIZE; i++) {
+        assert(col_double_get(sum, NULL)[i] == x[i] + x[i]);
+        assert(col_double_get(diff, NULL)[i] == 0.0);
+        assert(col_double_get(prod, NULL)[i] == x[i] * x[i]);
+    }
+    assert(isnan(col_double_get(quot, NULL)[0]));
+    assert(col_double_get(quot, NULL)[1] == 1.0);
+    col_free(sum);
+    col_free(diff);
+    col_free(prod);
+    col_free(quot);
+
+    /* float */
+    col_t *f = col_float_dummy_create("f", SIZE);
+    col_t *fsum = col_binary(f, f, COL_OP_ADD, &err);
+    for (size_t i = 0; i < SIZE; i++)
+        assert(col_float_get(fsum, NULL)[i] == 2 * col_float_get(f, NULL)[i]);
+    col_free(fsum);
+
+    /* err */
+    assert(col_binary(a, f, COL_OP_ADD, &err) == NULL);
+    assert(err == COL_ERR_INVALID_DTYPE);
+    col_free(f);
+
+    col_remove(b, 0);
+    assert(col_binary(a, b, COL_OP_ADD, &err) == NULL);
+    assert(err == COL_ERR_INVALID_ARG);
+    assert(col_binary(a, a, COL_BINOPS, &err) == NULL);
+    assert(err == COL_ERR_INVALID_ARG);
+    col_free(a);
+    col_free(b);
+
+    col_t *s = col_string_dummy_create("s", SIZE);
+    assert(col_binary(s, s, COL_OP_ADD, &err) == NULL);
+    assert(err == COL_ERR_INVALID_DTYPE);
+    col_free(s);
+}
+
+void test_col_binary_scalar() {
+    int err;
+
+    /* valid */
+    col_t *a = col_double_dummy_create("a", SIZE);
+    const double *x = col_double_get(a, NULL);
+    col_t *res = col_binary_scalar(a, 0.5, COL_OP_MUL, &err);
+    assert(err == COL_ERR_OK);
+    for (size_t i = 0; i < SIZE; i++)
+        assert(col_double_get(res, NULL)[i] == x[i] * 0.5);
+    col_free(res);
+
+    res = col_binary_scalar(a, 0.0, COL_OP_DIV, &err);
+    assert(err == COL_ERR_OK);
+    assert(isnan(col_double_get(res, NULL)[0]));
+    assert(isinf(col_double_get(res, NULL)[1]));
+    col_free(res);
+
+    res = col_binary_scalar(a, 1.0, COL_OP_SUB, &err);
+    assert(col_double_get(res, NULL)[0] == -1.0);
+    col_free(res);
+    col_free(a);
+
+    /* err: integer scalars must be exact */
+    col_t *i32 = col_int32_dummy_create("i32", SIZE);
+    assert(col_binary_scalar(i32, 0.5, COL_OP_MUL, &err) == NULL);
+    assert(err == COL_ERR_INVALID_ARG);
+    assert(col_binary_scalar(i32, 1e10, COL_OP_ADD, &err) == NULL);
+    assert(err == COL_ERR_INVALID_ARG);
+    assert(col_binary_scalar(i32, NAN, COL_OP_ADD, &err) == NULL);
+    assert(err == COL_ERR_INVALID_ARG);
+    assert(col_binary_scalar(i32, 0, COL_OP_DIV, &err) == NULL);
+    assert(err == COL_ERR_INVALID_ARG);
+    col_free(i32);
+
+    col_t *u8 = col_uint8_dummy_create("u8", SIZE);
+    assert(col_binary_scalar(u8, -1, COL_OP_ADD, &err) == NULL);
+    assert(err == COL_ERR_INVALID_ARG);
+    col_free(u8);
+}
+
+void test_col_binary_int() {
+    int err;
+
+    /* valid: wrapping */
+    const int32_t xs[] = { INT32_MAX, INT32_MIN, 7, -7, 5 };
+    const int32_t ys[] = { 1, -1, 2, 2, 0 };
+    col_t *a = col_create_array("a", xs, 5, COL_DTYPE_INT32, NULL);
+    col_t *b = col_create_array("b", ys, 5, COL_DTYPE_INT32, NULL);
+
+    col_t *res = col_binary(a, b, COL_OP_ADD, &err);
+    assert(err == COL_ERR_OK);
+    assert(col_int32_get(res, NULL)[0] == INT32_MIN);
+    assert(col_int32_get(res, NULL)[1] == INT32_MAX);
+    col_free(res);
+
+    /* truncating division, INT_MIN / -1 wraps, zero divisor is null */
+    res = col_binary(a, b, COL_OP_DIV, &err);
+    assert(err == COL_ERR_OK);
+    assert(col_int32_get(res, NULL)[1] == INT32_MIN);
+    assert(col_int32_get(res, NULL)[2] == 3);
+    assert(col_int32_get(res, NULL)[3] == -3);
+    assert(col_null_count(res) == 1);
+    assert(col_is_null(res, 4, NULL) == 1);
+    assert(col_is_null(a, 4, NULL) == 0);
+    col_free(res);
+    col_free(a);
+    col_free(b);
+
+    const uint8_t us[] = { 250, 10 };
+    a = col_create_array("u8", us, 2, COL_DTYPE_UINT8, NULL);
+    res = col_binary_scalar(a, 10, COL_OP_ADD, &err);
+    assert(col_uint8_get(res, NULL)[0] == 4);
+    assert(col_uint8_get(res, NULL)[1] == 20);
+    col_free(res);
+    col_free(a);
+
+    const int64_t ls[] = { -9, 9 };
+    a = col_create_array("i64", ls, 2, COL_DTYPE_INT64, NULL);
+    res = col_binary_scalar(a, -3, COL_OP_DIV, &err);
+    assert(col_int64_get(res, NULL)[0] == 3);
+    assert(col_int64_get(res, NULL)[1] == -3);
+    col_free(res);
+    col_free(a);
+}
+
+void test_col_fma() {
+    int err;
+
+    /* valid */
+    col_t *a = col_double_dummy_create("a", SIZE);
+    const double *x = col_double_get(a, NULL);
+    col_t *res = col_fma(a, a, a, &err);
+    assert(err == COL_ERR_OK);
+    for (size_t i = 0; i < SIZE; i++)
+        assert(fabs(col_double_get(res, NULL)[i] - (x[i] * x[i] + x[i]))
+            <= 1e-12 * (x[i] * x[i] + x[i]));
+    col_free(res);
+
+    res = col_fma_scalar(a, 2.0, -1.0, &err);
+    assert(err == COL_ERR_OK);
+    for (size_t i = 0; i < SIZE; i++)
+        assert(col_double_get(res, NULL)[i] == x[i] * 2.0 - 1.0);
+    col_free(res);
+
+    col_t *i64 = col_int64_dummy_create("i64", SIZE);
+    res = col_fma_scalar(i64, 3, 1, &err);
+    for (size_t i = 0; i < SIZE; i++)
+        assert(col_int64_get(res, NULL)[i] == (int64_t)i * 64 * 3 + 1);
+    col_free(res);
+
+    /* err */
+    assert(col_fma(a, a, i64, &err) == NULL);
+    assert(err == COL_ERR_INVALID_DTYPE);
+    assert(col_fma_scalar(i64, 1.5, 0, &err) == NULL);
+    assert(err == COL_ERR_INVALID_ARG);
+    col_free(i64);
+    col_free(a);
+}
+
+void test_col_unary() {
+    int err;
+
+    /* valid */
+    const double xs[] = { -4, 0, 4, 1 };
+    col_t *a = col_create_array("a", xs, 4, COL_DTYPE_DOUBLE, NULL);
+    col_t *res = col_unary(a, COL_OP_ABS, &err);
+    assert(err == COL_ERR_OK);
+    assert(col_double_get(res, NULL)[0] == 4.0);
+    col_free(res);
+
+    res = col_unary(a, COL_OP_SQRT, &err);
+    assert(isnan(col_double_get(res, NULL)[0]));
+    assert(col_double_get(res, NULL)[2] == 2.0);
+    col_free(res);
+
+    res = col_unary(a, COL_OP_LOG, &err);
+    assert(isinf(col_double_get(res, NULL)[1]));
+    assert(col_double_get(res, NULL)[3] == 0.0);
+    col_free(res);
+
+    res = col_unary(a, COL_OP_EXP, &err);
+    assert(col_double_get(res, NULL)[1] == 1.0);
+    col_free(res);
+    col_free(a);
+
+    const float fs[] = { -2.25f, 2.25f };
+    a = col_create_array("f", fs, 2, COL_DTYPE_FLOAT, NULL);
+    res = col_unary(a, COL_OP_ABS, &err);
+    assert(col_float_get(res, NULL)[0] == 2.25f);
+    col_free(res);
+    res = col_unary(a, COL_OP_SQRT, &err);
+    assert(col_float_get(res, NULL)[1] == 1.5f);
+    col_free(res);
+    col_free(a);
+
+    const int32_t is[] = { INT32_MIN, -3, 3 };
+    a = col_create_array("i32", is, 3, COL_DTYPE_INT32, NULL);
+    res = col_unary(a, COL_OP_ABS, &err);
+    assert(err == COL_ERR_OK);
+    assert(col_int32_get(res, NULL)[0] == INT32_MIN);
+    assert(col_int32_get(res, NULL)[1] == 3);
+    col_free(res);
+
+    /* err */
+    assert(col_unary(a, COL_OP_SQRT, &err) == NULL);
+    assert(err == COL_ERR_INVALID_DTYPE);
+    assert(col_unary(a, COL_UNOPS, &err) == NULL);
+    assert(err == COL_ERR_INVALID_ARG);
+    col_free(a);
+}
+
+void test_col_clip() {
+    int err;
+
+    /* valid */
+    const double xs[] = { -5, 0.5, NAN, 5 };
+    col_t *a = col_create_array("a", xs, 4, COL_DTYPE_DOUBLE, NULL);
+    col_t *res = col_clip(a, 0, 1, &err);
+    assert(err == COL_ERR_OK);
+    assert(col_double_get(res, NULL)[0] == 0.0);
+    assert(col_double_get(res, NULL)[1] == 0.5);
+    assert(isnan(col_double_get(res, NULL)[2]));
+    assert(col_double_get(res, NULL)[3] == 1.0);
+    col_free(res);
+
+    /* integer bounds round inwards and saturate */
+    const int32_t is[] = { -5, 0, 2, 5 };
+    col_t *i32 = col_create_array("i32", is, 4, COL_DTYPE_INT32, NULL);
+    res = col_clip(i32, -0.5, 2.5, &err);
+    assert(err == COL_ERR_OK);
+    assert(col_int32_get(res, NULL)[0] == 0);
+    assert(col_int32_get(res, NULL)[3] == 2);
+    col_free(res);
+
+    res = col_clip(i32, -INFINITY, 1e20, &err);
+    assert(err == COL_ERR_OK);
+    assert(col_int32_get(res, NULL)[0] == -5);
+    col_free(res);
+
+    /* err */
+    assert(col_clip(a, 1, 0, &err) == NULL);
+    assert(err == COL_ERR_INVALID_ARG);
+    assert(col_clip(a, NAN, 0, &err) == NULL);
+    assert(err == COL_ERR_INVALID_ARG);
+    assert(col_clip(i32, 0.2, 0.8, &err) == NULL);
+    assert(err == COL_ERR_INVALID_ARG);
+    col_free(i32);
+    col_free(a);
+}
+
+void test_col_arith_into() {
+    /* valid: dst grows to fit */
+    col_t *a = col_double_dummy_create("a", SIZE);
+    const double *x = col_double_get(a, NULL);
+    col_t *dst = col_create("dst", COL_DTYPE_DOUBLE, NULL);
+    assert(col_binary_into(dst, a, a, COL_OP_ADD) == COL_ERR_OK);
+    assert(dst->n_rows == SIZE);
+    assert(col_double_get(dst, NULL)[SIZE - 1] == 2 * x[SIZE - 1]);
+
+    /* reused without reallocating */
+    const void *data = dst->data;
+    assert(col_binary_scalar_into(dst, a, 1, COL_OP_ADD) == COL_ERR_OK);
+    assert(dst->data == data);
+    assert(col_double_get(dst, NULL)[0] == 1.0);
+
+    /* dst may alias an operand */
+    assert(col_binary_into(dst, a, dst, COL_OP_SUB) == COL_ERR_OK);
+    assert(col_double_get(dst, NULL)[0] == -1.0);
+
+    /* in-place */
+    assert(col_binary_scalar_inplace(dst, 3, COL_OP_MUL) == COL_ERR_OK);
+    assert(col_double_get(dst, NULL)[0] == -3.0);
+    assert(col_fma_scalar_inplace(dst, -1, 3) == COL_ERR_OK);
+    assert(col_double_get(dst, NULL)[0] == 6.0);
+    assert(col_clip_inplace(dst, 0, 5) == COL_ERR_OK);
+    assert(col_double_get(dst, NULL)[0] == 5.0);
+    assert(col_unary_inplace(dst, COL_OP_SQRT) == COL_ERR_OK);
+    assert(col_double_get(dst, NULL)[0] == sqrt(5.0));
+    assert(col_binary_inplace(dst, dst, COL_OP_SUB) == COL_ERR_OK);
+    assert(col_double_get(dst, NULL)[0] == 0.0);
+    assert(col_fma_inplace(dst, a, a) == COL_ERR_OK);
+    assert(col_double_get(dst, NULL)[1] == x[1]);
+
+    /* err */
+    col_t *f = col_create("f", COL_DTYPE_FLOAT, NULL);
+    assert(col_binary_into(f, a, a, COL_OP_ADD) == COL_ERR_INVALID_DTYPE);
+    assert(col_unary_into(NULL, a, COL_OP_ABS) == COL_ERR_NO_DATA);
+    assert(col_clip_into(dst, NULL, 0, 1) == COL_ERR_NO_DATA);
+    col_free(f);
+    col_free(dst);
+    col_free(a);
+}
+
+void test_col_arith_nulls() {
+    int err;
+
+    /* valid: result rows are null if any operand row is */
+    col_t *a = col_double_dummy_create("a", SIZE);
+    col_t *b = col_double_dummy_create("b", SIZE);
+    col_set_null(a, 3);
+    col_set_null(b, 5);
+    col_set_null(b, SIZE - 1);
+
+    col_t *res = col_binary(a, b, COL_OP_ADD, &err);
+    assert(err == COL_ERR_OK);
+    assert(col_null_count(res) == 3);
+    assert(col_is_null(res, 3, NULL) == 1);
+    assert(col_is_null(res, 5, NULL) == 1);
+    assert(col_is_null(res, SIZE - 1, NULL) == 1);
+    assert(col_is_null(res, 4, NULL) == 0);
+
+    /* an `_into` over non-null operands clears stale nulls */
+    col_t *c = col_double_dummy_create("c", SIZE);
+    assert(col_binary_into(res, c, c, COL_OP_ADD) == COL_ERR_OK);
+    assert(col_null_count(res) == 0);
+    assert(col_is_null(res, 3, NULL) == 0);
+
+    assert(col_unary_into(res, a, COL_OP_ABS) == COL_ERR_OK);
+    assert(col_null_count(res) == 1);
+    assert(col_is_null(res, 3, NULL) == 1);
+
+    assert(col_fma_into(res, c, c, b) == COL_ERR_OK);
+    assert(col_null_count(res) == 2);
+    assert(col_is_null(res, 5, NULL) == 1);
+    col_free(res);
+
+    /* in-place keeps the column's own nulls */
+    assert(col_binary_inplace(a, c, COL_OP_MUL) == COL_ERR_OK);
+    assert(col_null_count(a) == 1);
+    assert(col_is_null(a, 3, NULL) == 1);
+
+    col_free(a);
+    col_free(b);
+    col_free(c);
+}
+
+void test_col_arith_isa() {
+    /* valid: every code path the host supports matches the scalar result */
+    const mlc_isa_t host = mlc_cpu_isa_detect();
+    for (size_t n = 1; n < 40; n++) {
+        mlc_cpu_isa_limit(MLC_ISA_SCALAR);
+        col_t *a = col_double_dummy_create("a", n);
+        col_t *f = col_float_dummy_create("f", n);
+        col_t *ref_add = col_binary_scalar(a, 2.5, COL_OP_SUB, NULL);
+        col_t *ref_div = col_binary(f, f, COL_OP_DIV, NULL);
+        col_t *ref_abs = col_unary(ref_add, COL_OP_ABS, NULL);
+        col_t *ref_clip = col_clip(f, 3, 50, NULL);
+        col_t *ref_fma = col_fma_scalar(f, 2, 1, NULL);
+
+        for (mlc_isa_t isa = MLC_ISA_SSE2; isa <= host; isa++) {
+            mlc_cpu_isa_limit(isa);
+            col_t *add = col_binary_scalar(a, 2.5, COL_OP_SUB, NULL);
+            col_t *div = col_binary(f, f, COL_OP_DIV, NULL);
+            col_t *mag = col_unary(add, COL_OP_ABS, NULL);
+            col_t *clip = col_clip(f, 3, 50, NULL);
+            col_t *fma = col_fma_scalar(f, 2, 1, NULL);
+            for (size_t i = 0; i < n; i++) {
+                assert(col_double_get(add, NULL)[i] == col_double_get(ref_add, NULL)[i]);
+                assert(col_double_get(mag, NULL)[i] == col_double_get(ref_abs, NULL)[i]);
+                assert(col_float_get(clip, NULL)[i] == col_float_get(ref_clip, NULL)[i]);
+                assert(col_float_get(fma, NULL)[i] == col_float_get(ref_fma, NULL)[i]);
+                if (i)
+                    assert(col_float_get(div, NULL)[i] == col_float_get(ref_div, NULL)[i]);
+            }
+            col_free(add);
+            col_free(div);
+            col_free(mag);
+            col_free(clip);
+            col_free(fma);
+        }
+
+        col_free(ref_add);
+        col_free(ref_div);
+        col_free(ref_abs);
+        col_free(ref_clip);
+        col_free(ref_fma);
+        col_free(a);
+        col_free(f);
+    }
+    mlc_cpu_isa_limit(MLC_ISA_COUNT);
+}
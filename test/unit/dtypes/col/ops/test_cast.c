@@ -0,0 +1,363 @@
+#include <assert.h>
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "core/cpu.h"
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/accessors.h"
+#include "dtypes/col/core/category.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/col/core/modifiers.h"
+#include "dtypes/col/ops/cast.h"
+#include "test_utils/col.h"
+
+void test_col_cast_widen();
+void test_col_cast_narrow();
+void test_col_cast_nulls();
+void test_col_cast_inplace();
+void test_col_cast_isa();
+void test_col_parse();
+void test_col_parse_category();
+void test_col_cast_string();
+
+static const size_t SIZE = 999;
+
+int main() {
+    test_col_cast_widen();
+    test_col_cast_narrow();
+    test_col_cast_nulls();
+    test_col_cast_inplace();
+    test_col_cast_isa();
+    test_col_parse();
+    test_col_parse_category();
+    test_col_cast_string();
+}
+
+void test_col_cast_widen() {
+    int err;
+
+    /* valid */
+    col_t *i32 = col_int32_dummy_create("i32", SIZE);
+    col_t *dbl = col_cast(i32, COL_DTYPE_DOUBLE, &err);
+    assert(err == COL_ERR_OK);
+    assert(dbl->dtype == COL_DTYPE_DOUBLE && dbl->n_rows == SIZE);
+    assert(strcmp(dbl->name, "i32") == 0);
+    col_t *i64 = col_cast(i32, COL_DTYPE_INT64, &err);
+    col_t *flt = col_cast(i32, COL_DTYPE_FLOAT, &err);
+    for (size_t i = 0; i < SIZE; i++) {
+        assert(col_double_get(dbl, NULL)[i] == (double)(i * 32));
+        assert(col_int64_get(i64, NULL)[i] == (int64_t)(i * 32));
+        assert(col_float_get(flt, NULL)[i] == (float)(i * 32));
+    }
+    col_free(dbl);
+    col_free(i64);
+    col_free(flt);
+    col_free(i32);
+
+    col_t *u8 = col_uint8_dummy_create("u8", SIZE);
+    for (col_dtype_t dtype = COL_DTYPE_DOUBLE; dtype < COL_DTYPE_UINT8; dtype++) {
+        col_t *res = col_cast(u8, dtype, &err);
+        assert(err == COL_ERR_OK);
+        col_t *back = col_cast(res, COL_DTYPE_UINT8, &err);
+        assert(err == COL_ERR_OK);
+        assert(col_null_count(back) == 0);
+        assert(memcmp(back->data, u8->data, SIZE) == 0);
+        col_free(res);
+        col_free(back);
+    }
+    col_free(u8);
+
+    /* same dtype clones */
+    col_t *f = col_float_dummy_create("f", SIZE);
+    col_t *same = col_cast(f, COL_DTYPE_FLOAT, &err);
+    assert(err == COL_ERR_OK && same != f);
+    assert(memcmp(same->data, f->data, SIZE * sizeof(float)) == 0);
+    col_free(same);
+
+    /* empty columns cast to any dtype, their own included */
+    col_t *empty = col_create("empty", COL_DTYPE_INT32, NULL);
+    for (col_dtype_t dtype = COL_DTYPE_DOUBLE; dtype <= COL_DTYPE_UINT8; dtype++) {
+        err = -1;
+        same = col_cast(empty, dtype, &err);
+        assert(err == COL_ERR_OK);
+        assert(same->n_rows == 0 && same->dtype == dtype);
+        col_free(same);
+    }
+    col_free(empty);
+
+    /* err */
+    assert(col_cast(f, COL_DTYPE_STRING, &err) == NULL);
+    assert(err == COL_ERR_INVALID_DTYPE);
+    assert(col_cast(f, 99, &err) == NULL);
+    assert(err == COL_ERR_INVALID_DTYPE);
+    assert(col_cast(NULL, COL_DTYPE_DOUBLE, &err) == NULL);
+    assert(err == COL_ERR_NO_DATA);
+    col_free(f);
+}
+
+void test_col_cast_narrow() {
+    int err;
+
+    /* valid: truncation towards zero, unrepresentable values become null */
+    const double xs[] = { 1.9, -1.9, NAN, 1e300, -1e300, 255.5, -0.5, 3e9 };
+    col_t *dbl = col_create_array("d", xs, 8, COL_DTYPE_DOUBLE, NULL);
+
+    col_t *i32 = col_cast(dbl, COL_DTYPE_INT32, &err);
+    assert(err == COL_ERR_OK);
+    const int32_t *v32 = col_int32_get(i32, NULL);
+    assert(v32[0] == 1 && v32[1] == -1 && v32[5] == 255 && v32[6] == 0);
+    assert(col_null_count(i32) == 4);
+    assert(col_is_null(i32, 2, NULL) && col_is_null(i32, 3, NULL));
+    assert(col_is_null(i32, 4, NULL) && col_is_null(i32, 7, NULL));
+    col_free(i32);
+
+    col_t *u8 = col_cast(dbl, COL_DTYPE_UINT8, &err);
+    assert(col_uint8_get(u8, NULL)[0] == 1);
+    assert(col_uint8_get(u8, NULL)[5] == 255);
+    assert(col_uint8_get(u8, NULL)[6] == 0);
+    assert(col_is_null(u8, 1, NULL) == 1);
+    assert(col_null_count(u8) == 5);
+    col_free(u8);
+
+    col_t *i64 = col_cast(dbl, COL_DTYPE_INT64, &err);
+    assert(col_int64_get(i64, NULL)[7] == 3000000000LL);
+    assert(col_null_count(i64) == 3);
+    col_free(i64);
+
+    /* double -> float rounds, overflow saturates to infinity */
+    col_t *flt = col_cast(dbl, COL_DTYPE_FLOAT, &err);
+    assert(col_float_get(flt, NULL)[0] == 1.9f);
+    assert(isinf(col_float_get(flt, NULL)[3]));
+    assert(col_null_count(flt) == 0);
+    col_free(flt);
+    col_free(dbl);
+
+    const double wide[] = { 1e300, -1e300, NAN, 3.5e38, -3.5e38 };
+    dbl = col_create_array("w", wide, 5, COL_DTYPE_DOUBLE, NULL);
+    flt = col_cast(dbl, COL_DTYPE_FLOAT, &err);
+    assert(err == COL_ERR_OK);
+    assert(col_float_get(flt, NULL)[0] == INFINITY);
+    assert(col_float_get(flt, NULL)[1] == -INFINITY);
+    assert(isnan(col_float_get(flt, NULL)[2]));
+    assert(col_float_get(flt, NULL)[3] == INFINITY);
+    assert(col_float_get(flt, NULL)[4] == -INFINITY);
+    assert(col_null_count(flt) == 0);
+    col_free(flt);
+    col_free(dbl);
+
+    const int64_t ls[] = { INT64_MAX, -1, 300, 7 };
+    i64 = col_create_array("l", ls, 4, COL_DTYPE_INT64, NULL);
+    i32 = col_cast(i64, COL_DTYPE_INT32, &err);
+    assert(col_is_null(i32, 0, NULL) == 1);
+    assert(col_int32_get(i32, NULL)[1] == -1);
+    assert(col_null_count(i32) == 1);
+    u8 = col_cast(i32, COL_DTYPE_UINT8, &err);
+    assert(col_null_count(u8) == 3);
+    assert(col_uint8_get(u8, NULL)[3] == 7);
+    col_free(u8);
+    col_free(i32);
+    col_free(i64);
+}
+
+void test_col_cast_nulls() {
+    int err;
+
+    /* valid: nulls carry over */
+    col_t *f = col_float_dummy_create("f", SIZE);
+    col_set_null(f, 0);
+    col_set_null(f, SIZE - 1);
+    col_t *d = col_cast(f, COL_DTYPE_DOUBLE, &err);
+    assert(col_null_count(d) == 2);
+    assert(col_is_null(d, SIZE - 1, NULL) == 1);
+    assert(col_is_null(d, 1, NULL) == 0);
+
+    /* a null row holding an unrepresentable value is only counted once */
+    ((double *)d->data)[0] = NAN;
+    col_t *i = col_cast(d, COL_DTYPE_INT32, &err);
+    assert(col_null_count(i) == 2);
+    col_free(i);
+    col_free(d);
+    col_free(f);
+}
+
+void test_col_cast_inplace() {
+    /* valid: double -> float halves the buffer */
+    col_t *d = col_double_dummy_create("d", SIZE);
+    col_t *ref = col_cast(d, COL_DTYPE_FLOAT, NULL);
+    assert(col_cast_inplace(d, COL_DTYPE_FLOAT) == COL_ERR_OK);
+    assert(d->dtype == COL_DTYPE_FLOAT);
+    assert(d->stride == sizeof(float));
+    assert(memcmp(d->data, ref->data, SIZE * sizeof(float)) == 0);
+
+    /* the column keeps working after the cast */
+    assert(col_float_append(d, 1.5f) == COL_ERR_OK);
+    assert(col_float_get(d, NULL)[SIZE] == 1.5f);
+    col_free(ref);
+
+    /* checked narrowing marks nulls */
+    const double xs[] = { 1, NAN, 3 };
+    col_t *small = col_create_array("s", xs, 3, COL_DTYPE_DOUBLE, NULL);
+    assert(col_cast_inplace(small, COL_DTYPE_INT32) == COL_ERR_OK);
+    assert(col_int32_get(small, NULL)[2] == 3);
+    assert(col_null_count(small) == 1);
+    assert(col_is_null(small, 1, NULL) == 1);
+
+    /* same stride */
+    assert(col_cast_inplace(small, COL_DTYPE_FLOAT) == COL_ERR_OK);
+    assert(col_float_get(small, NULL)[0] == 1.0f);
+    assert(col_null_count(small) == 1);
+
+    /* err: widening needs a new buffer */
+    assert(col_cast_inplace(small, COL_DTYPE_DOUBLE) == COL_ERR_INVALID_ARG);
+    assert(col_cast_inplace(small, COL_DTYPE_STRING) == COL_ERR_INVALID_DTYPE);
+    assert(col_cast_inplace(NULL, COL_DTYPE_FLOAT) == COL_ERR_NO_DATA);
+    col_free(small);
+    col_free(d);
+
+    col_t *s = col_string_dummy_create("s", SIZE);
+    assert(col_cast_inplace(s, COL_DTYPE_UINT8) == COL_ERR_INVALID_DTYPE);
+    col_free(s);
+}
+
+void test_col_cast_isa() {
+    /* valid: every code path the host supports matches the scalar result */
+    const mlc_isa_t host = mlc_cpu_isa_detect();
+    const size_t n = 67;
+    col_t *srcs[] = {
+        col_double_dummy_create("d", n),
+        col_float_dummy_create("f", n),
+        col_int64_dummy_create("l", n),
+        col_int32_dummy_create("i", n),
+        col_uint8_dummy_create("u", n)
+    };
+    for (size_t s = 0; s < 5; s++) {
+        for (col_dtype_t dtype = COL_DTYPE_DOUBLE; dtype <= COL_DTYPE_UINT8; dtype++) {
+            mlc_cpu_isa_limit(MLC_ISA_SCALAR);
+            col_t *ref = col_cast(srcs[s], dtype, NULL);
+            for (mlc_isa_t isa = MLC_ISA_SSE2; isa <= host; isa++) {
+                mlc_cpu_isa_limit(isa);
+                col_t *res = col_cast(srcs[s], dtype, NULL);
+                assert(memcmp(res->data, ref->data, n * res->stride) == 0);
+                assert(col_null_count(res) == col_null_count(ref));
+
+                col_t *copy = col_clone(srcs[s], NULL);
+                if (col_cast_inplace(copy, dtype) == COL_ERR_OK)
+                    assert(memcmp(copy->data, ref->data, n * res->stride) == 0);
+                col_free(copy);
+                col_free(res);
+            }
+            col_free(ref);
+        }
+    }
+    for (size_t s = 0; s < 5; s++)
+        col_free(srcs[s]);
+    mlc_cpu_isa_limit(MLC_ISA_COUNT);
+}
+
+void test_col_parse() {
+    int err;
+    size_t row;
+
+    /* valid */
+    col_t *s = col_create("s", COL_DTYPE_STRING, NULL);
+    col_string_append(s, " 42 ");
+    col_string_append(s, "-7");
+    col_string_append(s, "");
+    col_string_append(s, "+255");
+    col_append_null(s);
+
+    col_t *i32 = col_parse(s, COL_DTYPE_INT32, &row, &err);
+    assert(err == COL_ERR_OK);
+    assert(row == SIZE_MAX);
+    assert(col_int32_get(i32, NULL)[0] == 42);
+    assert(col_int32_get(i32, NULL)[1] == -7);
+    assert(col_int32_get(i32, NULL)[3] == 255);
+    assert(col_null_count(i32) == 2);
+    assert(col_is_null(i32, 2, NULL) && col_is_null(i32, 4, NULL));
+    col_free(i32);
+
+    col_t *d = col_cast(s, COL_DTYPE_DOUBLE, &err);
+    assert(err == COL_ERR_OK);
+    assert(col_double_get(d, NULL)[1] == -7.0);
+    col_free(d);
+
+    col_string_append(s, "1e-3");
+    col_string_append(s, "nan");
+    col_t *f = col_parse(s, COL_DTYPE_FLOAT, &row, &err);
+    assert(err == COL_ERR_OK);
+    assert(col_float_get(f, NULL)[5] == 1e-3f);
+    assert(isnan(col_float_get(f, NULL)[6]));
+    col_free(f);
+
+    /* err: reports the first bad row */
+    assert(col_parse(s, COL_DTYPE_INT64, &row, &err) == NULL);
+    assert(err == COL_ERR_PARSE);
+    assert(row == 5);
+
+    col_string_set(s, "12abc", 5);
+    assert(col_parse(s, COL_DTYPE_DOUBLE, &row, &err) == NULL);
+    assert(err == COL_ERR_PARSE);
+    assert(row == 5);
+    col_free(s);
+
+    s = col_create("s", COL_DTYPE_STRING, NULL);
+    col_string_append(s, "255");
+    col_string_append(s, "256");
+    assert(col_parse(s, COL_DTYPE_UINT8, &row, &err) == NULL);
+    assert(err == COL_ERR_PARSE && row == 1);
+    col_string_set(s, "99999999999999999999", 1);
+    assert(col_parse(s, COL_DTYPE_INT64, &row, &err) == NULL);
+    assert(err == COL_ERR_PARSE && row == 1);
+    assert(col_parse(s, COL_DTYPE_STRING, &row, &err) == NULL);
+    assert(err == COL_ERR_INVALID_DTYPE);
+    col_free(s);
+
+    col_t *num = col_double_dummy_create("d", SIZE);
+    assert(col_parse(num, COL_DTYPE_INT32, &row, &err) == NULL);
+    assert(err == COL_ERR_INVALID_DTYPE);
+    col_free(num);
+}
+
+void test_col_parse_category() {
+    int err;
+    size_t row;
+
+    /* valid */
+    const char *vals[] = { "1.5", "2", "1.5", "", "2" };
+    col_t *s = col_create_array("s", vals, 5, COL_DTYPE_STRING, NULL);
+    col_t *cat = col_category_from_string(s, NULL);
+    col_set_null(cat, 4);
+    col_t *d = col_cast(cat, COL_DTYPE_DOUBLE, &err);
+    assert(err == COL_ERR_OK);
+    assert(col_double_get(d, NULL)[0] == 1.5);
+    assert(col_double_get(d, NULL)[1] == 2.0);
+    assert(col_double_get(d, NULL)[2] == 1.5);
+    assert(col_null_count(d) == 2);
+    assert(col_is_null(d, 3, NULL) && col_is_null(d, 4, NULL));
+    col_free(d);
+
+    /* err: the bad category is reported at its first row */
+    assert(col_parse(cat, COL_DTYPE_INT32, &row, &err) == NULL);
+    assert(err == COL_ERR_PARSE);
+    assert(row == 0);
+    col_free(cat);
+    col_free(s);
+}
+
+void test_col_cast_string() {
+    int err;
+
+    /* valid: string <-> category */
+    col_t *s = col_category_dummy_create("c", SIZE, 7);
+    col_t *str = col_cast(s, COL_DTYPE_STRING, &err);
+    assert(err == COL_ERR_OK);
+    assert(str->dtype == COL_DTYPE_STRING);
+    col_t *cat = col_cast(str, COL_DTYPE_CATEGORY, &err);
+    assert(err == COL_ERR_OK);
+    for (size_t i = 0; i < SIZE; i++)
+        assert(strcmp(col_category_at(cat, i, NULL), col_category_at(s, i, NULL)) == 0);
+    col_free(cat);
+    col_free(str);
+    col_free(s);
+}
@@ -0,0 +1,345 @@
+#include <assert.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/cpu.h"
+#include "core/thread.h"
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/accessors.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/col/core/modifiers.h"
+#include "dtypes/col/ops/distinct.h"
+#include "test_utils/random.h"
+
+void test_col_unique();
+void test_col_value_counts();
+void test_col_ndistinct();
+void test_col_hll();
+void test_col_hll_merge();
+void test_col_distinct_invalid();
+
+/* Large enough to be split into chunks */
+static const size_t LARGE = 200000;
+static const size_t LARGE_DISTINCT = 50000;
+
+/* `n` random values below `n_distinct`, every 17th row null */
+static col_t *distinct_dummy_create(const size_t n, const size_t n_distinct, int64_t *vals) {
+    col_t *col = col_create_with_capacity("value", n, COL_DTYPE_INT64, NULL);
+    for (size_t i = 0; i < n; i++) {
+        vals[i] = (int64_t)(next_random() % n_distinct);
+        if (i % 17 == 16)
+            assert(col_append_null(col) == 0);
+        else
+            assert(col_int64_append(col, vals[i]) == 0);
+    }
+    return col;
+}
+
+/* Relative error of an estimate */
+static double rel_err(const double estimate, const size_t exact) {
+    return fabs(estimate - (double)exact) / (double)exact;
+}
+
+int main() {
+    test_col_unique();
+    test_col_value_counts();
+    test_col_ndistinct();
+    test_col_hll();
+    test_col_hll_merge();
+    test_col_distinct_invalid();
+}
+
+void test_col_unique() {
+    int err = -1;
+
+    /* valid: first appearance order, nulls kept once */
+    col_t *col = col_create("ints", COL_DTYPE_INT64, NULL);
+    const int64_t ints[] = {3, 1, 3, 0, 2, 1, 0};
+    for (size_t i = 0; i < 7; i++) {
+        if (i == 3 || i == 6)
+            assert(col_append_null(col) == 0);
+        else
+            assert(col_int64_append(col, ints[i]) == 0);
+    }
+    col_t *res = col_unique(col, &err);
+    assert(err == COL_ERR_OK);
+    assert(res->n_rows == 4);
+    assert(res->dtype == COL_DTYPE_INT64);
+    assert(!strcmp(res->name, "ints"));
+    assert(*col_int64_at(res, 0, NULL) == 3);
+    assert(*col_int64_at(res, 1, NULL) == 1);
+    assert(col_is_null(res, 2, NULL) == 1);
+    assert(*col_int64_at(res, 3, NULL) == 2);
+    assert(res->null_count == 1);
+    col_free(res);
+    col_free(col);
+
+    /* valid: NaN is one value and -0.0 equals 0.0 */
+    col = col_create("floats", COL_DTYPE_DOUBLE, NULL);
+    const double floats[] = {0.0, -0.0, NAN, 1.5, -NAN, 1.5};
+    for (size_t i = 0; i < 6; i++)
+        assert(col_double_append(col, floats[i]) == 0);
+    res = col_unique(col, &err);
+    assert(err == COL_ERR_OK);
+    assert(res->n_rows == 3);
+    assert(*col_double_at(res, 0, NULL) == 0.0);
+    assert(isnan(*col_double_at(res, 1, NULL)));
+    assert(*col_double_at(res, 2, NULL) == 1.5);
+    col_free(res);
+    col_free(col);
+
+    /* valid: strings */
+    col = col_create("strings", COL_DTYPE_STRING, NULL);
+    const char *strings[] = {"b", "a", "", "b", "a"};
+    for (size_t i = 0; i < 5; i++)
+        assert(col_string_append(col, strings[i]) == 0);
+    res = col_unique(col, &err);
+    assert(err == COL_ERR_OK);
+    assert(res->n_rows == 3);
+    for (size_t i = 0; i < 3; i++)
+        assert(!strcmp(col_string_at(res, i, NULL), strings[i]));
+    col_free(res);
+
+    /* valid: empty */
+    col_t *empty = col_create("empty", COL_DTYPE_STRING, NULL);
+    res = col_unique(empty, &err);
+    assert(err == COL_ERR_OK);
+    assert(res->n_rows == 0);
+    col_free(res);
+    col_free(empty);
+    col_free(col);
+}
+
+void test_col_value_counts() {
+    col_t *col = col_create("letters", COL_DTYPE_STRING, NULL);
+    const char *letters[] = {"c", "a", "b", "a", "b", "b", "d"};
+    for (size_t i = 0; i < 7; i++)
+        assert(col_string_append(col, letters[i]) == 0);
+
+    /* valid: first appearance order */
+    col_t *values = NULL;
+    col_t *counts = NULL;
+    assert(col_value_counts(col, 0, &values, &counts) == 0);
+    const char *exp_values[] = {"c", "a", "b", "d"};
+    const int64_t exp_counts[] = {1, 2, 3, 1};
+    assert(values->n_rows == 4);
+    assert(counts->n_rows == 4);
+    assert(!strcmp(values->name, "letters"));
+    assert(!strcmp(counts->name, "count"));
+    assert(counts->dtype == COL_DTYPE_INT64);
+    for (size_t i = 0; i < 4; i++) {
+        assert(!strcmp(col_string_at(values, i, NULL), exp_values[i]));
+        assert(*col_int64_at(counts, i, NULL) == exp_counts[i]);
+    }
+    col_free(values);
+    col_free(counts);
+
+    /* valid: most frequent first, ties in first appearance order */
+    assert(col_value_counts(col, 1, &values, &counts) == 0);
+    const char *sorted_values[] = {"b", "a", "c", "d"};
+    const int64_t sorted_counts[] = {3, 2, 1, 1};
+    for (size_t i = 0; i < 4; i++) {
+        assert(!strcmp(col_string_at(values, i, NULL), sorted_values[i]));
+        assert(*col_int64_at(counts, i, NULL) == sorted_counts[i]);
+    }
+    col_free(values);
+    col_free(counts);
+    col_free(col);
+
+    /* valid: a column named as the counts */
+    col = col_create("count", COL_DTYPE_INT32, NULL);
+    for (int32_t i = 0; i < 5; i++)
+        assert(col_int32_append(col, i % 2) == 0);
+    assert(col_value_counts(col, 1, &values, &counts) == 0);
+    assert(!strcmp(values->name, "count"));
+    assert(!strcmp(counts->name, "count"));
+    assert(*col_int32_at(values, 0, NULL) == 0);
+    assert(*col_int64_at(counts, 0, NULL) == 3);
+    col_free(values);
+    col_free(counts);
+    col_free(col);
+
+    /* valid: counts add up to the rows, nulls included */
+    int64_t *vals = malloc(LARGE * sizeof(int64_t));
+    col = distinct_dummy_create(LARGE, LARGE_DISTINCT, vals);
+    assert(col_value_counts(col, 1, &values, &counts) == 0);
+    int64_t total = 0;
+    for (size_t i = 0; i < counts->n_rows; i++) {
+        total += *col_int64_at(counts, i, NULL);
+        if (i)
+            assert(*col_int64_at(counts, i, NULL) <= *col_int64_at(counts, i - 1, NULL));
+    }
+    assert(total == (int64_t)LARGE);
+    assert(values->null_count == 1);
+    col_free(values);
+    col_free(counts);
+    col_free(col);
+    free(vals);
+}
+
+void test_col_ndistinct() {
+    int err = -1;
+    int64_t *vals = malloc(LARGE * sizeof(int64_t));
+    col_t *col = distinct_dummy_create(LARGE, LARGE_DISTINCT, vals);
+
+    /* reference: distinct non-null values */
+    uint8_t *seen = calloc(LARGE_DISTINCT, sizeof(uint8_t));
+    size_t exact = 0;
+    for (size_t i = 0; i < LARGE; i++) {
+        if (i % 17 != 16 && !seen[vals[i]]) {
+            seen[vals[i]] = 1;
+            exact++;
+        }
+    }
+
+    /* valid: nulls are not counted, on any thread count */
+    for (size_t threads = 1; threads <= 4; threads += 3) {
+        mlc_thread_set_count(threads);
+        assert(col_ndistinct(col, &err) == exact);
+        assert(err == COL_ERR_OK);
+    }
+    mlc_thread_set_count(0);
+
+    /* valid: empty */
+    col_t *empty = col_create("empty", COL_DTYPE_DOUBLE, NULL);
+    assert(col_ndistinct(empty, &err) == 0);
+    assert(err == COL_ERR_OK);
+    col_free(empty);
+
+    free(seen);
+    col_free(col);
+    free(vals);
+}
+
+void test_col_hll() {
+    int err = -1;
+    int64_t *vals = malloc(LARGE * sizeof(int64_t));
+    col_t *col = distinct_dummy_create(LARGE, LARGE_DISTINCT, vals);
+    const size_t exact = col_ndistinct(col, NULL);
+
+    /* valid: within a few standard errors at every precision */
+    for (unsigned p = 10; p <= COL_HLL_PRECISION_MAX; p += 4) {
+        const double estimate = col_ndistinct_hll(col, p, &err);
+        assert(err == COL_ERR_OK);
+        assert(rel_err(estimate, exact) < 4 * 1.04 / sqrt((double)((size_t)1 << p)));
+    }
+
+    /* valid: registers do not depend on the thread count or the ISA */
+    col_hll_t *ref = col_hll_create(COL_HLL_PRECISION_DEFAULT, &err);
+    assert(err == COL_ERR_OK);
+    assert(ref->n_registers == (size_t)1 << COL_HLL_PRECISION_DEFAULT);
+    mlc_thread_set_count(1);
+    mlc_cpu_isa_limit(MLC_ISA_SCALAR);
+    assert(col_hll_add(ref, col) == 0);
+    const mlc_isa_t host = mlc_cpu_isa_detect();
+    for (mlc_isa_t isa = MLC_ISA_SCALAR; isa <= host; isa++) {
+        mlc_cpu_isa_limit(isa);
+        for (size_t threads = 1; threads <= 4; threads += 3) {
+            mlc_thread_set_count(threads);
+            col_hll_t *hll = col_hll_create(COL_HLL_PRECISION_DEFAULT, NULL);
+            assert(col_hll_add(hll, col) == 0);
+            assert(!memcmp(hll->registers, ref->registers, ref->n_registers));
+            col_hll_free(hll);
+        }
+    }
+    mlc_cpu_isa_limit(MLC_ISA_COUNT);
+    mlc_thread_set_count(0);
+    col_hll_free(ref);
+
+    /* valid: small sets are counted almost exactly */
+    col_t *small = col_create("small", COL_DTYPE_STRING, NULL);
+    assert(col_ndistinct_hll(small, 0, &err) == 0);
+    assert(err == COL_ERR_OK);
+    for (size_t i = 0; i < 300; i++) {
+        char buf[16];
+        snprintf(buf, sizeof(buf), "v%zu", i % 100);
+        assert(col_string_append(small, buf) == 0);
+    }
+    assert(rel_err(col_ndistinct_hll(small, 0, NULL), 100) < 0.02);
+    col_free(small);
+
+    col_free(col);
+    free(vals);
+}
+
+void test_col_hll_merge() {
+    int err = -1;
+    int64_t *vals = malloc(LARGE * sizeof(int64_t));
+    col_t *col = distinct_dummy_create(LARGE, LARGE_DISTINCT, vals);
+    col_t *head = col_slice(col, 0, LARGE / 3, NULL);
+    col_t *tail = col_slice(col, LARGE / 3, LARGE - LARGE / 3, NULL);
+
+    /* valid: merged sketches of the chunks equal the sketch of the whole */
+    col_hll_t *whole = col_hll_create(12, NULL);
+    col_hll_t *a = col_hll_create(12, NULL);
+    col_hll_t *b = col_hll_create(12, NULL);
+    assert(col_hll_add(whole, col) == 0);
+    assert(col_hll_add(a, head) == 0);
+    assert(col_hll_add(b, tail) == 0);
+    assert(col_hll_merge(a, b) == 0);
+    assert(!memcmp(a->registers, whole->registers, whole->n_registers));
+    assert(col_hll_estimate(a, &err) == col_hll_estimate(whole, NULL));
+    assert(err == COL_ERR_OK);
+
+    /* valid: integers sketch alike in any width */
+    col_t *narrow = col_create_with_capacity("narrow", LARGE, COL_DTYPE_INT32, NULL);
+    for (size_t i = 0; i < LARGE; i++) {
+        if (i % 17 == 16)
+            assert(col_append_null(narrow) == 0);
+        else
+            assert(col_int32_append(narrow, (int32_t)vals[i]) == 0);
+    }
+    col_hll_t *c = col_hll_create(12, NULL);
+    assert(col_hll_add(c, narrow) == 0);
+    assert(!memcmp(c->registers, whole->registers, whole->n_registers));
+    col_free(narrow);
+
+    /* invalid: precisions differ */
+    col_hll_t *other = col_hll_create(13, NULL);
+    assert(col_hll_merge(a, other) == COL_ERR_INVALID_ARG);
+    col_hll_free(other);
+
+    col_hll_free(c);
+    col_hll_free(b);
+    col_hll_free(a);
+    col_hll_free(whole);
+    col_free(tail);
+    col_free(head);
+    col_free(col);
+    free(vals);
+}
+
+void test_col_distinct_invalid() {
+    int err = -1;
+    col_t *values = NULL;
+    col_t *counts = NULL;
+    col_t *col = col_create("col", COL_DTYPE_INT32, NULL);
+
+    /* invalid: NULL arguments */
+    assert(col_unique(NULL, &err) == NULL);
+    assert(err == COL_ERR_NO_DATA);
+    assert(col_value_counts(NULL, 0, &values, &counts) == COL_ERR_NO_DATA);
+    assert(col_value_counts(col, 0, NULL, &counts) == COL_ERR_NO_DATA);
+    assert(col_ndistinct(NULL, &err) == SIZE_MAX);
+    assert(err == COL_ERR_NO_DATA);
+    assert(isnan(col_ndistinct_hll(NULL, 0, &err)));
+    assert(err == COL_ERR_NO_DATA);
+    assert(isnan(col_hll_estimate(NULL, &err)));
+    assert(err == COL_ERR_NO_DATA);
+    assert(col_hll_add(NULL, col) == COL_ERR_NO_DATA);
+    assert(col_hll_merge(NULL, NULL) == COL_ERR_NO_DATA);
+    col_hll_free(NULL);
+
+    /* invalid: precision out of range */
+    assert(col_hll_create(COL_HLL_PRECISION_MIN - 1, &err) == NULL);
+    assert(err == COL_ERR_INVALID_ARG);
+    assert(col_hll_create(COL_HLL_PRECISION_MAX + 1, &err) == NULL);
+    assert(err == COL_ERR_INVALID_ARG);
+    assert(isnan(col_ndistinct_hll(col, COL_HLL_PRECISION_MAX + 1, &err)));
+    assert(err == COL_ERR_INVALID_ARG);
+
+    col_free(col);
+}
@@ -0,0 +1,393 @@
+#include <assert.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/cpu.h"
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/accessors.h"
+#include "dtypes/col/core/category.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/col/core/modifiers.h"
+#include "dtypes/col/ops/filter.h"
+#include "test_utils/col.h"
+
+void test_col_mask_cmp();
+void test_col_mask_between();
+void test_col_mask_isin();
+void test_col_mask_isin_str();
+void test_col_mask_exact();
+void test_col_sel_from_mask();
+void test_col_sel_chain();
+void test_col_filter();
+void test_col_filter_invalid();
+
+static const size_t SIZE = 9999;
+
+/* Operands around, between and beyond the dummy values */
+static const double OPERANDS[] = {
+    -1000.5, -3.0, 0.0, 2.5, 17.0, 250.0, 1e30, -INFINITY, INFINITY, NAN
+};
+
+/* Mixed-sign values, exactly representable in every numeric dtype, with a
+ * NaN in floating point columns and every 13th row null */
+static col_t *filter_dummy_create(const col_dtype_t dtype, const size_t n) {
+    void *data = malloc(n * sizeof(double));
+    for (size_t i = 0; i < n; i++) {
+        const double v = dtype == COL_DTYPE_UINT8
+            ? (double)((i * 37) % 251)
+            : (double)((long)((i * 7919) % 2003) - 1000);
+        switch (dtype) {
+            case COL_DTYPE_DOUBLE: ((double *)data)[i] = i % 7 == 3 ? NAN : v; break;
+            case COL_DTYPE_FLOAT: ((float *)data)[i] = i % 7 == 3 ? NAN : v; break;
+            case COL_DTYPE_INT64: ((int64_t *)data)[i] = v; break;
+            case COL_DTYPE_INT32: ((int32_t *)data)[i] = v; break;
+            default: ((uint8_t *)data)[i] = v; break;
+        }
+    }
+    col_t *col = col_create_array("filter", data, n, dtype, NULL);
+    for (size_t i = 5; i < n; i += 13)
+        assert(col_set_null(col, i) == 0);
+    free(data);
+    return col;
+}
+
+static double reference(const col_t *col, const size_t idx) {
+    switch (col->dtype) {
+        case COL_DTYPE_DOUBLE: return ((double *)col->data)[idx];
+        case COL_DTYPE_FLOAT: return ((float *)col->data)[idx];
+        case COL_DTYPE_INT64: return ((int64_t *)col->data)[idx];
+        case COL_DTYPE_INT32: return ((int32_t *)col->data)[idx];
+        default: return ((uint8_t *)col->data)[idx];
+    }
+}
+
+static int is_null(const col_t *col, const size_t idx) {
+    return col->null_count && !(col->validity[idx >> 3] >> (idx & 7) & 1);
+}
+
+static int bit(const uint8_t *mask, const size_t idx) {
+    return mask[idx >> 3] >> (idx & 7) & 1;
+}
+
+static int compare(const double x, const col_cmp_t cmp, const double v) {
+    switch (cmp) {
+        case COL_CMP_LT: return x < v;
+        case COL_CMP_LE: return x <= v;
+        case COL_CMP_GT: return x > v;
+        case COL_CMP_GE: return x >= v;
+        case COL_CMP_EQ: return x == v;
+        default: return x != v;
+    }
+}
+
+int main() {
+    test_col_mask_cmp();
+    test_col_mask_between();
+    test_col_mask_isin();
+    test_col_mask_isin_str();
+    test_col_mask_exact();
+    test_col_sel_from_mask();
+    test_col_sel_chain();
+    test_col_filter();
+    test_col_filter_invalid();
+}
+
+void test_col_mask_cmp() {
+    const size_t n_operands = sizeof(OPERANDS) / sizeof(OPERANDS[0]);
+
+    /* valid: every code path the host supports agrees with C comparisons */
+    const mlc_isa_t host = mlc_cpu_isa_detect();
+    for (mlc_isa_t isa = MLC_ISA_SCALAR; isa <= host; isa++) {
+        mlc_cpu_isa_limit(isa);
+        for (col_dtype_t dtype = COL_DTYPE_DOUBLE; dtype <= COL_DTYPE_UINT8; dtype++) {
+            /* odd lengths exercise the vector and scalar tails */
+            for (size_t n = 1; n < SIZE; n = n * 3 + 4) {
+                col_t *col = filter_dummy_create(dtype, n);
+                uint8_t *mask = malloc(col_mask_bytes(n));
+                for (col_cmp_t cmp = COL_CMP_LT; cmp < COL_CMPS; cmp++) {
+                    for (size_t k = 0; k < n_operands; k++) {
+                        assert(col_mask_cmp(col, cmp, OPERANDS[k], mask) == 0);
+                        for (size_t i = 0; i < n; i++) {
+                            const int expected = !is_null(col, i)
+                                && compare(reference(col, i), cmp, OPERANDS[k]);
+                            assert(bit(mask, i) == expected);
+                        }
+                        /* bits past the last row are cleared */
+                        if (n % 8)
+                            assert(!(mask[n / 8] >> (n % 8)));
+                    }
+                }
+                free(mask);
+                col_free(col);
+            }
+        }
+    }
+    mlc_cpu_isa_limit(MLC_ISA_COUNT);
+    assert(mlc_cpu_isa() == host);
+}
+
+void test_col_mask_between() {
+    const size_t n_operands = sizeof(OPERANDS) / sizeof(OPERANDS[0]);
+
+    /* valid: inclusive on both ends */
+    for (col_dtype_t dtype = COL_DTYPE_DOUBLE; dtype <= COL_DTYPE_UINT8; dtype++) {
+        col_t *col = filter_dummy_create(dtype, SIZE);
+        uint8_t *mask = malloc(col_mask_bytes(SIZE));
+        for (size_t a = 0; a < n_operands; a++) {
+            for (size_t b = 0; b < n_operands; b++) {
+                const double lo = OPERANDS[a], hi = OPERANDS[b];
+                assert(col_mask_between(col, lo, hi, mask) == 0);
+                for (size_t i = 0; i < SIZE; i++) {
+                    const double x = reference(col, i);
+                    assert(bit(mask, i) == (!is_null(col, i) && x >= lo && x <= hi));
+                }
+            }
+        }
+        free(mask);
+        col_free(col);
+    }
+}
+
+void test_col_mask_isin() {
+    static const double values[] = {17.0, -3.0, 2.5, 250.0, NAN, -3.0, 1e30, 0.0};
+    const size_t n_values = sizeof(values) / sizeof(values[0]);
+
+    /* valid: unrepresentable values and NaN never match */
+    for (col_dtype_t dtype = COL_DTYPE_DOUBLE; dtype <= COL_DTYPE_UINT8; dtype++) {
+        col_t *col = filter_dummy_create(dtype, SIZE);
+        uint8_t *mask = malloc(col_mask_bytes(SIZE));
+        assert(col_mask_isin(col, values, n_values, mask) == 0);
+
+        size_t n_matches = 0;
+        for (size_t i = 0; i < SIZE; i++) {
+            int expected = 0;
+            for (size_t k = 0; k < n_values; k++)
+                expected |= reference(col, i) == values[k];
+            expected &= !is_null(col, i);
+            assert(bit(mask, i) == expected);
+            n_matches += expected;
+        }
+        assert(n_matches > 0);
+
+        /* valid: no values */
+        assert(col_mask_isin(col, NULL, 0, mask) == 0);
+        for (size_t i = 0; i < SIZE; i++)
+            assert(!bit(mask, i));
+
+        free(mask);
+        col_free(col);
+    }
+
+    /* invalid */
+    col_t *col = col_string_dummy_create("s", 8);
+    uint8_t mask[1];
+    assert(col_mask_isin(col, values, n_values, mask) == COL_ERR_INVALID_DTYPE);
+    col_free(col);
+}
+
+void test_col_mask_isin_str() {
+    int err;
+    static const char *values[] = {"b", "missing", "a"};
+    static const char *rows[] = {"a", "b", "c", "a", "d", "b", "", "a", "c"};
+    const size_t n_rows = sizeof(rows) / sizeof(rows[0]);
+
+    col_t *col = col_create("s", COL_DTYPE_STRING, &err);
+    for (size_t i = 0; i < n_rows; i++)
+        assert(col_append(col, rows[i]) == 0);
+    assert(col_set_null(col, 7) == 0);
+    col_t *cat = col_category_from_string(col, &err);
+    assert(err == 0);
+
+    /* valid: `string` and `category` agree, nulls excluded */
+    const col_t *cols[] = {col, cat};
+    for (size_t c = 0; c < 2; c++) {
+        uint8_t mask[2];
+        assert(col_mask_isin_str(cols[c], values, 3, mask) == 0);
+        for (size_t i = 0; i < n_rows; i++) {
+            const int expected = i != 7
+                && (!strcmp(rows[i], "a") || !strcmp(rows[i], "b"));
+            assert(bit(mask, i) == expected);
+        }
+
+        col_sel_t *sel = col_sel_create(0, &err);
+        assert(col_sel_isin_str(cols[c], values + 2, 1, NULL, sel) == 0);
+        assert(sel->n == 2);
+        assert(sel->idx[0] == 0 && sel->idx[1] == 3);
+        col_sel_free(sel);
+    }
+
+    /* invalid */
+    uint8_t mask[2];
+    const char *null_values[] = {"a", NULL};
+    assert(col_mask_isin_str(col, null_values, 2, mask) == COL_ERR_NO_DATA);
+    col_t *num = col_double_dummy_create("d", 4);
+    assert(col_mask_isin_str(num, values, 3, mask) == COL_ERR_INVALID_DTYPE);
+
+    col_free(num);
+    col_free(cat);
+    col_free(col);
+}
+
+void test_col_mask_exact() {
+    uint8_t mask[1];
+
+    /* valid: large integers compare exactly, not through `double` */
+    const int64_t big[] = {
+        ((int64_t)1 << 60), ((int64_t)1 << 60) + 1, INT64_MAX, INT64_MIN
+    };
+    col_t *col = col_create_array("i", big, 4, COL_DTYPE_INT64, NULL);
+    assert(col_mask_cmp(col, COL_CMP_GT, 0x1p60, mask) == 0);
+    assert(mask[0] == 0x6);
+    assert(col_mask_cmp(col, COL_CMP_LT, 0x1p63, mask) == 0);
+    assert(mask[0] == 0xF);
+    assert(col_mask_cmp(col, COL_CMP_LE, -0x1p63, mask) == 0);
+    assert(mask[0] == 0x8);
+    assert(col_mask_cmp(col, COL_CMP_GT, -0x1p63, mask) == 0);
+    assert(mask[0] == 0x7);
+    assert(col_mask_cmp(col, COL_CMP_NE, 0.5, mask) == 0);
+    assert(mask[0] == 0xF);
+    col_free(col);
+
+    /* valid: a `float` column compares with the `double` operand */
+    const float floats[] = {0.1f, 1.0f, INFINITY, -INFINITY};
+    col = col_create_array("f", floats, 4, COL_DTYPE_FLOAT, NULL);
+    assert(col_mask_cmp(col, COL_CMP_EQ, 0.1, mask) == 0);
+    assert(mask[0] == 0);
+    assert(col_mask_cmp(col, COL_CMP_EQ, (double)0.1f, mask) == 0);
+    assert(mask[0] == 0x1);
+    assert(col_mask_cmp(col, COL_CMP_LT, 0.1, mask) == 0);
+    assert(mask[0] == (0.1f < 0.1 ? 0x9 : 0x8));
+    assert(col_mask_cmp(col, COL_CMP_LT, 1e39, mask) == 0);
+    assert(mask[0] == 0xB);
+    assert(col_mask_cmp(col, COL_CMP_GT, INFINITY, mask) == 0);
+    assert(mask[0] == 0);
+    assert(col_mask_cmp(col, COL_CMP_GE, INFINITY, mask) == 0);
+    assert(mask[0] == 0x4);
+    col_free(col);
+}
+
+void test_col_sel_from_mask() {
+    int err;
+    col_sel_t *sel = col_sel_create(0, &err);
+    assert(sel && err == 0);
+
+    /* valid: set bits past `n_rows` are ignored */
+    uint8_t mask[20];
+    for (size_t b = 0; b < sizeof(mask); b++)
+        mask[b] = (uint8_t)(b * 29 + 7);
+    const size_t n_rows = 150;
+    assert(col_sel_from_mask(mask, n_rows, sel) == 0);
+
+    size_t k = 0;
+    for (size_t i = 0; i < n_rows; i++)
+        if (bit(mask, i))
+            assert(sel->idx[k++] == i);
+    assert(sel->n == k);
+
+    /* valid: empty */
+    assert(col_sel_from_mask(NULL, 0, sel) == 0);
+    assert(sel->n == 0);
+
+    /* invalid */
+    assert(col_sel_from_mask(mask, 8, NULL) == COL_ERR_NO_DATA);
+    assert(col_sel_from_mask(NULL, 8, sel) == COL_ERR_NO_DATA);
+
+    col_sel_free(sel);
+    col_sel_free(NULL);
+}
+
+void test_col_sel_chain() {
+    int err;
+    col_t *a = filter_dummy_create(COL_DTYPE_DOUBLE, SIZE);
+    col_t *b = filter_dummy_create(COL_DTYPE_INT32, SIZE);
+    col_sel_t *sel = col_sel_create(0, &err);
+    col_sel_t *out = col_sel_create(0, &err);
+
+    /* valid: dense refinement, in place */
+    assert(col_sel_cmp(a, COL_CMP_GT, -500.0, NULL, sel) == 0);
+    assert(col_sel_between(b, -800.0, 900.0, sel, sel) == 0);
+    size_t k = 0;
+    for (size_t i = 0; i < SIZE; i++) {
+        const double x = reference(a, i), y = reference(b, i);
+        if (is_null(a, i) || is_null(b, i) || !(x > -500.0) || y < -800 || y > 900)
+            continue;
+        assert(sel->idx[k++] == i);
+    }
+    assert(sel->n == k);
+
+    /* valid: sparse refinement into another vector */
+    static const double values[] = {-999.0, 12.0, 999.0};
+    assert(col_sel_isin(b, values, 3, sel, sel) == 0);
+    assert(sel->n * 8 < SIZE);
+    const size_t n_sparse = sel->n;
+    assert(col_sel_cmp(a, COL_CMP_NE, 12.0, sel, out) == 0);
+    k = 0;
+    for (size_t j = 0; j < n_sparse; j++)
+        if (reference(a, sel->idx[j]) != 12.0)
+            assert(out->idx[k++] == sel->idx[j]);
+    assert(out->n == k);
+
+    /* invalid: out of bounds selection */
+    col_t *small = col_double_dummy_create("small", 4);
+    assert(col_sel_cmp(small, COL_CMP_LT, 0.0, sel, out) == COL_ERR_OUT_OF_BOUNDS);
+    assert(col_sel_cmp(small, COL_CMPS, 0.0, NULL, out) == COL_ERR_INVALID_ARG);
+    assert(col_sel_cmp(small, COL_CMP_LT, 0.0, NULL, NULL) == COL_ERR_NO_DATA);
+
+    col_free(small);
+    col_sel_free(out);
+    col_sel_free(sel);
+    col_free(b);
+    col_free(a);
+}
+
+void test_col_filter() {
+    int err;
+    col_t *num = filter_dummy_create(COL_DTYPE_FLOAT, SIZE);
+    col_t *str = col_string_dummy_create("s", SIZE);
+    col_sel_t *sel = col_sel_create(0, &err);
+
+    /* valid: rows and nulls follow the selection */
+    assert(col_sel_cmp(num, COL_CMP_LT, 0.0, NULL, sel) == 0);
+    col_t *filtered = col_filter(num, sel, &err);
+    assert(filtered && err == 0);
+    assert(filtered->n_rows == sel->n);
+    for (size_t j = 0; j < sel->n; j++)
+        assert(*col_float_at(filtered, j, NULL) == reference(num, sel->idx[j]));
+    col_free(filtered);
+
+    /* valid: selected rows of another column */
+    filtered = col_filter(str, sel, &err);
+    assert(filtered && err == 0);
+    for (size_t j = 0; j < sel->n; j++)
+        assert(!strcmp(
+            col_string_at(filtered, j, NULL),
+            col_string_at(str, sel->idx[j], NULL)
+        ));
+    col_free(filtered);
+
+    /* invalid */
+    assert(!col_filter(num, NULL, &err));
+    assert(err == COL_ERR_NO_DATA);
+
+    col_sel_free(sel);
+    col_free(str);
+    col_free(num);
+}
+
+void test_col_filter_invalid() {
+    uint8_t mask[1];
+
+    /* invalid */
+    assert(col_mask_cmp(NULL, COL_CMP_LT, 0.0, mask) == COL_ERR_NO_DATA);
+    col_t *col = col_string_dummy_create("s", 4);
+    assert(col_mask_cmp(col, COL_CMP_LT, 0.0, mask) == COL_ERR_INVALID_DTYPE);
+    assert(col_mask_between(col, 0.0, 1.0, mask) == COL_ERR_INVALID_DTYPE);
+    col_free(col);
+
+    col = col_double_dummy_create("d", 4);
+    assert(col_mask_cmp(col, COL_CMP_LT, 0.0, NULL) == COL_ERR_NO_DATA);
+    assert(col_mask_isin(col, NULL, 2, mask) == COL_ERR_NO_DATA);
+    col_free(col);
+}
@@ -0,0 +1,496 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/cpu.h"
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/accessors.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/col/core/modifiers.h"
+#include "dtypes/col/core/strbuf.h"
+#include "dtypes/col/ops/gather.h"
+#include "test_utils/col.h"
+
+void test_col_take();
+void test_col_take_string();
+void test_col_take_category();
+void test_col_take_invalid();
+void test_col_take_indices();
+void test_col_take_large();
+void test_col_take_permutation();
+void test_col_scatter();
+void test_col_scatter_string();
+void test_col_scatter_category();
+void test_col_scatter_overlap();
+void test_col_scatter_invalid();
+
+static const size_t SIZE = 999;
+
+/* Reversed, repeating indices */
+static size_t *gather_idx_create(const size_t n, const size_t n_rows) {
+    size_t *idx = malloc(n * sizeof(size_t));
+    for (size_t i = 0; i < n; i++)
+        idx[i] = (n_rows - 1 - (i * 7) % n_rows);
+    return idx;
+}
+
+int main() {
+    test_col_take();
+    test_col_take_string();
+    test_col_take_category();
+    test_col_take_invalid();
+    test_col_take_indices();
+    test_col_take_large();
+    test_col_take_permutation();
+    test_col_scatter();
+    test_col_scatter_string();
+    test_col_scatter_category();
+    test_col_scatter_overlap();
+    test_col_scatter_invalid();
+}
+
+/* Asserts row `i` of `res` holds row `idx[i]` of `col` */
+static void gather_check(
+    const col_t *res,
+    const col_t *col,
+    const size_t *idx,
+    const size_t n
+) {
+    assert(res->n_rows == n);
+    for (size_t i = 0; i < n; i++)
+        assert(memcmp(
+            (char *)res->data + i * res->stride,
+            (char *)col->data + idx[i] * col->stride,
+            col->stride
+        ) == 0);
+}
+
+void test_col_take() {
+    int err;
+    const size_t n = SIZE * 2;
+    size_t *idx = gather_idx_create(n, SIZE);
+    col_t *cols[] = {
+        col_double_dummy_create("double", SIZE),
+        col_float_dummy_create("float", SIZE),
+        col_int64_dummy_create("int64", SIZE),
+        col_int32_dummy_create("int32", SIZE),
+        col_uint8_dummy_create("uint8", SIZE)
+    };
+
+    /* valid: every fixed-width dtype, with nulls */
+    for (size_t c = 0; c < sizeof(cols) / sizeof(cols[0]); c++) {
+        col_t *col = cols[c];
+        for (size_t i = 0; i < SIZE; i += 11)
+            assert(col_set_null(col, i) == 0);
+
+        col_t *res = col_take(col, idx, n, &err);
+        assert(res && err == COL_ERR_OK);
+        assert(res->dtype == col->dtype && res->n_rows == n);
+        assert(strcmp(res->name, col->name) == 0);
+
+        size_t null_count = 0;
+        for (size_t i = 0; i < n; i++) {
+            const int null = idx[i] % 11 == 0;
+            assert((res->validity[i >> 3] >> (i & 7) & 1) == !null);
+            null_count += null;
+            assert(memcmp(
+                (char *)res->data + i * res->stride,
+                (char *)col->data + idx[i] * col->stride,
+                col->stride
+            ) == 0);
+        }
+        assert(res->null_count == null_count);
+
+        col_free(res);
+        col_free(col);
+    }
+
+    /* valid: no rows */
+    col_t *col = col_double_dummy_create("double", SIZE);
+    col_t *res = col_take(col, NULL, 0, &err);
+    assert(res && err == COL_ERR_OK && res->n_rows == 0);
+    col_free(res);
+    col_free(col);
+
+    free(idx);
+}
+
+void test_col_take_string() {
+    int err;
+    const size_t n = SIZE * 2;
+    size_t *idx = gather_idx_create(n, SIZE);
+    col_t *col = col_string_dummy_create("string", SIZE);
+    assert(col_set_null(col, SIZE - 1) == 0);
+
+    /* valid */
+    col_t *res = col_take(col, idx, n, &err);
+    assert(res && err == COL_ERR_OK);
+    assert(res->n_rows == n && res->null_count == 2);
+    for (size_t i = 0; i < n; i++)
+        assert(strcmp(
+            col_string_at(res, i, NULL),
+            col_string_at(col, idx[i], NULL)
+        ) == 0);
+
+    /* valid: the result owns its strings */
+    col_free(col);
+    assert(col_append(res, "appended") == 0);
+    assert(strcmp(col_string_at(res, n, NULL), "appended") == 0);
+
+    col_free(res);
+    free(idx);
+}
+
+void test_col_take_category() {
+    int err;
+    const size_t n = SIZE * 2;
+    size_t *idx = gather_idx_create(n, SIZE);
+
+    /* valid: wide codes and their dictionary are carried over */
+    col_t *col = col_category_dummy_create("category", SIZE, 300);
+    col_t *res = col_take(col, idx, n, &err);
+    assert(res && err == COL_ERR_OK);
+    assert(res->stride == col->stride);
+    for (size_t i = 0; i < n; i++)
+        assert(strcmp(
+            col_category_at(res, i, NULL),
+            col_category_at(col, idx[i], NULL)
+        ) == 0);
+
+    /* valid: the dictionary is a copy */
+    col_free(col);
+    assert(col_append(res, "new category") == 0);
+    assert(strcmp(col_category_at(res, n, NULL), "new category") == 0);
+
+    col_free(res);
+    free(idx);
+}
+
+void test_col_take_invalid() {
+    int err;
+    col_t *col = col_double_dummy_create("double", SIZE);
+    const size_t idx[] = {0, SIZE};
+
+    /* invalid */
+    assert(!col_take(NULL, idx, 1, &err));
+    assert(err == COL_ERR_NO_DATA);
+    assert(!col_take(col, NULL, 1, &err));
+    assert(err == COL_ERR_NO_DATA);
+    assert(!col_take(col, idx, 2, &err));
+    assert(err == COL_ERR_OUT_OF_BOUNDS);
+
+    /* invalid: negative indices */
+    const int32_t idx32[] = {0, -1};
+    const int64_t idx64[] = {0, -1};
+    assert(!col_take_int32(col, idx32, 2, &err));
+    assert(err == COL_ERR_OUT_OF_BOUNDS);
+    assert(!col_take_int64(col, idx64, 2, &err));
+    assert(err == COL_ERR_OUT_OF_BOUNDS);
+
+    col_free(col);
+}
+
+void test_col_take_indices() {
+    int err;
+    col_t *cols[] = {
+        col_double_dummy_create("double", SIZE),
+        col_float_dummy_create("float", SIZE),
+        col_int64_dummy_create("int64", SIZE),
+        col_int32_dummy_create("int32", SIZE),
+        col_uint8_dummy_create("uint8", SIZE)
+    };
+
+    /* valid: every index type on every code path the host supports */
+    const mlc_isa_t host = mlc_cpu_isa_detect();
+    for (mlc_isa_t isa = MLC_ISA_SCALAR; isa <= host; isa++) {
+        mlc_cpu_isa_limit(isa);
+        /* odd lengths exercise the vector and scalar tails */
+        for (size_t n = 1; n < SIZE * 2; n = n * 3 + 4) {
+            size_t *idx = gather_idx_create(n, SIZE);
+            int32_t *idx32 = malloc(n * sizeof(int32_t));
+            int64_t *idx64 = malloc(n * sizeof(int64_t));
+            for (size_t i = 0; i < n; i++) {
+                idx32[i] = (int32_t)idx[i];
+                idx64[i] = (int64_t)idx[i];
+            }
+
+            for (size_t c = 0; c < sizeof(cols) / sizeof(cols[0]); c++) {
+                col_t *res = col_take(cols[c], idx, n, &err);
+                assert(res && err == COL_ERR_OK);
+                gather_check(res, cols[c], idx, n);
+                col_free(res);
+
+                res = col_take_int32(cols[c], idx32, n, &err);
+                assert(res && err == COL_ERR_OK);
+                gather_check(res, cols[c], idx, n);
+                col_free(res);
+
+                res = col_take_int64(cols[c], idx64, n, &err);
+                assert(res && err == COL_ERR_OK);
+                gather_check(res, cols[c], idx, n);
+                col_free(res);
+            }
+
+            free(idx);
+            free(idx32);
+            free(idx64);
+        }
+    }
+    mlc_cpu_isa_limit(MLC_ISA_COUNT);
+    assert(mlc_cpu_isa() == host);
+
+    for (size_t c = 0; c < sizeof(cols) / sizeof(cols[0]); c++)
+        col_free(cols[c]);
+}
+
+void test_col_take_large() {
+    int err;
+    /* past the prefetch threshold of the kernels */
+    const size_t n_rows = (size_t)1 << 20;
+    const size_t n = 4096;
+    size_t *idx = malloc(n * sizeof(size_t));
+    for (size_t i = 0; i < n; i++)
+        idx[i] = (i * 2654435761u) % n_rows;
+
+    /* valid */
+    col_t *col = col_double_dummy_create("double", n_rows);
+    col_t *res = col_take(col, idx, n, &err);
+    assert(res && err == COL_ERR_OK);
+    gather_check(res, col, idx, n);
+
+    /* valid: scattered back, the rows are unchanged */
+    assert(col_scatter(col, res, idx) == 0);
+    col_t *again = col_take(col, idx, n, &err);
+    assert(again && err == COL_ERR_OK);
+    assert(memcmp(again->data, res->data, n * sizeof(double)) == 0);
+
+    col_free(again);
+    col_free(res);
+    col_free(col);
+    free(idx);
+}
+
+void test_col_take_permutation() {
+    int err;
+    size_t *idx = malloc(SIZE * sizeof(size_t));
+    for (size_t i = 0; i < SIZE; i++)
+        idx[i] = (i * 7) % SIZE;
+
+    col_t *col = col_string_dummy_create("string", SIZE);
+    assert(col_set_null(col, 3) == 0);
+
+    /* valid: a shuffle */
+    col_t *res = col_take(col, idx, SIZE, &err);
+    assert(res && err == COL_ERR_OK);
+    assert(res->n_rows == SIZE && res->null_count == 1);
+    for (size_t i = 0; i < SIZE; i++)
+        assert(strcmp(
+            col_string_at(res, i, NULL),
+            col_string_at(col, idx[i], NULL)
+        ) == 0);
+
+    /* valid: most rows, the rest left as waste */
+    const size_t n = SIZE - SIZE / 4;
+    col_t *part = col_take(col, idx, n, &err);
+    assert(part && err == COL_ERR_OK);
+    assert(part->strbuf.waste > 0);
+    assert(col_strbuf_compact(part, 1) == 0);
+    assert(part->strbuf.waste == 0);
+    for (size_t i = 0; i < n; i++)
+        assert(strcmp(
+            col_string_at(part, i, NULL),
+            col_string_at(col, idx[i], NULL)
+        ) == 0);
+
+    /* valid: the results own their strings */
+    col_free(col);
+    assert(col_append(res, "appended") == 0);
+    assert(strcmp(col_string_at(res, SIZE, NULL), "appended") == 0);
+    assert(col_strbuf_compact(res, 1) == 0);
+    assert(strcmp(col_string_at(res, 0, NULL), "Entry 0") == 0);
+    assert(strcmp(col_string_at(res, SIZE, NULL), "appended") == 0);
+
+    col_free(part);
+    col_free(res);
+    free(idx);
+}
+
+void test_col_scatter() {
+    const size_t n = SIZE / 3;
+    size_t *idx = gather_idx_create(n, SIZE);
+    int32_t *idx32 = malloc(n * sizeof(int32_t));
+    int64_t *idx64 = malloc(n * sizeof(int64_t));
+    for (size_t i = 0; i < n; i++) {
+        idx32[i] = (int32_t)idx[i];
+        idx64[i] = (int64_t)idx[i];
+    }
+
+    /* valid: every index type */
+    for (int type = 0; type < 3; type++) {
+        col_t *dst = col_int32_dummy_create("dst", SIZE);
+        col_t *src = col_int32_dummy_create("src", n);
+        for (size_t i = 0; i < n; i++)
+            assert(col_int32_set(src, -(int32_t)i, i) == 0);
+        assert(col_set_null(src, 0) == 0);
+        assert(col_set_null(dst, idx[1]) == 0);
+
+        int ret = type == 0 ? col_scatter(dst, src, idx)
+            : type == 1 ? col_scatter_int32(dst, src, idx32)
+            : col_scatter_int64(dst, src, idx64);
+        assert(ret == 0);
+
+        /* null rows of `src` made their targets null, the rest valid */
+        assert(dst->null_count == 1);
+        assert(!(dst->validity[idx[0] >> 3] >> (idx[0] & 7) & 1));
+        for (size_t i = 1; i < n; i++)
+            assert(*col_int32_at(dst, idx[i], NULL) == -(int32_t)i);
+
+        col_free(src);
+        col_free(dst);
+    }
+
+    /* valid: repeated indices, the last write wins */
+    col_t *dst = col_double_dummy_create("dst", SIZE);
+    col_t *src = col_double_dummy_create("src", 3);
+    const size_t same[] = {5, 5, 5};
+    assert(col_scatter(dst, src, same) == 0);
+    assert(*col_double_at(dst, 5, NULL) == *col_double_at(src, 2, NULL));
+    col_free(src);
+
+    /* valid: no rows */
+    src = col_create("src", COL_DTYPE_DOUBLE, NULL);
+    assert(col_scatter(dst, src, NULL) == 0);
+    col_free(src);
+
+    /* valid: a clone sharing storage with `dst` is left unchanged */
+    col_t *clone = col_clone(dst, NULL);
+    src = col_double_dummy_create("src", 1);
+    const double before = *col_double_at(clone, 0, NULL);
+    assert(col_scatter(dst, src, (size_t[]){0}) == 0);
+    assert(*col_double_at(clone, 0, NULL) == before);
+    assert(*col_double_at(dst, 0, NULL) == *col_double_at(src, 0, NULL));
+    col_free(clone);
+    col_free(src);
+    col_free(dst);
+
+    free(idx);
+    free(idx32);
+    free(idx64);
+}
+
+void test_col_scatter_string() {
+    const size_t n = SIZE / 3;
+    size_t *idx = gather_idx_create(n, SIZE);
+    col_t *dst = col_string_dummy_create("dst", SIZE);
+    col_t *src = col_string_dummy_create("src", n);
+
+    /* valid */
+    assert(col_scatter(dst, src, idx) == 0);
+    for (size_t i = 0; i < n; i++)
+        assert(strcmp(
+            col_string_at(dst, idx[i], NULL),
+            col_string_at(src, i, NULL)
+        ) == 0);
+    assert(strcmp(col_string_at(dst, 1, NULL), "Entry 1") == 0);
+
+    /* valid: replaced strings are reclaimed by compaction */
+    assert(dst->strbuf.waste > 0);
+    assert(col_strbuf_compact(dst, 1) == 0);
+    assert(dst->strbuf.waste == 0);
+    for (size_t i = 0; i < n; i++)
+        assert(strcmp(
+            col_string_at(dst, idx[i], NULL),
+            col_string_at(src, i, NULL)
+        ) == 0);
+
+    col_free(src);
+    col_free(dst);
+    free(idx);
+}
+
+void test_col_scatter_category() {
+    const size_t n = SIZE / 3;
+    size_t *idx = gather_idx_create(n, SIZE);
+
+    /* valid: categories missing from `dst` are added, widening its codes */
+    col_t *dst = col_category_dummy_create("dst", SIZE, 3);
+    col_t *src = col_category_dummy_create("src", n, 300);
+    assert(col_set_null(src, 1) == 0);
+    assert(col_scatter(dst, src, idx) == 0);
+    assert(dst->stride > 1 && dst->null_count == 1);
+    for (size_t i = 0; i < n; i++) {
+        if (i == 1)
+            continue;
+        assert(strcmp(
+            col_category_at(dst, idx[i], NULL),
+            col_category_at(src, i, NULL)
+        ) == 0);
+    }
+    assert(strcmp(col_category_at(dst, 1, NULL), "Category 1") == 0);
+
+    col_free(src);
+    col_free(dst);
+    free(idx);
+}
+
+void test_col_scatter_overlap() {
+    const size_t shift[] = {1, 2, 3, 4};
+
+    /* valid: a slice of `dst` is read before its rows change */
+    col_t *dst = col_int32_dummy_create("dst", SIZE);
+    int32_t expected[5];
+    for (size_t i = 0; i < 5; i++)
+        expected[i] = *col_int32_at(dst, i, NULL);
+    col_t *src = col_slice(dst, 0, 4, NULL);
+    assert(src);
+    assert(col_scatter(dst, src, shift) == 0);
+    assert(*col_int32_at(dst, 0, NULL) == expected[0]);
+    for (size_t i = 1; i < 5; i++)
+        assert(*col_int32_at(dst, i, NULL) == expected[i - 1]);
+    col_free(src);
+    col_free(dst);
+
+    /* valid: the same for strings */
+    dst = col_string_dummy_create("dst", SIZE);
+    src = col_slice(dst, 0, 4, NULL);
+    assert(src);
+    assert(col_scatter(dst, src, shift) == 0);
+    assert(strcmp(col_string_at(dst, 0, NULL), "Entry 0") == 0);
+    for (size_t i = 1; i < 5; i++) {
+        char buf[32];
+        sprintf(buf, "Entry %zu", i - 1);
+        assert(strcmp(col_string_at(dst, i, NULL), buf) == 0);
+    }
+    col_free(src);
+    col_free(dst);
+}
+
+void test_col_scatter_invalid() {
+    col_t *dst = col_double_dummy_create("dst", SIZE);
+    col_t *src = col_double_dummy_create("src", 2);
+    col_t *other = col_int32_dummy_create("other", 2);
+    const size_t idx[] = {0, SIZE};
+    const int32_t idx32[] = {0, -1};
+    const int64_t idx64[] = {0, -1};
+
+    /* invalid */
+    assert(col_scatter(NULL, src, idx) == COL_ERR_NO_DATA);
+    assert(col_scatter(dst, NULL, idx) == COL_ERR_NO_DATA);
+    assert(col_scatter(dst, src, NULL) == COL_ERR_NO_DATA);
+    assert(col_scatter(dst, dst, idx) == COL_ERR_INVALID_ARG);
+    assert(col_scatter(dst, other, (size_t[]){0, 1}) == COL_ERR_INVALID_DTYPE);
+    assert(col_scatter(dst, src, idx) == COL_ERR_OUT_OF_BOUNDS);
+    assert(col_scatter_int32(dst, src, idx32) == COL_ERR_OUT_OF_BOUNDS);
+    assert(col_scatter_int64(dst, src, idx64) == COL_ERR_OUT_OF_BOUNDS);
+
+    /* invalid: nothing was written */
+    col_t *ref = col_double_dummy_create("dst", SIZE);
+    assert(memcmp(dst->data, ref->data, SIZE * sizeof(double)) == 0);
+
+    col_free(ref);
+    col_free(other);
+    col_free(src);
+    col_free(dst);
+}
@@ -0,0 +1,367 @@
+#include <assert.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "core/cpu.h"
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/col/core/modifiers.h"
+#include "dtypes/col/ops/reduce.h"
+#include "test_utils/col.h"
+
+void test_col_sum();
+void test_col_mean_var();
+void test_col_min_max();
+void test_col_argmin_argmax();
+void test_col_norm();
+void test_col_reduce_nulls();
+void test_col_reduce_isa();
+void test_col_reduce_precision();
+
+static const size_t SIZE = 9999;
+
+static int close_enough(const double a, const double b) {
+    return fabs(a - b) <= 1e-9 * (fabs(a) > 1.0 ? fabs(a) : 1.0);
+}
+
+/* Mixed-sign values, exactly representable in every numeric dtype */
+static col_t *reduce_dummy_create(const col_dtype_t dtype, const size_t n) {
+    double *values = malloc(n * sizeof(double));
+    void *data = malloc(n * sizeof(double));
+    for (size_t i = 0; i < n; i++) {
+        values[i] = dtype == COL_DTYPE_UINT8
+            ? (double)((i * 37) % 251)
+            : (double)((long)((i * 7919) % 2003) - 1000);
+        switch (dtype) {
+            case COL_DTYPE_DOUBLE: ((double *)data)[i] = values[i]; break;
+            case COL_DTYPE_FLOAT: ((float *)data)[i] = values[i]; break;
+            case COL_DTYPE_INT64: ((int64_t *)data)[i] = values[i]; break;
+            case COL_DTYPE_INT32: ((int32_t *)data)[i] = values[i]; break;
+            default: ((uint8_t *)data)[i] = values[i]; break;
+        }
+    }
+    col_t *col = col_create_array("reduce", data, n, dtype, NULL);
+    free(values);
+    free(data);
+    return col;
+}
+
+static double reference(const col_t *col, const size_t idx) {
+    switch (col->dtype) {
+        case COL_DTYPE_DOUBLE: return ((double *)col->data)[idx];
+        case COL_DTYPE_FLOAT: return ((float *)col->data)[idx];
+        case COL_DTYPE_INT64: return ((int64_t *)col->data)[idx];
+        case COL_DTYPE_INT32: return ((int32_t *)col->data)[idx];
+        default: return ((uint8_t *)col->data)[idx];
+    }
+}
+
+/* Checks every reduction against a naive long double reference */
+static void reduce_assert(const col_t *col) {
+    int err;
+    long double sum = 0, l1 = 0, l2 = 0;
+    double mn = INFINITY, mx = -INFINITY;
+    size_t count = 0, argmin = SIZE_MAX, argmax = SIZE_MAX;
+    for (size_t i = 0; i < col->n_rows; i++) {
+        if (col->null_count && !(col->validity[i >> 3] >> (i & 7) & 1))
+            continue;
+        const double v = reference(col, i);
+        sum += v;
+        l1 += fabs(v);
+        l2 += (long double)v * v;
+        if (v < mn) { mn = v; argmin = i; }
+        if (v > mx) { mx = v; argmax = i; }
+        count++;
+    }
+    const double mean = (double)(sum / count);
+    long double sq = 0;
+    for (size_t i = 0; i < col->n_rows; i++) {
+        if (col->null_count && !(col->validity[i >> 3] >> (i & 7) & 1))
+            continue;
+        sq += ((long double)reference(col, i) - mean)
+            * ((long double)reference(col, i) - mean);
+    }
+
+    assert(close_enough(col_sum(col, &err), (double)sum) && err == COL_ERR_OK);
+    assert(close_enough(col_mean(col, &err), mean) && err == COL_ERR_OK);
+    assert(close_enough(col_var(col, 0, &err), (double)(sq / count)));
+    assert(close_enough(col_var(col, 1, &err), (double)(sq / (count - 1))));
+    assert(col_min(col, &err) == mn && err == COL_ERR_OK);
+    assert(col_max(col, &err) == mx && err == COL_ERR_OK);
+    assert(col_argmin(col, &err) == argmin && err == COL_ERR_OK);
+    assert(col_argmax(col, &err) == argmax && err == COL_ERR_OK);
+    assert(close_enough(col_norm_l1(col, &err), (double)l1));
+    assert(close_enough(col_norm_l2(col, &err), sqrt((double)l2)));
+}
+
+int main() {
+    test_col_sum();
+    test_col_mean_var();
+    test_col_min_max();
+    test_col_argmin_argmax();
+    test_col_norm();
+    test_col_reduce_nulls();
+    test_col_reduce_isa();
+    test_col_reduce_precision();
+}
+
+void test_col_sum() {
+    int err;
+
+    /* valid */
+    for (col_dtype_t dtype = COL_DTYPE_DOUBLE; dtype <= COL_DTYPE_UINT8; dtype++) {
+        col_t *col = reduce_dummy_create(dtype, SIZE);
+        reduce_assert(col);
+        col_free(col);
+    }
+
+    col_t *col = col_int32_dummy_create("int32", SIZE);
+    assert(col_sum(col, &err) == 32.0 * (SIZE - 1) * SIZE / 2);
+    assert(err == COL_ERR_OK);
+    col_free(col);
+
+    col = col_create("empty", COL_DTYPE_DOUBLE, NULL);
+    assert(col_sum(col, &err) == 0.0);
+    assert(err == COL_ERR_OK);
+    col_free(col);
+
+    /* err */
+    col = col_string_dummy_create("string", SIZE);
+    assert(isnan(col_sum(col, &err)));
+    assert(err == COL_ERR_INVALID_DTYPE);
+    col_free(col);
+
+    assert(isnan(col_sum(NULL, &err)));
+    assert(err == COL_ERR_NO_DATA);
+    assert(isnan(col_mean(NULL, &err)));
+    assert(err == COL_ERR_NO_DATA);
+    assert(isnan(col_var(NULL, 0, &err)));
+    assert(err == COL_ERR_NO_DATA);
+    assert(isnan(col_min(NULL, &err)));
+    assert(err == COL_ERR_NO_DATA);
+    assert(isnan(col_max(NULL, &err)));
+    assert(err == COL_ERR_NO_DATA);
+    assert(col_argmin(NULL, &err) == SIZE_MAX);
+    assert(err == COL_ERR_NO_DATA);
+    assert(col_argmax(NULL, &err) == SIZE_MAX);
+    assert(err == COL_ERR_NO_DATA);
+    assert(isnan(col_norm_l1(NULL, &err)));
+    assert(err == COL_ERR_NO_DATA);
+    assert(isnan(col_norm_l2(NULL, &err)));
+    assert(err == COL_ERR_NO_DATA);
+}
+
+void test_col_mean_var() {
+    int err;
+
+    /* valid */
+    const double values[] = { 2, 4, 4, 4, 5, 5, 7, 9 };
+    col_t *col = col_create_array("double", values, 8, COL_DTYPE_DOUBLE, NULL);
+    assert(col_mean(col, &err) == 5.0);
+    assert(err == COL_ERR_OK);
+    assert(col_var(col, 0, &err) == 4.0);
+    assert(err == COL_ERR_OK);
+    assert(close_enough(col_var(col, 1, &err), 32.0 / 7.0));
+    col_free(col);
+
+    /* err */
+    col = col_create("empty", COL_DTYPE_FLOAT, NULL);
+    assert(isnan(col_mean(col, &err)));
+    assert(err == COL_ERR_NO_DATA);
+    col_free(col);
+
+    col = col_create_array("double", values, 1, COL_DTYPE_DOUBLE, NULL);
+    assert(col_var(col, 0, &err) == 0.0);
+    assert(isnan(col_var(col, 1, &err)));
+    assert(err == COL_ERR_NO_DATA);
+    col_free(col);
+
+    col = col_category_dummy_create("category", SIZE, 4);
+    assert(isnan(col_var(col, 0, &err)));
+    assert(err == COL_ERR_INVALID_DTYPE);
+    col_free(col);
+}
+
+void test_col_min_max() {
+    int err;
+
+    /* valid */
+    const double values[] = { 3, NAN, -1, 8, NAN, 8, -1 };
+    col_t *col = col_create_array("double", values, 7, COL_DTYPE_DOUBLE, NULL);
+    assert(col_min(col, &err) == -1.0);
+    assert(err == COL_ERR_OK);
+    assert(col_max(col, &err) == 8.0);
+    assert(err == COL_ERR_OK);
+    col_free(col);
+
+    /* valid: int64 values beyond 2^53 compare exactly */
+    const int64_t large[] = { ((int64_t)1 << 53) + 1, (int64_t)1 << 53, ((int64_t)1 << 53) + 2 };
+    col = col_create_array("int64", large, 3, COL_DTYPE_INT64, NULL);
+    assert(col_argmin(col, &err) == 1);
+    assert(err == COL_ERR_OK);
+    assert(col_argmax(col, &err) == 2);
+    assert(err == COL_ERR_OK);
+    col_set_null(col, 1);
+    assert(col_argmin(col, &err) == 0);
+    col_free(col);
+
+    const double nans[] = { NAN, NAN };
+    col = col_create_array("nan", nans, 2, COL_DTYPE_DOUBLE, NULL);
+    assert(isnan(col_min(col, &err)));
+    assert(err == COL_ERR_OK);
+    col_free(col);
+
+    /* err */
+    col = col_create("empty", COL_DTYPE_INT64, NULL);
+    assert(isnan(col_min(col, &err)));
+    assert(err == COL_ERR_NO_DATA);
+    assert(isnan(col_max(col, &err)));
+    assert(err == COL_ERR_NO_DATA);
+    col_free(col);
+}
+
+void test_col_argmin_argmax() {
+    int err;
+
+    /* valid: first occurrence wins */
+    const int32_t values[] = { 3, -1, 8, 0, 8, -1 };
+    col_t *col = col_create_array("int32", values, 6, COL_DTYPE_INT32, NULL);
+    assert(col_argmin(col, &err) == 1);
+    assert(err == COL_ERR_OK);
+    assert(col_argmax(col, &err) == 2);
+    assert(err == COL_ERR_OK);
+    col_free(col);
+
+    /* valid: int64 values beyond 2^53 compare exactly */
+    const int64_t large[] = { ((int64_t)1 << 53) + 1, (int64_t)1 << 53, ((int64_t)1 << 53) + 2 };
+    col = col_create_array("int64", large, 3, COL_DTYPE_INT64, NULL);
+    assert(col_argmin(col, &err) == 1);
+    assert(err == COL_ERR_OK);
+    assert(col_argmax(col, &err) == 2);
+    assert(err == COL_ERR_OK);
+    col_set_null(col, 1);
+    assert(col_argmin(col, &err) == 0);
+    col_free(col);
+
+    const double nans[] = { NAN, NAN };
+    col = col_create_array("nan", nans, 2, COL_DTYPE_DOUBLE, NULL);
+    assert(col_argmax(col, &err) == 0);
+    assert(err == COL_ERR_OK);
+    col_free(col);
+
+    /* err */
+    col = col_create("empty", COL_DTYPE_UINT8, NULL);
+    assert(col_argmin(col, &err) == SIZE_MAX);
+    assert(err == COL_ERR_NO_DATA);
+    col_free(col);
+
+    col = col_string_dummy_create("string", SIZE);
+    assert(col_argmax(col, &err) == SIZE_MAX);
+    assert(err == COL_ERR_INVALID_DTYPE);
+    col_free(col);
+}
+
+void test_col_norm() {
+    int err;
+
+    /* valid */
+    const float values[] = { 3, -4 };
+    col_t *col = col_create_array("float", values, 2, COL_DTYPE_FLOAT, NULL);
+    assert(col_norm_l1(col, &err) == 7.0);
+    assert(err == COL_ERR_OK);
+    assert(col_norm_l2(col, &err) == 5.0);
+    assert(err == COL_ERR_OK);
+    col_free(col);
+
+    col = col_create("empty", COL_DTYPE_DOUBLE, NULL);
+    assert(col_norm_l2(col, &err) == 0.0);
+    assert(err == COL_ERR_OK);
+    col_free(col);
+
+    /* err */
+    col = col_string_dummy_create("string", SIZE);
+    assert(isnan(col_norm_l1(col, &err)));
+    assert(err == COL_ERR_INVALID_DTYPE);
+    col_free(col);
+}
+
+void test_col_reduce_nulls() {
+    int err;
+
+    /* valid: sparse and dense nulls across block boundaries */
+    for (col_dtype_t dtype = COL_DTYPE_DOUBLE; dtype <= COL_DTYPE_UINT8; dtype++) {
+        col_t *col = reduce_dummy_create(dtype, SIZE);
+        for (size_t i = 0; i < SIZE; i += 997)
+            assert(col_set_null(col, i) == COL_ERR_OK);
+        for (size_t i = 4000; i < 4100; i++)
+            assert(col_set_null(col, i) == COL_ERR_OK);
+        reduce_assert(col);
+        col_free(col);
+    }
+
+    /* null rows never count, even when they hold the extreme value */
+    const double values[] = { -100, 1, 2, 100 };
+    col_t *col = col_create_array("double", values, 4, COL_DTYPE_DOUBLE, NULL);
+    col_set_null(col, 0);
+    col_set_null(col, 3);
+    assert(col_mean(col, &err) == 1.5);
+    assert(col_argmin(col, &err) == 1);
+    assert(col_argmax(col, &err) == 2);
+
+    /* err */
+    col_set_null(col, 1);
+    col_set_null(col, 2);
+    assert(col_sum(col, &err) == 0.0);
+    assert(isnan(col_mean(col, &err)));
+    assert(err == COL_ERR_NO_DATA);
+    assert(col_argmin(col, &err) == SIZE_MAX);
+    assert(err == COL_ERR_NO_DATA);
+    col_free(col);
+}
+
+void test_col_reduce_isa() {
+    /* valid: every code path the host supports agrees with the reference */
+    const mlc_isa_t host = mlc_cpu_isa_detect();
+    for (mlc_isa_t isa = MLC_ISA_SCALAR; isa <= host; isa++) {
+        mlc_cpu_isa_limit(isa);
+        assert(mlc_cpu_isa() == isa);
+        for (col_dtype_t dtype = COL_DTYPE_DOUBLE; dtype <= COL_DTYPE_UINT8; dtype++) {
+            /* odd lengths exercise the vector and scalar tails */
+            for (size_t n = 1; n < 40; n += 3) {
+                col_t *col = reduce_dummy_create(dtype, n + 1);
+                reduce_assert(col);
+                col_free(col);
+            }
+            col_t *col = reduce_dummy_create(dtype, SIZE);
+            reduce_assert(col);
+            col_free(col);
+        }
+    }
+    mlc_cpu_isa_limit(MLC_ISA_COUNT);
+    assert(mlc_cpu_isa() == host);
+}
+
+void test_col_reduce_precision() {
+    int err;
+
+    /* valid: 1 + n * 1e-16 loses every small term when summed naively,
+     * an error of ~1e-11 */
+    const size_t n = 100000;
+    double *values = malloc(n * sizeof(double));
+    values[0] = 1.0;
+    for (size_t i = 1; i < n; i++)
+        values[i] = 1e-16;
+    col_t *col = col_create_array("double", values, n, COL_DTYPE_DOUBLE, NULL);
+    assert(fabs(col_sum(col, &err) - (1.0 + (n - 1) * 1e-16)) < 1e-13);
+    assert(err == COL_ERR_OK);
+
+    /* large offset does not destroy the variance */
+    for (size_t i = 0; i < n; i++)
+        values[i] = 1e9 + (double)(i % 2);
+    col_free(col);
+    col = col_create_array("double", values, n, COL_DTYPE_DOUBLE, NULL);
+    assert(close_enough(col_var(col, 0, &err), 0.25));
+    col_free(col);
+    free(values);
+}
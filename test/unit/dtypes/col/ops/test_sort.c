@@ -0,0 +1,404 @@
+#include <assert.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/accessors.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/col/core/modifiers.h"
+#include "dtypes/col/core/strbuf.h"
+#include "dtypes/col/ops/gather.h"
+#include "dtypes/col/ops/sort.h"
+#include "test_utils/col.h"
+#include "test_utils/random.h"
+
+void test_col_argsort();
+void test_col_argsort_float();
+void test_col_argsort_string();
+void test_col_argsort_category();
+void test_col_sort();
+void test_col_sort_string();
+void test_col_sort_invalid();
+
+/* Large enough to be split into chunks and merged */
+static const size_t LARGE = 200000;
+static const size_t SIZES[] = {0, 1, 2, 7, 999, LARGE};
+
+/* Random values with many duplicates, every 13th row null */
+static col_t *sort_dummy_create(const col_dtype_t dtype, const size_t n) {
+    col_t *col = col_create("sort", dtype, NULL);
+    for (size_t i = 0; i < n; i++) {
+        const uint64_t r = next_random();
+        const int64_t v = (int64_t)(r % 101) - 50;
+        if (i % 13 == 5) {
+            assert(col_append_null(col) == 0);
+            continue;
+        }
+        switch (dtype) {
+            case COL_DTYPE_DOUBLE:
+                assert(col_double_append(col, (double)v / 4) == 0);
+                break;
+            case COL_DTYPE_FLOAT:
+                assert(col_float_append(col, (float)v / 4) == 0);
+                break;
+            case COL_DTYPE_INT64:
+                assert(col_int64_append(col, v * (INT64_MAX / 64)) == 0);
+                break;
+            case COL_DTYPE_INT32:
+                assert(col_int32_append(col, (int32_t)v * 1000) == 0);
+                break;
+            default:
+                assert(col_uint8_append(col, (uint8_t)(r % 7)) == 0);
+                break;
+        }
+    }
+    return col;
+}
+
+static int is_null(const col_t *col, const size_t i) {
+    return col_is_null(col, i, NULL) == 1;
+}
+
+static int is_nan(const col_t *col, const size_t i) {
+    if (col->dtype == COL_DTYPE_DOUBLE)
+        return isnan(*col_double_at(col, i, NULL));
+    if (col->dtype == COL_DTYPE_FLOAT)
+        return isnan(*col_float_at(col, i, NULL));
+    return 0;
+}
+
+static int sign(const double x) {
+    return (x > 0) - (x < 0);
+}
+
+/* Compares two valid rows in the order of the sort */
+static int compare(
+    const col_t *col,
+    const size_t a,
+    const size_t b,
+    const int descending
+) {
+    /* NaN sorts last in either direction */
+    if (is_nan(col, a) || is_nan(col, b))
+        return is_nan(col, a) - is_nan(col, b);
+
+    int cmp;
+    switch (col->dtype) {
+        case COL_DTYPE_DOUBLE: {
+            const double x = *col_double_at(col, a, NULL);
+            const double y = *col_double_at(col, b, NULL);
+            cmp = x == y ? (signbit(y) != 0) - (signbit(x) != 0) : sign(x - y);
+            break;
+        }
+        case COL_DTYPE_FLOAT: {
+            const float x = *col_float_at(col, a, NULL);
+            const float y = *col_float_at(col, b, NULL);
+            cmp = x == y ? (signbit(y) != 0) - (signbit(x) != 0) : sign(x - y);
+            break;
+        }
+        case COL_DTYPE_INT64: {
+            const int64_t x = *col_int64_at(col, a, NULL);
+            const int64_t y = *col_int64_at(col, b, NULL);
+            cmp = (x > y) - (x < y);
+            break;
+        }
+        case COL_DTYPE_INT32: {
+            const int32_t x = *col_int32_at(col, a, NULL);
+            const int32_t y = *col_int32_at(col, b, NULL);
+            cmp = (x > y) - (x < y);
+            break;
+        }
+        case COL_DTYPE_UINT8:
+            cmp = *col_uint8_at(col, a, NULL) - *col_uint8_at(col, b, NULL);
+            break;
+        case COL_DTYPE_STRING:
+            cmp = strcmp(col_string_at(col, a, NULL), col_string_at(col, b, NULL));
+            break;
+        default:
+            cmp = strcmp(col_category_at(col, a, NULL), col_category_at(col, b, NULL));
+            break;
+    }
+    cmp = (cmp > 0) - (cmp < 0);
+    return descending ? -cmp : cmp;
+}
+
+/* Asserts `order` sorts `col` stably, nulls placed as asked */
+static void check_order(
+    const col_t *col,
+    const col_t *order,
+    const col_sort_options_t *options
+) {
+    const size_t n = col->n_rows;
+    const int64_t *idx = order->data;
+    assert(order->dtype == COL_DTYPE_INT64 && order->n_rows == n);
+
+    uint8_t *seen = calloc(n + 1, 1);
+    for (size_t i = 0; i < n; i++) {
+        assert(idx[i] >= 0 && (size_t)idx[i] < n && !seen[idx[i]]);
+        seen[idx[i]] = 1;
+    }
+    free(seen);
+
+    const size_t n_null = col->null_count;
+    const size_t first = options->nulls_first ? n_null : 0;
+    const size_t last = options->nulls_first ? n : n - n_null;
+    for (size_t i = 0; i < n; i++) {
+        const int null = is_null(col, (size_t)idx[i]);
+        assert(null == (i < first || i >= last));
+        /* null rows keep their input order */
+        if (null && i > 0 && is_null(col, (size_t)idx[i - 1]))
+            assert(idx[i - 1] < idx[i]);
+    }
+    for (size_t i = first + 1; i < last; i++) {
+        const int cmp = compare(
+            col,
+            (size_t)idx[i - 1],
+            (size_t)idx[i],
+            options->descending
+        );
+        assert(cmp < 0 || (cmp == 0 && idx[i - 1] < idx[i]));
+    }
+}
+
+/* Checks every combination of options on `col` */
+static void check_argsort(const col_t *col) {
+    const size_t threads[] = {1, 4};
+    for (size_t t = 0; t < 2; t++) {
+        for (int flags = 0; flags < 4; flags++) {
+            int err;
+            col_sort_options_t options = col_sort_options_default();
+            options.descending = flags & 1;
+            options.nulls_first = (flags >> 1) & 1;
+            options.n_threads = threads[t];
+
+            col_t *order = col_argsort(col, &options, &err);
+            assert(order && err == COL_ERR_OK);
+            check_order(col, order, &options);
+            col_free(order);
+        }
+    }
+}
+
+int main() {
+    test_col_argsort();
+    test_col_argsort_float();
+    test_col_argsort_string();
+    test_col_argsort_category();
+    test_col_sort();
+    test_col_sort_string();
+    test_col_sort_invalid();
+}
+
+void test_col_argsort() {
+    /* valid: every numeric dtype and size, with nulls */
+    for (col_dtype_t dtype = COL_DTYPE_DOUBLE; dtype <= COL_DTYPE_UINT8; dtype++) {
+        for (size_t s = 0; s < sizeof(SIZES) / sizeof(SIZES[0]); s++) {
+            col_t *col = sort_dummy_create(dtype, SIZES[s]);
+            check_argsort(col);
+            col_free(col);
+        }
+    }
+
+    /* valid: default options */
+    int err;
+    col_t *col = col_int32_dummy_create("int32", 999);
+    col_t *order = col_argsort(col, NULL, &err);
+    assert(order && err == COL_ERR_OK);
+    const col_sort_options_t options = col_sort_options_default();
+    check_order(col, order, &options);
+    col_free(order);
+    col_free(col);
+}
+
+void test_col_argsort_float() {
+    /* valid: infinities, signed zeros and NaN of either sign */
+    const double specials[] = {
+        INFINITY, -INFINITY, 0.0, -0.0, NAN, -NAN, 1e-310, -1e-310, 1.5, -1.5
+    };
+    const size_t n_specials = sizeof(specials) / sizeof(specials[0]);
+
+    col_t *col_double = col_create("double", COL_DTYPE_DOUBLE, NULL);
+    col_t *col_float = col_create("float", COL_DTYPE_FLOAT, NULL);
+    for (size_t i = 0; i < LARGE; i++) {
+        const double x = specials[next_random() % n_specials];
+        assert(col_double_append(col_double, x) == 0);
+        assert(col_float_append(col_float, (float)x) == 0);
+    }
+    check_argsort(col_double);
+    check_argsort(col_float);
+    col_free(col_double);
+    col_free(col_float);
+}
+
+void test_col_argsort_string() {
+    /* valid: empty strings, shared prefixes longer than a key, and
+     * strings ending within one */
+    const char *stems[] = {
+        "",
+        "a",
+        "abcdefg",
+        "abcdefgh",
+        "abcdefghi",
+        "abcdefgh-shared-prefix-longer-than-eight-bytes-",
+        "\xc3\xa9t\xc3\xa9",
+        "zz"
+    };
+    const size_t n_stems = sizeof(stems) / sizeof(stems[0]);
+
+    for (size_t s = 0; s < sizeof(SIZES) / sizeof(SIZES[0]); s++) {
+        col_t *col = col_create("string", COL_DTYPE_STRING, NULL);
+        for (size_t i = 0; i < SIZES[s]; i++) {
+            const uint64_t r = next_random();
+            if (i % 17 == 3) {
+                assert(col_append_null(col) == 0);
+                continue;
+            }
+            char buf[128];
+            if (r % 3)
+                snprintf(buf, sizeof(buf), "%s%u", stems[r % n_stems], (unsigned)(r >> 40) % 50);
+            else
+                snprintf(buf, sizeof(buf), "%s", stems[r % n_stems]);
+            assert(col_string_append(col, buf) == 0);
+        }
+        check_argsort(col);
+        col_free(col);
+    }
+
+    /* valid: ties deeper than the radix passes go */
+    col_t *col = col_create("string", COL_DTYPE_STRING, NULL);
+    char buf[256];
+    memset(buf, 'x', 200);
+    for (size_t i = 0; i < 999; i++) {
+        snprintf(buf + 200, 56, "%u", (unsigned)(next_random() % 100));
+        assert(col_string_append(col, buf) == 0);
+    }
+    check_argsort(col);
+    col_free(col);
+}
+
+void test_col_argsort_category() {
+    /* valid: by the strings of the categories, not their codes */
+    col_t *col = col_category_dummy_create("category", 999, 300);
+    assert(col_set_null(col, 10) == 0);
+    check_argsort(col);
+    col_free(col);
+
+    col = col_create("category", COL_DTYPE_CATEGORY, NULL);
+    const char *names[] = {"zebra", "apple", "mango", "banana"};
+    for (size_t i = 0; i < LARGE; i++)
+        assert(col_category_append(col, names[next_random() % 4]) == 0);
+    check_argsort(col);
+    col_free(col);
+}
+
+void test_col_sort() {
+    /* valid: in place, the same rows as `col_take` of the order */
+    for (col_dtype_t dtype = COL_DTYPE_DOUBLE; dtype <= COL_DTYPE_UINT8; dtype++) {
+        for (int nulls = 0; nulls < 2; nulls++) {
+            for (int flags = 0; flags < 4; flags++) {
+                col_sort_options_t options = col_sort_options_default();
+                options.descending = flags & 1;
+                options.nulls_first = (flags >> 1) & 1;
+                options.n_threads = 4;
+
+                col_t *col = sort_dummy_create(dtype, LARGE);
+                if (!nulls) {
+                    /* nulls are dropped by reading the rows back */
+                    for (size_t i = 5; i < LARGE; i += 13)
+                        assert(col_set(col, (char *)col->data + (i - 1) * col->stride, i) == 0);
+                    assert(col->null_count == 0);
+                }
+
+                int err;
+                col_t *order = col_argsort(col, &options, &err);
+                assert(order && err == COL_ERR_OK);
+                col_t *expected = col_take_int64(col, order->data, LARGE, &err);
+                assert(expected && err == COL_ERR_OK);
+
+                col_t *clone = col_clone(col, NULL);
+                assert(col_sort(col, &options) == 0);
+                assert(col->null_count == expected->null_count);
+                for (size_t i = 0; i < LARGE; i++) {
+                    assert(is_null(col, i) == is_null(expected, i));
+                    if (!is_null(col, i))
+                        assert(memcmp(
+                            (char *)col->data + i * col->stride,
+                            (char *)expected->data + i * col->stride,
+                            col->stride
+                        ) == 0);
+                }
+
+                /* valid: the clone kept its rows */
+                for (size_t i = 0; i < LARGE; i++)
+                    assert(is_null(clone, i) == (i % 13 == 5 && nulls));
+
+                col_free(clone);
+                col_free(expected);
+                col_free(order);
+                col_free(col);
+            }
+        }
+    }
+
+    /* valid: NaN is written back as NaN */
+    col_t *col = col_create("double", COL_DTYPE_DOUBLE, NULL);
+    assert(col_double_append(col, NAN) == 0);
+    assert(col_double_append(col, -0.0) == 0);
+    assert(col_double_append(col, 0.0) == 0);
+    assert(col_double_append(col, -1.0) == 0);
+    assert(col_sort(col, NULL) == 0);
+    assert(*col_double_at(col, 0, NULL) == -1.0);
+    assert(signbit(*col_double_at(col, 1, NULL)));
+    assert(!signbit(*col_double_at(col, 2, NULL)));
+    assert(isnan(*col_double_at(col, 3, NULL)));
+    col_free(col);
+
+    /* valid: a slice is sorted in rows of its own */
+    col = col_int32_dummy_create("int32", 999);
+    col_t *slice = col_slice(col, 10, 100, NULL);
+    col_sort_options_t options = col_sort_options_default();
+    options.descending = 1;
+    assert(col_sort(slice, &options) == 0);
+    assert(*col_int32_at(slice, 0, NULL) == *col_int32_at(col, 109, NULL));
+    assert(*col_int32_at(col, 10, NULL) < *col_int32_at(col, 109, NULL));
+    col_free(slice);
+    col_free(col);
+}
+
+void test_col_sort_string() {
+    col_t *col = col_string_dummy_create("string", 999);
+    assert(col_set_null(col, 0) == 0);
+
+    /* valid */
+    assert(col_sort(col, NULL) == 0);
+    assert(is_null(col, 998) && col->null_count == 1);
+    for (size_t i = 1; i < 998; i++)
+        assert(strcmp(col_string_at(col, i - 1, NULL), col_string_at(col, i, NULL)) <= 0);
+    assert(strcmp(col_string_at(col, 0, NULL), "Entry 1") == 0);
+
+    /* valid: the string buffer stays consistent */
+    assert(col_append(col, "appended") == 0);
+    assert(col_strbuf_compact(col, 1) == 0);
+    assert(strcmp(col_string_at(col, 0, NULL), "Entry 1") == 0);
+    assert(strcmp(col_string_at(col, 999, NULL), "appended") == 0);
+    col_free(col);
+
+    /* valid: categories */
+    col = col_category_dummy_create("category", 999, 30);
+    assert(col_sort(col, NULL) == 0);
+    for (size_t i = 1; i < 999; i++)
+        assert(strcmp(col_category_at(col, i - 1, NULL), col_category_at(col, i, NULL)) <= 0);
+    col_free(col);
+}
+
+void test_col_sort_invalid() {
+    int err;
+
+    /* invalid */
+    assert(col_sort(NULL, NULL) == COL_ERR_NO_DATA);
+    assert(!col_argsort(NULL, NULL, &err));
+    assert(err == COL_ERR_NO_DATA);
+}
@@ -0,0 +1,68 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/df/core/type.h"
+#include "dtypes/df/core/accessors.h"
+#include "dtypes/df/core/lifecycle.h"
+#include "dtypes/df/core/modifiers.h"
+
+void test_df_col_at();
+void test_df_col_index();
+
+static const size_t SIZE = 999;
+
+int main() {
+    test_df_col_at();
+    test_df_col_index();
+}
+
+void test_df_col_at() {
+    int err = -1;
+    df_t *df = df_create(NULL);
+    col_t *col = col_create("a", COL_DTYPE_DOUBLE, NULL);
+    df_add_col(df, col);
+
+    /* valid */
+    assert(df_col_at(df, 0, &err) == col);
+    assert(err == COL_ERR_OK);
+
+    /* invalid */
+    assert(df_col_at(df, 1, &err) == NULL);
+    assert(err == COL_ERR_OUT_OF_BOUNDS);
+    df_free(df);
+}
+
+void test_df_col_index() {
+    int err = -1;
+    df_t *df = df_create(NULL);
+
+    /* valid: many columns, all found through the index */
+    for (size_t j = 0; j < SIZE; j++) {
+        char name[32];
+        snprintf(name, sizeof(name), "col_%zu", j);
+        assert(df_add_col(df, col_create(name, COL_DTYPE_INT32, NULL)) == COL_ERR_OK);
+    }
+    assert(df->n_slots >= 2 * SIZE);
+    for (size_t j = 0; j < SIZE; j++) {
+        char name[32];
+        snprintf(name, sizeof(name), "col_%zu", j);
+        assert(df_col_index(df, name, &err) == j);
+        assert(err == COL_ERR_OK);
+        assert(strcmp(df_col(df, name, NULL)->name, name) == 0);
+    }
+
+    /* invalid */
+    assert(df_col_index(df, "col_999", &err) == SIZE_MAX);
+    assert(err == COL_ERR_NOT_FOUND);
+    assert(df_col(df, "", &err) == NULL);
+    assert(err == COL_ERR_NOT_FOUND);
+    assert(df_col(df, NULL, &err) == NULL);
+    assert(err == COL_ERR_NO_DATA);
+    assert(df_col_index(NULL, "a", &err) == SIZE_MAX);
+    assert(err == COL_ERR_NO_DATA);
+    df_free(df);
+}
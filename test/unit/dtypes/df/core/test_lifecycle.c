@@ -0,0 +1,204 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/accessors.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/col/core/modifiers.h"
+#include "dtypes/df/core/type.h"
+#include "dtypes/df/core/accessors.h"
+#include "dtypes/df/core/lifecycle.h"
+
+void test_df_create();
+void test_df_from_cols();
+void test_df_clone();
+void test_df_select();
+void test_df_slice();
+
+static const size_t SIZE = 999;
+
+/* Columns "c0".."c<n-1>" of SIZE rows, row i of column j holding i * j */
+static void make_cols(col_t **cols, const size_t n) {
+    for (size_t j = 0; j < n; j++) {
+        char name[32];
+        snprintf(name, sizeof(name), "c%zu", j);
+        cols[j] = col_create_with_capacity(name, SIZE, COL_DTYPE_INT64, NULL);
+        for (size_t i = 0; i < SIZE; i++)
+            col_int64_append(cols[j], (int64_t)(i * j));
+    }
+}
+
+int main() {
+    test_df_create();
+    test_df_from_cols();
+    test_df_clone();
+    test_df_select();
+    test_df_slice();
+}
+
+void test_df_create() {
+    int err = -1;
+
+    /* valid */
+    df_t *df = df_create(&err);
+    assert(err == COL_ERR_OK);
+    assert(df_n_cols(df) == 0);
+    assert(df_n_rows(df) == 0);
+    df_free(df);
+
+    /* valid: freeing NULL is a no-op */
+    df_free(NULL);
+}
+
+void test_df_from_cols() {
+    int err = -1;
+    col_t *cols[40];
+    make_cols(cols, 40);
+
+    /* valid: columns keep their order and are found by name */
+    df_t *df = df_from_cols(cols, 40, &err);
+    assert(err == COL_ERR_OK);
+    assert(df_n_cols(df) == 40);
+    assert(df_n_rows(df) == SIZE);
+    for (size_t j = 0; j < 40; j++) {
+        char name[32];
+        snprintf(name, sizeof(name), "c%zu", j);
+        assert(df_col_at(df, j, NULL) == cols[j]);
+        assert(df_col(df, name, NULL) == cols[j]);
+    }
+    df_free(df);
+
+    /* invalid: the caller keeps its columns on error */
+    make_cols(cols, 2);
+    col_t *other = col_create("c0", COL_DTYPE_DOUBLE, NULL);
+    col_t *dup[3] = {cols[0], cols[1], other};
+    assert(df_from_cols(dup, 3, &err) == NULL);
+    assert(err == COL_ERR_INVALID_ARG);
+
+    col_rename(other, "x");
+    assert(df_from_cols(dup, 3, &err) == NULL);
+    assert(err == COL_ERR_INVALID_ARG);
+    col_free(other);
+
+    dup[1] = NULL;
+    assert(df_from_cols(dup, 2, &err) == NULL);
+    assert(err == COL_ERR_NO_DATA);
+    assert(df_from_cols(NULL, 2, &err) == NULL);
+    assert(err == COL_ERR_NO_DATA);
+    col_free(cols[0]);
+    col_free(cols[1]);
+
+    /* valid: no columns */
+    df = df_from_cols(NULL, 0, &err);
+    assert(err == COL_ERR_OK);
+    assert(df_n_cols(df) == 0);
+    df_free(df);
+}
+
+void test_df_clone() {
+    int err = -1;
+    col_t *cols[3];
+    make_cols(cols, 3);
+    df_t *df = df_from_cols(cols, 3, NULL);
+
+    /* valid: shares data until mutated */
+    df_t *clone = df_clone(df, &err);
+    assert(err == COL_ERR_OK);
+    assert(df_n_cols(clone) == 3);
+    assert(df_n_rows(clone) == SIZE);
+    assert(df_col(clone, "c2", NULL) != cols[2]);
+    assert(df_col(clone, "c2", NULL)->data == cols[2]->data);
+
+    col_int64_set(df_col(clone, "c2", NULL), -1, 0);
+    assert(*col_int64_at(cols[2], 0, NULL) == 0);
+    assert(*col_int64_at(df_col(clone, "c2", NULL), 0, NULL) == -1);
+    df_free(clone);
+
+    /* valid: zero rows */
+    df_t *empty = df_slice(df, 0, 0, NULL);
+    clone = df_clone(empty, &err);
+    assert(err == COL_ERR_OK);
+    assert(df_n_cols(clone) == 3);
+    assert(df_n_rows(clone) == 0);
+    assert(df_col(clone, "c1", NULL)->dtype == COL_DTYPE_INT64);
+    df_free(clone);
+    df_free(empty);
+    df_free(df);
+
+    /* invalid */
+    assert(df_clone(NULL, &err) == NULL);
+    assert(err == COL_ERR_NO_DATA);
+}
+
+void test_df_select() {
+    int err = -1;
+    col_t *cols[3];
+    make_cols(cols, 3);
+    df_t *df = df_from_cols(cols, 3, NULL);
+
+    /* valid: the given order */
+    const char *names[] = {"c2", "c0"};
+    df_t *sel = df_select(df, names, 2, &err);
+    assert(err == COL_ERR_OK);
+    assert(df_n_cols(sel) == 2);
+    assert(strcmp(df_col_at(sel, 0, NULL)->name, "c2") == 0);
+    assert(*col_int64_at(df_col(sel, "c2", NULL), 5, NULL) == 10);
+    assert(df_col(sel, "c1", &err) == NULL);
+    assert(err == COL_ERR_NOT_FOUND);
+    df_free(sel);
+
+    /* valid: zero rows */
+    col_t *empty_cols[2] = {
+        col_create("a", COL_DTYPE_STRING, NULL),
+        col_create("b", COL_DTYPE_DOUBLE, NULL)
+    };
+    df_t *empty = df_from_cols(empty_cols, 2, NULL);
+    const char *empty_names[] = {"b"};
+    sel = df_select(empty, empty_names, 1, &err);
+    assert(err == COL_ERR_OK);
+    assert(df_n_cols(sel) == 1);
+    assert(df_n_rows(sel) == 0);
+    assert(df_col_at(sel, 0, NULL)->dtype == COL_DTYPE_DOUBLE);
+    df_free(sel);
+    df_free(empty);
+
+    /* invalid: unknown or repeated names */
+    const char *missing[] = {"c0", "nope"};
+    assert(df_select(df, missing, 2, &err) == NULL);
+    assert(err == COL_ERR_NOT_FOUND);
+    const char *repeated[] = {"c0", "c0"};
+    assert(df_select(df, repeated, 2, &err) == NULL);
+    assert(err == COL_ERR_INVALID_ARG);
+    assert(df_select(df, NULL, 1, &err) == NULL);
+    assert(err == COL_ERR_NO_DATA);
+    df_free(df);
+}
+
+void test_df_slice() {
+    int err = -1;
+    col_t *cols[2];
+    make_cols(cols, 2);
+    df_t *df = df_from_cols(cols, 2, NULL);
+
+    /* valid: rows are viewed, not copied */
+    df_t *view = df_slice(df, 10, 20, &err);
+    assert(err == COL_ERR_OK);
+    assert(df_n_rows(view) == 20);
+    assert(*col_int64_at(df_col(view, "c1", NULL), 0, NULL) == 10);
+    assert(df_col(view, "c1", NULL)->data == (int64_t *)cols[1]->data + 10);
+    df_free(view);
+
+    view = df_slice(df, SIZE, 0, &err);
+    assert(err == COL_ERR_OK);
+    assert(df_n_rows(view) == 0);
+    df_free(view);
+
+    /* invalid */
+    assert(df_slice(df, SIZE - 5, 6, &err) == NULL);
+    assert(err == COL_ERR_OUT_OF_BOUNDS);
+    assert(df_slice(NULL, 0, 0, &err) == NULL);
+    assert(err == COL_ERR_NO_DATA);
+    df_free(df);
+}
@@ -0,0 +1,130 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/col/core/modifiers.h"
+#include "dtypes/df/core/type.h"
+#include "dtypes/df/core/accessors.h"
+#include "dtypes/df/core/lifecycle.h"
+#include "dtypes/df/core/modifiers.h"
+
+void test_df_add_col();
+void test_df_take_col();
+void test_df_drop_col();
+void test_df_rename_col();
+
+static const size_t SIZE = 999;
+
+static col_t *make_col(const char *name, const size_t n_rows) {
+    col_t *col = col_create_with_capacity(name, n_rows, COL_DTYPE_DOUBLE, NULL);
+    for (size_t i = 0; i < n_rows; i++)
+        col_double_append(col, (double)i);
+    return col;
+}
+
+int main() {
+    test_df_add_col();
+    test_df_take_col();
+    test_df_drop_col();
+    test_df_rename_col();
+}
+
+void test_df_add_col() {
+    df_t *df = df_create(NULL);
+
+    /* valid: the first column sets the row count */
+    col_t *a = make_col("a", SIZE);
+    assert(df_add_col(df, a) == COL_ERR_OK);
+    assert(df_n_rows(df) == SIZE);
+    assert(df_col(df, "a", NULL) == a);
+
+    /* invalid: row count, duplicate name, NULL */
+    col_t *b = make_col("b", SIZE - 1);
+    assert(df_add_col(df, b) == COL_ERR_INVALID_ARG);
+    col_free(b);
+    b = make_col("a", SIZE);
+    assert(df_add_col(df, b) == COL_ERR_INVALID_ARG);
+    col_free(b);
+    assert(df_add_col(df, NULL) == COL_ERR_NO_DATA);
+    assert(df_add_col(NULL, a) == COL_ERR_NO_DATA);
+    assert(df_n_cols(df) == 1);
+    df_free(df);
+}
+
+void test_df_take_col() {
+    int err = -1;
+    df_t *df = df_create(NULL);
+    col_t *cols[20];
+    for (size_t j = 0; j < 20; j++) {
+        char name[32];
+        snprintf(name, sizeof(name), "c%zu", j);
+        cols[j] = make_col(name, SIZE);
+        df_add_col(df, cols[j]);
+    }
+
+    /* valid: the rest keep their order and stay indexed */
+    col_t *col = df_take_col(df, "c5", &err);
+    assert(err == COL_ERR_OK);
+    assert(col == cols[5]);
+    assert(df_n_cols(df) == 19);
+    assert(df_col(df, "c5", NULL) == NULL);
+    assert(df_col_at(df, 5, NULL) == cols[6]);
+    assert(df_col_index(df, "c19", NULL) == 18);
+    col_free(col);
+
+    /* invalid */
+    assert(df_take_col(df, "c5", &err) == NULL);
+    assert(err == COL_ERR_NOT_FOUND);
+
+    /* valid: an emptied frame takes any row count */
+    for (size_t j = 0; j < 20; j++) {
+        char name[32];
+        snprintf(name, sizeof(name), "c%zu", j);
+        if (j != 5)
+            col_free(df_take_col(df, name, NULL));
+    }
+    assert(df_n_cols(df) == 0);
+    assert(df_n_rows(df) == 0);
+    assert(df_add_col(df, make_col("x", 3)) == COL_ERR_OK);
+    assert(df_n_rows(df) == 3);
+    df_free(df);
+}
+
+void test_df_drop_col() {
+    df_t *df = df_create(NULL);
+    df_add_col(df, make_col("a", SIZE));
+    df_add_col(df, make_col("b", SIZE));
+
+    /* valid */
+    assert(df_drop_col(df, "a") == COL_ERR_OK);
+    assert(df_n_cols(df) == 1);
+    assert(df_col_index(df, "b", NULL) == 0);
+
+    /* invalid */
+    assert(df_drop_col(df, "a") == COL_ERR_NOT_FOUND);
+    assert(df_drop_col(NULL, "b") == COL_ERR_NO_DATA);
+    df_free(df);
+}
+
+void test_df_rename_col() {
+    df_t *df = df_create(NULL);
+    col_t *a = make_col("a", SIZE);
+    df_add_col(df, a);
+    df_add_col(df, make_col("b", SIZE));
+
+    /* valid */
+    assert(df_rename_col(df, "a", "z") == COL_ERR_OK);
+    assert(strcmp(a->name, "z") == 0);
+    assert(df_col(df, "z", NULL) == a);
+    assert(df_col(df, "a", NULL) == NULL);
+    assert(df_rename_col(df, "z", "z") == COL_ERR_OK);
+
+    /* invalid */
+    assert(df_rename_col(df, "z", "b") == COL_ERR_INVALID_ARG);
+    assert(df_rename_col(df, "z", "") == COL_ERR_EMPTY_NAME);
+    assert(df_rename_col(df, "a", "y") == COL_ERR_NOT_FOUND);
+    df_free(df);
+}
@@ -0,0 +1,533 @@
+#include <assert.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/cpu.h"
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/accessors.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/col/core/modifiers.h"
+#include "dtypes/df/core/type.h"
+#include "dtypes/df/core/accessors.h"
+#include "dtypes/df/core/lifecycle.h"
+#include "dtypes/df/ops/groupby.h"
+#include "test_utils/random.h"
+
+void test_df_groupby();
+void test_df_groupby_sort();
+void test_df_groupby_float_keys();
+void test_df_groupby_dtypes();
+void test_df_groupby_large();
+void test_df_groupby_invalid();
+
+/* Large enough to be split into chunks and partitions */
+static const size_t LARGE = 200000;
+static const size_t CARDINALITY = 5000;
+
+static int is_null(const col_t *col, const size_t i) {
+    return col_is_null(col, i, NULL) == 1;
+}
+
+static double double_at(const df_t *df, const char *name, const size_t i) {
+    return *col_double_at(df_col(df, name, NULL), i, NULL);
+}
+
+static int64_t int64_at(const df_t *df, const char *name, const size_t i) {
+    return *col_int64_at(df_col(df, name, NULL), i, NULL);
+}
+
+/* Whether row `i` of `a` and row `j` of `b` hold the same value, NaN
+ * equal to NaN and null to null */
+static int same_row(const col_t *a, const size_t i, const col_t *b, const size_t j) {
+    if (is_null(a, i) || is_null(b, j))
+        return is_null(a, i) == is_null(b, j);
+
+    switch (a->dtype) {
+        case COL_DTYPE_DOUBLE: {
+            const double x = *col_double_at(a, i, NULL);
+            const double y = *col_double_at(b, j, NULL);
+            return x == y || (isnan(x) && isnan(y));
+        }
+        case COL_DTYPE_FLOAT: {
+            const float x = *col_float_at(a, i, NULL);
+            const float y = *col_float_at(b, j, NULL);
+            return x == y || (isnan(x) && isnan(y));
+        }
+        case COL_DTYPE_INT64:
+            return *col_int64_at(a, i, NULL) == *col_int64_at(b, j, NULL);
+        case COL_DTYPE_INT32:
+            return *col_int32_at(a, i, NULL) == *col_int32_at(b, j, NULL);
+        case COL_DTYPE_UINT8:
+            return *col_uint8_at(a, i, NULL) == *col_uint8_at(b, j, NULL);
+        case COL_DTYPE_STRING:
+            return !strcmp(col_string_at(a, i, NULL), col_string_at(b, j, NULL));
+        default:
+            return !strcmp(col_category_at(a, i, NULL), col_category_at(b, j, NULL));
+    }
+}
+
+static void assert_df_equal(const df_t *a, const df_t *b) {
+    assert(df_n_cols(a) == df_n_cols(b));
+    assert(df_n_rows(a) == df_n_rows(b));
+    for (size_t j = 0; j < df_n_cols(a); j++) {
+        const col_t *x = df_col_at(a, j, NULL);
+        const col_t *y = df_col_at(b, j, NULL);
+        assert(!strcmp(x->name, y->name));
+        assert(x->dtype == y->dtype);
+        for (size_t i = 0; i < df_n_rows(a); i++)
+            assert(same_row(x, i, y, i));
+    }
+}
+
+/*
+ * row  k1    k2  v
+ * 0    a     1   1
+ * 1    b     1   2
+ * 2    a     1   3
+ * 3    null  2   4
+ * 4    a     2   null
+ * 5    b     1   NaN
+ * 6    null  2   6
+ * 7    a     1   -1
+ * 8    a     2   null
+ * 9    c     3   5
+ */
+static df_t *small_df_create(void) {
+    const char *k1[] = {"a", "b", "a", NULL, "a", "b", NULL, "a", "a", "c"};
+    const int32_t k2[] = {1, 1, 1, 2, 2, 1, 2, 1, 2, 3};
+    const double v[] = {1, 2, 3, 4, 0, NAN, 6, -1, 0, 5};
+
+    col_t *cols[3] = {
+        col_create("k1", COL_DTYPE_STRING, NULL),
+        col_create("k2", COL_DTYPE_INT32, NULL),
+        col_create("v", COL_DTYPE_DOUBLE, NULL)
+    };
+    for (size_t i = 0; i < 10; i++) {
+        if (k1[i])
+            assert(col_string_append(cols[0], k1[i]) == 0);
+        else
+            assert(col_append_null(cols[0]) == 0);
+        assert(col_int32_append(cols[1], k2[i]) == 0);
+        if (i == 4 || i == 8)
+            assert(col_append_null(cols[2]) == 0);
+        else
+            assert(col_double_append(cols[2], v[i]) == 0);
+    }
+    return df_from_cols(cols, 3, NULL);
+}
+
+static const df_agg_t SMALL_AGGS[] = {
+    {NULL, DF_AGG_COUNT, NULL},
+    {"v", DF_AGG_COUNT, NULL},
+    {"v", DF_AGG_SUM, NULL},
+    {"v", DF_AGG_MEAN, NULL},
+    {"v", DF_AGG_MIN, NULL},
+    {"v", DF_AGG_MAX, "largest"}
+};
+
+int main() {
+    test_df_groupby();
+    test_df_groupby_sort();
+    test_df_groupby_float_keys();
+    test_df_groupby_dtypes();
+    test_df_groupby_large();
+    test_df_groupby_invalid();
+}
+
+void test_df_groupby() {
+    int err = -1;
+    df_t *df = small_df_create();
+    const char *keys[] = {"k1", "k2"};
+
+    /* valid: groups in order of first appearance, null keys grouped */
+    df_t *res = df_groupby(df, keys, 2, SMALL_AGGS, 6, NULL, &err);
+    assert(err == COL_ERR_OK);
+    assert(df_n_rows(res) == 5);
+    assert(df_n_cols(res) == 8);
+
+    const char *names[] = {
+        "k1", "k2", "count", "v_count", "v_sum", "v_mean", "v_min", "largest"
+    };
+    for (size_t j = 0; j < 8; j++)
+        assert(!strcmp(df_col_at(res, j, NULL)->name, names[j]));
+    assert(df_col(res, "count", NULL)->dtype == COL_DTYPE_INT64);
+    assert(df_col(res, "v_sum", NULL)->dtype == COL_DTYPE_DOUBLE);
+
+    const col_t *k1 = df_col(res, "k1", NULL);
+    const col_t *k2 = df_col(res, "k2", NULL);
+    const char *exp_k1[] = {"a", "b", NULL, "a", "c"};
+    const int32_t exp_k2[] = {1, 1, 2, 2, 3};
+    const int64_t exp_size[] = {3, 2, 2, 2, 1};
+    const int64_t exp_count[] = {3, 2, 2, 0, 1};
+    for (size_t g = 0; g < 5; g++) {
+        if (exp_k1[g])
+            assert(!strcmp(col_string_at(k1, g, NULL), exp_k1[g]));
+        else
+            assert(is_null(k1, g));
+        assert(*col_int32_at(k2, g, NULL) == exp_k2[g]);
+        assert(int64_at(res, "count", g) == exp_size[g]);
+        assert(int64_at(res, "v_count", g) == exp_count[g]);
+    }
+
+    /* valid: sums skip nulls, and NaN propagates through sums only */
+    assert(double_at(res, "v_sum", 0) == 3);
+    assert(isnan(double_at(res, "v_sum", 1)));
+    assert(double_at(res, "v_sum", 2) == 10);
+    assert(double_at(res, "v_sum", 3) == 0);
+    assert(double_at(res, "v_mean", 0) == 1);
+    assert(isnan(double_at(res, "v_mean", 1)));
+    assert(double_at(res, "v_mean", 2) == 5);
+    assert(double_at(res, "v_min", 0) == -1);
+    assert(double_at(res, "v_min", 1) == 2);
+    assert(double_at(res, "largest", 0) == 3);
+    assert(double_at(res, "largest", 1) == 2);
+    assert(double_at(res, "largest", 2) == 6);
+    assert(double_at(res, "v_min", 4) == 5);
+
+    /* valid: groups without values are null except for counts and sums */
+    assert(is_null(df_col(res, "v_mean", NULL), 3));
+    assert(is_null(df_col(res, "v_min", NULL), 3));
+    assert(is_null(df_col(res, "largest", NULL), 3));
+    assert(!is_null(df_col(res, "v_sum", NULL), 3));
+    assert(df_col(res, "v_mean", NULL)->null_count == 1);
+    df_free(res);
+
+    /* valid: a single key, no aggregations */
+    res = df_groupby(df, keys + 1, 1, NULL, 0, NULL, &err);
+    assert(err == COL_ERR_OK);
+    assert(df_n_rows(res) == 3);
+    assert(df_n_cols(res) == 1);
+    assert(*col_int32_at(df_col(res, "k2", NULL), 2, NULL) == 3);
+    df_free(res);
+
+    /* valid: empty frame */
+    df_t *empty = df_slice(df, 4, 0, NULL);
+    res = df_groupby(empty, keys, 2, SMALL_AGGS, 6, NULL, &err);
+    assert(err == COL_ERR_OK);
+    assert(df_n_rows(res) == 0);
+    assert(df_n_cols(res) == 8);
+    df_free(res);
+    df_free(empty);
+
+    df_free(df);
+}
+
+void test_df_groupby_sort() {
+    int err = -1;
+    df_t *df = small_df_create();
+    const char *keys[] = {"k1", "k2"};
+    df_groupby_options_t options = df_groupby_options_default();
+    options.sort = 1;
+
+    /* valid: ordered by the first key, then the second, nulls last */
+    df_t *res = df_groupby(df, keys, 2, SMALL_AGGS, 6, &options, &err);
+    assert(err == COL_ERR_OK);
+    assert(df_n_rows(res) == 5);
+
+    const col_t *k1 = df_col(res, "k1", NULL);
+    const col_t *k2 = df_col(res, "k2", NULL);
+    const char *exp_k1[] = {"a", "a", "b", "c", NULL};
+    const int32_t exp_k2[] = {1, 2, 1, 3, 2};
+    const int64_t exp_size[] = {3, 2, 2, 1, 2};
+    for (size_t g = 0; g < 5; g++) {
+        if (exp_k1[g])
+            assert(!strcmp(col_string_at(k1, g, NULL), exp_k1[g]));
+        else
+            assert(is_null(k1, g));
+        assert(*col_int32_at(k2, g, NULL) == exp_k2[g]);
+        assert(int64_at(res, "count", g) == exp_size[g]);
+    }
+    assert(double_at(res, "v_sum", 4) == 10);
+    assert(is_null(df_col(res, "v_mean", NULL), 1));
+    df_free(res);
+
+    /* valid: the second key first */
+    const char *swapped[] = {"k2", "k1"};
+    res = df_groupby(df, swapped, 2, NULL, 0, &options, &err);
+    assert(err == COL_ERR_OK);
+    const int32_t exp_swapped[] = {1, 1, 2, 2, 3};
+    for (size_t g = 0; g < 5; g++)
+        assert(*col_int32_at(df_col(res, "k2", NULL), g, NULL) == exp_swapped[g]);
+    assert(!strcmp(col_string_at(df_col(res, "k1", NULL), 2, NULL), "a"));
+    assert(is_null(df_col(res, "k1", NULL), 3));
+    df_free(res);
+
+    df_free(df);
+}
+
+void test_df_groupby_float_keys() {
+    int err = -1;
+    const double keys[] = {0.0, -0.0, NAN, 1.5, -NAN, 0.0, 1.5};
+    const float fkeys[] = {0.0f, -0.0f, NAN, 1.5f, -NAN, 0.0f, 1.5f};
+
+    col_t *cols[3] = {
+        col_create("d", COL_DTYPE_DOUBLE, NULL),
+        col_create("f", COL_DTYPE_FLOAT, NULL),
+        col_create("v", COL_DTYPE_INT64, NULL)
+    };
+    for (size_t i = 0; i < 7; i++) {
+        assert(col_double_append(cols[0], keys[i]) == 0);
+        assert(col_float_append(cols[1], fkeys[i]) == 0);
+        assert(col_int64_append(cols[2], (int64_t)i) == 0);
+    }
+    assert(col_append_null(cols[0]) == 0);
+    assert(col_append_null(cols[1]) == 0);
+    assert(col_int64_append(cols[2], 100) == 0);
+    df_t *df = df_from_cols(cols, 3, NULL);
+
+    /* valid: -0.0 groups with 0.0, every NaN together, null apart */
+    const df_agg_t aggs[] = {{"v", DF_AGG_SUM, NULL}};
+    const char *names[] = {"d", "f"};
+    for (size_t k = 0; k < 2; k++) {
+        df_t *res = df_groupby(df, names + k, 1, aggs, 1, NULL, &err);
+        assert(err == COL_ERR_OK);
+        assert(df_n_rows(res) == 4);
+        assert(double_at(res, "v_sum", 0) == 0 + 1 + 5);
+        assert(double_at(res, "v_sum", 1) == 2 + 4);
+        assert(double_at(res, "v_sum", 2) == 3 + 6);
+        assert(double_at(res, "v_sum", 3) == 100);
+        assert(is_null(df_col_at(res, 0, NULL), 3));
+        df_free(res);
+    }
+
+    df_free(df);
+}
+
+/* Random keys of `dtype` drawn from a few values, every 11th row null */
+static col_t *key_create(const char *name, const col_dtype_t dtype, const size_t n) {
+    static const char *labels[] = {"red", "green", "blue", "", "cyan"};
+    col_t *col = col_create(name, dtype, NULL);
+    for (size_t i = 0; i < n; i++) {
+        const uint64_t r = next_random() % 5;
+        if (i % 11 == 3) {
+            assert(col_append_null(col) == 0);
+            continue;
+        }
+        switch (dtype) {
+            case COL_DTYPE_DOUBLE:
+                assert(col_double_append(col, (double)r / 2) == 0);
+                break;
+            case COL_DTYPE_FLOAT:
+                assert(col_float_append(col, (float)r / 2) == 0);
+                break;
+            case COL_DTYPE_INT64:
+                assert(col_int64_append(col, (int64_t)r * (INT64_MAX / 5)) == 0);
+                break;
+            case COL_DTYPE_INT32:
+                assert(col_int32_append(col, -(int32_t)r) == 0);
+                break;
+            case COL_DTYPE_UINT8:
+                assert(col_uint8_append(col, (uint8_t)(r * 50)) == 0);
+                break;
+            case COL_DTYPE_STRING:
+                assert(col_string_append(col, labels[r]) == 0);
+                break;
+            default:
+                assert(col_category_append(col, labels[r]) == 0);
+                break;
+        }
+    }
+    return col;
+}
+
+void test_df_groupby_dtypes() {
+    int err = -1;
+    const size_t n = 999;
+    const col_dtype_t dtypes[] = {
+        COL_DTYPE_DOUBLE, COL_DTYPE_FLOAT, COL_DTYPE_INT64, COL_DTYPE_INT32,
+        COL_DTYPE_UINT8, COL_DTYPE_STRING, COL_DTYPE_CATEGORY
+    };
+    const size_t n_dtypes = sizeof(dtypes) / sizeof(dtypes[0]);
+
+    /* valid: every pair of key dtypes against a brute force grouping */
+    for (size_t a = 0; a < n_dtypes; a++) {
+        for (size_t b = 0; b < n_dtypes; b++) {
+            col_t *cols[3] = {
+                key_create("a", dtypes[a], n),
+                key_create("b", dtypes[b], n),
+                col_create("v", COL_DTYPE_INT32, NULL)
+            };
+            for (size_t i = 0; i < n; i++)
+                assert(col_int32_append(cols[2], (int32_t)i) == 0);
+            df_t *df = df_from_cols(cols, 3, NULL);
+
+            const char *keys[] = {"a", "b"};
+            const df_agg_t aggs[] = {
+                {NULL, DF_AGG_COUNT, NULL},
+                {"v", DF_AGG_SUM, NULL},
+                {"v", DF_AGG_MIN, NULL}
+            };
+            df_t *res = df_groupby(df, keys, 2, aggs, 3, NULL, &err);
+            assert(err == COL_ERR_OK);
+
+            /* the first row of every group comes before any other row */
+            const col_t *ka = df_col(res, "a", NULL);
+            const col_t *kb = df_col(res, "b", NULL);
+            size_t n_groups = 0;
+            int64_t *count = calloc(n, sizeof(int64_t));
+            double *sum = calloc(n, sizeof(double));
+            for (size_t i = 0; i < n; i++) {
+                size_t g = 0;
+                while (g < n_groups
+                    && !(same_row(ka, g, cols[0], i) && same_row(kb, g, cols[1], i)))
+                    g++;
+                if (g == n_groups) {
+                    assert(double_at(res, "v_min", g) == (double)i);
+                    n_groups++;
+                }
+                count[g]++;
+                sum[g] += (double)i;
+            }
+            assert(df_n_rows(res) == n_groups);
+            for (size_t g = 0; g < n_groups; g++) {
+                assert(int64_at(res, "count", g) == count[g]);
+                assert(double_at(res, "v_sum", g) == sum[g]);
+            }
+            if (dtypes[a] == COL_DTYPE_CATEGORY)
+                assert(ka->dtype == COL_DTYPE_CATEGORY);
+
+            free(sum);
+            free(count);
+            df_free(res);
+            df_free(df);
+        }
+    }
+}
+
+void test_df_groupby_large() {
+    int err = -1;
+    col_t *cols[3] = {
+        col_create_with_capacity("key", LARGE, COL_DTYPE_INT64, NULL),
+        col_create_with_capacity("half", LARGE, COL_DTYPE_UINT8, NULL),
+        col_create_with_capacity("v", LARGE, COL_DTYPE_DOUBLE, NULL)
+    };
+    int64_t *count = calloc(CARDINALITY, sizeof(int64_t));
+    double *sum = calloc(CARDINALITY, sizeof(double));
+    double *max = calloc(CARDINALITY, sizeof(double));
+    for (size_t i = 0; i < LARGE; i++) {
+        const int64_t key = (int64_t)(next_random() % CARDINALITY);
+        const double v = (double)(next_random() % 1000);
+        assert(col_int64_append(cols[0], key * 7919) == 0);
+        assert(col_uint8_append(cols[1], (uint8_t)(key % 2)) == 0);
+        assert(col_double_append(cols[2], v) == 0);
+        if (!count[key] || v > max[key])
+            max[key] = v;
+        count[key]++;
+        sum[key] += v;
+    }
+    df_t *df = df_from_cols(cols, 3, NULL);
+
+    const char *keys[] = {"key", "half"};
+    const df_agg_t aggs[] = {
+        {NULL, DF_AGG_COUNT, NULL},
+        {"v", DF_AGG_SUM, NULL},
+        {"v", DF_AGG_MEAN, NULL},
+        {"v", DF_AGG_MAX, NULL}
+    };
+    df_groupby_options_t options = df_groupby_options_default();
+
+    /* valid: one thread, against the reference */
+    options.n_threads = 1;
+    df_t *ref = df_groupby(df, keys, 2, aggs, 4, &options, &err);
+    assert(err == COL_ERR_OK);
+    assert(df_n_rows(ref) == CARDINALITY);
+    for (size_t g = 0; g < CARDINALITY; g++) {
+        const int64_t key = *col_int64_at(df_col(ref, "key", NULL), g, NULL) / 7919;
+        assert(*col_uint8_at(df_col(ref, "half", NULL), g, NULL) == key % 2);
+        assert(int64_at(ref, "count", g) == count[key]);
+        assert(double_at(ref, "v_sum", g) == sum[key]);
+        assert(double_at(ref, "v_mean", g) == sum[key] / (double)count[key]);
+        assert(double_at(ref, "v_max", g) == max[key]);
+    }
+
+    /* valid: partitioned on several threads and every ISA, identical */
+    const mlc_isa_t host = mlc_cpu_isa_detect();
+    for (mlc_isa_t isa = MLC_ISA_SCALAR; isa <= host; isa++) {
+        mlc_cpu_isa_limit(isa);
+        options.n_threads = 4;
+        df_t *res = df_groupby(df, keys, 2, aggs, 4, &options, &err);
+        assert(err == COL_ERR_OK);
+        assert_df_equal(res, ref);
+        df_free(res);
+    }
+    mlc_cpu_isa_limit(MLC_ISA_COUNT);
+
+    /* valid: sorted by key, on one thread and several */
+    options.sort = 1;
+    df_t *sorted = df_groupby(df, keys, 2, aggs, 4, &options, &err);
+    assert(err == COL_ERR_OK);
+    const col_t *key = df_col(sorted, "key", NULL);
+    for (size_t g = 1; g < CARDINALITY; g++)
+        assert(*col_int64_at(key, g - 1, NULL) < *col_int64_at(key, g, NULL));
+    options.n_threads = 1;
+    df_t *res = df_groupby(df, keys, 2, aggs, 4, &options, &err);
+    assert(err == COL_ERR_OK);
+    assert_df_equal(res, sorted);
+    df_free(res);
+    df_free(sorted);
+
+    df_free(ref);
+    free(max);
+    free(sum);
+    free(count);
+    df_free(df);
+}
+
+void test_df_groupby_invalid() {
+    int err = -1;
+    df_t *df = small_df_create();
+    const char *keys[] = {"k1", "k2"};
+    const char *missing[] = {"k3"};
+
+    /* invalid: NULL arguments */
+    assert(df_groupby(NULL, keys, 2, NULL, 0, NULL, &err) == NULL);
+    assert(err == COL_ERR_NO_DATA);
+    assert(df_groupby(df, NULL, 2, NULL, 0, NULL, &err) == NULL);
+    assert(err == COL_ERR_NO_DATA);
+    assert(df_groupby(df, keys, 2, NULL, 1, NULL, &err) == NULL);
+    assert(err == COL_ERR_NO_DATA);
+
+    /* invalid: no keys */
+    assert(df_groupby(df, keys, 0, NULL, 0, NULL, &err) == NULL);
+    assert(err == COL_ERR_INVALID_ARG);
+
+    /* invalid: missing columns */
+    assert(df_groupby(df, missing, 1, NULL, 0, NULL, &err) == NULL);
+    assert(err == COL_ERR_NOT_FOUND);
+    const df_agg_t absent[] = {{"w", DF_AGG_SUM, NULL}};
+    assert(df_groupby(df, keys, 2, absent, 1, NULL, &err) == NULL);
+    assert(err == COL_ERR_NOT_FOUND);
+
+    /* invalid: only counts take no value column */
+    const df_agg_t no_col[] = {{NULL, DF_AGG_MEAN, NULL}};
+    assert(df_groupby(df, keys, 2, no_col, 1, NULL, &err) == NULL);
+    assert(err == COL_ERR_INVALID_ARG);
+
+    /* invalid: non-numeric values, except for counts */
+    const df_agg_t strings[] = {{"k1", DF_AGG_SUM, NULL}};
+    assert(df_groupby(df, keys + 1, 1, strings, 1, NULL, &err) == NULL);
+    assert(err == COL_ERR_INVALID_DTYPE);
+    const df_agg_t string_count[] = {{"k1", DF_AGG_COUNT, NULL}};
+    df_t *res = df_groupby(df, keys + 1, 1, string_count, 1, NULL, &err);
+    assert(err == COL_ERR_OK);
+    assert(int64_at(res, "k1_count", 1) == 2);
+    df_free(res);
+
+    /* invalid: duplicate result names */
+    const df_agg_t twice[] = {{"v", DF_AGG_SUM, NULL}, {"v", DF_AGG_SUM, NULL}};
+    assert(df_groupby(df, keys, 2, twice, 2, NULL, &err) == NULL);
+    assert(err == COL_ERR_INVALID_ARG);
+    const df_agg_t shadow[] = {{"v", DF_AGG_SUM, "k1"}};
+    assert(df_groupby(df, keys, 2, shadow, 1, NULL, &err) == NULL);
+    assert(err == COL_ERR_INVALID_ARG);
+
+    /* invalid: unknown aggregation */
+    const df_agg_t unknown[] = {{"v", (df_agg_op_t)99, NULL}};
+    assert(df_groupby(df, keys, 2, unknown, 1, NULL, &err) == NULL);
+    assert(err == COL_ERR_INVALID_ARG);
+
+    df_free(df);
+}
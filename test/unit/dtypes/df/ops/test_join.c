@@ -0,0 +1,401 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/cpu.h"
+#include "dtypes/col/core/type.h"
+#include "dtypes/col/core/accessors.h"
+#include "dtypes/col/core/lifecycle.h"
+#include "dtypes/col/core/modifiers.h"
+#include "dtypes/df/core/type.h"
+#include "dtypes/df/core/accessors.h"
+#include "dtypes/df/core/lifecycle.h"
+#include "dtypes/df/ops/join.h"
+#include "test_utils/random.h"
+
+void test_df_join_inner();
+void test_df_join_left();
+void test_df_join_multi_key();
+void test_df_join_empty();
+void test_df_join_large();
+void test_df_join_invalid();
+
+/* Large enough to be split into chunks and partitions */
+static const size_t LARGE_LEFT = 200000;
+static const size_t LARGE_RIGHT = 150000;
+static const size_t LARGE_KEYS = 100000;
+
+static int is_null(const col_t *col, const size_t i) {
+    return col_is_null(col, i, NULL) == 1;
+}
+
+/*
+ * left             right
+ * row  id    x     row  key   y    x
+ * 0    1     0.5   0    2     "b"  20
+ * 1    2     1.5   1    3     "c"  30
+ * 2    3     2.5   2    3     "C"  31
+ * 3    4     3.5   3    5     "e"  50
+ * 4    2     4.5   4    null  "n"  0
+ * 5    null  5.5
+ */
+static df_t *left_create(void) {
+    col_t *cols[2] = {
+        col_create("id", COL_DTYPE_INT64, NULL),
+        col_create("x", COL_DTYPE_DOUBLE, NULL)
+    };
+    const int64_t ids[] = {1, 2, 3, 4, 2};
+    for (size_t i = 0; i < 6; i++) {
+        if (i < 5)
+            assert(col_int64_append(cols[0], ids[i]) == 0);
+        else
+            assert(col_append_null(cols[0]) == 0);
+        assert(col_double_append(cols[1], (double)i + 0.5) == 0);
+    }
+    return df_from_cols(cols, 2, NULL);
+}
+
+static df_t *right_create(void) {
+    col_t *cols[3] = {
+        col_create("key", COL_DTYPE_INT64, NULL),
+        col_create("y", COL_DTYPE_STRING, NULL),
+        col_create("x", COL_DTYPE_INT32, NULL)
+    };
+    const int64_t keys[] = {2, 3, 3, 5};
+    const char *ys[] = {"b", "c", "C", "e", "n"};
+    const int32_t xs[] = {20, 30, 31, 50, 0};
+    for (size_t i = 0; i < 5; i++) {
+        if (i < 4)
+            assert(col_int64_append(cols[0], keys[i]) == 0);
+        else
+            assert(col_append_null(cols[0]) == 0);
+        assert(col_string_append(cols[1], ys[i]) == 0);
+        assert(col_int32_append(cols[2], xs[i]) == 0);
+    }
+    return df_from_cols(cols, 3, NULL);
+}
+
+int main() {
+    test_df_join_inner();
+    test_df_join_left();
+    test_df_join_multi_key();
+    test_df_join_empty();
+    test_df_join_large();
+    test_df_join_invalid();
+}
+
+void test_df_join_inner() {
+    int err = -1;
+    df_t *left = left_create();
+    df_t *right = right_create();
+    const char *lon[] = {"id"};
+    const char *ron[] = {"key"};
+
+    /* valid: left rows in order, matches in right row order, nulls unmatched */
+    col_t *lidx = NULL;
+    col_t *ridx = NULL;
+    assert(df_join_index(left, right, lon, ron, 1, NULL, &lidx, &ridx) == 0);
+    const int64_t exp_l[] = {1, 2, 2, 4};
+    const int64_t exp_r[] = {0, 1, 2, 0};
+    assert(lidx->n_rows == 4);
+    assert(ridx->n_rows == 4);
+    for (size_t i = 0; i < 4; i++) {
+        assert(*col_int64_at(lidx, i, NULL) == exp_l[i]);
+        assert(*col_int64_at(ridx, i, NULL) == exp_r[i]);
+    }
+    col_free(lidx);
+    col_free(ridx);
+
+    /* valid: left columns, then right ones but the keys, suffixed on clash */
+    df_t *res = df_join(left, right, lon, ron, 1, NULL, &err);
+    assert(err == COL_ERR_OK);
+    assert(df_n_rows(res) == 4);
+    assert(df_n_cols(res) == 4);
+    const char *names[] = {"id", "x", "y", "x_right"};
+    for (size_t j = 0; j < 4; j++)
+        assert(!strcmp(df_col_at(res, j, NULL)->name, names[j]));
+
+    const char *exp_y[] = {"b", "c", "C", "b"};
+    const int32_t exp_x[] = {20, 30, 31, 20};
+    const int64_t exp_id[] = {2, 3, 3, 2};
+    for (size_t i = 0; i < 4; i++) {
+        assert(*col_int64_at(df_col(res, "id", NULL), i, NULL) == exp_id[i]);
+        assert(*col_double_at(df_col(res, "x", NULL), i, NULL) == (double)exp_l[i] + 0.5);
+        assert(!strcmp(col_string_at(df_col(res, "y", NULL), i, NULL), exp_y[i]));
+        assert(*col_int32_at(df_col(res, "x_right", NULL), i, NULL) == exp_x[i]);
+    }
+    df_free(res);
+
+    /* valid: custom suffix */
+    df_join_options_t options = df_join_options_default();
+    options.suffix = "_r";
+    res = df_join(left, right, lon, ron, 1, &options, &err);
+    assert(err == COL_ERR_OK);
+    assert(df_col(res, "x_r", NULL) != NULL);
+    df_free(res);
+
+    df_free(right);
+    df_free(left);
+}
+
+void test_df_join_left() {
+    int err = -1;
+    df_t *left = left_create();
+    df_t *right = right_create();
+    const char *lon[] = {"id"};
+    const char *ron[] = {"key"};
+    df_join_options_t options = df_join_options_default();
+    options.type = DF_JOIN_LEFT;
+
+    /* valid: unmatched left rows, null keys included, pair with -1 */
+    col_t *lidx = NULL;
+    col_t *ridx = NULL;
+    assert(df_join_index(left, right, lon, ron, 1, &options, &lidx, &ridx) == 0);
+    const int64_t exp_l[] = {0, 1, 2, 2, 3, 4, 5};
+    const int64_t exp_r[] = {-1, 0, 1, 2, -1, 0, -1};
+    assert(lidx->n_rows == 7);
+    for (size_t i = 0; i < 7; i++) {
+        assert(*col_int64_at(lidx, i, NULL) == exp_l[i]);
+        assert(*col_int64_at(ridx, i, NULL) == exp_r[i]);
+    }
+    col_free(lidx);
+    col_free(ridx);
+
+    /* valid: right columns are null where unmatched */
+    df_t *res = df_join(left, right, lon, ron, 1, &options, &err);
+    assert(err == COL_ERR_OK);
+    assert(df_n_rows(res) == 7);
+    const col_t *y = df_col(res, "y", NULL);
+    const col_t *x = df_col(res, "x_right", NULL);
+    assert(y->null_count == 3);
+    assert(x->null_count == 3);
+    for (size_t i = 0; i < 7; i++) {
+        assert(is_null(y, i) == (exp_r[i] < 0));
+        assert(is_null(x, i) == (exp_r[i] < 0));
+    }
+    assert(!strcmp(col_string_at(y, 3, NULL), "C"));
+    assert(*col_int32_at(x, 5, NULL) == 20);
+    assert(is_null(df_col(res, "id", NULL), 6));
+    df_free(res);
+
+    df_free(right);
+    df_free(left);
+}
+
+void test_df_join_multi_key() {
+    int err = -1;
+    const char *lnames[] = {"a", "b", "a", "b", "c"};
+    const int32_t lnums[] = {1, 1, 2, 2, 1};
+    const char *rnames[] = {"b", "a", "a", "c", "b"};
+    const int32_t rnums[] = {2, 1, 1, 2, 1};
+
+    col_t *lcols[2] = {
+        col_create("name", COL_DTYPE_STRING, NULL),
+        col_create("num", COL_DTYPE_INT32, NULL)
+    };
+    col_t *rcols[3] = {
+        col_create("rname", COL_DTYPE_STRING, NULL),
+        col_create("rnum", COL_DTYPE_INT32, NULL),
+        col_create("row", COL_DTYPE_INT64, NULL)
+    };
+    for (size_t i = 0; i < 5; i++) {
+        assert(col_string_append(lcols[0], lnames[i]) == 0);
+        assert(col_int32_append(lcols[1], lnums[i]) == 0);
+        assert(col_string_append(rcols[0], rnames[i]) == 0);
+        assert(col_int32_append(rcols[1], rnums[i]) == 0);
+        assert(col_int64_append(rcols[2], (int64_t)i) == 0);
+    }
+    df_t *left = df_from_cols(lcols, 2, NULL);
+    df_t *right = df_from_cols(rcols, 3, NULL);
+
+    /* valid: every key must match */
+    const char *lon[] = {"name", "num"};
+    const char *ron[] = {"rname", "rnum"};
+    df_t *res = df_join(left, right, lon, ron, 2, NULL, &err);
+    assert(err == COL_ERR_OK);
+    assert(df_n_cols(res) == 3);
+    const char *exp_name[] = {"a", "a", "b", "b"};
+    const int64_t exp_row[] = {1, 2, 4, 0};
+    assert(df_n_rows(res) == 4);
+    for (size_t i = 0; i < 4; i++) {
+        assert(!strcmp(col_string_at(df_col(res, "name", NULL), i, NULL), exp_name[i]));
+        assert(*col_int64_at(df_col(res, "row", NULL), i, NULL) == exp_row[i]);
+    }
+    df_free(res);
+
+    df_free(right);
+    df_free(left);
+}
+
+void test_df_join_empty() {
+    int err = -1;
+    df_t *left = left_create();
+    df_t *right = right_create();
+    df_t *none = df_slice(right, 0, 0, NULL);
+    const char *lon[] = {"id"};
+    const char *ron[] = {"key"};
+    df_join_options_t options = df_join_options_default();
+
+    /* valid: nothing to match */
+    df_t *res = df_join(left, none, lon, ron, 1, &options, &err);
+    assert(err == COL_ERR_OK);
+    assert(df_n_rows(res) == 0);
+    assert(df_n_cols(res) == 4);
+    df_free(res);
+
+    /* valid: a left join keeps every row, right columns all null */
+    options.type = DF_JOIN_LEFT;
+    res = df_join(left, none, lon, ron, 1, &options, &err);
+    assert(err == COL_ERR_OK);
+    assert(df_n_rows(res) == 6);
+    assert(df_col(res, "y", NULL)->null_count == 6);
+    assert(df_col(res, "x_right", NULL)->dtype == COL_DTYPE_INT32);
+    df_free(res);
+
+    /* valid: empty left */
+    res = df_join(none, right, ron, ron, 1, &options, &err);
+    assert(err == COL_ERR_OK);
+    assert(df_n_rows(res) == 0);
+    df_free(res);
+
+    df_free(none);
+    df_free(right);
+    df_free(left);
+}
+
+/* Frame of `n` random keys below `n_keys`, as `int64` and as strings */
+static df_t *large_create(const size_t n, const size_t n_keys, int64_t *keys) {
+    col_t *cols[2] = {
+        col_create_with_capacity("key", n, COL_DTYPE_INT64, NULL),
+        col_create_with_capacity("skey", n, COL_DTYPE_STRING, NULL)
+    };
+    for (size_t i = 0; i < n; i++) {
+        char buf[32];
+        keys[i] = (int64_t)(next_random() % n_keys);
+        snprintf(buf, sizeof(buf), "key-%lld", (long long)keys[i]);
+        assert(col_int64_append(cols[0], keys[i]) == 0);
+        assert(col_string_append(cols[1], buf) == 0);
+    }
+    return df_from_cols(cols, 2, NULL);
+}
+
+void test_df_join_large() {
+    int64_t *lkeys = malloc(LARGE_LEFT * sizeof(int64_t));
+    int64_t *rkeys = malloc(LARGE_RIGHT * sizeof(int64_t));
+    df_t *left = large_create(LARGE_LEFT, LARGE_KEYS, lkeys);
+    df_t *right = large_create(LARGE_RIGHT, LARGE_KEYS, rkeys);
+
+    /* reference: right rows of every key in row order */
+    size_t *starts = calloc(LARGE_KEYS + 1, sizeof(size_t));
+    size_t *by_key = malloc(LARGE_RIGHT * sizeof(size_t));
+    for (size_t i = 0; i < LARGE_RIGHT; i++)
+        starts[rkeys[i] + 1]++;
+    for (size_t k = 0; k < LARGE_KEYS; k++)
+        starts[k + 1] += starts[k];
+    size_t *pos = malloc(LARGE_KEYS * sizeof(size_t));
+    memcpy(pos, starts, LARGE_KEYS * sizeof(size_t));
+    for (size_t i = 0; i < LARGE_RIGHT; i++)
+        by_key[pos[rkeys[i]]++] = i;
+
+    const char *on[] = {"key"};
+    const char *son[] = {"skey"};
+    df_join_options_t options = df_join_options_default();
+    const mlc_isa_t host = mlc_cpu_isa_detect();
+
+    /* valid: against the reference on every thread count, ISA and key dtype */
+    for (int type = DF_JOIN_INNER; type <= DF_JOIN_LEFT; type++) {
+        for (size_t threads = 1; threads <= 4; threads += 3) {
+            for (mlc_isa_t isa = MLC_ISA_SCALAR; isa <= host; isa++) {
+                mlc_cpu_isa_limit(isa);
+                options.type = (df_join_type_t)type;
+                options.n_threads = threads;
+                col_t *lidx = NULL;
+                col_t *ridx = NULL;
+                const int strings = isa == host && threads == 4;
+                assert(df_join_index(
+                    left, right, strings ? son : on, strings ? son : on,
+                    1, &options, &lidx, &ridx
+                ) == 0);
+
+                size_t m = 0;
+                for (size_t i = 0; i < LARGE_LEFT; i++) {
+                    const int64_t k = lkeys[i];
+                    if (starts[k] == starts[k + 1] && type == DF_JOIN_LEFT) {
+                        assert(*col_int64_at(lidx, m, NULL) == (int64_t)i);
+                        assert(*col_int64_at(ridx, m, NULL) == -1);
+                        m++;
+                    }
+                    for (size_t e = starts[k]; e < starts[k + 1]; e++, m++) {
+                        assert(*col_int64_at(lidx, m, NULL) == (int64_t)i);
+                        assert(*col_int64_at(ridx, m, NULL) == (int64_t)by_key[e]);
+                    }
+                }
+                assert(lidx->n_rows == m);
+                col_free(lidx);
+                col_free(ridx);
+            }
+        }
+    }
+    mlc_cpu_isa_limit(MLC_ISA_COUNT);
+
+    free(pos);
+    free(by_key);
+    free(starts);
+    df_free(right);
+    df_free(left);
+    free(rkeys);
+    free(lkeys);
+}
+
+void test_df_join_invalid() {
+    int err = -1;
+    df_t *left = left_create();
+    df_t *right = right_create();
+    const char *lon[] = {"id"};
+    const char *ron[] = {"key"};
+    col_t *lidx = NULL;
+    col_t *ridx = NULL;
+
+    /* invalid: NULL arguments */
+    assert(df_join(NULL, right, lon, ron, 1, NULL, &err) == NULL);
+    assert(err == COL_ERR_NO_DATA);
+    assert(df_join(left, right, NULL, ron, 1, NULL, &err) == NULL);
+    assert(err == COL_ERR_NO_DATA);
+    assert(df_join_index(left, right, lon, ron, 1, NULL, NULL, &ridx) == COL_ERR_NO_DATA);
+
+    /* invalid: no keys */
+    assert(df_join(left, right, lon, ron, 0, NULL, &err) == NULL);
+    assert(err == COL_ERR_INVALID_ARG);
+
+    /* invalid: missing key column */
+    const char *missing[] = {"nope"};
+    assert(df_join(left, right, lon, missing, 1, NULL, &err) == NULL);
+    assert(err == COL_ERR_NOT_FOUND);
+
+    /* invalid: key dtypes differ or are not joinable */
+    const char *rx[] = {"x"};
+    assert(df_join(left, right, lon, rx, 1, NULL, &err) == NULL);
+    assert(err == COL_ERR_INVALID_DTYPE);
+    const char *lx[] = {"x"};
+    assert(df_join(left, left, lx, lx, 1, NULL, &err) == NULL);
+    assert(err == COL_ERR_INVALID_DTYPE);
+
+    /* invalid: unknown join type, leaving the outputs NULL */
+    df_join_options_t options = df_join_options_default();
+    options.type = (df_join_type_t)7;
+    lidx = ridx = (col_t *)left;
+    assert(df_join_index(left, right, lon, ron, 1, &options, &lidx, &ridx)
+        == COL_ERR_INVALID_ARG);
+    assert(lidx == NULL && ridx == NULL);
+
+    /* invalid: the suffix still clashes */
+    options = df_join_options_default();
+    options.suffix = "";
+    assert(df_join(left, right, lon, ron, 1, &options, &err) == NULL);
+    assert(err == COL_ERR_INVALID_ARG);
+
+    df_free(right);
+    df_free(left);
+}